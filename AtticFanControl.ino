@@ -18,10 +18,16 @@
 #include "history.h"
 #include "diagnostics.h"
 #include "indoor_sensors.h"
+#include "profiler.h"
+#include "breadcrumbs.h"
+#include "events.h"
+#include "http_server.h"
+#include "background_response.h"
+#include "ingest_limits.h"
 
 #define USE_FS_WEBUI 0 // Set to 1 to use index.html from FS
 
-ESP8266WebServer server(80);
+ESP8266WebServer server(HTTP_PORT);
 DNSServer dnsServer; 
 
 const unsigned long SENSOR_UPDATE_INTERVAL_MS = 5000; // ms
@@ -90,6 +96,7 @@ void logSerial(const char* format, ...) {
  * @note This handles the inverted logic for the onboard LED.
  */
 void setFanState(bool fanOn) {
+  if ((digitalRead(FAN_RELAY_PIN) == HIGH) != fanOn) recordBreadcrumb(CRUMB_FAN, fanOn);
   digitalWrite(FAN_RELAY_PIN, fanOn ? HIGH : LOW); // This function now ONLY controls the fan.
 }
 
@@ -136,6 +143,7 @@ void setup() {
   loadConfig(); // Load settings from EEPROM
   fanMode = config.fanMode; // Restore the last saved fan mode from config
   initSensors();
+  sampleSensors(); // Seed the snapshot; probe readings land in it once their first conversion completes
   initIndoorSensors(); // Initialize indoor sensors system
   initMqtt(); // Initialize MQTT client
   pinMode(FAN_RELAY_PIN, OUTPUT);
@@ -184,9 +192,11 @@ void setup() {
   #endif
   // TZ String for Pacific Time (PST/PDT). Find others at https://github.com/nayarsystems/posix_tz_db/blob/master/zones.csv
   configTime("PST8PDT,M3.2.0,M11.1.0", "pool.ntp.org");
+  initHistoryStore(); // After configTime() so an imported history.csv is read in local time
 
   // Log a boot message. This ensures the diagnostics file is created.
   logDiagnostics("-------------------- [BOOT] Device starting up --------------------");
+  initBreadcrumbs(); // Reports the previous run's breadcrumbs if it crashed
 
   // -------------------------
   // Route registration
@@ -203,6 +213,8 @@ void setup() {
   }
   server.on("/weather", HTTP_GET, [&]() { handleWeather(server); });
   server.on("/history.csv", HTTP_GET, [](){ handleHistoryDownload(server); });
+  server.on("/history", HTTP_GET, [](){ handleHistoryQuery(server); });
+  server.on("/history_rollup.csv", HTTP_GET, [](){ handleHistoryRollup(server); });
   // Indoor sensors endpoints
   if (config.indoorSensorsEnabled) {
     server.on("/indoor_sensors/data", HTTP_POST, [](){ handleIndoorSensorData(server); });
@@ -216,13 +228,18 @@ void setup() {
   server.on("/diagnostics", [](){ handleDiagnosticsDownload(server); });
   server.on("/update_wrapper", HTTP_GET, [](){ handleUpdateWrapper(server); });
   server.on("/system_info", HTTP_GET, [](){ handleSystemInfo(server); });
+  server.on("/metrics", HTTP_GET, [](){ handleMetrics(server); });
+  server.on("/events", HTTP_GET, [&](){ handleEvents(server, fanMode); });
+  server.on("/api/bootstrap", HTTP_GET, [&](){ handleBootstrap(server, fanMode); });
   ElegantOTA.begin(&server, ota_user, ota_password);
+  ElegantOTA.onStart([]() { flushHistoryBuffer(); }); // OTA reuses the RTC blocks that mirror the history buffer
 
   // --- Arduino IDE OTA Setup ---
   ArduinoOTA.setHostname(MDNS_HOSTNAME);
   ArduinoOTA.setPassword(ota_password);
 
   ArduinoOTA.onStart([]() {
+    flushHistoryBuffer(); // OTA reuses the RTC blocks that mirror the history buffer
     String type;
     if (ArduinoOTA.getCommand() == U_FLASH) {
       type = "sketch";
@@ -248,7 +265,12 @@ void setup() {
   // -------------------------
   // Start HTTP server
   // -------------------------
-  server.begin();
+  server.collectHeaders("If-None-Match", "Range", "If-Range", "Accept-Encoding"); // Revalidation (ETag / 304), resumed downloads, gzip assets
+  beginHttpServer(server); // Keep-alive, bounded pending connections, request counting; before any other hook
+  server.addHook([](const String& method, const String& url, WiFiClient* client, ESP8266WebServer::ContentTypeFunction) {
+    recordHttpBreadcrumb(method, url);
+    return admitIndoorSensorPost(method, url, client); // Rate limits, before the body is parsed
+  });
   delay(10);
   yield();
   #if DEBUG_SERIAL
@@ -411,7 +433,7 @@ void updateStatusLED() {
 
   // Priority 3: Slow blink if fan is ON and in the hysteresis temperature zone.
   if (fanMode == AUTO && digitalRead(FAN_RELAY_PIN) == HIGH) {
-    float atticTemp = readAtticTemp();
+    float atticTemp = sensorSnapshot.atticTemp;
     float effectiveFanOnTemp = config.fanOnTemp;
     // Safely check for pre-cooling conditions only if weather data is valid.
     if (config.preCoolingEnabled && currentWeather.isValid) {
@@ -477,15 +499,22 @@ void handleDailyRestart() {
 }
 
 void loop() {
-  server.handleClient();   // must be first
+  const uint32_t loopStart = ESP.getCycleCount();
+  uint32_t t = loopStart;
+  profileEnter(STAGE_HTTP);
+  serviceHttp(server);     // must be first
+  t = profileMark(STAGE_HTTP, t);
+  profileEnter(STAGE_MDNS);
   MDNS.update();           // second
   static unsigned long lastMdnsAnnounce = 0;
   if (millis() - lastMdnsAnnounce > 30000) {  // every 30s
     MDNS.announce();                          // re-announce http + arduino services
     lastMdnsAnnounce = millis();
   }
+  t = profileMark(STAGE_MDNS, t);
 
   // --- NTP Sync Check (runs once) ---
+  profileEnter(STAGE_NTP);
   if (!ntpHasSynced) {
     time_t now;
     time(&now);
@@ -497,45 +526,69 @@ void loop() {
       logSerial("[NTP] SUCCESS: Time has been synchronized.");
     }
   }
+  t = profileMark(STAGE_NTP, t);
 
   // Handle IDE-based OTA updates.
+  profileEnter(STAGE_OTA);
   ArduinoOTA.handle();
+  t = profileMark(STAGE_OTA, t);
 
   // Manage WiFi connection state first to ensure network is ready for other tasks.
+  profileEnter(STAGE_WIFI);
   handleWiFiConnection();
+  t = profileMark(STAGE_WIFI, t);
 
   // Handle MQTT connection and messages
+  profileEnter(STAGE_MQTT);
   handleMqtt();
+  t = profileMark(STAGE_MQTT, t);
 
   // Fetch weather data periodically (the function handles its own timing)
+  profileEnter(STAGE_WEATHER);
   updateWeatherData();
+  t = profileMark(STAGE_WEATHER, t);
 
   // Handle manual timer logic
+  profileEnter(STAGE_TIMER);
   handleManualTimer();
+  t = profileMark(STAGE_TIMER, t);
 
   // Update the status LED on every loop cycle for responsiveness.
+  profileEnter(STAGE_LED);
   updateStatusLED();
+  t = profileMark(STAGE_LED, t);
 
   // Check if a daily restart is needed for long-term stability.
+  profileEnter(STAGE_RESTART);
   handleDailyRestart();
+  t = profileMark(STAGE_RESTART, t);
   
   // Clean up expired indoor sensors periodically (if enabled)
   if (config.indoorSensorsEnabled) {
     static unsigned long lastSensorCleanup = 0;
     if (millis() - lastSensorCleanup > 60000) { // Every minute
+      profileEnter(STAGE_INDOOR);
       cleanupExpiredSensors();
       lastSensorCleanup = millis();
+      t = profileMark(STAGE_INDOOR, t);
     }
   }
 
+  // Advance background sensor conversions; results land in sensorSnapshot
+  profileEnter(STAGE_PROBES);
+  serviceSensors();
+  t = profileMark(STAGE_PROBES, t);
+
   // Only run fan logic at the specified interval
   if (millis() - lastSensorRead >= SENSOR_UPDATE_INTERVAL_MS) {
+    profileEnter(STAGE_SENSORS);
     lastSensorRead = millis();
 
-    // Always read sensors to keep data fresh for the UI
-    float atticTemp = readAtticTemp();
-    float atticHumidity = readAtticHumidity();
-    float outdoorTemp = readOutdoorTemp();
+    // Sample the sensors once; the UI, MQTT and LED read this snapshot until the next interval
+    const SensorSnapshot& sensors = sampleSensors();
+    float atticTemp = sensors.atticTemp;
+    float atticHumidity = sensors.atticHumidity;
+    float outdoorTemp = sensors.outdoorTemp;
 
     const char* modeStr = "UNKNOWN";
     switch (fanMode) {
@@ -589,23 +642,56 @@ void loop() {
         #endif
       }
     }
+    t = profileMark(STAGE_SENSORS, t);
 
     // --- Periodic CSV Logging ---
     if (millis() - lastHistoryLog >= config.historyLogIntervalMs) {
+      profileEnter(STAGE_HISTORY);
       lastHistoryLog = millis();
       bool fanIsOn = (digitalRead(FAN_RELAY_PIN) == HIGH);
       appendHistoryLog(atticTemp, outdoorTemp, atticHumidity, fanIsOn);
       #if DEBUG_SERIAL
       Serial.printf("[%lu] [LOG] History: %.2f, %.2f, %.2f, %d\n", millis(), atticTemp, outdoorTemp, atticHumidity, fanIsOn ? 1 : 0);
       #endif
+      t = profileMark(STAGE_HISTORY, t);
     }
   }
 
+  // Rebuild the rollups' open periods after boot, a slice per pass
+  if (rollupRebuilding) {
+    profileEnter(STAGE_HISTORY);
+    serviceHistoryRollups();
+    t = profileMark(STAGE_HISTORY, t);
+  }
+
+  // Write buffered diagnostics log lines in one batch when the flush interval is up
+  profileEnter(STAGE_DIAGNOSTICS);
+  serviceDiagnostics();
+  t = profileMark(STAGE_DIAGNOSTICS, t);
+
+  // Push state changes to /events subscribers
+  profileEnter(STAGE_EVENTS);
+  serviceEvents(fanMode);
+  t = profileMark(STAGE_EVENTS, t);
+
+  // Write the next pieces of downloads in progress, within a time budget
+  profileEnter(STAGE_RESPONSES);
+  serviceBackgroundResponses();
+  t = profileMark(STAGE_RESPONSES, t);
+
   // Handle DNS requests when in AP mode
   if (apModeActive) {
+    profileEnter(STAGE_DNS);
     dnsServer.processNextRequest();
+    t = profileMark(STAGE_DNS, t);
   }
   // Handle mDNS queries
+  profileEnter(STAGE_MDNS_LATE);
   MDNS.update();
-  server.handleClient();
+  t = profileMark(STAGE_MDNS_LATE, t);
+  profileEnter(STAGE_HTTP_LATE);
+  serviceHttp(server);
+  profileMark(STAGE_HTTP_LATE, t);
+  profileMark(STAGE_LOOP, loopStart);
+  profileEnter(STAGE_LOOP); // Until the next loop(): the SDK and WiFi tasks run in between
 }
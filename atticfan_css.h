@@ -7,666 +7,369 @@
 #define WEBUI_EMIT_STREAM_HELPER 1
 #endif
 
-#undef F
-const char ATTICFAN_CSS[] PROGMEM = R"EMB1(
-/* Uniform button sizing and vertical centering for System & Maintenance */
-.system-controls-columns .section-save-btn {
-  min-width: 180px;
-  max-width: 220px;
-  height: 48px;
-  display: flex;
-  align-items: center;
-  justify-content: center;
-  white-space: normal;
-  text-align: center;
-}
-@charset "UTF-8";
-
-/* Add vertical spacing between ON/OFF and SET TIMER buttons in Mode Control */
-#mode-control-box > div:last-child button + button + button {
-  margin-top: 0.75rem;
-}
-/* Danger row for System & Maintenance section */
-/* Style for help-link (the (?), shown as superscript) */
-.help-link {
-  font-size: 0.7em;
-  vertical-align: super;
-  text-decoration: none;
-  margin-left: 2px;
-  color: #2980b9;
-  cursor: pointer;
-  transition: color 0.2s;
-}
-.help-link:hover, .help-link:focus {
-  color: #e67e22;
-  text-decoration: underline;
-}
-:root{
-  --primary-blue:#2196F3;--primary-blue-dark:#1976D2;--primary-teal:#21CBF3;
-  --danger-red:#dc3545;--success-green:#28a745;--warning-orange:#fd7e14;
-  --text-muted:#6c757d;--border-light:#e0e0e0;--bg-card:#fff;
-  --shadow-sm:0 2px 4px rgba(0,0,0,.1);--shadow-md:0 4px 8px rgba(0,0,0,.15)
-}
-*{box-sizing:border-box}
-html,body{height:100%}
-body {
-  font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, sans-serif;
-  margin: 0 auto;
-  background: linear-gradient(135deg, #f5f7fa 0%, #c3cfe2 100%);
-  max-width: 900px;
-  padding: 0 16px;
-  min-height: 100vh;
-}
-
-/* ---------- Headings ---------- */
-h1{margin:20px 0;color:#2c3e50;font-weight:300;font-size:clamp(1.5rem,4vw,2.5rem);text-align:center}
-h2 {
-  margin: 18px 0 12px;
-  color: #2c3e50;
-  font-weight: 600;
-  font-size: 1.3rem;
-  text-align: center;
-}
-
-/* ---------- Layout ---------- */
-.page-container{
-  max-width: 700px;
-  margin: 0 auto;
-  padding: 0 2vw;
-  width: 100%;
-}
-
-/* Optional utility container for future use */
-.container {
-  max-width: 700px;
-  margin: 0 auto;
-  padding: 0 2vw;
-  width: 100%;
-}
-.top-layout-grid{display:grid;grid-template-columns:250px minmax(0, 1fr);gap:20px;margin-bottom:20px;align-items:stretch}
-.sensor-column{display:flex;flex-direction:column;gap:20px;justify-content:flex-start}
-.control-column{display:flex}
-
-/* fill the right column card */
-#mode-control-box{background:linear-gradient(135deg,#667eea 0%,#764ba2 100%);color:#fff;border-radius:16px;padding:24px 28px;margin:0;width:100%;display:flex;flex-direction:column;justify-content:center;box-shadow:0 8px 25px rgba(102,126,234,.3);border:1px solid rgba(255,255,255,.25);text-align:center}
-#mode-control-box h3{color:#fff;margin:0 0 20px}
-
-/* ---------- Cards & Sections ---------- */
-.content-section{
-  margin: 20px auto;
-  padding: 20px;
-  background: linear-gradient(135deg, #eaf0fb 0%, #f5eafd 100%);
-  border-radius: 12px;
-  box-shadow: var(--shadow-md);
-  border: 1px solid var(--border-light);
-  text-align: center;
-}
-
-/* Help page specific tweaks */
-.help-section h2 {
-  /* Help page sections remain left-aligned */
-  text-align: left;
-  font-size: 1.25rem;
-  font-weight: 600;
-  margin-top: 0;
-  margin-bottom: 10px;
-  color: #2c3e50;
-}
-.help-section dl dt {
-  font-weight: 600;
-  font-size: 1.08rem;
-  margin-top: 10px;
-  color: #2980b9;
-}
-.help-section dl dd {
-/* Restore left alignment for help-section content only */
-  margin-left: 22px;
-  margin-bottom: 10px;
-  color: #333;
-}
-.help-section ul {
-  margin-left: 22px;
-  color: #333;
-}
-.help-section code {
-  background-color: #e9ecef;
-  padding: 2px 5px;
-  border-radius: 4px;
-  word-wrap: break-word;
-  font-size: 0.98em;
-}
-.back-link {
-  display: inline-block;
-  margin-bottom: 20px;
-  color: #2980b9;
-  text-decoration: none;
-  font-size: 1em;
-}
-.back-link:hover {
-  text-decoration: underline;
-}
-}
-.settings-container{display:grid;grid-template-columns:repeat(auto-fit,minmax(300px,1fr));gap:20px;margin-bottom:20px}
-.settings-group{
-  background: linear-gradient(135deg, #f3f7fd 0%, #f8f6fb 100%);
-  border:1px solid var(--border-light);
-  border-radius:12px;
-  padding:20px;
-  box-shadow:var(--shadow-sm);
-}
-.config-subheading{margin:0 0 15px;text-align:center;color:#2c3e50;font-weight:500;font-size:1.1rem}
-.unit-note{font-size:.9rem;color:var(--text-muted);margin:-5px 0 15px;font-style:italic;text-align:center;display:block}
-
-/* ---------- Sensors ---------- */
-.sensor-grid{display:flex;justify-content:center;gap:15px;margin-bottom:20px;flex-wrap:wrap}
-.sensor-item{
-  padding:15px;
-  border:2px solid var(--border-light);
-  border-radius:var(--radius-md);
-  min-width:120px;
-  background: linear-gradient(135deg, #f4f7fb 0%, #f7f4fb 100%);
-  box-shadow:var(--shadow-sm);
-  transition:transform .2s ease, box-shadow .2s ease;
-  text-align:center;
-}
-.sensor-item:hover{transform:translateY(-2px);box-shadow:0 4px 12px rgba(0,0,0,.1)}
-.sensor-item strong{color:#2c3e50;display:block;margin-bottom:8px;font-size:.9rem;text-transform:uppercase;letter-spacing:.5px}
-.sensor-value{font-size:1.2rem;font-weight:600;color:var(--primary-blue)}
-
-/* ---------- Switch ---------- */
-.switch{position:relative;display:inline-block;width:60px;height:34px}
-.switch input{opacity:0;width:0;height:0}
-.slider{position:absolute;cursor:pointer;inset:0;background:linear-gradient(45deg,#bdc3c7,#95a5a6);transition:.3s;border-radius:34px;box-shadow:inset 0 2px 4px rgba(0,0,0,.1)}
-.slider:before{content:"";position:absolute;height:26px;width:26px;left:4px;bottom:4px;background:linear-gradient(45deg,#fff,#f8f9fa);transition:.3s;border-radius:50%;box-shadow:0 2px 4px rgba(0,0,0,.2)}
-input:checked+.slider{background:linear-gradient(45deg,var(--primary-blue),var(--primary-teal))}
-input:checked+.slider:before{transform:translateX(26px)}
-
-/* ---------- Buttons ---------- */
-.section-save-btn{padding:12px 24px;background:linear-gradient(135deg,var(--primary-blue),var(--primary-teal));color:#fff;border:0;border-radius:8px;box-shadow:0 4px 15px rgba(33,150,243,.3);font-size:.95rem;font-weight:600;cursor:pointer;transition:.3s;text-decoration:none;display:inline-block;text-transform:uppercase;letter-spacing:.5px}
-.section-save-btn:hover{background:linear-gradient(135deg,var(--primary-blue-dark),#00BCD4);box-shadow:0 6px 20px rgba(33,150,243,.4);transform:translateY(-2px)}
-.section-save-btn:active{transform:translateY(0)}
-.section-save-btn:disabled{background:linear-gradient(135deg,#95a5a6,#7f8c8d);box-shadow:none;cursor:not-allowed;opacity:.6}
-.section-save-btn.btn-danger{background:linear-gradient(135deg,var(--danger-red),#c82333);box-shadow:0 4px 15px rgba(220,53,69,.3)}
-.section-save-btn.btn-danger:hover{background:linear-gradient(135deg,#c82333,#bd2130);box-shadow:0 6px 20px rgba(220,53,69,.4)}
-
-/* Responsive button sizing for mobile */
-@media (max-width: 600px) {
-  .system-controls-columns .section-save-btn,
-  .system-controls-columns button {
-    min-width: 0;
-    max-width: 100%;
-    width: 100%;
-    box-sizing: border-box;
-    font-size: 1rem;
-  }
-}
-.mode-buttons-container{display:flex;justify-content:center;gap:12px;margin-bottom:20px;flex-wrap:wrap}
-.fan-status-container{display:flex;justify-content:center;align-items:center;gap:20px;margin:15px 0;flex-wrap:wrap}
-.fan-text-container{text-align:left}
-
-/* ---------- Icons & Animations ---------- */
-#fan-icon-container{width:70px;height:70px;padding:10px;background:rgba(255,255,255,.2);border-radius:50%;backdrop-filter:blur(10px)}
-.fan-icon{width:100%;height:100%;transition:.3s}
-@keyframes spin{from{transform:rotate(0)}to{transform:rotate(360deg)}}
-.fan-icon.spinning{animation:spin 1s linear infinite}
-
-/* ---------- Status Indicator (kept hidden to match current UI) ---------- */
-.status-indicator{display:none!important;width:12px;height:12px;border-radius:50%;margin-right:8px}
-.status-indicator.online{background:var(--success-green);box-shadow:0 0 8px rgba(40,167,69,.5)}
-.status-indicator.offline{background:var(--text-muted)}
-
-/* ---------- Grids ---------- */
-.config-grid{display:flex;flex-wrap:wrap;justify-content:center;gap:15px;align-items:stretch}
-.config-item{
-  display: flex;
-  flex-direction: column;
-  align-items: stretch;
-  flex: 1;
-  min-width: 120px;
-  padding: 15px;
-  background: linear-gradient(145deg,#fff,#f8f9fa);
-  border-radius: 8px;
-  border: 1px solid var(--border-light)
-}
-.config-item label:first-child {
-  margin-bottom: 10px;
-}
-.config-item .switch {
-  align-self: flex-end;
-  margin-top: auto;
-  margin-bottom: 8px;
-}
-
-/* Ensure the switch is always centered vertically in config-item */
-.config-item .switch {
-  align-self: center;
-  margin-top: 8px;
-}
-.number-input-wrapper{display:flex;align-items:center;justify-content:center;width:100%}
-
-/* Push the input/switch to the bottom of the config item for vertical alignment */
-.config-item > .number-input-wrapper,
-.config-item > .switch {
-  margin-top: auto;
-}
-.number-input-wrapper input{text-align:center;font-size:1.1rem;height:44px;width:100%;max-width:120px;border:2px solid var(--border-light);border-radius:8px;transition:.2s;background:#fff;-moz-appearance:textfield}
-.number-input-wrapper input:focus{outline:none;border-color:var(--primary-blue);box-shadow:0 0 0 3px rgba(33,150,243,.1)}
-/* New style for the save button container to span the full width of the grid */
-.save-cell {
-  grid-column: 1 / -1; /* Span all columns */
-  display: flex;
-  justify-content: center;
-  padding-top: 10px;
-}
-
-/* ---------- Range Inputs ---------- */
-input[type=range]{width:100%;height:6px;border-radius:3px;background:var(--border-light);outline:none;-webkit-appearance:none}
-input[type=range]::-webkit-slider-thumb{appearance:none;width:20px;height:20px;border-radius:50%;background:var(--primary-blue);cursor:pointer;box-shadow:0 2px 6px rgba(0,0,0,.3)}
-input[type=range]::-moz-range-thumb{width:20px;height:20px;border-radius:50%;background:var(--primary-blue);cursor:pointer;border:0;box-shadow:0 2px 6px rgba(0,0,0,.3)}
-
-/* ---------- Chart ---------- */
-.chart-container{background:#fff;border-radius:var(--radius-lg);padding:20px;margin:20px auto;box-shadow:var(--shadow-sm);border:1px solid var(--border-light);max-width:900px}
-#historyChart{width:100%!important;height:250px!important}
-#historyChartMsg{color:#888;font-size:.95em;margin-top:8px}
-
-/* ---------- Toast ---------- */
-.toast{visibility:hidden;min-width:300px;background:linear-gradient(135deg,#2c3e50,#34495e);color:#fff;text-align:center;border-radius:8px;padding:16px 20px;position:fixed;z-index:1001;left:50%;transform:translateX(-50%);bottom:30px;box-shadow:0 8px 25px rgba(0,0,0,.3);font-weight:500}
-.toast.show{visibility:visible;animation:toastSlideUp .3s ease-out}
-@keyframes toastSlideUp{from{transform:translateX(-50%) translateY(100%);opacity:0}to{transform:translateX(-50%) translateY(0);opacity:1}}
-
-/* ---------- Modal (Timer) ---------- */
-.modal{display:none;position:fixed;inset:0;z-index:1000;background:rgba(0,0,0,.5);backdrop-filter:blur(5px)}
-.modal-content{background:#fff;margin:10% auto;padding:30px;border-radius:16px;width:90%;max-width:450px;box-shadow:0 20px 40px rgba(0,0,0,.3);animation:modalSlideIn .3s ease-out}
-@keyframes modalSlideIn{from{transform:translateY(-50px);opacity:0}to{transform:translateY(0);opacity:1}}
-.close-btn{color:#aaa;float:right;font-size:28px;font-weight:700;cursor:pointer;transition:color .2s}
-.close-btn:hover{color:var(--danger-red)}
-.modal-content h3 { text-align: center; }
-#timerStatus{font-size:.95rem;color:var(--warning-orange);font-weight:600;margin-top:8px;display:none;padding:8px;background:rgba(253,126,20,.1);border-radius:6px;border:1px solid rgba(253,126,20,.2)}
-
-/* ---------- System Controls ---------- */
-.system-controls-grid {
-  display: flex;
-  flex-direction: column;
-  gap: 1rem;
-  align-items: center;
-}
-.system-col {
-  display: flex;
-  flex-direction: column;
-  align-items: stretch; /* Changed from center to stretch */
-  gap: 1rem; /* Reduced from 2rem */
-  justify-content: flex-start;
-}
-#test-panel .config-item label { padding-bottom: 15px; }
-#test-panel .config-item label+input[type=range]{display:block;margin-top:14px}
-#test-panel .config-item{margin-bottom:8px}
-#test-panel .config-grid{display:grid;grid-template-columns:1fr 1fr;column-gap:28px;row-gap:16px}
-.test-panel-actions { text-align: center; margin-top: 15px; }
-.modal .timer-options { margin-top: 15px; }
-.modal .timer-options select { padding: 5px; }
-.modal .timer-actions { margin-top: 20px; }
-
-/* Styles for the indoor sensor list modal */
-#indoorSensorsList {
-  max-height: 40vh;
-  overflow-y: auto;
-}
-.sensor-modal-item {
-  display: flex;
-  justify-content: space-between;
-  padding: 10px 5px;
-  border-bottom: 1px solid var(--border-light);
-}
-
-.modal-link-container {
-  text-align: center;
-  margin: -5px 0 15px 0;
-  font-size: 0.95em;
-}
-
-
-/* ---------- Footer ---------- */
-/* ---------- Footer ---------- */
-.app-footer { margin-top: 2rem; padding: 0.75rem 0; text-align: center; opacity: 0.8; }
-
-/* System & Maintenance two-column layout - fixed syntax */
-/* System & Maintenance two-column layout - reduced spacing */
-/* System & Maintenance two-column layout - always two columns, responsive */
-.system-controls-columns {
-  display: grid;
-  grid-template-columns: repeat(2, 1fr);
-  column-gap: 0.7rem;
-  row-gap: 0.4rem;
-  width: 100%;
-  max-width: 100%;
-}
-/* ---------- Weather ---------- */
-.weather-forecast{display:flex;justify-content:center;gap:15px;margin-top:15px;flex-wrap:wrap}
-.forecast-day {
-  /* Removed card styles to match hourly forecast */
-  display: flex;
-  flex-direction: column;
-  gap: 4px;
-  text-align: center;
-  min-width: 70px;
-  padding: 0 10px;
-}
-.forecast-day .emoji { font-size: 1.4rem; }
-.forecast-day div:first-child { font-size: 0.9rem; font-weight: 500; color: #666; }
-
-/* Weather header with sunrise/sunset */
-.weather-header-row{display:flex;justify-content:space-between;align-items:center;margin-top:10px;margin-bottom:15px;padding:0 10px}
-.sunrise-sunset{font-size:0.9rem;font-weight:500;color:#666}
-
-.weather-header-title {
-  flex: 1;
-  text-align: center;
-  font-size: 1.3rem;
-  font-weight: 600;
-  color: #2c3e50;
-}
-
-/* Hourly forecast */
-.hourly-forecast{display:flex;gap:12px;margin-top:15px;margin-bottom:20px;padding:10px 0;justify-content:center}
-.hourly-item{
-  /* Removed card styles like background, border, and padding */
-  padding: 0 5px; /* Add horizontal padding only */
-  min-width: 55px; /* A smaller min-width */
-  text-align:center;
-  flex-shrink:0;
-  display: flex;
-  flex-direction: column;
-  gap: 4px; /* Add a small gap between time/icon/temp */
-}
-.hourly-time{font-size:0.8rem;font-weight:500;margin-bottom:4px;color:#666}
-.hourly-icon{font-size:1.2rem;margin-bottom:4px}
-.hourly-temp{font-size:0.85rem;font-weight:600}
-
-/* ---------- Responsive ---------- */
-@media (max-width:900px){#historyChart{height:200px!important}}
-@media (max-width:800px){.top-layout-grid{grid-template-columns:1fr}.fan-status-container{flex-direction:column;gap:15px}.settings-container{grid-template-columns:1fr}}
-@media (max-width:680px){#test-panel .config-grid{grid-template-columns:1fr;row-gap:24px}#test-panel .config-item{margin-bottom:16px}}
-@media (max-width:480px){
-  .section-save-btn{padding:10px 16px;font-size:.9rem}
-  h1{font-size:1.5rem}
-  .hourly-forecast{gap: 8px;} /* Reduce gap on small screens */
-  .hourly-item{min-width: 50px;}
-}
-
-:root { --radius-lg:16px; --radius-md:12px }
-
-h1{letter-spacing:.5px}
-
-/* #mode-control-box h3{
-  display:flex;align-items:center;gap:8px;
-  font-weight:600;letter-spacing:.3px;margin-bottom:18px;
-} */
-#mode-control-box a{
-  color:#fff;text-decoration:underline;text-underline-offset:2px;opacity:.9
-}
-#mode-control-box a:hover{opacity:1}
-
-.mode-buttons-container .section-save-btn{min-width:110px}
-.section-save-btn.is-active,
-.section-save-btn[aria-pressed="true"]{
-  filter:none;opacity:1;
-  background:linear-gradient(135deg,#00BCD4,#21CBF3)
-}
-.section-save-btn:disabled{opacity:.5}
-
-
-a{color:#1976D2}
-.content-section h2 a{color:inherit}
-
-@media (max-width:900px){
-  #mode-control-box{padding:20px}
-}
-
-/* --- Utility Styles --- */
-.error-message {
-  color: var(--danger-red);
-  background-color: rgba(220, 53, 69, 0.05);
-  border: 1px solid rgba(220, 53, 69, 0.2);
-  padding: 15px;
-  border-radius: 8px;
-}
-
-/* --- Indoor Sensor Dashboard Styles --- */
-.stats { 
-    display: flex; 
-    justify-content: space-around; 
-    margin-bottom: 30px; 
-    flex-wrap: wrap; 
-    gap: 15px;
-}
-.stat-card { 
-    background: linear-gradient(135deg, #667eea 0%, #764ba2 100%); 
-    color: white; 
-    padding: 20px; 
-    border-radius: 12px; 
-    text-align: center; 
-    min-width: 150px; 
-    flex: 1;
-    box-shadow: var(--shadow-sm);
-}
-.stat-number { 
-    font-size: 2em; 
-    font-weight: bold; 
-    margin-bottom: 5px; 
-}
-.stat-label { 
-    font-size: 0.9em; 
-    opacity: 0.9; 
-}
-.sensor-grid { 
-    display: grid; 
-    grid-template-columns: repeat(auto-fit, minmax(250px, 1fr)); 
-    gap: 20px; 
-    margin-top: 20px; 
-}
-.sensor-card { 
-    border: 1px solid var(--border-light); 
-    border-radius: 12px; 
-    padding: 15px; 
-    background: linear-gradient(135deg, #f5f7fa 0%, #e8ecf3 100%); 
-    position: relative;
-    box-shadow: var(--shadow-sm);
-}
-.sensor-card.offline { 
-    opacity: 0.6; 
-    background: linear-gradient(135deg, #fff2f2 0%, #ffe4e4 100%); 
-}
-.sensor-name { 
-    font-weight: bold; 
-    font-size: 1.1em; 
-    margin-bottom: 10px; 
-    color: #333; 
-}
-.sensor-data { 
-    display: flex; 
-    justify-content: space-between; 
-    margin-bottom: 8px; 
-    font-size: 0.95em;
-}
-.sensor-value { 
-    font-size: 1.2em; 
-    font-weight: bold; 
-}
-.sensor-value.temp { color: #e74c3c; }
-.sensor-value.humidity { color: #3498db; }
-.last-update { 
-    font-size: 0.85em; 
-    color: #666; 
-    margin-top: 10px; 
-}
-.remove-btn { 
-    background: #e74c3c; 
-    color: white; 
-    border: none; 
-    padding: 2px 8px;
-    font-size: 1.2em;
-    line-height: 1;
-    border-radius: 4px; 
-    cursor: pointer; 
-    position: absolute;
-    top: 10px;
-    right: 10px;
-}
-.remove-btn:hover { 
-    background: #c0392b; 
-}
-.dashboard-controls { 
-    text-align: center; 
-    margin-bottom: 20px; 
-}
-
-/* --- Indoor Sensor Dashboard Styles --- */
-.stats { 
-    display: flex; 
-    justify-content: space-around; 
-    margin-bottom: 30px; 
-    flex-wrap: wrap; 
-    gap: 15px;
-}
-.stat-card { 
-    background: linear-gradient(135deg, #667eea 0%, #764ba2 100%); 
-    color: white; 
-    padding: 20px; 
-    border-radius: 12px; 
-    text-align: center; 
-    min-width: 150px; 
-    flex: 1;
-    box-shadow: var(--shadow-sm);
-}
-.stat-number { 
-    font-size: 2em; 
-    font-weight: bold; 
-    margin-bottom: 5px; 
-}
-.stat-label { 
-    font-size: 0.9em; 
-    opacity: 0.9; 
-}
-.sensor-grid { 
-    display: grid; 
-    grid-template-columns: repeat(auto-fit, minmax(250px, 1fr)); 
-    gap: 20px; 
-    margin-top: 20px; 
-}
-.sensor-card { 
-    border: 1px solid var(--border-light); 
-    border-radius: 12px; 
-    padding: 15px; 
-    background: linear-gradient(135deg, #f5f7fa 0%, #e8ecf3 100%); 
-    position: relative;
-    box-shadow: var(--shadow-sm);
-}
-.sensor-card.offline { 
-    opacity: 0.6; 
-    background: linear-gradient(135deg, #fff2f2 0%, #ffe4e4 100%); 
-}
-.sensor-name { 
-    font-weight: bold; 
-    font-size: 1.1em; 
-    margin-bottom: 10px; 
-    color: #333; 
-}
-.sensor-data { 
-    display: flex; 
-    justify-content: space-between; 
-    margin-bottom: 8px; 
-    font-size: 0.95em;
-}
-.sensor-value { 
-    font-size: 1.2em; 
-    font-weight: bold; 
-}
-.sensor-value.temp { color: #e74c3c; }
-.sensor-value.humidity { color: #3498db; }
-.last-update { 
-    font-size: 0.85em; 
-    color: #666; 
-    margin-top: 10px; 
-}
-.remove-btn { 
-    background: #e74c3c; 
-    color: white; 
-    border: none; 
-    padding: 2px 8px;
-    font-size: 1.2em;
-    line-height: 1;
-    border-radius: 4px; 
-    cursor: pointer; 
-    position: absolute;
-    top: 10px;
-    right: 10px;
-}
-.remove-btn:hover { 
-    background: #c0392b; 
-}
-.dashboard-controls { 
-    text-align: center; 
-    margin-bottom: 20px; 
-}
-
-/* --- Minimal Styles for Indoor Sensor Dashboard --- */
-/* These styles are scoped to avoid affecting the main page */
-
-.sensor-dashboard-card {
-  position: relative; /* Needed for the remove button positioning */
-  text-align: left;   /* Override the default center alignment of config-item */
-  min-width: 250px;   /* Give cards a bit more space */
-}
-
-.sensor-dashboard-card.offline {
-  opacity: 0.6;
-  background: linear-gradient(135deg, #fff2f2 0%, #ffe4e4 100%);
-}
-
-.sensor-dashboard-data {
-  display: flex;
-  justify-content: space-between;
-  margin-bottom: 8px;
-  font-size: 0.95em;
-}
-
-.sensor-dashboard-card .last-update {
-  font-size: 0.85em;
-  color: #666;
-  margin-top: 10px;
-}
-
-.sensor-remove-btn {
-  background: #e74c3c;
-  color: white;
-  border: none;
-  padding: 2px 8px;
-  font-size: 1.2em;
-  line-height: 1;
-  border-radius: 4px;
-  cursor: pointer;
-  position: absolute;
-  top: 10px;
-  right: 10px;
-}
-
-.sensor-remove-btn:hover {
-  background: #c0392b;
-}
-)EMB1";
-const size_t ATTICFAN_CSS_LEN = sizeof(ATTICFAN_CSS) - 1;
+// 21072 bytes, gzipped to 5446
+const unsigned char ATTICFAN_CSS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x5c, 0x5b, 0x93, 0xdb, 0xb8,
+  0xb1, 0x7e, 0xd7, 0xaf, 0xc0, 0xf1, 0xd4, 0x26, 0xa3, 0x5d, 0x51, 0xa6, 0x28, 0x51, 0xa3, 0x91,
+  0x2a, 0x39, 0x9b, 0xbd, 0x38, 0x71, 0x55, 0x9c, 0x4d, 0xf9, 0x52, 0xe7, 0xa4, 0x52, 0x79, 0x80,
+  0x48, 0x70, 0xc4, 0x98, 0x22, 0x55, 0x24, 0x35, 0xf2, 0xac, 0x4a, 0xff, 0x3d, 0xdd, 0xb8, 0x90,
+  0xb8, 0x49, 0x23, 0x3b, 0x39, 0xe7, 0xc9, 0xbb, 0x6b, 0xaf, 0x04, 0x02, 0x44, 0xa3, 0xd1, 0xfd,
+  0xf5, 0x05, 0x0d, 0xbd, 0xfc, 0x96, 0x7c, 0x28, 0xf3, 0xac, 0xaa, 0xb7, 0x64, 0xbd, 0x6f, 0xdb,
+  0xaa, 0x24, 0x4d, 0xfe, 0x6b, 0x5e, 0x3e, 0x10, 0x5a, 0xa6, 0xe4, 0x91, 0xd5, 0x6d, 0x9e, 0xd0,
+  0x82, 0x24, 0xac, 0x6c, 0x59, 0x8d, 0xcd, 0xd0, 0x93, 0xbc, 0x7b, 0x6a, 0x5a, 0xb6, 0x25, 0xbf,
+  0x21, 0x6f, 0x68, 0x0e, 0xed, 0x25, 0x2d, 0x13, 0x46, 0xbe, 0x7d, 0x39, 0x18, 0x37, 0xfc, 0x41,
+  0x90, 0x54, 0x65, 0x5b, 0x57, 0x45, 0x03, 0x1f, 0x8a, 0xfd, 0xb6, 0x6c, 0xc8, 0xb8, 0x61, 0x49,
+  0x9b, 0x57, 0x65, 0xd0, 0xd0, 0x47, 0x16, 0xac, 0xdb, 0x92, 0x1c, 0x07, 0x84, 0x6c, 0xf3, 0x32,
+  0x38, 0xe4, 0x69, 0xbb, 0x59, 0x92, 0xc9, 0x22, 0xdc, 0x7d, 0x5a, 0x61, 0x1b, 0xfd, 0xa4, 0xda,
+  0xa2, 0x48, 0xb6, 0x6d, 0x58, 0xfe, 0xb0, 0x69, 0x97, 0x64, 0xb6, 0x10, 0xdf, 0xd3, 0xbc, 0xd9,
+  0x15, 0xf4, 0x69, 0x49, 0xb2, 0x82, 0xf1, 0x06, 0x5a, 0xe4, 0x0f, 0x65, 0x90, 0xc3, 0xd4, 0xcd,
+  0x52, 0x92, 0x8a, 0xcd, 0xff, 0xdc, 0x37, 0x6d, 0x9e, 0x3d, 0x71, 0x72, 0xa0, 0x51, 0x7f, 0x74,
+  0xd8, 0x40, 0xef, 0xa0, 0xd9, 0xd1, 0x84, 0x2d, 0x49, 0x09, 0x8b, 0xa7, 0x05, 0x36, 0xb7, 0xec,
+  0x53, 0x1b, 0xf0, 0xb7, 0xf5, 0x9d, 0x4f, 0x83, 0xef, 0x93, 0x0d, 0xad, 0x1b, 0xd6, 0x92, 0x17,
+  0x1f, 0xde, 0xbf, 0x0a, 0x16, 0x2f, 0x56, 0x83, 0xc1, 0xcb, 0x6f, 0xc9, 0x1f, 0x52, 0x8d, 0x3f,
+  0xf8, 0x26, 0xe4, 0xce, 0x9a, 0xb5, 0x07, 0xc6, 0x4a, 0xf2, 0xcb, 0x5f, 0x5e, 0xfe, 0xf2, 0xea,
+  0x15, 0xe7, 0xe1, 0xbb, 0x9f, 0xdf, 0x93, 0xf7, 0xaf, 0xdf, 0xfc, 0xfc, 0x56, 0xf2, 0xb7, 0x21,
+  0x79, 0x49, 0xde, 0x54, 0x29, 0x23, 0x3f, 0x0a, 0x36, 0x21, 0xe7, 0x6e, 0xb6, 0xd0, 0xa0, 0xf8,
+  0x16, 0xac, 0xab, 0x4f, 0xe4, 0xf7, 0xb0, 0xcc, 0xc7, 0x65, 0x41, 0x9b, 0x36, 0x48, 0x36, 0x79,
+  0x91, 0xaa, 0xdd, 0xf9, 0xce, 0xf9, 0xc0, 0x59, 0x49, 0xeb, 0x07, 0xe0, 0x66, 0x5b, 0xed, 0x96,
+  0x24, 0x1c, 0xdf, 0xc5, 0x35, 0xdb, 0x22, 0xe5, 0x40, 0xe6, 0x4f, 0xb4, 0x7c, 0x60, 0x35, 0xa9,
+  0xab, 0xc3, 0xf9, 0xad, 0x93, 0xbb, 0x83, 0x84, 0xc0, 0x88, 0x77, 0xed, 0x53, 0xc1, 0x78, 0xe7,
+  0x0d, 0x2b, 0x76, 0x41, 0x91, 0x97, 0x1f, 0xc9, 0x6d, 0xbb, 0x61, 0xe4, 0xf6, 0xbf, 0x87, 0x23,
+  0xd2, 0x6c, 0xaa, 0x43, 0x49, 0x68, 0x43, 0x9a, 0xfd, 0x8e, 0xd5, 0x4d, 0x52, 0xe7, 0xbb, 0x76,
+  0xc8, 0x37, 0xbf, 0xef, 0x8d, 0x14, 0x65, 0xb0, 0x96, 0x00, 0x44, 0x89, 0x71, 0x82, 0x90, 0x1c,
+  0xd2, 0xb1, 0x4b, 0xb1, 0x98, 0xbf, 0xa2, 0xe3, 0x7b, 0xca, 0x92, 0xaa, 0xa6, 0x48, 0x08, 0x6e,
+  0x49, 0xc9, 0x56, 0xfd, 0xba, 0x0a, 0x96, 0xc1, 0xf6, 0x45, 0x62, 0xfb, 0x41, 0xa8, 0xaa, 0x7a,
+  0x49, 0x6e, 0xa2, 0xfb, 0x45, 0xb8, 0xbe, 0xe7, 0x2d, 0xfb, 0xba, 0xc1, 0xa6, 0x5d, 0x95, 0xab,
+  0x0d, 0x6e, 0x6b, 0x5a, 0x36, 0xb9, 0x78, 0x19, 0x1f, 0x00, 0x54, 0x44, 0x0d, 0xf2, 0xa4, 0xa7,
+  0x73, 0xb9, 0xa9, 0x80, 0xa2, 0x11, 0xd1, 0x5a, 0xb2, 0x2a, 0xd9, 0x37, 0x9c, 0x7e, 0x35, 0x0b,
+  0x9b, 0xdf, 0xb1, 0x28, 0xf2, 0x12, 0xb9, 0x2f, 0x53, 0x56, 0xc3, 0x30, 0x86, 0xaf, 0x5d, 0xd6,
+  0x55, 0xd5, 0xe2, 0xc0, 0x20, 0xd8, 0xd5, 0x39, 0xd0, 0xfd, 0x14, 0xac, 0x8b, 0x3d, 0x5b, 0xde,
+  0x44, 0x93, 0xfb, 0xf9, 0xab, 0xe9, 0xca, 0x6c, 0x0e, 0x52, 0x5a, 0x7f, 0x5c, 0xde, 0x4c, 0xee,
+  0xef, 0xe6, 0x3f, 0x45, 0xda, 0xb3, 0x96, 0xd1, 0x02, 0x87, 0xfc, 0xf8, 0x03, 0x0c, 0xe1, 0x2f,
+  0x4b, 0xf9, 0xfe, 0x05, 0x35, 0x4b, 0x97, 0x37, 0x69, 0x32, 0x8d, 0x67, 0x31, 0x74, 0x6f, 0xf6,
+  0x49, 0xc2, 0x9a, 0x26, 0x78, 0xa8, 0x41, 0xd8, 0xa0, 0xff, 0x82, 0xde, 0xf1, 0xf6, 0x03, 0xad,
+  0x4b, 0x10, 0xc3, 0x00, 0x48, 0x84, 0x51, 0xcb, 0x9b, 0x2c, 0xbd, 0x63, 0x93, 0x99, 0x78, 0x11,
+  0x27, 0x7f, 0xbb, 0x6f, 0xf1, 0x45, 0xf3, 0xe4, 0x2e, 0xbe, 0x4b, 0x61, 0xc0, 0xba, 0xaa, 0x61,
+  0x0d, 0xb0, 0x76, 0x54, 0xb0, 0x1b, 0x16, 0xe2, 0xbf, 0xd8, 0xfc, 0x10, 0x24, 0xb4, 0x86, 0x8e,
+  0x59, 0x96, 0x89, 0xd1, 0xcd, 0x86, 0xa6, 0xd5, 0x21, 0x68, 0xb6, 0xcb, 0x10, 0xf7, 0x81, 0xcc,
+  0xe0, 0x4f, 0xfd, 0xb0, 0xa6, 0xb7, 0xe1, 0x08, 0xff, 0x1d, 0x4f, 0x86, 0xab, 0xae, 0xd3, 0x36,
+  0x85, 0x4e, 0xd8, 0x61, 0x61, 0x77, 0x8a, 0x87, 0xc0, 0xa9, 0x6f, 0x8f, 0x20, 0xdf, 0x81, 0x40,
+  0x99, 0xa5, 0x24, 0x00, 0x5a, 0x4e, 0x83, 0x4d, 0xbb, 0x2d, 0x46, 0xeb, 0x2a, 0x7d, 0x3a, 0x4a,
+  0x8d, 0x9f, 0x84, 0xe1, 0x37, 0xa7, 0x01, 0xb6, 0xf4, 0x22, 0x95, 0xd1, 0x6d, 0x5e, 0x80, 0xee,
+  0x07, 0x74, 0xb7, 0x2b, 0x40, 0x85, 0xb9, 0x3c, 0x8f, 0xc8, 0x0f, 0xb8, 0x7d, 0x6f, 0x68, 0x22,
+  0xe4, 0xfb, 0x15, 0xf4, 0x1c, 0x91, 0xdf, 0xbe, 0x63, 0x0f, 0x15, 0x23, 0x1f, 0x5e, 0xff, 0x76,
+  0x44, 0xde, 0x56, 0xeb, 0xaa, 0xad, 0x40, 0x7c, 0x41, 0x2c, 0x82, 0x06, 0xa0, 0x2c, 0xeb, 0xc5,
+  0x0b, 0x24, 0x94, 0xd0, 0x7d, 0x5b, 0x61, 0xcb, 0x9a, 0x26, 0x1f, 0x1f, 0xea, 0x0a, 0xb6, 0x76,
+  0x49, 0x70, 0x6b, 0x69, 0x0d, 0x4c, 0xa6, 0x69, 0x0e, 0x60, 0x70, 0x3b, 0x99, 0xc6, 0x29, 0x7b,
+  0x18, 0x91, 0x9b, 0x2c, 0xce, 0xee, 0x32, 0x4a, 0xc2, 0x6f, 0xe0, 0x73, 0x32, 0x4d, 0x32, 0x16,
+  0x11, 0x24, 0x75, 0x68, 0x01, 0xd8, 0x7d, 0x28, 0x01, 0x6c, 0x47, 0xd3, 0x14, 0x17, 0x0b, 0xf3,
+  0x4c, 0xe6, 0x12, 0xe7, 0x40, 0xaa, 0x15, 0xae, 0xc1, 0xd8, 0xc7, 0x0d, 0xca, 0x10, 0x6a, 0x5f,
+  0xd0, 0xfd, 0x43, 0xfe, 0xc4, 0x28, 0x0e, 0x6b, 0xf4, 0x36, 0x50, 0xb4, 0xcd, 0xe4, 0x28, 0xe9,
+  0x46, 0x80, 0x24, 0xe1, 0x4a, 0x88, 0xea, 0x4d, 0x94, 0x4c, 0x59, 0x1c, 0xae, 0x38, 0x97, 0x0e,
+  0xe2, 0xd5, 0xd3, 0x50, 0x7e, 0xe7, 0x8a, 0x98, 0x14, 0x74, 0xbb, 0xbb, 0x9d, 0x8c, 0x11, 0x1d,
+  0x46, 0xb3, 0xc7, 0xc3, 0x28, 0xe2, 0x1f, 0x87, 0x2b, 0x0d, 0xf6, 0x04, 0xea, 0xc1, 0x5e, 0x44,
+  0x1a, 0xae, 0x20, 0x3e, 0xe3, 0x4c, 0x64, 0x62, 0xab, 0xa0, 0x98, 0x52, 0xed, 0x8d, 0x9c, 0x95,
+  0xcc, 0xc3, 0xbe, 0x4d, 0x40, 0xc0, 0x64, 0x3c, 0xad, 0x05, 0x06, 0xf8, 0x21, 0xd6, 0x5a, 0xf9,
+  0x9f, 0xe9, 0x53, 0xb5, 0x6f, 0xad, 0x75, 0x8f, 0x77, 0xf4, 0x41, 0x60, 0x24, 0x40, 0x17, 0xab,
+  0x8f, 0x26, 0xb3, 0xef, 0xc2, 0xce, 0x82, 0xd8, 0x7b, 0xaa, 0xb1, 0x3f, 0x7a, 0x3c, 0x70, 0xf8,
+  0x97, 0x56, 0x07, 0x36, 0x4d, 0xcd, 0xfe, 0xcb, 0x0e, 0x95, 0x1a, 0xa0, 0x7c, 0xdf, 0xe6, 0x45,
+  0xde, 0x3e, 0x91, 0x6e, 0x22, 0x0e, 0x85, 0xd9, 0xbe, 0xdd, 0xd7, 0x8c, 0xec, 0x1b, 0x61, 0xe8,
+  0xfa, 0x87, 0xff, 0x41, 0x32, 0xc6, 0x00, 0xdf, 0x41, 0xc1, 0x97, 0x0e, 0x42, 0x97, 0xa7, 0x47,
+  0x65, 0xe8, 0xf0, 0xcb, 0x0a, 0xff, 0x02, 0x25, 0xde, 0x42, 0x4b, 0xcb, 0x94, 0x65, 0x5d, 0x46,
+  0x31, 0xca, 0x00, 0x48, 0x13, 0xd0, 0x00, 0x6a, 0x46, 0x26, 0x59, 0x3d, 0x5c, 0x3d, 0xd0, 0x1d,
+  0x97, 0x8d, 0x95, 0x84, 0x4f, 0x10, 0xfd, 0xb6, 0xda, 0x8a, 0x26, 0xdd, 0x56, 0x36, 0x6d, 0xcd,
+  0xda, 0x64, 0x03, 0x33, 0x37, 0xac, 0x04, 0x04, 0x95, 0x6f, 0xed, 0xe6, 0xe5, 0xf6, 0x15, 0xff,
+  0x0a, 0xd2, 0xbc, 0x16, 0x36, 0x62, 0x29, 0xba, 0xf4, 0x53, 0xd8, 0x46, 0x96, 0x77, 0x6f, 0x5a,
+  0x5a, 0xb7, 0x27, 0xc1, 0x26, 0x34, 0x68, 0x9e, 0xf7, 0x0a, 0xae, 0x67, 0x79, 0x51, 0x10, 0xb4,
+  0x2d, 0x35, 0x4a, 0x0e, 0x11, 0xfd, 0x08, 0x62, 0x8f, 0xd7, 0x2a, 0x1e, 0x35, 0xf5, 0x3c, 0xa3,
+  0x9d, 0x37, 0x73, 0x00, 0x6c, 0xc6, 0x95, 0xf3, 0xe6, 0x6e, 0x3e, 0x5b, 0x53, 0xa5, 0x9b, 0x52,
+  0x4b, 0x10, 0xd1, 0x24, 0xe8, 0xe0, 0xc8, 0x7d, 0xb3, 0xe4, 0x2a, 0xa9, 0x36, 0x27, 0x42, 0xdc,
+  0x8a, 0x16, 0x1d, 0xef, 0x96, 0xe1, 0x4a, 0xec, 0x12, 0xdf, 0xa4, 0x2b, 0x18, 0x63, 0xf3, 0x43,
+  0xca, 0x38, 0x87, 0x3c, 0x0e, 0x8f, 0x80, 0x8d, 0xa8, 0x4c, 0x51, 0xac, 0xc0, 0x71, 0x12, 0x46,
+  0xa3, 0x49, 0x34, 0x1f, 0x45, 0xd3, 0xd9, 0x68, 0x3c, 0x1d, 0x4a, 0xea, 0x96, 0x13, 0x78, 0xde,
+  0x54, 0x45, 0x9e, 0x8a, 0x5e, 0x51, 0x1c, 0x8f, 0xd4, 0x9f, 0x71, 0x14, 0x7b, 0x95, 0xd6, 0xf5,
+  0x22, 0x36, 0xd3, 0xa3, 0xb6, 0x6e, 0xb5, 0x24, 0x94, 0x40, 0xd8, 0x3b, 0x47, 0xed, 0x7e, 0x04,
+  0xbe, 0x37, 0xe0, 0x1b, 0xbc, 0x13, 0x4b, 0xb2, 0x81, 0x67, 0x2c, 0xd7, 0x14, 0x48, 0x7f, 0x41,
+  0x07, 0x08, 0x0e, 0x45, 0x8e, 0xa4, 0x2b, 0x0f, 0xee, 0x2a, 0x54, 0x65, 0x34, 0x0b, 0xb3, 0xb5,
+  0x40, 0xd5, 0x2c, 0x86, 0x6f, 0x69, 0x8f, 0xaa, 0xe6, 0x8e, 0x75, 0x38, 0xa4, 0x71, 0x95, 0x3c,
+  0xd2, 0xfa, 0x56, 0x33, 0x41, 0xda, 0x30, 0xe8, 0xdf, 0xf1, 0x52, 0xf4, 0xd2, 0xcd, 0xde, 0xf0,
+  0x32, 0x2a, 0xfd, 0x09, 0x7c, 0x03, 0x82, 0xc8, 0x03, 0x3e, 0x1e, 0x4b, 0xf2, 0x2c, 0x4f, 0x08,
+  0xb8, 0x78, 0xf4, 0x63, 0xd3, 0xfb, 0x3c, 0xca, 0x7d, 0x92, 0x98, 0x69, 0x0e, 0x52, 0xac, 0x04,
+  0xf8, 0x03, 0xc0, 0x20, 0xe8, 0xc9, 0x88, 0x89, 0x18, 0x17, 0x71, 0x73, 0x6a, 0x7c, 0xea, 0x20,
+  0x67, 0x14, 0x4b, 0xe8, 0xf4, 0x61, 0xac, 0xe1, 0xf8, 0x69, 0x0d, 0x52, 0xe5, 0x81, 0x83, 0x7e,
+  0xc4, 0x3e, 0x59, 0xb4, 0xa7, 0x05, 0x49, 0xdb, 0xde, 0xca, 0x5e, 0x42, 0xf2, 0x70, 0x21, 0xe9,
+  0xd1, 0xe7, 0x76, 0xe6, 0x91, 0xce, 0x99, 0x6f, 0x9e, 0x14, 0xe6, 0x01, 0x26, 0xbd, 0x65, 0x4d,
+  0x5b, 0x01, 0xa6, 0xe2, 0xa2, 0x85, 0x0b, 0xbf, 0x05, 0xce, 0xf7, 0x8e, 0xa7, 0x1a, 0x22, 0xa5,
+  0x8e, 0x54, 0x65, 0xf1, 0x24, 0x58, 0x66, 0x7a, 0x85, 0x91, 0x0e, 0xb8, 0x67, 0x17, 0x3e, 0x9d,
+  0x4e, 0x5d, 0x6a, 0xf6, 0x85, 0xee, 0x3d, 0x9b, 0xef, 0xbb, 0x38, 0x30, 0x41, 0xff, 0xfd, 0x68,
+  0x48, 0x76, 0xd0, 0x79, 0x8c, 0xf7, 0x2c, 0x61, 0x99, 0xa9, 0x07, 0x20, 0x7f, 0xb1, 0x12, 0x59,
+  0x43, 0x92, 0x67, 0xa2, 0xf5, 0x00, 0xad, 0xc1, 0xa1, 0x06, 0x50, 0x25, 0xeb, 0x1a, 0xa4, 0x2b,
+  0xc0, 0x86, 0x95, 0xed, 0x46, 0xdf, 0x2f, 0x84, 0x5b, 0x3f, 0xc6, 0x59, 0x7b, 0x57, 0xbb, 0x8b,
+  0x87, 0xf2, 0x12, 0x95, 0x0b, 0x1c, 0xcc, 0x2a, 0xf9, 0xe8, 0x61, 0x49, 0x14, 0x9e, 0x73, 0xa0,
+  0xcf, 0xfa, 0xdf, 0xfa, 0xc6, 0xdb, 0x73, 0x0b, 0xf7, 0x99, 0x53, 0x70, 0xd9, 0x35, 0xe6, 0xf6,
+  0xa5, 0x6d, 0xd1, 0x95, 0xd1, 0xcc, 0xf7, 0x15, 0xc6, 0xad, 0x66, 0x3b, 0x46, 0xdb, 0x5b, 0x84,
+  0x95, 0x20, 0xcb, 0xdb, 0x91, 0x34, 0x73, 0x53, 0xb4, 0xb1, 0x23, 0xb4, 0x74, 0x17, 0x4d, 0x9d,
+  0x3e, 0x2d, 0x6e, 0xd1, 0xee, 0x78, 0xb5, 0x7f, 0x37, 0x05, 0xff, 0x2e, 0x95, 0x48, 0xb4, 0xc8,
+  0xe6, 0x80, 0x4a, 0x16, 0x12, 0x2d, 0x9f, 0x45, 0x14, 0xcb, 0xc6, 0x44, 0xa6, 0x27, 0xd8, 0x01,
+  0x63, 0x0f, 0x60, 0x06, 0x7e, 0x35, 0xe0, 0x95, 0x0d, 0x84, 0x01, 0xcd, 0xf2, 0x07, 0xf0, 0xf7,
+  0xd7, 0x1b, 0xe1, 0x0c, 0x1e, 0x35, 0x0c, 0x9f, 0xa0, 0x48, 0x39, 0x66, 0xe0, 0x82, 0x3b, 0x18,
+  0x1b, 0xee, 0xe0, 0x64, 0x3c, 0x01, 0x45, 0x86, 0x49, 0xf6, 0x65, 0xde, 0x06, 0x65, 0xd5, 0xb2,
+  0x63, 0xff, 0x70, 0x7c, 0x8f, 0x4a, 0x2e, 0x5e, 0x25, 0x28, 0xeb, 0xe3, 0x87, 0xa1, 0x32, 0x24,
+  0x41, 0x2c, 0xbc, 0x42, 0xa4, 0x43, 0x0c, 0xc5, 0xd0, 0x71, 0x99, 0xb7, 0x40, 0x4f, 0xe2, 0xa1,
+  0x4c, 0x6d, 0x39, 0x17, 0x50, 0xc7, 0xfa, 0xbc, 0xe3, 0x3e, 0x88, 0x63, 0x74, 0xa4, 0x6b, 0x62,
+  0x38, 0x44, 0xdc, 0xfe, 0x9e, 0xb1, 0xb4, 0x28, 0x11, 0x9c, 0x22, 0x8f, 0xf3, 0xc3, 0x4d, 0x36,
+  0x57, 0x33, 0xfc, 0xab, 0xf7, 0x7b, 0xd0, 0x1d, 0x3a, 0x6a, 0xdb, 0x33, 0x31, 0x94, 0x75, 0x19,
+  0x7d, 0xde, 0x66, 0x8b, 0x4e, 0xe2, 0x8b, 0xb2, 0x44, 0x7d, 0xae, 0x63, 0xf2, 0x59, 0x46, 0x31,
+  0x9b, 0x81, 0x28, 0x2a, 0xa3, 0x78, 0x07, 0xdf, 0x0c, 0x51, 0xbc, 0x20, 0x3c, 0x46, 0x08, 0xcc,
+  0x3f, 0xf2, 0x1c, 0x0f, 0x04, 0xc1, 0x84, 0xd1, 0x86, 0x8d, 0xb4, 0xd1, 0x5d, 0xa3, 0x65, 0x09,
+  0x7b, 0x43, 0xa8, 0xf3, 0x49, 0xa8, 0xfd, 0xb1, 0x7b, 0xa5, 0x78, 0x39, 0xea, 0xed, 0xdf, 0x6e,
+  0x03, 0xe0, 0xd4, 0xd0, 0xf4, 0x75, 0xd0, 0x9f, 0x42, 0xe9, 0xb7, 0xa2, 0x45, 0xf3, 0x9d, 0x04,
+  0x3c, 0xd1, 0x0a, 0x84, 0xdb, 0x14, 0x5d, 0x43, 0x5c, 0xac, 0xed, 0x5c, 0x74, 0x22, 0xd7, 0x4b,
+  0x2b, 0x27, 0xbd, 0xa7, 0x6b, 0xbf, 0xdb, 0xb1, 0x3a, 0xc1, 0x65, 0x15, 0x00, 0x03, 0xb0, 0x3d,
+  0x32, 0x49, 0xb3, 0x1c, 0xc7, 0x12, 0x1c, 0xf8, 0xfc, 0x8f, 0x14, 0xe2, 0xf1, 0xa3, 0xae, 0x16,
+  0x11, 0xbe, 0x4c, 0xd7, 0x1b, 0xb4, 0x82, 0xba, 0x2a, 0xe8, 0x91, 0xfc, 0xd0, 0x95, 0xe3, 0x43,
+  0x0e, 0x4e, 0xb5, 0x23, 0xc6, 0xbc, 0xf5, 0xb8, 0xab, 0xe4, 0x96, 0xd4, 0x0c, 0x58, 0x96, 0x3f,
+  0xb2, 0x6e, 0x95, 0x06, 0x78, 0x0b, 0x51, 0x99, 0xa3, 0xa4, 0xc8, 0x28, 0x71, 0x3a, 0x13, 0x44,
+  0x8b, 0x97, 0xe7, 0xe5, 0x6e, 0xdf, 0x1e, 0x2b, 0x5c, 0x50, 0xfb, 0xd4, 0xf9, 0xa8, 0xa1, 0xea,
+  0x1c, 0x62, 0x4f, 0x90, 0x57, 0xd8, 0xa7, 0x6e, 0x42, 0xba, 0x06, 0x11, 0x06, 0xf5, 0x5d, 0xc9,
+  0x6c, 0x89, 0x4a, 0x96, 0xe4, 0x25, 0xa0, 0x24, 0x0c, 0xbd, 0xe0, 0x5a, 0xcf, 0x84, 0x67, 0xbd,
+  0x4e, 0x21, 0xd8, 0xbd, 0x1b, 0xdd, 0xdc, 0xc7, 0x34, 0xa6, 0x73, 0xf0, 0x40, 0x7b, 0x01, 0x1b,
+  0x4f, 0x1b, 0xcb, 0xab, 0x46, 0x7a, 0x75, 0x49, 0xe0, 0xd3, 0x90, 0x73, 0xc9, 0x83, 0x8e, 0xde,
+  0xe5, 0x9a, 0xc1, 0xe6, 0xb1, 0xa3, 0x52, 0xea, 0x17, 0x2f, 0x56, 0xee, 0x0a, 0xe4, 0x2a, 0x23,
+  0x74, 0xdc, 0xc5, 0xca, 0xf9, 0x47, 0x6e, 0xbf, 0xc5, 0xb4, 0x5c, 0x46, 0xf8, 0xc7, 0x67, 0x57,
+  0x05, 0x8e, 0xf1, 0x08, 0x51, 0xfe, 0x3e, 0xa3, 0xcf, 0x2c, 0x29, 0x86, 0x08, 0xc0, 0x90, 0x6d,
+  0xdf, 0x5a, 0x22, 0x58, 0x0b, 0xdf, 0x9d, 0x65, 0xb2, 0x61, 0xc9, 0x47, 0x96, 0x7e, 0xa7, 0x76,
+  0xe2, 0x59, 0x52, 0x3c, 0xc2, 0x65, 0xb5, 0x61, 0x7a, 0x68, 0x78, 0x6e, 0x02, 0xc5, 0x3a, 0x8f,
+  0x66, 0xfe, 0xef, 0x2d, 0x32, 0xc8, 0x15, 0xd5, 0x1f, 0x64, 0x46, 0xd2, 0x81, 0x5c, 0x33, 0x5b,
+  0x7b, 0xec, 0x70, 0x11, 0x57, 0x1c, 0x3d, 0xc3, 0x57, 0x89, 0x5d, 0xd7, 0xae, 0xc6, 0x0d, 0xcc,
+  0x50, 0x18, 0x0d, 0xc6, 0x2f, 0x4c, 0x51, 0x92, 0xa0, 0xd2, 0x05, 0x50, 0xd3, 0xe9, 0x68, 0x12,
+  0x87, 0xa3, 0x68, 0x36, 0xe5, 0xf1, 0x93, 0x0e, 0x0b, 0xb1, 0x57, 0x95, 0x4d, 0x05, 0xb0, 0xf6,
+  0xdc, 0xf6, 0x65, 0xb8, 0x2b, 0xe4, 0x55, 0xd2, 0xcf, 0xc6, 0x1b, 0x93, 0xab, 0x12, 0x48, 0xbf,
+  0x84, 0x93, 0x3c, 0x7d, 0x38, 0x1c, 0xdd, 0x84, 0xe1, 0x0f, 0x3f, 0xfe, 0x34, 0xb3, 0x10, 0x77,
+  0x8e, 0x7b, 0x14, 0xfa, 0x98, 0x33, 0x93, 0x02, 0xee, 0x85, 0x6d, 0x1f, 0x85, 0x34, 0x41, 0x88,
+  0xf2, 0x63, 0x7d, 0xe8, 0x1d, 0x01, 0x8c, 0xa2, 0xeb, 0x82, 0xa5, 0xd7, 0x44, 0xea, 0x02, 0x47,
+  0x20, 0x4c, 0xcf, 0x16, 0xc9, 0x22, 0x35, 0x56, 0xc1, 0x99, 0x2e, 0xf7, 0x09, 0x3c, 0x13, 0x30,
+  0x48, 0x45, 0x75, 0x60, 0xe9, 0x4a, 0x21, 0xde, 0x78, 0xee, 0x99, 0x7c, 0x0c, 0x7f, 0x64, 0xbe,
+  0xf4, 0x6a, 0xae, 0xf6, 0xe9, 0x55, 0x60, 0x67, 0xb2, 0x88, 0xc0, 0xdb, 0x1f, 0x5e, 0x92, 0xb5,
+  0x28, 0x0a, 0x47, 0xf1, 0x74, 0x34, 0xbf, 0x47, 0x51, 0xbb, 0x4c, 0xc3, 0xd5, 0xfb, 0x2b, 0xe7,
+  0x45, 0x80, 0x8d, 0x26, 0xd3, 0xf0, 0xe2, 0x76, 0x6a, 0xf3, 0xcf, 0xa4, 0x3e, 0x43, 0x1c, 0xb5,
+  0x03, 0x25, 0x86, 0x8d, 0xb2, 0x4e, 0x70, 0x30, 0x92, 0xda, 0x56, 0xeb, 0xbc, 0xe0, 0x39, 0xab,
+  0xef, 0xb7, 0x2c, 0xcd, 0x29, 0xb9, 0xd5, 0x92, 0x55, 0x73, 0x74, 0xa4, 0x87, 0xdc, 0x83, 0xbf,
+  0xfe, 0xe8, 0x66, 0x74, 0xa9, 0xb7, 0x76, 0x24, 0x61, 0x9c, 0xef, 0xf0, 0x28, 0xd2, 0x48, 0x94,
+  0x89, 0xa4, 0x17, 0x36, 0x3a, 0x0d, 0x5a, 0x7a, 0x98, 0xf4, 0xf9, 0x61, 0xf1, 0x4c, 0x0f, 0x48,
+  0x64, 0x18, 0xca, 0x03, 0x0c, 0x9e, 0xf9, 0x90, 0x07, 0x2c, 0x9e, 0x20, 0xe3, 0x59, 0x87, 0x31,
+  0xba, 0xd2, 0x61, 0xcc, 0x68, 0x89, 0xd9, 0xad, 0x76, 0xff, 0xb9, 0xb3, 0xe8, 0x79, 0x37, 0x6d,
+  0x62, 0x2d, 0x76, 0xe1, 0x5e, 0x27, 0x70, 0xca, 0x3b, 0x27, 0xc7, 0x9a, 0x7e, 0x46, 0xcd, 0x4b,
+  0x43, 0xab, 0xe7, 0x00, 0xfb, 0xeb, 0x04, 0x61, 0xfd, 0x37, 0xe4, 0x0f, 0x25, 0x80, 0x86, 0x2f,
+  0x97, 0x73, 0x83, 0x2f, 0xcd, 0xa1, 0x97, 0xf6, 0x52, 0xb1, 0x11, 0x77, 0x9a, 0xd3, 0xc1, 0x3f,
+  0x77, 0xe0, 0x1f, 0x9a, 0xb8, 0xef, 0x49, 0x4b, 0x0d, 0x7d, 0x16, 0x13, 0x46, 0xa4, 0x75, 0xb5,
+  0x83, 0x08, 0xae, 0x68, 0xd1, 0x4a, 0x15, 0xfb, 0xfa, 0x16, 0xdf, 0x35, 0x94, 0x4b, 0x43, 0x2a,
+  0x8e, 0x5a, 0x92, 0x4d, 0x4b, 0xfe, 0x5b, 0xd8, 0x7c, 0x1a, 0x7c, 0xff, 0x91, 0x3d, 0x65, 0x35,
+  0xdd, 0xb2, 0x86, 0x34, 0xbb, 0xbc, 0x3c, 0x66, 0x75, 0xb5, 0xd5, 0xe0, 0xa9, 0xae, 0x60, 0x6b,
+  0x18, 0x42, 0x53, 0x5b, 0xb9, 0xcd, 0xd3, 0x79, 0x08, 0xea, 0x36, 0x3c, 0x69, 0xf3, 0x8e, 0xf1,
+  0x2d, 0x78, 0x64, 0x72, 0xa4, 0x8a, 0x53, 0x4b, 0x6c, 0x22, 0x93, 0x46, 0xfa, 0xe4, 0xe0, 0x6a,
+  0x65, 0x39, 0x04, 0x48, 0xcc, 0xf5, 0xf3, 0xb8, 0x18, 0x90, 0xd7, 0x65, 0x9a, 0x27, 0xb4, 0x05,
+  0x5d, 0xbb, 0xfd, 0xc8, 0x76, 0x2d, 0xd9, 0xe4, 0x69, 0xca, 0x4a, 0xd2, 0x56, 0x20, 0xed, 0xe8,
+  0xaa, 0x01, 0x8a, 0xd5, 0x98, 0xbe, 0xf8, 0xf0, 0x7a, 0xe8, 0xd8, 0x59, 0x21, 0x48, 0xb9, 0x7a,
+  0x43, 0x27, 0x48, 0x08, 0x7f, 0xff, 0x95, 0x6f, 0x77, 0x55, 0xdd, 0xd2, 0xb2, 0x55, 0x19, 0xc8,
+  0xa8, 0xdf, 0x18, 0xfe, 0xd9, 0xe5, 0xb5, 0x94, 0x60, 0x9e, 0x4c, 0x45, 0xab, 0x79, 0x72, 0xe7,
+  0x18, 0x57, 0xdc, 0x84, 0xe9, 0xb0, 0x24, 0x83, 0x07, 0xfd, 0x4c, 0xc9, 0xc2, 0xa0, 0xb0, 0x3f,
+  0xca, 0x99, 0x85, 0xa3, 0xc9, 0xfc, 0x8e, 0x03, 0x50, 0x3c, 0xf4, 0xbe, 0x3f, 0xcb, 0xfc, 0x13,
+  0x68, 0x01, 0xa4, 0xc3, 0xcb, 0x3f, 0x42, 0x74, 0xe7, 0x4b, 0x37, 0x62, 0xf0, 0xeb, 0x46, 0x7e,
+  0xa6, 0x86, 0x3c, 0x1b, 0x08, 0xfa, 0x53, 0xde, 0xf2, 0xed, 0x2a, 0xf4, 0x73, 0x0e, 0x95, 0xad,
+  0xf4, 0xae, 0xcc, 0x4d, 0x3b, 0xc7, 0xcd, 0xf2, 0x85, 0x6a, 0x04, 0xc0, 0xd2, 0xca, 0x3a, 0xda,
+  0x8e, 0xec, 0x53, 0xa0, 0x2e, 0xba, 0xbc, 0x14, 0x00, 0xfa, 0xbc, 0x53, 0x37, 0x7d, 0xb4, 0x30,
+  0xe2, 0xd4, 0xcb, 0x79, 0xce, 0x81, 0xb9, 0x68, 0x52, 0xd0, 0x35, 0x2b, 0x96, 0x59, 0x5e, 0x77,
+  0x47, 0xcc, 0xc7, 0x73, 0x69, 0x34, 0x6b, 0xa4, 0x8a, 0x42, 0x8e, 0x1d, 0x33, 0x1a, 0x56, 0x64,
+  0x82, 0x75, 0x01, 0x2b, 0x53, 0x3b, 0x39, 0xa8, 0xf2, 0xc2, 0xd6, 0xbb, 0x17, 0xe2, 0xd5, 0x28,
+  0x0a, 0x3f, 0x97, 0x0d, 0x1e, 0xaf, 0xe0, 0x49, 0x80, 0x8a, 0x70, 0x1a, 0x78, 0xf5, 0x81, 0x3e,
+  0x35, 0x32, 0x1f, 0xcb, 0xfa, 0xd3, 0xf6, 0xe2, 0x09, 0x8f, 0xd0, 0x75, 0x82, 0x34, 0x69, 0xb9,
+  0x48, 0x60, 0x5f, 0x00, 0xa0, 0x93, 0x27, 0xe9, 0x18, 0x97, 0xfb, 0xed, 0x1a, 0xb8, 0xc5, 0x9d,
+  0x6b, 0x2e, 0x5e, 0x3b, 0x1b, 0xdb, 0x3d, 0x20, 0x7e, 0x46, 0xf8, 0x7a, 0x3c, 0x13, 0x0b, 0xfc,
+  0xeb, 0xbe, 0xd9, 0xf0, 0xe5, 0xf1, 0xb7, 0xbf, 0x94, 0xf4, 0x01, 0x48, 0x60, 0x9b, 0x60, 0x08,
+  0xa9, 0x32, 0xfe, 0x4d, 0x2c, 0x84, 0xf0, 0x85, 0xa0, 0x09, 0xef, 0x8a, 0x0c, 0xfa, 0x1c, 0xa9,
+  0xbd, 0xde, 0xdf, 0x13, 0x2f, 0xf1, 0x23, 0xa7, 0x97, 0xc6, 0x17, 0x77, 0x83, 0xce, 0xb0, 0x40,
+  0x06, 0x9b, 0x6e, 0x62, 0xc0, 0x4e, 0x25, 0x29, 0x70, 0x9a, 0xcd, 0xba, 0xb8, 0x8c, 0x83, 0x78,
+  0x6f, 0xf5, 0x85, 0x2e, 0x5c, 0x95, 0x55, 0x71, 0x23, 0x00, 0xdd, 0x16, 0x44, 0x8d, 0x6e, 0x89,
+  0x78, 0xec, 0x10, 0x6c, 0xab, 0x5f, 0xf1, 0x50, 0x18, 0xd4, 0x08, 0x8b, 0x1a, 0x96, 0x48, 0x6f,
+  0x96, 0xb3, 0x22, 0xbd, 0xb8, 0x2c, 0x71, 0xe2, 0x7f, 0xac, 0xf6, 0x2d, 0x6a, 0xa0, 0xf0, 0x3b,
+  0xe5, 0xd4, 0x67, 0x23, 0x7e, 0x1b, 0x1b, 0x43, 0x32, 0xf5, 0x79, 0xdb, 0x18, 0xd5, 0xc2, 0xce,
+  0xff, 0x85, 0x1d, 0x48, 0xd3, 0x95, 0x54, 0x70, 0x09, 0xa7, 0xbd, 0xab, 0xd6, 0x1f, 0x24, 0x82,
+  0x2c, 0x40, 0xc0, 0x50, 0xf2, 0x1e, 0xd9, 0xbe, 0x28, 0x84, 0x5f, 0xa4, 0x84, 0x02, 0x41, 0x50,
+  0xd8, 0x0c, 0x74, 0xc3, 0x12, 0x56, 0x88, 0xcc, 0x35, 0xcf, 0x9b, 0x0a, 0x64, 0x02, 0x5d, 0x25,
+  0x2f, 0x49, 0x30, 0x59, 0xe1, 0x01, 0xc4, 0x3b, 0x7c, 0x13, 0x68, 0x0a, 0x51, 0x8e, 0x19, 0xcf,
+  0x9b, 0x3b, 0x18, 0x77, 0xa1, 0x42, 0x46, 0xa2, 0x95, 0x9e, 0xdd, 0x77, 0x50, 0xfb, 0x2d, 0xfa,
+  0xb9, 0x60, 0x00, 0x81, 0x8f, 0x36, 0x78, 0x73, 0xe6, 0xfe, 0xbd, 0x7d, 0xda, 0xb1, 0xdf, 0xf1,
+  0x5a, 0x84, 0x7f, 0x78, 0x2c, 0xfc, 0xdc, 0xb1, 0x61, 0x53, 0xd3, 0xc3, 0xf0, 0xc9, 0x85, 0xb1,
+  0x53, 0x10, 0xd5, 0xad, 0x3f, 0xe6, 0xad, 0xbe, 0xed, 0xd8, 0x7e, 0x72, 0xa7, 0x5f, 0x2e, 0x55,
+  0x5f, 0x11, 0x2c, 0x07, 0xed, 0x06, 0x64, 0xe2, 0x68, 0x0d, 0x54, 0xd9, 0x04, 0xcd, 0x05, 0xd2,
+  0x24, 0xd6, 0xf6, 0x6a, 0x0c, 0x2a, 0x4d, 0x09, 0xb1, 0x42, 0x4c, 0x27, 0x6b, 0x30, 0xb7, 0xb2,
+  0x06, 0xd3, 0xa1, 0x9f, 0x66, 0x94, 0x69, 0xfe, 0x45, 0xd2, 0xfb, 0x7f, 0x46, 0x5f, 0x17, 0x77,
+  0x5f, 0x41, 0xa8, 0x7d, 0x6a, 0xb8, 0xa1, 0xb5, 0x73, 0x56, 0x8f, 0x25, 0x53, 0xba, 0xc3, 0x6a,
+  0x6b, 0xeb, 0x85, 0x8c, 0x69, 0xf1, 0x30, 0x5c, 0x19, 0x79, 0x72, 0xbd, 0xda, 0x81, 0x23, 0xd5,
+  0xa5, 0xc4, 0xe7, 0x55, 0xf9, 0xf9, 0x1e, 0x91, 0x78, 0x8d, 0xc6, 0x69, 0x70, 0xb3, 0xc9, 0xf1,
+  0x30, 0xea, 0x89, 0xaf, 0x45, 0x13, 0x55, 0xcd, 0x09, 0x53, 0xfc, 0xc6, 0x03, 0xf7, 0xbe, 0xd9,
+  0x1a, 0xfa, 0xa6, 0xe9, 0x92, 0x98, 0x8b, 0xc5, 0xc2, 0x4c, 0x45, 0x00, 0x40, 0x6a, 0x98, 0xbb,
+  0xf0, 0x9c, 0xbf, 0xbe, 0xaf, 0x68, 0xe3, 0x70, 0xb2, 0xc5, 0xc6, 0xe3, 0x63, 0xde, 0xe4, 0x6b,
+  0x5e, 0x98, 0xb0, 0x14, 0x0e, 0xe6, 0xaa, 0x77, 0x31, 0xf8, 0x79, 0xc8, 0x15, 0x19, 0x19, 0x99,
+  0x57, 0x1d, 0xdd, 0x4c, 0x67, 0x33, 0x20, 0xc7, 0xc8, 0xbc, 0xb8, 0xe8, 0xee, 0x02, 0x70, 0x17,
+  0x08, 0xa8, 0x90, 0xb4, 0x4f, 0xcd, 0x65, 0xf9, 0x27, 0x88, 0xce, 0x7f, 0x45, 0x37, 0x10, 0x7c,
+  0x20, 0xe0, 0xdc, 0x44, 0x64, 0xe3, 0x62, 0xe5, 0xc3, 0xdb, 0xf9, 0xa8, 0x20, 0xc6, 0x24, 0xb6,
+  0xf4, 0x04, 0xa6, 0xa1, 0x9d, 0xe0, 0x31, 0x4f, 0xc8, 0x3b, 0xd9, 0xb3, 0x4f, 0x33, 0x4e, 0x92,
+  0x3d, 0x63, 0xac, 0x4a, 0xd3, 0x79, 0xc4, 0x3f, 0x16, 0x6c, 0xd5, 0x7b, 0xf5, 0xbc, 0xdf, 0x3b,
+  0xd4, 0xfd, 0x0f, 0x3b, 0x02, 0xb1, 0x04, 0x4f, 0x78, 0x07, 0x80, 0x26, 0x46, 0x50, 0xa1, 0xf7,
+  0xb2, 0x83, 0x0b, 0x9b, 0x7a, 0xa2, 0x25, 0x43, 0x44, 0x4e, 0xbe, 0xcb, 0xc7, 0x9a, 0xe1, 0xc7,
+  0xa5, 0x81, 0x61, 0x3f, 0x6a, 0x72, 0x72, 0x04, 0xe2, 0x4d, 0x95, 0x82, 0xdd, 0xbf, 0x7d, 0x9f,
+  0x6f, 0x59, 0xed, 0x44, 0x0f, 0x5b, 0x7c, 0x68, 0x84, 0x0c, 0xf6, 0x7e, 0xa8, 0xd4, 0xae, 0xb6,
+  0x2f, 0xa1, 0x13, 0xc1, 0x49, 0xe6, 0xc6, 0x43, 0x7f, 0xa4, 0x16, 0x8b, 0x40, 0x8d, 0x4f, 0xa6,
+  0xec, 0x84, 0xa3, 0xcd, 0x2a, 0x80, 0x0d, 0xbf, 0x11, 0x0a, 0xaa, 0x24, 0x65, 0xea, 0x82, 0xd3,
+  0xa4, 0x4f, 0xda, 0xde, 0x1b, 0xbe, 0xc1, 0x2c, 0x76, 0xa4, 0x80, 0x6b, 0xfc, 0x2c, 0x74, 0xc5,
+  0xa0, 0xdf, 0x56, 0x4e, 0x17, 0xdf, 0xb0, 0xd7, 0xe5, 0xf9, 0x6d, 0xd5, 0x7b, 0x9d, 0xdd, 0xd6,
+  0xbf, 0xe1, 0xee, 0xe0, 0xf9, 0xc5, 0x73, 0xdb, 0xe8, 0xec, 0xda, 0x38, 0x29, 0xaa, 0x46, 0x64,
+  0x4a, 0xa5, 0x4a, 0x51, 0x4a, 0x21, 0x4a, 0xa9, 0x68, 0xbb, 0xe4, 0xb1, 0x98, 0x06, 0x04, 0x51,
+  0x77, 0x72, 0x71, 0x50, 0x31, 0xf6, 0xa5, 0x8c, 0xa4, 0xa8, 0x5d, 0x04, 0x7f, 0x47, 0x9f, 0x45,
+  0x66, 0x96, 0x74, 0x07, 0x45, 0xcb, 0x63, 0xd9, 0xbb, 0x45, 0x36, 0x53, 0x72, 0xf4, 0x55, 0x38,
+  0x10, 0x00, 0xaf, 0x16, 0x45, 0x4b, 0x44, 0xb2, 0x47, 0x27, 0x71, 0xaa, 0x4f, 0x60, 0x96, 0x16,
+  0x0e, 0x9d, 0xa4, 0xaa, 0x09, 0x6d, 0x2b, 0x53, 0x2c, 0xa5, 0x38, 0x2c, 0xbc, 0x09, 0x84, 0xa9,
+  0xa8, 0x7e, 0x11, 0x45, 0x84, 0xa6, 0xb0, 0xf4, 0x1e, 0x82, 0x5b, 0x0e, 0xd3, 0x0f, 0x8b, 0x3c,
+  0x67, 0x30, 0xa2, 0xcc, 0x55, 0x56, 0xd8, 0xba, 0x09, 0x6e, 0x2b, 0x7d, 0xc5, 0xbd, 0xab, 0xcf,
+  0x8c, 0x02, 0x31, 0xbc, 0xec, 0x72, 0x50, 0xde, 0x0a, 0xe4, 0x93, 0x36, 0x51, 0x41, 0xfe, 0x13,
+  0x41, 0x26, 0xba, 0x76, 0x60, 0x67, 0x60, 0x03, 0x52, 0x82, 0x62, 0x2c, 0xa7, 0xe2, 0xbe, 0xa3,
+  0xe8, 0x22, 0x1c, 0xbd, 0x9e, 0x36, 0xc2, 0x13, 0x84, 0xe9, 0x3e, 0x51, 0x23, 0xf0, 0x70, 0x4b,
+  0x74, 0x72, 0x9c, 0xbf, 0xbe, 0x74, 0x0b, 0x69, 0xbf, 0x69, 0x19, 0x04, 0x86, 0xe0, 0x47, 0xb2,
+  0x82, 0xb8, 0x71, 0x23, 0x48, 0x94, 0xf2, 0x10, 0xbb, 0x50, 0x11, 0xc3, 0x5a, 0xf2, 0xdc, 0xc0,
+  0xef, 0x5c, 0xcf, 0xd0, 0x7b, 0xce, 0x87, 0x82, 0x34, 0xe1, 0x67, 0x5e, 0xe7, 0xde, 0x77, 0x74,
+  0x4e, 0x04, 0xfd, 0x7d, 0xaf, 0x2d, 0xa5, 0x9b, 0x64, 0x35, 0x96, 0xcf, 0xad, 0xc4, 0xf7, 0x80,
+  0x67, 0xe7, 0x50, 0x62, 0x6b, 0xf0, 0x2c, 0x78, 0x2e, 0x61, 0xce, 0x13, 0x2a, 0xfd, 0x0c, 0x01,
+  0x95, 0xb5, 0x3d, 0x7e, 0xed, 0x32, 0xca, 0x63, 0x24, 0x6f, 0x84, 0x66, 0x92, 0x31, 0x57, 0xbb,
+  0xa0, 0xda, 0xa9, 0xf1, 0xd7, 0xf7, 0x85, 0x40, 0x16, 0x84, 0xa5, 0x67, 0xff, 0x92, 0x78, 0xbb,
+  0xf7, 0xa4, 0xe9, 0xaf, 0xe6, 0x46, 0x9b, 0x08, 0x6d, 0xe1, 0x65, 0xde, 0x4d, 0x17, 0x94, 0x80,
+  0x85, 0xa8, 0xe0, 0xa3, 0x38, 0x14, 0x25, 0x05, 0xf8, 0x34, 0x02, 0x35, 0x79, 0xb2, 0x50, 0x3c,
+  0x94, 0x07, 0xf4, 0x7f, 0xc6, 0x67, 0xaa, 0xec, 0xb1, 0xab, 0xcd, 0xe7, 0x25, 0xac, 0x84, 0x20,
+  0x30, 0x01, 0xf0, 0x1d, 0x82, 0x27, 0x2d, 0xaa, 0x94, 0x27, 0xad, 0x02, 0x95, 0xb8, 0x28, 0x1c,
+  0xaf, 0x8a, 0x46, 0x78, 0x7d, 0x7e, 0x20, 0x6b, 0xea, 0xcd, 0x14, 0x4a, 0xe8, 0x54, 0xd4, 0x74,
+  0x62, 0x78, 0xf9, 0xb0, 0x1e, 0x16, 0x2f, 0xe1, 0x11, 0x6b, 0x58, 0x02, 0xb3, 0x90, 0xd3, 0x57,
+  0x06, 0xd6, 0xd7, 0xb8, 0x69, 0xe5, 0x0e, 0x24, 0x74, 0x8b, 0x73, 0x62, 0x51, 0x20, 0x63, 0x43,
+  0xd1, 0xab, 0xaa, 0x42, 0x15, 0x35, 0x11, 0xe8, 0x8a, 0x2e, 0x63, 0x88, 0x4d, 0x82, 0x4c, 0x3c,
+  0xb1, 0x76, 0x91, 0x2b, 0x76, 0x5f, 0x4e, 0x2a, 0xea, 0xfd, 0x81, 0x24, 0xaf, 0x18, 0x2a, 0x43,
+  0x05, 0xfd, 0x16, 0xdd, 0xde, 0xfb, 0x6e, 0x01, 0xb4, 0x87, 0x4a, 0xea, 0x02, 0x29, 0x64, 0xfd,
+  0x2d, 0xe1, 0x7e, 0x04, 0x69, 0x9e, 0x80, 0x49, 0x9f, 0xd4, 0xf5, 0x80, 0x6b, 0xc7, 0xd6, 0x12,
+  0x76, 0xd4, 0xdd, 0x88, 0xcf, 0x1c, 0x2e, 0xb3, 0x3f, 0xf0, 0x48, 0x05, 0xb1, 0x23, 0x78, 0x65,
+  0x77, 0xd4, 0x71, 0xe9, 0xba, 0x89, 0x21, 0x5d, 0x5c, 0xe3, 0x55, 0xa8, 0xec, 0x28, 0x3d, 0x91,
+  0x35, 0x46, 0x91, 0x2c, 0x9d, 0x15, 0xe5, 0x51, 0x4a, 0xff, 0x91, 0xb7, 0x12, 0xe1, 0x15, 0x0a,
+  0x40, 0xd3, 0x4c, 0x36, 0x59, 0x07, 0x17, 0xce, 0xe1, 0xc6, 0xc9, 0xda, 0xe6, 0xff, 0x81, 0x89,
+  0x36, 0xee, 0x3e, 0x1f, 0x44, 0x73, 0x80, 0x87, 0xb7, 0x09, 0xfa, 0xfa, 0x5f, 0x52, 0xe5, 0xc2,
+  0xe1, 0x32, 0xf6, 0x9e, 0x58, 0xc8, 0xd7, 0x82, 0x8b, 0xf0, 0xa4, 0xea, 0x13, 0xdf, 0xb2, 0x2d,
+  0x28, 0x6a, 0x2a, 0x0a, 0x6d, 0x1b, 0x01, 0x04, 0x5d, 0xc2, 0x7a, 0x53, 0xed, 0xeb, 0xe2, 0x89,
+  0xa8, 0x71, 0x67, 0x52, 0x07, 0xcf, 0x18, 0x46, 0x59, 0xd7, 0x76, 0x46, 0xa1, 0xfa, 0xec, 0xe8,
+  0x9d, 0xa7, 0x44, 0x5e, 0xa5, 0x1c, 0x0d, 0xca, 0xc7, 0x40, 0xf2, 0x3f, 0x73, 0xd0, 0x04, 0xa3,
+  0x16, 0x91, 0x6f, 0x05, 0xb1, 0xfb, 0xe2, 0xcd, 0x19, 0x23, 0xaf, 0x69, 0x69, 0x2a, 0x1f, 0x64,
+  0xd4, 0x39, 0x62, 0x65, 0x54, 0x57, 0x17, 0x37, 0x9f, 0xcf, 0x95, 0xa2, 0xa8, 0x2d, 0xc3, 0xea,
+  0x2b, 0xf8, 0xdf, 0x21, 0x6f, 0x37, 0xa4, 0xd9, 0x97, 0x75, 0xde, 0xb0, 0x97, 0xf0, 0x7f, 0x2c,
+  0x69, 0xd0, 0xb7, 0x50, 0x74, 0x0b, 0x40, 0x56, 0x2e, 0x6f, 0xa2, 0x09, 0x6c, 0x9e, 0xac, 0xa2,
+  0xbe, 0xab, 0x6e, 0x75, 0x1b, 0xdf, 0x68, 0xc5, 0x31, 0xc1, 0x30, 0x44, 0x59, 0x41, 0x57, 0x20,
+  0xe8, 0xd2, 0xbc, 0x39, 0xb9, 0x62, 0xbb, 0x12, 0x4c, 0xba, 0xaa, 0xb0, 0x5a, 0xc4, 0x44, 0x6b,
+  0x09, 0x6d, 0xde, 0x16, 0xa2, 0xc2, 0x51, 0xcb, 0x6a, 0xfb, 0x77, 0xd3, 0x5b, 0xe6, 0xef, 0xab,
+  0x22, 0x75, 0x6b, 0x50, 0x79, 0x81, 0xad, 0x2b, 0x6e, 0x63, 0x21, 0x82, 0x67, 0x34, 0xc2, 0x3e,
+  0xaf, 0xeb, 0x44, 0xdf, 0x73, 0x7e, 0xa7, 0x9f, 0x5d, 0x01, 0x40, 0xfa, 0x95, 0xe9, 0xd4, 0x4d,
+  0xa8, 0x0e, 0x03, 0xce, 0xa8, 0x48, 0x91, 0x7f, 0x64, 0x5a, 0xd6, 0x7e, 0x24, 0x4d, 0xcf, 0x88,
+  0xdf, 0xf3, 0x92, 0x53, 0x09, 0x75, 0xd1, 0xc4, 0x99, 0x9b, 0x67, 0x79, 0x5f, 0x6c, 0x53, 0xd5,
+  0xf9, 0xaf, 0x68, 0x71, 0x8a, 0xae, 0xbb, 0x56, 0xd5, 0xda, 0x6b, 0x45, 0xdc, 0x0d, 0x22, 0xcd,
+  0x96, 0x16, 0x05, 0x88, 0x5e, 0xf7, 0xd4, 0xa9, 0x1a, 0xd6, 0x76, 0x82, 0x3b, 0x70, 0x9b, 0x1a,
+  0x8b, 0x33, 0xc3, 0xd5, 0x17, 0x6a, 0xad, 0xa2, 0x95, 0x8a, 0xa9, 0xf1, 0x41, 0x77, 0xad, 0x0d,
+  0x7d, 0x8b, 0x97, 0x78, 0x6e, 0xf6, 0x12, 0x81, 0x14, 0x29, 0xe9, 0x79, 0x87, 0xcf, 0x0c, 0xa1,
+  0x5b, 0xf8, 0x84, 0xce, 0xdc, 0x23, 0x9c, 0x4f, 0x17, 0xc3, 0x6e, 0x1f, 0xf0, 0x48, 0xd0, 0x29,
+  0xc9, 0x72, 0xc6, 0x6a, 0x93, 0x03, 0x39, 0xe6, 0xe4, 0xbe, 0xca, 0x0f, 0x37, 0x81, 0xd9, 0xdb,
+  0x13, 0x13, 0x94, 0xdd, 0xc3, 0x72, 0x9e, 0x28, 0x1a, 0x1e, 0xcd, 0x44, 0x51, 0x97, 0x83, 0x33,
+  0x73, 0x42, 0x27, 0xcf, 0xf8, 0x85, 0x18, 0xef, 0xdc, 0xf1, 0x38, 0xeb, 0x8b, 0x9e, 0xfc, 0x67,
+  0xcd, 0xe7, 0xaf, 0x63, 0xa0, 0x0e, 0x9c, 0x7c, 0x95, 0xb6, 0xe7, 0xa7, 0xf0, 0x11, 0x3a, 0x5f,
+  0x88, 0x85, 0x9e, 0xf3, 0xa4, 0xcf, 0xbe, 0xad, 0x73, 0x94, 0xb1, 0x40, 0xe8, 0x74, 0xa5, 0xd7,
+  0xce, 0x9d, 0x6a, 0x1f, 0x19, 0x33, 0x41, 0x06, 0x2f, 0x36, 0x38, 0x5b, 0x8e, 0x84, 0x5a, 0xcd,
+  0x13, 0x0a, 0x56, 0x29, 0xe0, 0x09, 0x6f, 0x8d, 0x4e, 0x0c, 0x09, 0x8a, 0x65, 0xb3, 0x83, 0x2d,
+  0x5c, 0xf0, 0xd1, 0xcf, 0x3f, 0xf5, 0xb1, 0x12, 0x17, 0x7a, 0x2c, 0xa4, 0xe0, 0x1a, 0xd0, 0x24,
+  0x78, 0x24, 0x2a, 0x73, 0xe8, 0x06, 0x54, 0xe8, 0x2a, 0x8b, 0x70, 0x83, 0xa5, 0x08, 0xe2, 0x26,
+  0x20, 0xd8, 0x1c, 0x2d, 0xa1, 0x29, 0xb2, 0x1e, 0x44, 0x2b, 0x0a, 0x15, 0xa5, 0x54, 0xd0, 0x1b,
+  0xc8, 0xf4, 0x96, 0x0b, 0xa1, 0xa4, 0x7a, 0xef, 0x73, 0x68, 0x6a, 0x7d, 0xee, 0x4c, 0x0a, 0x97,
+  0x24, 0x4f, 0x06, 0xed, 0x30, 0xdd, 0x9e, 0x6b, 0xea, 0x1a, 0x17, 0x71, 0x1c, 0xe6, 0xbf, 0x95,
+  0x4a, 0xfb, 0xab, 0x91, 0x7d, 0xda, 0x50, 0x2b, 0x96, 0xea, 0xeb, 0xbe, 0xf9, 0x93, 0xee, 0x6b,
+  0x50, 0x65, 0x19, 0xe6, 0xa2, 0x10, 0xb6, 0xbb, 0x1a, 0x9e, 0xfb, 0x81, 0xef, 0xca, 0x0a, 0x95,
+  0xd9, 0x8d, 0x3e, 0xc1, 0x32, 0x38, 0x57, 0xde, 0xe1, 0x11, 0x0d, 0xad, 0xce, 0x56, 0x99, 0x45,
+  0xbb, 0x42, 0x27, 0x6f, 0x02, 0x51, 0xd7, 0x34, 0x72, 0x1f, 0xfe, 0x9d, 0xd6, 0x39, 0x0d, 0x76,
+  0xe0, 0x67, 0x36, 0x2c, 0xfd, 0xdd, 0x8b, 0xb6, 0xde, 0xb3, 0x17, 0xff, 0xe0, 0x56, 0x50, 0xa4,
+  0xc4, 0x78, 0x3a, 0xa3, 0xa3, 0xcc, 0x3a, 0xc4, 0x3d, 0x97, 0x76, 0x15, 0x55, 0x5a, 0x23, 0x79,
+  0xad, 0x73, 0x38, 0xb8, 0x58, 0x37, 0xd5, 0x71, 0x27, 0xc6, 0x50, 0x82, 0xaa, 0x84, 0x92, 0xb8,
+  0x29, 0x7a, 0x72, 0xee, 0xe0, 0xe0, 0xa5, 0x13, 0xd5, 0x29, 0x2f, 0xc1, 0x80, 0xe7, 0x58, 0x0c,
+  0x72, 0x16, 0xbe, 0x80, 0x60, 0xf7, 0x52, 0x95, 0x9e, 0x6c, 0x3f, 0xf5, 0xa7, 0x3c, 0xe4, 0x83,
+  0xbc, 0x09, 0x27, 0x23, 0x45, 0xe5, 0xaf, 0xb2, 0xba, 0xc6, 0x60, 0x0e, 0x58, 0x84, 0x17, 0x5c,
+  0xb4, 0xbb, 0xb2, 0x4e, 0x26, 0x6a, 0xe5, 0xbd, 0x20, 0xd1, 0xd5, 0x31, 0x91, 0x78, 0x3a, 0x22,
+  0xf3, 0xfb, 0x11, 0xb8, 0x64, 0x61, 0x7c, 0xe6, 0xbe, 0x8e, 0xaf, 0x73, 0x34, 0xf4, 0x1f, 0xa7,
+  0x7b, 0x8e, 0xc6, 0xfb, 0xc5, 0xbc, 0x16, 0xf1, 0xad, 0x88, 0x61, 0xc9, 0x4f, 0xb4, 0xd9, 0xac,
+  0x2b, 0x34, 0xed, 0xd6, 0xe2, 0x10, 0x6f, 0x31, 0x6a, 0xe6, 0xc5, 0x46, 0xa6, 0xf9, 0x14, 0x6d,
+  0x67, 0x82, 0x54, 0xca, 0x97, 0x28, 0xfb, 0x58, 0xe7, 0xdc, 0x3c, 0x0b, 0x2a, 0x9e, 0xf4, 0xde,
+  0x39, 0xe1, 0xa5, 0x0b, 0xa2, 0x55, 0xa4, 0x6b, 0x62, 0xe9, 0xf6, 0x22, 0x09, 0xfc, 0xfa, 0xad,
+  0x22, 0xe3, 0xaa, 0x42, 0xf1, 0xfe, 0xda, 0x1b, 0x31, 0xef, 0xbd, 0x89, 0x77, 0x48, 0xde, 0xf3,
+  0x7b, 0xef, 0xb2, 0xc9, 0xbc, 0xa5, 0x25, 0xa7, 0xf2, 0xdc, 0xb3, 0x12, 0x4f, 0x7c, 0xa1, 0xa5,
+  0x5d, 0xe5, 0x35, 0x89, 0xcd, 0x95, 0x4a, 0xb7, 0xf1, 0xc2, 0x3d, 0x2d, 0x75, 0xcf, 0x81, 0xaf,
+  0x59, 0x9c, 0xd2, 0xaa, 0x55, 0x6b, 0x6e, 0x65, 0x84, 0xfe, 0x7a, 0xdf, 0xa8, 0xdc, 0xca, 0x75,
+  0x55, 0x9c, 0xe1, 0x38, 0x77, 0x9f, 0xba, 0xf7, 0xaa, 0x84, 0x95, 0xfd, 0x5a, 0xf0, 0x8b, 0xbb,
+  0x17, 0x6b, 0x51, 0xf2, 0xbd, 0x1c, 0xda, 0xdf, 0x3b, 0x70, 0xe4, 0x81, 0xc7, 0x94, 0x72, 0xef,
+  0x2e, 0x86, 0x95, 0xdd, 0xd5, 0x15, 0x75, 0x45, 0x93, 0x1f, 0x1f, 0x89, 0x58, 0x73, 0xa8, 0xef,
+  0xbe, 0xb6, 0x07, 0x6e, 0xc2, 0x46, 0x23, 0xc7, 0x90, 0x8b, 0xab, 0x6e, 0xb7, 0x3d, 0xb7, 0xb1,
+  0xa6, 0x1e, 0x7d, 0x86, 0xc4, 0xe9, 0xb7, 0xa0, 0xd9, 0x82, 0x25, 0xd9, 0xd4, 0x90, 0xb8, 0xee,
+  0x2c, 0x82, 0x74, 0xa5, 0xee, 0x57, 0xca, 0x42, 0xbf, 0x52, 0x55, 0x4c, 0xa4, 0x56, 0xac, 0xed,
+  0xd2, 0xfc, 0xb3, 0x48, 0xcd, 0xb2, 0x28, 0x8b, 0xe4, 0x2d, 0x8a, 0x8c, 0xcd, 0xd8, 0xac, 0x23,
+  0xb5, 0x9f, 0xb0, 0xa4, 0x5b, 0x66, 0x48, 0x89, 0x47, 0xce, 0x8c, 0x58, 0x67, 0xd2, 0x49, 0x8f,
+  0xaf, 0x68, 0xc6, 0xd0, 0x3b, 0x7e, 0x8b, 0x4c, 0x9f, 0x2c, 0xa5, 0x2d, 0xfd, 0x02, 0x98, 0x51,
+  0x21, 0xa3, 0x77, 0xda, 0x45, 0xaf, 0x7c, 0xbe, 0xc4, 0x94, 0x71, 0xe1, 0xc1, 0xa3, 0x0e, 0xe0,
+  0x65, 0x5f, 0xd4, 0x33, 0xeb, 0x0d, 0x63, 0x1e, 0x02, 0x1c, 0xfb, 0x1f, 0x4a, 0xb8, 0x9b, 0x25,
+  0xd3, 0x84, 0x07, 0xe3, 0x46, 0xb7, 0xcd, 0x7e, 0x9b, 0xa7, 0x68, 0x46, 0xfa, 0xae, 0xd3, 0xd9,
+  0xfd, 0x22, 0x5d, 0xf3, 0xae, 0xfc, 0x07, 0x2e, 0xf6, 0x3b, 0x60, 0x07, 0xf3, 0x6a, 0xe8, 0x22,
+  0xee, 0x68, 0x32, 0xc2, 0x73, 0x47, 0x53, 0x26, 0x9d, 0xa6, 0xd4, 0x3c, 0x72, 0x13, 0xbf, 0x32,
+  0xe2, 0xca, 0x48, 0x47, 0xe7, 0x39, 0x58, 0x54, 0x5a, 0xc5, 0x4d, 0xbd, 0x8d, 0x94, 0xe2, 0x47,
+  0x0d, 0x56, 0x7e, 0xd6, 0xf1, 0x56, 0xee, 0xed, 0x74, 0x37, 0xfb, 0x57, 0x3e, 0xe5, 0x9b, 0xf5,
+  0xd2, 0x61, 0xfd, 0x70, 0x85, 0xad, 0x39, 0xdd, 0x8d, 0x07, 0x01, 0xc1, 0xfa, 0x45, 0x4b, 0x22,
+  0xae, 0x4c, 0x6b, 0x15, 0x5a, 0xfd, 0xba, 0xd5, 0xcd, 0x3c, 0xcf, 0xea, 0x93, 0x70, 0x7a, 0x1f,
+  0xad, 0x05, 0xa3, 0x52, 0x65, 0x04, 0xbb, 0x0c, 0x9a, 0x1a, 0x72, 0x1e, 0xec, 0x3d, 0x37, 0x0a,
+  0xc9, 0x57, 0x2b, 0xfb, 0xd5, 0xca, 0x7e, 0xb5, 0xb2, 0x5f, 0xad, 0xec, 0x57, 0x2b, 0xfb, 0xd5,
+  0xca, 0x7e, 0xb5, 0xb2, 0xff, 0x0f, 0x56, 0xf6, 0x4d, 0x8e, 0xf5, 0x2f, 0x85, 0x7e, 0x84, 0x7b,
+  0xce, 0xf0, 0xf6, 0xe7, 0x8d, 0xef, 0x37, 0xac, 0x61, 0x2a, 0x93, 0x4d, 0x6b, 0xf8, 0x98, 0x54,
+  0x3b, 0x96, 0xe2, 0xb9, 0x0f, 0x7d, 0xac, 0x00, 0xd6, 0x28, 0xe8, 0x6c, 0x82, 0xb9, 0x43, 0x7e,
+  0x1e, 0xcc, 0x7f, 0xad, 0x82, 0xff, 0x84, 0x05, 0x0c, 0xd7, 0x14, 0xaa, 0x5b, 0x0c, 0x87, 0xc8,
+  0x81, 0x17, 0x81, 0x08, 0x2f, 0x7b, 0x65, 0x29, 0xd6, 0x1c, 0xc8, 0xe3, 0x65, 0xc1, 0x36, 0x55,
+  0xf5, 0xaa, 0xc6, 0x74, 0xf9, 0x72, 0xe7, 0x47, 0x30, 0x08, 0x4f, 0xc2, 0xff, 0x02, 0x0c, 0x06,
+  0xe4, 0x17, 0x85, 0xe1, 0x29, 0xcb, 0xe8, 0xbe, 0x68, 0x55, 0xcd, 0x43, 0x5f, 0x0d, 0x5d, 0x65,
+  0x76, 0x31, 0xb8, 0x61, 0x2f, 0x23, 0x61, 0x2f, 0xf9, 0x0b, 0xff, 0x88, 0xa9, 0xde, 0x84, 0xff,
+  0xcc, 0x09, 0x25, 0xeb, 0x1c, 0xcf, 0xb8, 0x91, 0x13, 0xa8, 0xf5, 0x22, 0x9b, 0x7d, 0x66, 0xa5,
+  0x3d, 0x44, 0x0e, 0x2c, 0x7c, 0x1c, 0xfc, 0xbb, 0xe0, 0xe8, 0x9f, 0x54, 0x20, 0xd7, 0x97, 0x9d,
+  0x92, 0xfb, 0xca, 0xec, 0xcf, 0x1d, 0x56, 0x9f, 0xd9, 0x58, 0x13, 0x31, 0x06, 0x3e, 0xb8, 0x18,
+  0x98, 0x58, 0xe1, 0xfd, 0x3d, 0x10, 0x6d, 0x02, 0x1d, 0x2f, 0x06, 0x7e, 0xb0, 0x18, 0x58, 0x48,
+  0x31, 0xb0, 0x60, 0x62, 0xe0, 0xc7, 0x08, 0x1f, 0x42, 0xb8, 0xf8, 0xe0, 0xff, 0xdd, 0x0d, 0xcf,
+  0x2f, 0xc7, 0xf9, 0x71, 0xc1, 0x40, 0x05, 0x0b, 0x13, 0x3c, 0x6b, 0xd4, 0x7e, 0x1b, 0xc3, 0x07,
+  0x0c, 0x7c, 0x50, 0x01, 0xb2, 0x18, 0x14, 0xd5, 0x83, 0x4c, 0x92, 0xdb, 0x35, 0xf9, 0xe2, 0x97,
+  0xc2, 0xf4, 0x8e, 0x4e, 0xd1, 0x45, 0x34, 0x93, 0x04, 0xb9, 0x55, 0x17, 0x1a, 0xab, 0x16, 0xee,
+  0x6d, 0x13, 0x59, 0x4e, 0x47, 0xe4, 0x7f, 0x66, 0xfa, 0xad, 0xe3, 0xd1, 0xdc, 0x23, 0x38, 0xea,
+  0xb7, 0x5f, 0x8c, 0x1f, 0x50, 0xdc, 0xd5, 0x8c, 0xbb, 0xdb, 0x48, 0xee, 0xbf, 0x00, 0x0c, 0xc5,
+  0x57, 0xdf, 0x50, 0x52, 0x00, 0x00
+};
+const size_t ATTICFAN_CSS_LEN = sizeof(ATTICFAN_CSS);
+#define ATTICFAN_CSS_ETAG "\"e67de606b7e55130\""
 
 #if WEBUI_EMIT_STREAM_HELPER
-// NOTE: Assumes you have a global 'ESP8266WebServer server(80);'
-// If your instance is named differently, set WEBUI_EMIT_STREAM_HELPER=0
-// and paste a custom handler in your route file. 
-#include <ESP8266WebServer.h>                                                   
+#include <ESP8266WebServer.h>
 static void handleAtticfanCss() {
-  extern ESP8266WebServer server;                                              
-  server.sendHeader("Connection", "close");                                   
-  server.send_P(200, "text/css",                                               
-                ATTICFAN_CSS, ATTICFAN_CSS_LEN);
+  extern ESP8266WebServer server;
+  server.sendHeader("Vary", "Accept-Encoding");
+  if (server.header("Accept-Encoding").indexOf("gzip") < 0) {
+    server.send(406, "text/plain", "Only available gzip-compressed; send Accept-Encoding: gzip.");
+    return;
+  }
+  server.sendHeader("ETag", ATTICFAN_CSS_ETAG);
+  server.sendHeader("Cache-Control", server.hasArg("v") ? "public, max-age=31536000, immutable" : "no-cache");
+  if (server.header("If-None-Match") == ATTICFAN_CSS_ETAG) {
+    server.send(304);
+    return;
+  }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, "text/css", reinterpret_cast<const char*>(ATTICFAN_CSS), ATTICFAN_CSS_LEN);
 }
 #endif
-
-#define F(string_literal) (FPSTR(PSTR(string_literal)))
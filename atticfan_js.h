@@ -7,1050 +7,852 @@
 #define WEBUI_EMIT_STREAM_HELPER 1
 #endif
 
-#undef F
-const char ATTICFAN_JS[] PROGMEM = R"EMB1(
-// --- System Info Modal Logic ---
-function openSystemInfoModal() {
-  // Show modal
-  document.getElementById('systemInfoModal').style.display = 'block';
-  // Load system info (mock for now)
-  loadSystemInfo();
-}
-
-function closeSystemInfoModal() {
-  document.getElementById('systemInfoModal').style.display = 'none';
-}
-
-function loadSystemInfo() {
-  fetch('/system_info')
-    .then(res => res.json())
-    .then(info => {
-      const fsInfo = info.fs_total !== null ? `${(info.fs_free/1024).toFixed(1)} KB free / ${(info.fs_total/1024).toFixed(1)} KB total` : '--';
-      const uptime = info.uptime_ms !== undefined ? formatUptime(info.uptime_ms) : '--';
-      const html = `
-        <div><strong>Board:</strong> ${info.board || '--'}</div>
-        <div><strong>Firmware:</strong> ${info.firmware || '--'}</div>
-        <div><strong>Filesystem:</strong> ${fsInfo}</div>
-        <div><strong>Memory Free:</strong> ${info.memory_free !== undefined ? info.memory_free + ' bytes' : '--'}</div>
-        <div><strong>Uptime:</strong> ${uptime}</div>
-        <div><strong>IP Address:</strong> ${info.ip || '--'}</div>
-      `;
-      document.getElementById('systemInfoContent').innerHTML = html;
-    })
-    .catch(() => {
-      document.getElementById('systemInfoContent').innerHTML = '<div class="error-message">Unable to load system info.</div>';
-    });
-}
-
-function formatUptime(ms) {
-  const sec = Math.floor(ms / 1000);
-  const days = Math.floor(sec / 86400);
-  const hours = Math.floor((sec % 86400) / 3600);
-  const minutes = Math.floor((sec % 3600) / 60);
-  const seconds = sec % 60;
-  let str = '';
-  if (days > 0) str += days + 'd ';
-  if (hours > 0 || days > 0) str += hours + 'h ';
-  if (minutes > 0 || hours > 0 || days > 0) str += minutes + 'm ';
-  str += seconds + 's';
-  return str.trim();
-}
-
-// Make modal functions global
-window.openSystemInfoModal = openSystemInfoModal;
-window.closeSystemInfoModal = closeSystemInfoModal;
-function renderForecast(container, forecast, isMock = false) {
-  container.innerHTML = "";
-  forecast.forEach((day, index) => {
-    let dayOfWeek, icon, max, min;
-    if (isMock) {
-      dayOfWeek = day.dayOfWeek;
-      icon = day.icon;
-      max = day.max;
-      min = day.min;
-    } else {
-      dayOfWeek = day.dayOfWeek;
-      icon = day.icon;
-      max = day.max;
-      min = day.min;
-    }
-    const dayDiv = document.createElement("div");
-    dayDiv.className = "forecast-day";
-    dayDiv.innerHTML = `
-      <div>${dayOfWeekToString(dayOfWeek, index === 0)}</div>
-      <div class="emoji">${icon}</div>
-      <div><strong>${max}°</strong> / ${min}°</div>
-    `;
-    container.appendChild(dayDiv);
-  });
-}
-// Set to true to enable debug logging
-const DEBUG = false;
-function debugLog(...args) { if (DEBUG) console.log(...args); }
-function debugWarn(...args) { if (DEBUG) console.warn(...args); }
-function debugError(...args) { if (DEBUG) console.error(...args); }
-
-function saveCoreAutomation() {
-  saveConfig();
-}
-
-function saveSmartPreCooling() {
-  saveConfig();
-}
-
-window.saveCoreAutomation = saveCoreAutomation;
-window.saveSmartPreCooling = saveSmartPreCooling;
-async function fetchAndRenderHistory() {
-  const chartMsgEl = document.getElementById('historyChartMsg');
-  const chartEl = document.getElementById('historyChart');
-  debugLog('[AtticFan] Fetching /history.csv...');
-  try {
-    const res = await fetch('/history.csv');
-    if (!res.ok) {
-  debugWarn('[AtticFan] /history.csv not found or not OK:', res.status);
-      throw new Error('No history log found.');
-    }
-  debugLog('[AtticFan] /history.csv fetch OK');
-    const csv = await res.text();
-  debugLog('[AtticFan] /history.csv loaded, length:', csv.length);
-    const lines = csv.trim().split(/\r?\n/);
-    if (lines.length < 2) {
-  debugWarn('[AtticFan] /history.csv has no data rows.');
-      chartMsgEl.textContent = 'No historical data logged yet.';
-      if (historyChart) historyChart.destroy();
-      return;
-    }
-    const header = lines[0].split(',');
-    const timeIdx = header.indexOf('timestamp');
-    const atticIdx = header.indexOf('attic_temp');
-    if (timeIdx < 0 || atticIdx < 0) {
-  debugError('[AtticFan] /history.csv missing required columns.');
-      chartMsgEl.textContent = 'CSV format error: missing columns.';
-      return;
-    }
-    const outdoorIdx = header.indexOf('outdoor_temp');
-    const humidityIdx = header.indexOf('humidity');
-    const fanOnIdx = header.indexOf('fan_on');
-    const labels = [];
-    const attic = [];
-    const outdoor = [];
-    const humidity = [];
-    const fanOn = [];
-    for (let i = 1; i < lines.length; ++i) {
-      const row = lines[i].split(',');
-      const ts = row[timeIdx];
-      if (ts) {
-        labels.push(ts.substring(5, 16).replace('T', ' '));
-      } else {
-        labels.push('');
-      }
-      attic.push(parseFloat(row[atticIdx]));
-      if (outdoorIdx >= 0) outdoor.push(parseFloat(row[outdoorIdx]));
-      if (humidityIdx >= 0) humidity.push(parseFloat(row[humidityIdx]));
-      if (fanOnIdx >= 0) fanOn.push(parseInt(row[fanOnIdx], 10));
-    }
-    const N = 100;
-    const start = labels.length > N ? labels.length - N : 0;
-    const chartLabels = labels.slice(start);
-    const chartAttic = attic.slice(start);
-    const chartOutdoor = outdoorIdx >= 0 ? outdoor.slice(start) : undefined;
-    const chartHumidity = humidityIdx >= 0 ? humidity.slice(start) : undefined;
-    const chartFanOn = fanOnIdx >= 0 ? fanOn.slice(start) : undefined;
-    const datasets = [
-      { label: 'Attic Temp (°F)', data: chartAttic, borderColor: '#e67e22', backgroundColor: 'rgba(230,126,34,0.1)', yAxisID: 'y', tension: 0.2 },
-      { label: 'Outdoor Temp (°F)', data: chartOutdoor, borderColor: '#2980b9', backgroundColor: 'rgba(41,128,185,0.1)', yAxisID: 'y', tension: 0.2, hidden: chartOutdoor === undefined }
-    ];
-    if (chartHumidity) datasets.push({ label: 'Attic Humidity (%)', data: chartHumidity, borderColor: '#27ae60', backgroundColor: 'rgba(39,174,96,0.1)', yAxisID: 'y2', tension: 0.2, hidden: chartHumidity === undefined });
-    if (chartFanOn) datasets.push({ label: 'Fan On', data: chartFanOn, borderColor: '#9b59b6', backgroundColor: 'rgba(155,89,182,0.2)', yAxisID: 'y3', tension: 0.2, stepped: true, fill: true, hidden: chartFanOn === undefined });
-    const ctx = chartEl.getContext('2d');
-    if (historyChart) historyChart.destroy();
-  debugLog('[AtticFan] Chart rendered with', chartLabels.length, 'points.');
-    historyChart = new Chart(ctx, {
-      type: 'line',
-      data: { labels: chartLabels, datasets: datasets },
-      options: {
-        responsive: true,
-        maintainAspectRatio: false,
-        interaction: { mode: 'index', intersect: false },
-        plugins: {
-          legend: { position: 'top' },
-          title: { display: false },
-          tooltip: { enabled: true }
-        },
-        scales: {
-          y: {
-            type: 'linear',
-            display: true,
-            position: 'left',
-            title: { display: true, text: 'Temperature (°F)' }
-          },
-          y2: { type: 'linear', display: chartHumidity !== undefined, position: 'right', title: { display: true, text: 'Humidity (%)' }, grid: { drawOnChartArea: false }, min: 0, max: 100 },
-          y3: { type: 'linear', display: false, position: 'right', min: -0.5, max: 1.5 }
-        }
-      }
-    });
-    chartMsgEl.textContent = '';
-  } catch (err) {
-  debugError('[AtticFan] Error loading /history.csv:', err);
-    chartMsgEl.textContent = 'No historical data available.';
-    if (historyChart) historyChart.destroy();
-  }
-}
-
-(() => {
-  const isLocalDev = location.hostname === "" || location.hostname === "localhost" || location.hostname === "127.0.0.1" || location.protocol === "file:";
-  if (!isLocalDev) return;
-  console.info("ESP not detected, running in local test mode.");
-  let __fanOn=false, __fanMode='AUTO', __timerStart=0, __timerEnd=0, __postAction='stay_manual';
-  const mockConfig={fanOnTemp:95,fanDeltaTemp:2,fanHysteresis:2,preCoolTriggerTemp:78,preCoolTempOffset:2,preCoolingEnabled:false,onboardLedEnabled:true,dailyRestartEnabled:false,mqttEnabled:false,mqttDiscoveryEnabled:false,testModeEnabled:false,restartHour:3,restartMinute:0};
-  const now=Date.now(), pad=n=>(n<10?'0':'')+n, fmt=t=>{const d=new Date(t);return `${d.getFullYear()}-${pad(d.getMonth()+1)}-${pad(d.getDate())} ${pad(d.getHours())}:${pad(d.getMinutes())}:${pad(d.getSeconds())}`};
-  const rows=[]; for(let i=0;i<96;i++){const t=now-(95-i)*15*60*1000; rows.push(`${fmt(t)},95,92,40,0`);} const mockHistory="timestamp,attic_temp,outdoor_temp,attic_humidity,fan_on\n"+rows.join("\n");
-  const mockWeather={currentIcon:"☀️",currentTemp:72.4,currentHumidity:53,forecast:[{dayOfWeek:(new Date()).getDay(),icon:"⛅️",max:83,min:60},{dayOfWeek:(new Date(Date.now()+86400000)).getDay(),icon:"☀️",max:88,min:60},{dayOfWeek:(new Date(Date.now()+2*86400000)).getDay(),icon:"☀️",max:91,min:62}]};
-  const getMockStatus = () => {
-    const now=Date.now(),inDelay=(__timerStart>0&&now<__timerStart&&__timerEnd>0),inRun=(__timerStart>0&&now>=__timerStart&&now<__timerEnd),remaining=Math.max(0,Math.floor(((__timerEnd>0?__timerEnd:0)-now)/1000));
-    const fanOnNow=inRun?true:__fanOn;
-    return {
-      firmwareVersion:"v0.0.0-demo",atticTemp:95,atticHumidity:40,outdoorTemp:92,fanOn:fanOnNow,fanMode:__fanMode,timerActive:(__timerEnd>0&&(inDelay||inRun)),timerRemainingSec:remaining,
-      // --- Added for indoor sensor testing ---
-      indoorSensorsEnabled: true,
-      indoorSensorCount: 2,
-      avgIndoorTemp: '72.2',
-      avgIndoorHumidity: '45.3'
-    };
-  }
-  const mockIndoorSensors = {
-      "sensors": [
-          { "sensorId": "living_room_01", "name": "Living Room", "temperature": "72.5", "humidity": "45.1", "ipAddress": "192.168.1.150", "secondsSinceUpdate": 25 },
-          { "sensorId": "bedroom_01", "name": "Master Bedroom", "temperature": "70.2", "humidity": "48.9", "ipAddress": "192.168.1.151", "secondsSinceUpdate": 45 },
-          { "sensorId": "office_01", "name": "Office", "temperature": "73.8", "humidity": "42.0", "ipAddress": "192.168.1.152", "secondsSinceUpdate": 310 }
-      ], "count": 3, "averageTemperature": "72.2", "averageHumidity": "45.3"
-  };
-  const F=window.fetch.bind(window);
-  window.fetch = (input,init) => {
-    try {
-      const method = (init && (init.method || 'GET').toUpperCase()) || 'GET';
-      const raw = (typeof input === 'string') ? input : input.url;
-      const u = new URL(raw, location.origin);
-      const full = u.pathname + (u.search || "");
-      if (/^\/fan\?state=ping\b/.test(full)) return Promise.resolve(new Response('', { status: 200 }));
-      if (/^\/fan\?state=on\b/.test(full)) { __fanOn = true; __fanMode = 'MANUAL'; return Promise.resolve(new Response('', { status: 200 })); }
-      if (/^\/fan\?state=off\b/.test(full)) { __fanOn = false; __fanMode = 'MANUAL'; return Promise.resolve(new Response('', { status: 200 })); }
-      if (/^\/fan\?state=auto\b/.test(full)) { __fanMode = 'AUTO'; return Promise.resolve(new Response('', { status: 200 })); }
-      if (full === '/status') return Promise.resolve(new Response(JSON.stringify(getMockStatus()), { status: 200, headers: { 'Content-Type': 'application/json' } }));
-      if (full === '/indoor_sensors') return Promise.resolve(new Response(JSON.stringify(mockIndoorSensors), { status: 200, headers: { 'Content-Type': 'application/json' } }));
-      if (full === '/config' && method === 'GET') return Promise.resolve(new Response(JSON.stringify(mockConfig), { status: 200, headers: { 'Content-Type': 'application/json' } }));
-      if (full === '/config' && method === 'POST') {
-        try {
-          const body = init && typeof init.body === 'string' ? JSON.parse(init.body) : {};
-          Object.assign(mockConfig, body || {});
-          return Promise.resolve(new Response('Configuration saved!', { status: 200 }));
-        } catch (e) {
-          return Promise.resolve(new Response('Invalid JSON', { status: 400 }));
-        }
-      }
-      if (full === '/history.csv' && method === 'GET') return Promise.resolve(new Response(mockHistory, { status: 200, headers: { 'Content-Type': 'text/csv' } }));
-      if (u.pathname === '/fan' && method === 'POST') {
-        try {
-          const body = init && typeof init.body === 'string' ? JSON.parse(init.body) : {};
-          if (body && body.action === 'start_timed') {
-            const delayMs = (parseInt(body.delay || 0, 10) || 0) * 60 * 1000,
-              durationMs = (parseInt(body.duration || 0, 10) || 0) * 60 * 1000;
-            __postAction = (body.postAction || 'stay_manual');
-            __fanMode = 'MANUAL';
-            const t0 = Date.now();
-            __timerStart = t0 + delayMs;
-            __timerEnd = __timerStart + durationMs;
-            if (delayMs === 0) { __fanOn = true; }
-            try { if (window.updateSensorData) setTimeout(window.updateSensorData, 50); } catch (e) { }
-            if (delayMs > 0) try { if (window.updateSensorData) setTimeout(window.updateSensorData, delayMs + 250); } catch (e) { }
-            clearInterval(window.__timerTick);
-            window.__timerTick = setInterval(() => {
-              const nowT = Date.now();
-              if (__timerStart && nowT >= __timerStart && nowT < __timerEnd) __fanOn = true;
-              if (__timerEnd && nowT >= __timerEnd) {
-                clearInterval(window.__timerTick);
-                __timerStart = 0;
-                __timerEnd = 0;
-                if (__postAction === 'go_auto') { __fanMode = 'AUTO'; __fanOn = false; } else { __fanMode = 'MANUAL'; __fanOn = false; }
-                try { if (window.updateSensorData) setTimeout(window.updateSensorData, 50); } catch (e) { }
-              }
-            }, 1000);
-            return Promise.resolve(new Response('', { status: 200 }));
-          }
-        } catch (e) { }
-        return Promise.resolve(new Response('', { status: 200 }));
-      }
-      return F(input, init);
-    } catch (e) {
-      return F(input, init);
-    }
-  };
-})();
-
-let testMode = false;
-let isInteractingWithSlider = false;
-let historyChart;
-let currentFanState = false;
-const fanIconEl = document.getElementById("fan-icon");
-const fanKeyframes = `
-  @keyframes spin {
-    from { transform: rotate(0deg); }
-    to { transform: rotate(360deg); }
-  }`;
-const styleSheet = document.createElement("style");
-styleSheet.innerText = fanKeyframes;
-document.head.appendChild(styleSheet);
-
-function buildConfigPayload(fields) {
-  const payload = {};
-  fields.forEach(field => {
-    const el = document.getElementById(field.id);
-    if (!el) return;
-    let value = el.type === 'checkbox' ? el.checked : el.value;
-    if (field.parse) value = field.parse(value);
-    payload[field.key] = value;
-  });
-  return payload;
-}
-
-let allIndoorSensors = []; // Cache for modal
-function updateSensorData() {
-  if (testMode) {
-    return;
-  }
-  fetch("/status")
-    .then(res => res.json())
-    .then(data => {
-      document.getElementById("firmwareVersion").textContent = data.firmwareVersion;
-      document.getElementById("atticTemp").textContent = data.atticTemp;
-      document.getElementById("atticHumidity").textContent = data.atticHumidity;
-      document.getElementById("outdoorTemp").textContent = data.outdoorTemp;
-      const fanOn = data.fanOn;
-      currentFanState = fanOn;
-      updateFanVisual(fanOn);
-      document.getElementById("currentMode").textContent = data.fanMode;
-      const timerStatusEl = document.getElementById('timerStatus');
-      if (data.timerActive) {
-        const minutes = Math.floor(data.timerRemainingSec / 60);
-        const seconds = data.timerRemainingSec % 60;
-        const remainingTime = `${minutes}m ${String(seconds).padStart(2, '0')}s`;
-        if (data.timerMode === 'delay') {
-          timerStatusEl.innerHTML = `Timer starts in: ${remainingTime}`;
-        } else {
-          timerStatusEl.innerHTML = `Timer active for: ${remainingTime}`;
-        }
-        timerStatusEl.style.display = 'block'; // Make it visible
-        timerStatusEl.style.textAlign = 'center'; // Center the text
-        timerStatusEl.style.marginTop = '8px'; // Add some space above it
-      } else {
-        timerStatusEl.style.display = 'none'; // Hide it
-      }
-      if (data.testModeEnabled) {
-        document.getElementById('test-panel').style.display = 'block';
-        const atticSlider = document.getElementById('simulatedAtticTemp');
-        const outdoorSlider = document.getElementById('simulatedOutdoorTemp');
-        if (!isInteractingWithSlider) {
-          atticSlider.value = data.simulatedAtticTemp;
-          outdoorSlider.value = data.simulatedOutdoorTemp;
-        }
-        updateTempDisplay('attic-temp-val', atticSlider.value);
-        updateTempDisplay('outdoor-temp-val', outdoorSlider.value);
-      }
-      setMode(data.fanMode, false); // Update UI without sending a command back
-      if (data.fanMode === 'MANUAL') {
-  const manualOnBtn = document.getElementById("manualOnBtn");
-  const manualOffBtn = document.getElementById("manualOffBtn");
-  if (manualOnBtn) manualOnBtn.disabled = fanOn;
-  if (manualOffBtn) manualOffBtn.disabled = !fanOn;
-      } else {
-        // If not in manual mode, disable all manual buttons
-        if (manualOnBtn) manualOnBtn.disabled = true;
-        if (manualOffBtn) manualOffBtn.disabled = true;
-      }
-    })
-    .catch(() => {
-      document.getElementById("firmwareVersion").textContent = "--";
-      document.getElementById("atticTemp").textContent = "--";
-      document.getElementById("atticHumidity").textContent = "--";
-      document.getElementById("outdoorTemp").textContent = "--";
-      document.getElementById("currentMode").textContent = "--";
-    });
-
-  // Fetch and handle indoor sensor display logic
-  fetch("/indoor_sensors")
-    .then(res => res.json())
-    .then(data => {
-      allIndoorSensors = data.sensors || []; // Cache for modal
-      const count = data.count || 0;
-
-      const avgDisplay = document.getElementById('indoorSensorDisplay');
-      const sensor1Display = document.getElementById('indoorSensor1');
-      const sensor2Display = document.getElementById('indoorSensor2');
+// 49164 bytes, gzipped to 13178
+const unsigned char ATTICFAN_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0x5d, 0x73, 0x1b, 0x49,
+  0x92, 0xd8, 0x3b, 0x7f, 0x45, 0x0b, 0x3b, 0xab, 0x46, 0x4b, 0x60, 0x13, 0x84, 0x44, 0x89, 0x02,
+  0x04, 0xc9, 0xd4, 0x07, 0x57, 0xf4, 0x8a, 0xa2, 0x42, 0xe4, 0xec, 0xdc, 0x85, 0x86, 0x96, 0x9a,
+  0xe8, 0x06, 0xd9, 0x2b, 0xa0, 0x1b, 0xdb, 0xdd, 0x20, 0x87, 0xcb, 0x41, 0x84, 0x1f, 0xbc, 0x71,
+  0x7e, 0xb8, 0x08, 0x47, 0xd8, 0x2f, 0x8e, 0xd8, 0x70, 0xf8, 0xed, 0xce, 0x11, 0x7e, 0xd9, 0x47,
+  0x3f, 0xef, 0x4f, 0xb9, 0x3f, 0x60, 0xff, 0x04, 0xe7, 0x47, 0x7d, 0x76, 0x37, 0x1a, 0xa0, 0x66,
+  0x76, 0x6f, 0x1d, 0xe1, 0x99, 0x89, 0x01, 0xbb, 0x2a, 0x2b, 0x2b, 0xab, 0x2a, 0x2b, 0x2b, 0x2b,
+  0x2b, 0x2b, 0x6b, 0x6b, 0xcb, 0xd9, 0xdc, 0xdc, 0x74, 0x8e, 0xaf, 0xf3, 0x22, 0x9a, 0x3a, 0x07,
+  0xc9, 0x38, 0x75, 0x0e, 0xd3, 0x30, 0x98, 0x38, 0x6f, 0xd3, 0xf3, 0x78, 0x84, 0x79, 0x1b, 0xe3,
+  0x79, 0x32, 0x2a, 0xe2, 0x34, 0x71, 0xd2, 0x59, 0x94, 0x30, 0x20, 0xc2, 0x11, 0x58, 0xdb, 0x73,
+  0x6e, 0x36, 0x1c, 0x67, 0x6b, 0xcb, 0x39, 0xbe, 0x48, 0xaf, 0x9c, 0x29, 0xa6, 0xc1, 0x77, 0x98,
+  0x8e, 0xe6, 0xd3, 0x28, 0x29, 0xfc, 0xf3, 0xa8, 0x78, 0x3d, 0x89, 0xf0, 0xcf, 0x17, 0xd7, 0x07,
+  0x61, 0xdb, 0xcd, 0xed, 0xe2, 0xae, 0xe7, 0xe7, 0xc5, 0xf5, 0x24, 0xf2, 0xc3, 0x38, 0x9f, 0x4d,
+  0x82, 0x6b, 0x67, 0xe8, 0xb8, 0x67, 0x93, 0x74, 0xf4, 0xc5, 0x1d, 0x30, 0xd6, 0xb7, 0x69, 0x10,
+  0x3a, 0x5c, 0xc8, 0x89, 0x91, 0xb8, 0xf6, 0x14, 0x72, 0x9d, 0x71, 0x9a, 0x39, 0x49, 0x7a, 0xe5,
+  0x01, 0xd0, 0x04, 0x20, 0x34, 0x51, 0x6d, 0x6f, 0xb0, 0xb1, 0xd8, 0xd0, 0x24, 0x8f, 0x26, 0x69,
+  0x1e, 0xd5, 0xd3, 0xfc, 0x53, 0x68, 0x4c, 0xd2, 0x24, 0x72, 0xed, 0x9a, 0xca, 0x74, 0x50, 0x1d,
+  0xe3, 0xa8, 0x18, 0x5d, 0xb4, 0xdd, 0x2d, 0x46, 0xf9, 0x09, 0x5b, 0xe0, 0x22, 0xd1, 0x8e, 0xe3,
+  0x17, 0x17, 0x51, 0xd2, 0xce, 0xa2, 0xdc, 0x19, 0x3e, 0x73, 0xe0, 0xc7, 0xff, 0x6d, 0x9e, 0x26,
+  0x6d, 0xcf, 0xcc, 0xa4, 0xf6, 0x42, 0xee, 0x0d, 0xa5, 0x39, 0xce, 0x28, 0x4d, 0xf2, 0xc2, 0x19,
+  0xe7, 0x34, 0x48, 0x43, 0xea, 0x0e, 0x7f, 0x9c, 0x7f, 0x2a, 0xd2, 0x02, 0x86, 0xeb, 0xce, 0x70,
+  0xe8, 0x24, 0xf3, 0xc9, 0xc4, 0x79, 0xee, 0x7c, 0xfe, 0xe6, 0xa6, 0x2d, 0x33, 0xc7, 0x59, 0x14,
+  0x6d, 0x6d, 0x77, 0x7b, 0x0f, 0x3d, 0xbf, 0x48, 0xf7, 0xe3, 0x1f, 0xa2, 0xb0, 0xbd, 0xed, 0x2d,
+  0x9c, 0x5f, 0xbf, 0x70, 0x30, 0xc7, 0xd9, 0x72, 0x0c, 0x58, 0x42, 0x54, 0x0f, 0x4c, 0x59, 0x9f,
+  0x9d, 0xbe, 0xe3, 0x6e, 0x6e, 0xd2, 0xd0, 0x68, 0x7a, 0xe6, 0xb3, 0x22, 0x9e, 0x46, 0x92, 0x1e,
+  0xfe, 0xfa, 0x34, 0xcd, 0x89, 0xa0, 0x79, 0x12, 0x46, 0xe3, 0x38, 0x89, 0x42, 0xa0, 0x0a, 0x86,
+  0x6c, 0x1a, 0x14, 0xdf, 0x52, 0x7e, 0xdb, 0x86, 0xf5, 0x6a, 0x11, 0x5f, 0x14, 0xd3, 0x09, 0xa0,
+  0xfd, 0x2c, 0x12, 0x1d, 0xe7, 0x69, 0x18, 0x5f, 0x3e, 0x7b, 0x9a, 0x17, 0x59, 0x9a, 0x9c, 0x3f,
+  0x7b, 0x91, 0x06, 0x59, 0xd8, 0x7f, 0xba, 0x25, 0x3e, 0xa1, 0x1d, 0x84, 0xf3, 0x0c, 0x93, 0x9d,
+  0x1f, 0x7f, 0x24, 0x7c, 0x8b, 0xa7, 0x5b, 0x58, 0xa4, 0x1e, 0xc1, 0x7e, 0x9c, 0x4d, 0xaf, 0x82,
+  0x2c, 0xaa, 0xe2, 0x18, 0x8b, 0x9c, 0x35, 0xd1, 0x4c, 0x22, 0x1e, 0x5d, 0x0b, 0x11, 0x8f, 0x52,
+  0x63, 0xc9, 0xc3, 0x68, 0x9a, 0x66, 0xd7, 0xce, 0x3e, 0x8c, 0x43, 0x95, 0x86, 0x29, 0x65, 0xd2,
+  0xf0, 0x55, 0x7a, 0xb2, 0x02, 0x70, 0xdf, 0x71, 0x9d, 0xb3, 0xeb, 0x22, 0xca, 0x5d, 0xd1, 0x91,
+  0x8d, 0xf5, 0xf2, 0x10, 0x58, 0x55, 0xf2, 0x48, 0x34, 0x96, 0x3a, 0x78, 0xef, 0xec, 0x85, 0x21,
+  0x30, 0x6a, 0x5e, 0x25, 0x36, 0x9e, 0xd5, 0x77, 0xd5, 0x67, 0x39, 0xa0, 0x6b, 0x4c, 0xb5, 0x97,
+  0x69, 0x52, 0x40, 0x32, 0x4c, 0xb6, 0x38, 0x49, 0xa2, 0xec, 0xcd, 0xc9, 0xe1, 0x5b, 0x18, 0x7c,
+  0xe4, 0x01, 0x46, 0xb2, 0x10, 0x33, 0x63, 0x14, 0xe0, 0x8c, 0x82, 0xe9, 0x65, 0x4c, 0x8c, 0xaf,
+  0x46, 0xef, 0x62, 0x13, 0x41, 0x46, 0x04, 0x79, 0x3e, 0x6c, 0x45, 0x59, 0x96, 0x66, 0x9b, 0x53,
+  0x68, 0x61, 0x70, 0x1e, 0xb5, 0x9e, 0x7d, 0x9b, 0x04, 0x67, 0x93, 0x08, 0x38, 0x9f, 0x66, 0xb6,
+  0x29, 0x83, 0x7c, 0x6e, 0xa4, 0x2b, 0x09, 0xb3, 0xe5, 0x80, 0xc5, 0xe7, 0xc8, 0xdb, 0x48, 0x25,
+  0x73, 0x74, 0x1e, 0x8d, 0xa0, 0xd2, 0xc3, 0xa0, 0xb8, 0xf0, 0xc7, 0x93, 0x34, 0xcd, 0x20, 0x1b,
+  0x66, 0xe0, 0x76, 0xb7, 0xdb, 0xf5, 0x06, 0x0a, 0x28, 0x0c, 0xae, 0x73, 0x1b, 0x0a, 0x8b, 0x6d,
+  0x39, 0xbb, 0x8f, 0x1e, 0x5a, 0x70, 0x17, 0xe9, 0x3c, 0x2b, 0x01, 0x12, 0xe4, 0x2f, 0x05, 0x24,
+  0x14, 0x79, 0xf0, 0xc8, 0x2a, 0x31, 0x8d, 0x93, 0x79, 0x11, 0xd5, 0x97, 0x21, 0x50, 0x28, 0xf2,
+  0xc8, 0x2c, 0x00, 0x59, 0x69, 0x12, 0x62, 0x01, 0x06, 0x7a, 0xd4, 0xc5, 0xbc, 0x49, 0x04, 0x39,
+  0x45, 0x86, 0xdd, 0x47, 0x5d, 0x10, 0x8f, 0x9d, 0x36, 0x11, 0xfd, 0xcc, 0x01, 0x14, 0x98, 0x73,
+  0x7f, 0xc8, 0xad, 0x00, 0xbe, 0x0c, 0x1d, 0x05, 0xc3, 0x04, 0x03, 0x10, 0x32, 0x4b, 0xa5, 0x00,
+  0xe7, 0x42, 0x89, 0x0b, 0x5d, 0x42, 0x12, 0x2c, 0xca, 0x34, 0x23, 0x90, 0xc0, 0x80, 0x62, 0xca,
+  0x28, 0x44, 0x86, 0x6c, 0x05, 0x64, 0xe4, 0x94, 0x9e, 0x45, 0xc5, 0x3c, 0x4b, 0x30, 0xdb, 0x2f,
+  0xb2, 0x78, 0x2a, 0x96, 0x0c, 0x58, 0x6c, 0x0e, 0x83, 0x2f, 0x11, 0x2f, 0x61, 0x8e, 0x1c, 0xce,
+  0xdc, 0x39, 0x9f, 0xa4, 0x67, 0xb0, 0xa6, 0x5d, 0xc5, 0x49, 0x98, 0x5e, 0xf9, 0x35, 0x4b, 0x20,
+  0x74, 0x44, 0x4d, 0xea, 0x40, 0x96, 0xa8, 0x5b, 0x81, 0xa0, 0x48, 0x5d, 0xf2, 0x40, 0x73, 0x51,
+  0x16, 0xc1, 0x84, 0xcf, 0xf6, 0xd3, 0x2c, 0x1a, 0x05, 0x79, 0xd1, 0x86, 0x16, 0x14, 0x01, 0x4c,
+  0xff, 0xac, 0x83, 0xfc, 0x45, 0x69, 0x1d, 0x27, 0xce, 0x0f, 0x71, 0x2d, 0x1c, 0x3a, 0xe3, 0x60,
+  0x92, 0x47, 0x8a, 0xd1, 0x18, 0xd0, 0xe2, 0xf3, 0x56, 0x0b, 0xdb, 0x2d, 0x4b, 0xfa, 0xf0, 0xc7,
+  0xeb, 0x00, 0x67, 0x11, 0x74, 0x22, 0xa0, 0x81, 0x9a, 0x7e, 0x30, 0xe6, 0x13, 0x8e, 0x2f, 0x64,
+  0x1c, 0x8d, 0xbf, 0x8b, 0xa2, 0x2f, 0x90, 0x0d, 0x28, 0x3b, 0xce, 0x34, 0xf8, 0xa1, 0x83, 0x5d,
+  0xcc, 0x3c, 0x8f, 0x83, 0xc3, 0xb5, 0x7b, 0x7a, 0x12, 0xca, 0x22, 0x0e, 0x8d, 0xbe, 0xaf, 0xbe,
+  0xa5, 0x10, 0x40, 0x44, 0x22, 0x0f, 0xff, 0x94, 0xc9, 0x80, 0x59, 0xa4, 0xc2, 0x5f, 0x2a, 0x31,
+  0x96, 0xa0, 0xaa, 0xce, 0x85, 0x13, 0x41, 0x2b, 0xff, 0x7a, 0xd5, 0x6d, 0xe8, 0x95, 0x08, 0x32,
+  0x5e, 0x81, 0x9c, 0x18, 0x6a, 0x41, 0x33, 0xca, 0xa2, 0xa0, 0x88, 0x84, 0xac, 0x69, 0xb7, 0x40,
+  0x1c, 0xb4, 0x3c, 0x2e, 0xc7, 0xb0, 0x3e, 0xc9, 0x94, 0x77, 0x01, 0x2d, 0x8c, 0x2d, 0xd9, 0xf1,
+  0x9b, 0x90, 0xd9, 0xb2, 0xc0, 0xcc, 0x41, 0x92, 0x0b, 0x1d, 0x89, 0xdd, 0x6f, 0x6e, 0x54, 0x83,
+  0x4e, 0xd2, 0x63, 0x60, 0xd3, 0xe4, 0xbc, 0x6d, 0x0e, 0x0a, 0x8e, 0x99, 0x33, 0x84, 0x85, 0xa1,
+  0xeb, 0xd9, 0x32, 0xd7, 0x92, 0x68, 0xd3, 0xf4, 0xb7, 0x71, 0x0b, 0x70, 0x61, 0x07, 0x54, 0xc1,
+  0x94, 0x6c, 0xff, 0xe6, 0x06, 0xfa, 0x62, 0xf1, 0xe7, 0x3f, 0x69, 0xc1, 0x8e, 0x7a, 0x01, 0x74,
+  0x05, 0xa5, 0xa9, 0x52, 0x42, 0x9c, 0x6b, 0x16, 0x0b, 0x66, 0xc0, 0xf7, 0xe1, 0xcb, 0x8b, 0x78,
+  0x12, 0xb6, 0xb9, 0x41, 0xd4, 0x09, 0x2c, 0x11, 0x51, 0x25, 0x04, 0x4e, 0x02, 0xf9, 0x59, 0x64,
+  0x73, 0x92, 0xa3, 0x11, 0x4b, 0xd4, 0x30, 0x3a, 0x9b, 0x9f, 0x83, 0x50, 0x3d, 0x3f, 0x87, 0x46,
+  0x6d, 0x70, 0x0f, 0xbf, 0x7a, 0xfd, 0xe2, 0xdb, 0x5f, 0x49, 0x4e, 0x36, 0xa6, 0x01, 0xc1, 0x82,
+  0x26, 0xda, 0xf6, 0x7d, 0x3f, 0xc8, 0xce, 0x51, 0x9a, 0x12, 0xf3, 0x11, 0xbc, 0x47, 0xc3, 0x93,
+  0x82, 0x66, 0x36, 0x31, 0x20, 0x06, 0x30, 0x74, 0x76, 0xf9, 0xef, 0x82, 0x2c, 0x59, 0x81, 0xe0,
+  0xca, 0x04, 0xa9, 0x62, 0x78, 0x8d, 0x4b, 0xc3, 0x0a, 0x14, 0x91, 0x05, 0x83, 0x38, 0x34, 0x92,
+  0x3c, 0xb8, 0x8c, 0x5e, 0x02, 0x13, 0xec, 0xcd, 0x8b, 0x14, 0x16, 0x87, 0x18, 0x35, 0x3d, 0xe2,
+  0x64, 0xce, 0x48, 0xc6, 0xf1, 0x79, 0x59, 0x71, 0xc5, 0x9c, 0xe3, 0x69, 0x90, 0x15, 0xef, 0x33,
+  0x80, 0x48, 0x27, 0xc8, 0x00, 0x4b, 0xca, 0x08, 0x41, 0x53, 0xad, 0x04, 0x05, 0x77, 0x25, 0x71,
+  0x60, 0xc2, 0x97, 0x6a, 0x10, 0x05, 0x4a, 0xa9, 0x03, 0x31, 0x48, 0x6f, 0x0e, 0x8e, 0x4f, 0x8e,
+  0x3e, 0xfc, 0xfd, 0xa7, 0xef, 0x0e, 0xde, 0xbd, 0x3a, 0xfa, 0xee, 0xd3, 0xf1, 0xeb, 0x97, 0x00,
+  0xdf, 0x7b, 0xe8, 0xdc, 0x83, 0x85, 0x81, 0xfe, 0x57, 0x06, 0x3c, 0xdc, 0xfb, 0xbb, 0x4f, 0xef,
+  0x8f, 0x0e, 0xde, 0x9d, 0x1c, 0x03, 0xe0, 0x83, 0x2e, 0xe4, 0xa3, 0x6c, 0xb9, 0x88, 0xf3, 0x02,
+  0x54, 0x97, 0x0f, 0xe9, 0x15, 0xae, 0x2c, 0x1f, 0x4f, 0x07, 0x42, 0xdd, 0x00, 0x86, 0xa1, 0xb4,
+  0xd1, 0x3c, 0x03, 0xe9, 0x57, 0x4c, 0xae, 0x9d, 0xd1, 0x05, 0xd0, 0x11, 0x85, 0x1d, 0x27, 0x9d,
+  0x84, 0x11, 0xaa, 0xbe, 0x71, 0x96, 0x17, 0x26, 0x8e, 0x97, 0xb0, 0x20, 0xa4, 0xb8, 0x12, 0xa1,
+  0xe6, 0x3b, 0x60, 0x1c, 0x7f, 0xb7, 0xf9, 0x86, 0x33, 0x37, 0x45, 0x6e, 0x3a, 0x76, 0x40, 0x9d,
+  0x76, 0x60, 0x4a, 0x14, 0xa8, 0x68, 0xcf, 0x80, 0xc4, 0x68, 0xc0, 0xba, 0x32, 0x4c, 0xcc, 0x11,
+  0x2c, 0x19, 0x01, 0x88, 0x7b, 0xf8, 0xc2, 0x75, 0xde, 0xc4, 0xfe, 0xba, 0x08, 0xce, 0x25, 0x6e,
+  0x5a, 0x1f, 0xde, 0x07, 0x59, 0x0e, 0xe0, 0x5b, 0x22, 0xdf, 0x79, 0x79, 0xfc, 0x1b, 0x98, 0x89,
+  0xc0, 0xd9, 0x19, 0x6c, 0x7d, 0xd2, 0xb3, 0xdf, 0x46, 0xa3, 0x22, 0x1f, 0x40, 0x65, 0x19, 0x36,
+  0x23, 0xe6, 0x6a, 0xb3, 0xe8, 0x77, 0xf3, 0x38, 0x03, 0xbd, 0x6d, 0x94, 0x4e, 0xe6, 0x53, 0x58,
+  0x4f, 0x50, 0xb1, 0x9c, 0xc6, 0x79, 0x0e, 0x1d, 0xeb, 0xeb, 0xe1, 0x9e, 0x21, 0x6a, 0x41, 0xf8,
+  0xcb, 0xfc, 0xb2, 0x3d, 0xca, 0x2f, 0x4d, 0xcd, 0x01, 0x86, 0x81, 0x16, 0x6e, 0x48, 0x16, 0x6b,
+  0x96, 0x0f, 0x7b, 0x91, 0xb8, 0x68, 0x6f, 0x7d, 0x9f, 0x3d, 0xff, 0x3e, 0xd9, 0x32, 0xf5, 0x82,
+  0x28, 0x80, 0x95, 0x03, 0x60, 0xa9, 0xcc, 0xc7, 0xee, 0xa9, 0x80, 0x74, 0x3b, 0xae, 0x01, 0x85,
+  0xda, 0xc9, 0x41, 0x88, 0xa2, 0x90, 0xe1, 0x7d, 0x92, 0x28, 0x47, 0xe3, 0xb6, 0x8b, 0x39, 0x79,
+  0x11, 0x4c, 0x67, 0x26, 0x78, 0x50, 0x14, 0xf1, 0xa8, 0x1e, 0x9e, 0xb2, 0x3e, 0xc1, 0x32, 0x26,
+  0x0a, 0xe0, 0xd4, 0x90, 0xd8, 0x9f, 0xf2, 0x5a, 0xad, 0x4a, 0x3f, 0xc5, 0xf5, 0x9a, 0xfa, 0xc7,
+  0x49, 0xa2, 0x2b, 0x87, 0xa7, 0x95, 0x8b, 0xdd, 0xc8, 0x5a, 0x93, 0x43, 0x93, 0xa8, 0x2f, 0xfb,
+  0x47, 0xf6, 0x99, 0x6f, 0x92, 0x92, 0xce, 0x8b, 0x10, 0x14, 0x97, 0x7a, 0x62, 0x44, 0xa6, 0x41,
+  0x8e, 0xe8, 0x94, 0xf9, 0x34, 0x0e, 0xe3, 0xe2, 0xba, 0xbe, 0x94, 0xcc, 0x35, 0x4b, 0x8c, 0x83,
+  0xe4, 0x28, 0xa9, 0x07, 0x87, 0xac, 0x4f, 0x69, 0x62, 0x02, 0x67, 0x8a, 0x97, 0x79, 0x99, 0x75,
+  0xda, 0xc8, 0x46, 0x31, 0x24, 0x6d, 0x0f, 0xe0, 0xe7, 0x29, 0x8f, 0x85, 0x3f, 0x89, 0x92, 0xf3,
+  0xe2, 0x62, 0xe0, 0xdc, 0xbf, 0x1f, 0xcb, 0x75, 0x53, 0x95, 0x57, 0x03, 0x16, 0x97, 0x07, 0xcc,
+  0x21, 0xf4, 0xfe, 0x6c, 0x9e, 0x5f, 0xb4, 0xe5, 0xea, 0x57, 0xe4, 0x7d, 0x4c, 0xfd, 0x28, 0x3a,
+  0xfa, 0x94, 0xf4, 0x6f, 0xb7, 0x23, 0x72, 0xa9, 0xbf, 0xfb, 0xcc, 0x53, 0xfb, 0xc0, 0xd5, 0x45,
+  0x1b, 0x61, 0xe5, 0x28, 0x9c, 0x7a, 0x12, 0x4e, 0xf4, 0x56, 0xdf, 0xec, 0xd3, 0x67, 0xb0, 0xa4,
+  0xc0, 0x1e, 0xa3, 0x54, 0x56, 0x03, 0x9c, 0xe2, 0x66, 0x4d, 0xed, 0x46, 0x24, 0x26, 0xd9, 0x83,
+  0x7d, 0xab, 0xa7, 0xeb, 0x71, 0x19, 0x10, 0xf5, 0xc8, 0xa8, 0xeb, 0xfb, 0x7a, 0x04, 0x4c, 0x34,
+  0x07, 0x09, 0x23, 0x91, 0x99, 0xa7, 0x1d, 0xd0, 0x9f, 0x2d, 0x2c, 0x4a, 0x29, 0xe7, 0x35, 0x5c,
+  0x28, 0x7b, 0xd8, 0x85, 0x24, 0x2c, 0x83, 0xfc, 0x3a, 0x19, 0x39, 0x5a, 0x5b, 0xc7, 0x0d, 0xfa,
+  0x5e, 0x12, 0x7e, 0x20, 0x7d, 0x4b, 0x4c, 0xc0, 0xb6, 0x39, 0xf5, 0x48, 0x08, 0x1d, 0xe6, 0xe7,
+  0xaf, 0x27, 0xa6, 0x02, 0x50, 0xde, 0x69, 0x48, 0x81, 0x24, 0x80, 0x4d, 0xe6, 0x20, 0x04, 0xeb,
+  0x97, 0xe6, 0xa2, 0x20, 0x6d, 0xf6, 0x51, 0xda, 0x91, 0x50, 0xea, 0xb3, 0xf0, 0x02, 0x51, 0x4b,
+  0x2a, 0x70, 0x07, 0x16, 0xa5, 0x51, 0x0c, 0xd3, 0x05, 0xa4, 0x0a, 0x34, 0x01, 0xa5, 0x4c, 0x18,
+  0x5d, 0xc6, 0x23, 0x5a, 0x64, 0xaf, 0x2e, 0x60, 0x1a, 0x61, 0x12, 0x55, 0xeb, 0x8c, 0x02, 0x58,
+  0x4a, 0x2e, 0x40, 0xda, 0x33, 0xce, 0x0f, 0x11, 0x6c, 0x18, 0xf3, 0x8b, 0x08, 0xd8, 0x27, 0x4d,
+  0x40, 0xc2, 0x92, 0x84, 0x42, 0xe6, 0x0d, 0xc6, 0x05, 0x08, 0x0d, 0x2a, 0x47, 0x52, 0x13, 0x64,
+  0x6e, 0x06, 0x72, 0xf1, 0x41, 0xf7, 0x21, 0x60, 0x8c, 0x12, 0x27, 0x49, 0x8b, 0x0b, 0x9c, 0x91,
+  0x57, 0x01, 0xc0, 0xd2, 0xb2, 0x1f, 0x85, 0xbe, 0x9e, 0x2c, 0x59, 0x3a, 0xb5, 0xb7, 0x15, 0xaf,
+  0x80, 0x3a, 0x3f, 0x49, 0xaf, 0xda, 0x9e, 0xdc, 0xe1, 0x38, 0x9b, 0x35, 0x0b, 0x88, 0xee, 0xa5,
+  0x38, 0x01, 0x9d, 0x0a, 0x7b, 0x84, 0xb4, 0x63, 0x5b, 0xbe, 0x4b, 0xdb, 0x86, 0x86, 0x9e, 0x67,
+  0x13, 0xb2, 0x38, 0xe8, 0x32, 0xcf, 0x9d, 0xcf, 0x52, 0x2e, 0x3f, 0x07, 0xd9, 0x31, 0x8a, 0x86,
+  0xdf, 0xdc, 0x58, 0x58, 0x16, 0x77, 0x41, 0xc9, 0x79, 0x9f, 0x82, 0xbc, 0xce, 0x21, 0xab, 0xba,
+  0x44, 0x2d, 0xb4, 0xa1, 0xa1, 0xfa, 0x4f, 0xdf, 0xc0, 0x8e, 0x8d, 0x05, 0x0c, 0xf8, 0xb3, 0x1a,
+  0x27, 0x92, 0xac, 0x94, 0x18, 0xf7, 0xe3, 0x1e, 0xce, 0xc1, 0xfd, 0x20, 0x39, 0x75, 0xf6, 0x91,
+  0xf1, 0xa0, 0x47, 0xdd, 0x0e, 0x36, 0x86, 0xc6, 0xbc, 0x80, 0x25, 0xc5, 0x92, 0x0a, 0x24, 0xf2,
+  0x83, 0xab, 0x20, 0x2e, 0x84, 0x21, 0x09, 0x20, 0x3b, 0xa0, 0x7d, 0x8c, 0x40, 0x79, 0x8f, 0xfa,
+  0x68, 0x85, 0xda, 0x44, 0x92, 0x22, 0xc0, 0xc1, 0x32, 0x0a, 0x86, 0xd5, 0xec, 0x93, 0xbb, 0x77,
+  0xad, 0xa5, 0xec, 0x39, 0x14, 0x75, 0x0f, 0xc6, 0x9b, 0xef, 0xd2, 0x24, 0xda, 0x3c, 0xc4, 0x7d,
+  0xb4, 0xdb, 0xb7, 0x00, 0x16, 0xd0, 0xce, 0x9b, 0x85, 0x98, 0x3c, 0x2c, 0xc9, 0xd1, 0x32, 0x05,
+  0xab, 0x41, 0x31, 0xcf, 0x49, 0xdb, 0x04, 0x7e, 0x10, 0xc6, 0xb3, 0xba, 0x36, 0xa9, 0x85, 0x11,
+  0x66, 0xd7, 0x45, 0x90, 0x9c, 0x47, 0xa1, 0x94, 0x60, 0x72, 0x1e, 0x9a, 0xba, 0x75, 0x0d, 0xfa,
+  0x87, 0xdd, 0x27, 0xa8, 0x5d, 0x01, 0xa3, 0x8a, 0x99, 0x48, 0xfc, 0x36, 0x9a, 0x44, 0xb0, 0x68,
+  0x86, 0x03, 0xd8, 0xb1, 0x21, 0x4b, 0xa7, 0x97, 0x51, 0x26, 0xc5, 0x4e, 0x49, 0x0d, 0xa8, 0x5b,
+  0xb8, 0x2d, 0xc8, 0x0f, 0xa6, 0xa0, 0xd6, 0x64, 0x2d, 0x13, 0x03, 0x65, 0x72, 0xef, 0x20, 0xbd,
+  0xe9, 0x17, 0xa3, 0x0b, 0x48, 0xb7, 0xac, 0xed, 0x03, 0x98, 0x31, 0xb0, 0x14, 0x80, 0x58, 0x72,
+  0xc8, 0x56, 0x59, 0x38, 0x47, 0xbf, 0xee, 0xc3, 0x40, 0xe9, 0x16, 0xab, 0xae, 0xa9, 0x2c, 0x88,
+  0xef, 0x52, 0x49, 0x2f, 0xaa, 0xc9, 0x8c, 0xc5, 0x77, 0x0d, 0x6a, 0x9a, 0x7b, 0x9f, 0x1a, 0x03,
+  0xd5, 0xc9, 0x12, 0x42, 0x0c, 0xe5, 0x97, 0x8a, 0x9b, 0x90, 0x88, 0x22, 0xfa, 0xa1, 0xe0, 0x16,
+  0x36, 0x63, 0x43, 0x01, 0x84, 0x3a, 0x18, 0x2f, 0x5e, 0xd8, 0x04, 0x54, 0x42, 0xf8, 0xcb, 0xaa,
+  0x40, 0x2c, 0x82, 0x75, 0x9a, 0x0c, 0x83, 0x95, 0x47, 0x0b, 0xa9, 0x10, 0x7c, 0x8b, 0x12, 0xb1,
+  0xed, 0x96, 0x55, 0x37, 0xd7, 0x2e, 0x28, 0x86, 0xb5, 0x52, 0xec, 0xf5, 0x49, 0x70, 0xee, 0x1a,
+  0x3c, 0x6b, 0x4c, 0x01, 0xaf, 0x64, 0x3c, 0x1d, 0x81, 0x1a, 0x3c, 0x1e, 0xe3, 0x46, 0x03, 0x25,
+  0xd6, 0x3d, 0x92, 0x4c, 0xf5, 0x2c, 0x62, 0x7c, 0xf9, 0x50, 0x76, 0xc4, 0x8b, 0x57, 0xee, 0xf9,
+  0xe3, 0x78, 0x02, 0xa2, 0xb2, 0x9d, 0xe1, 0x86, 0xf9, 0x4e, 0xe6, 0x17, 0x39, 0xae, 0xbd, 0x24,
+  0xee, 0xa8, 0xe5, 0x6d, 0x4c, 0xf2, 0x70, 0xcd, 0xe2, 0xba, 0xbc, 0xda, 0xdd, 0xab, 0x5d, 0x17,
+  0x2f, 0x4e, 0x36, 0xab, 0x99, 0xf5, 0x73, 0x67, 0x8b, 0xed, 0xde, 0x3a, 0xbc, 0x77, 0x01, 0xb3,
+  0x26, 0x49, 0x61, 0x93, 0x59, 0x04, 0xac, 0x3c, 0xe8, 0x79, 0xa8, 0x97, 0x33, 0xe2, 0x00, 0x61,
+  0x17, 0x43, 0x63, 0x8e, 0xe2, 0xba, 0x78, 0x04, 0xb2, 0x83, 0xca, 0xe2, 0x26, 0x0d, 0x16, 0x99,
+  0xeb, 0xa8, 0xf0, 0x95, 0x71, 0xd6, 0x20, 0x8e, 0xd6, 0x2b, 0xcf, 0x31, 0xbf, 0x7c, 0x54, 0xd4,
+  0xb3, 0x54, 0xcd, 0x1d, 0xc7, 0xca, 0x2d, 0x4d, 0xca, 0x7a, 0x99, 0x50, 0x92, 0x60, 0x59, 0xb5,
+  0x07, 0x44, 0x39, 0x94, 0x13, 0x8c, 0x36, 0x98, 0xc0, 0x7e, 0x3c, 0xbc, 0xa6, 0x95, 0x2e, 0x77,
+  0x22, 0x10, 0x10, 0xd7, 0xb4, 0x5c, 0x99, 0xec, 0x8f, 0x80, 0x6f, 0x83, 0x33, 0x18, 0x86, 0xd2,
+  0xe8, 0x4e, 0x83, 0x19, 0x8f, 0x26, 0x0d, 0xe6, 0x73, 0xfa, 0xf1, 0xf3, 0xf9, 0x59, 0xce, 0xbb,
+  0xee, 0x1d, 0xd0, 0x30, 0x1e, 0x79, 0x7e, 0x16, 0xcd, 0x26, 0xc1, 0x28, 0x6a, 0xbb, 0x27, 0x30,
+  0x03, 0x5c, 0xc7, 0x25, 0x9b, 0x75, 0x69, 0x86, 0x61, 0x15, 0x34, 0x1a, 0xcb, 0x6b, 0x20, 0x25,
+  0xac, 0x5a, 0xea, 0x88, 0xf5, 0x2b, 0xbb, 0x1c, 0xea, 0xee, 0x42, 0xf1, 0xaa, 0xd8, 0x80, 0x97,
+  0xa0, 0x17, 0xe0, 0x96, 0x42, 0x54, 0xa9, 0xec, 0x8d, 0x50, 0xc0, 0xaa, 0xb5, 0x49, 0xd5, 0x6c,
+  0xdd, 0xea, 0x24, 0x7c, 0x73, 0x7d, 0xfb, 0xa8, 0xab, 0x55, 0x2b, 0x23, 0x15, 0x6e, 0xdd, 0x9a,
+  0x08, 0x78, 0x69, 0x35, 0xc8, 0xac, 0x79, 0x54, 0x90, 0x68, 0x17, 0xbc, 0x75, 0x03, 0x3a, 0x13,
+  0x0c, 0x36, 0x0c, 0x12, 0x8f, 0xc8, 0x09, 0xec, 0x08, 0x9c, 0xf6, 0x9f, 0xff, 0xb4, 0xef, 0xc1,
+  0xf8, 0x21, 0x7c, 0xdf, 0x18, 0xaf, 0x8e, 0x73, 0x96, 0x66, 0x20, 0x50, 0x5e, 0xa6, 0x13, 0x54,
+  0x87, 0xdd, 0x5f, 0x44, 0x8f, 0x1e, 0x47, 0xbd, 0x1e, 0x40, 0x9e, 0x05, 0xa3, 0x2f, 0xe7, 0x19,
+  0x0a, 0x60, 0x99, 0x97, 0x9d, 0x9f, 0x05, 0xed, 0xde, 0x83, 0x6e, 0x67, 0xbb, 0xf7, 0xa8, 0xf3,
+  0xe0, 0x61, 0xa7, 0xeb, 0x6f, 0x23, 0xca, 0xeb, 0xbd, 0x1f, 0xe2, 0xfc, 0xe0, 0x15, 0x00, 0x5c,
+  0xc3, 0x17, 0xcc, 0xa9, 0x1c, 0xd4, 0xcb, 0xbe, 0xd3, 0xf5, 0x7b, 0xce, 0xa2, 0x53, 0xa1, 0x49,
+  0x8e, 0xf7, 0x32, 0xaa, 0x44, 0x7e, 0x85, 0xae, 0xde, 0x93, 0xdd, 0xee, 0xd9, 0x93, 0xe5, 0x74,
+  0x3d, 0xdc, 0x06, 0xb2, 0x76, 0x3b, 0xdb, 0xbb, 0x3b, 0xab, 0xe9, 0x02, 0xa5, 0x21, 0x0e, 0xc3,
+  0x28, 0xe9, 0x97, 0x58, 0xd0, 0x1a, 0x10, 0x9e, 0x96, 0xa7, 0x5a, 0xb8, 0x5a, 0x1c, 0xe4, 0xa9,
+  0x9e, 0x17, 0xdb, 0x93, 0x52, 0xa7, 0x2b, 0x4e, 0x6b, 0xff, 0xb2, 0xd4, 0x40, 0x99, 0x53, 0x6d,
+  0xe1, 0xe3, 0x20, 0x7a, 0xd4, 0x5d, 0xde, 0xc2, 0x07, 0x4f, 0x3a, 0xdb, 0x8f, 0x1f, 0x76, 0x9e,
+  0x3c, 0xaa, 0x69, 0x60, 0xaf, 0xb9, 0x85, 0x9a, 0xef, 0xed, 0x26, 0x7a, 0xa5, 0xd6, 0xed, 0x33,
+  0xaf, 0x2d, 0x6b, 0x1a, 0x64, 0x3b, 0x47, 0x89, 0xdd, 0x1c, 0x2a, 0x52, 0x69, 0xcb, 0x93, 0xb3,
+  0x9d, 0x27, 0x67, 0x8f, 0x96, 0xb7, 0x65, 0x7b, 0x67, 0xa7, 0xb3, 0x0b, 0xed, 0xd9, 0xed, 0x41,
+  0x63, 0x7a, 0xa5, 0xc6, 0x3c, 0xa8, 0x34, 0x26, 0x2f, 0x22, 0xd0, 0xbc, 0x61, 0x37, 0x80, 0x06,
+  0xb5, 0x8e, 0x03, 0x0b, 0xd1, 0x44, 0xfe, 0x6d, 0xb5, 0x53, 0xcc, 0xb7, 0xda, 0x46, 0x8a, 0x69,
+  0x59, 0xe0, 0xbe, 0x56, 0x6c, 0x4c, 0x70, 0x11, 0xa5, 0x65, 0x00, 0xf4, 0x01, 0xb7, 0x17, 0x9a,
+  0x2b, 0xe9, 0xba, 0x72, 0xbe, 0x56, 0x83, 0x60, 0xd1, 0xcc, 0x86, 0x6c, 0xa0, 0xe0, 0x2a, 0x2e,
+  0x2e, 0x50, 0x79, 0xd0, 0x72, 0x58, 0x48, 0x75, 0x10, 0xa7, 0x33, 0x52, 0xa1, 0xfd, 0xd2, 0x7a,
+  0xaf, 0x96, 0x0c, 0xd0, 0x8c, 0xe8, 0xef, 0x36, 0xd0, 0xdd, 0x51, 0x6b, 0x68, 0x71, 0x3d, 0x43,
+  0x25, 0x18, 0x77, 0xcd, 0x6a, 0xe7, 0xcb, 0x43, 0x22, 0xc6, 0x2a, 0xef, 0x9b, 0xb5, 0x75, 0xd4,
+  0x80, 0xf6, 0xb5, 0xbc, 0x50, 0x53, 0x33, 0x9d, 0x91, 0xb5, 0xbf, 0xaf, 0xb0, 0x3b, 0xd2, 0x56,
+  0x14, 0x5f, 0x46, 0xa2, 0x97, 0x55, 0xce, 0x34, 0x88, 0xc9, 0x04, 0xba, 0x97, 0xcf, 0xa2, 0x51,
+  0xf1, 0x01, 0xcd, 0x6a, 0x7d, 0x36, 0x5d, 0x6a, 0x18, 0x80, 0x88, 0xb2, 0x80, 0x36, 0x99, 0x48,
+  0xd0, 0x34, 0x0d, 0x91, 0x58, 0xb2, 0x21, 0xb8, 0x1d, 0xce, 0xcd, 0xa1, 0xb0, 0x28, 0xa7, 0x09,
+  0x71, 0x9c, 0xd9, 0x64, 0x7e, 0x1e, 0xdb, 0xa4, 0xa0, 0x51, 0xfe, 0x1c, 0x3a, 0x12, 0x31, 0xcd,
+  0xd2, 0x3c, 0x66, 0xac, 0x6e, 0x91, 0xce, 0x5c, 0xb3, 0x24, 0xf4, 0x49, 0x5c, 0x4c, 0x22, 0x84,
+  0x12, 0x67, 0xd5, 0x35, 0xe8, 0x01, 0x28, 0x4d, 0x27, 0x45, 0x3c, 0x43, 0x30, 0x36, 0xc9, 0x0a,
+  0x96, 0x12, 0x93, 0x9d, 0x56, 0x63, 0x0d, 0x9f, 0x83, 0x36, 0x10, 0x95, 0xa8, 0xb9, 0xb6, 0x3f,
+  0xad, 0xb1, 0x08, 0x32, 0xb7, 0x63, 0xe5, 0x29, 0x52, 0xec, 0x4e, 0xa4, 0xa6, 0xea, 0xb6, 0x4c,
+  0xa2, 0x71, 0x51, 0x2a, 0x58, 0x6d, 0x0c, 0x33, 0x3b, 0x72, 0x2a, 0x94, 0x40, 0xd9, 0x09, 0x5d,
+  0x0c, 0xaa, 0x40, 0x24, 0x44, 0xa8, 0xd1, 0x00, 0xc7, 0x6e, 0xf2, 0x75, 0x0f, 0xf1, 0x94, 0xa8,
+  0xd4, 0x78, 0x6d, 0xf1, 0x60, 0x2d, 0x49, 0x1d, 0x93, 0xc8, 0x2c, 0x3e, 0xbf, 0x28, 0x70, 0x5e,
+  0x36, 0x53, 0x66, 0x89, 0x3d, 0x20, 0xc4, 0x39, 0xcf, 0x62, 0x1a, 0xbb, 0x30, 0x0b, 0xae, 0x8e,
+  0x12, 0xe2, 0xe5, 0x3d, 0xd0, 0x58, 0xf4, 0xe8, 0xe0, 0x09, 0x04, 0xcc, 0x72, 0x3a, 0x67, 0xe9,
+  0xa3, 0x56, 0x5a, 0x22, 0xff, 0x41, 0x23, 0xf9, 0xcc, 0x7a, 0x75, 0x84, 0x12, 0xda, 0xcd, 0xae,
+  0xbf, 0x23, 0x31, 0xfb, 0x3b, 0xe6, 0x28, 0x6f, 0x98, 0xbf, 0x4a, 0x44, 0x2c, 0xd5, 0x10, 0x49,
+  0x07, 0x5c, 0x38, 0x74, 0x04, 0xeb, 0xb4, 0xa3, 0x2c, 0x33, 0x94, 0x51, 0xb1, 0x75, 0x31, 0xe6,
+  0x3f, 0xa5, 0xd0, 0xf6, 0x01, 0x0d, 0x07, 0x52, 0x37, 0xc5, 0x0d, 0x04, 0x96, 0x5c, 0x51, 0x17,
+  0x80, 0xf8, 0xe2, 0x28, 0xd6, 0xa7, 0x6d, 0x5f, 0xfe, 0x1d, 0xc8, 0x0f, 0xb2, 0x15, 0x82, 0xea,
+  0xf5, 0xdc, 0xcc, 0x47, 0x45, 0xac, 0x46, 0x77, 0x0d, 0x2e, 0x83, 0x78, 0x82, 0xdc, 0x2d, 0x55,
+  0xd7, 0xdb, 0x29, 0xae, 0x4b, 0xd5, 0xd6, 0xf5, 0xf6, 0x9c, 0x0b, 0xb4, 0x35, 0x19, 0xc7, 0xd4,
+  0xc2, 0xc8, 0x91, 0xbf, 0x4d, 0x81, 0xc0, 0x57, 0x11, 0x6e, 0xc5, 0x26, 0xf0, 0x27, 0x0e, 0x97,
+  0x7f, 0x91, 0xe6, 0x45, 0x42, 0x47, 0x45, 0x43, 0x3c, 0xaa, 0xc3, 0xfd, 0xc4, 0x92, 0x3c, 0x4c,
+  0x9e, 0x60, 0x52, 0x13, 0xd0, 0x76, 0xef, 0xb1, 0xdf, 0x85, 0x7f, 0xb7, 0x6d, 0xa0, 0x59, 0x96,
+  0x16, 0xe9, 0x28, 0x9d, 0x30, 0x10, 0x2c, 0x1e, 0x51, 0xbf, 0x25, 0xed, 0xb5, 0x77, 0x34, 0x61,
+  0x9e, 0xa1, 0x95, 0xcb, 0xa3, 0x0d, 0x3c, 0xf4, 0x6e, 0xb7, 0x5e, 0x1f, 0xbf, 0xa7, 0x7d, 0x6c,
+  0x18, 0x15, 0x20, 0xb8, 0x70, 0x66, 0x64, 0xf3, 0x24, 0xc1, 0xb1, 0x8d, 0x13, 0xaa, 0x66, 0x02,
+  0xfc, 0x8f, 0xc7, 0xcc, 0x20, 0xea, 0x7c, 0x3e, 0x0e, 0x43, 0x2b, 0xe8, 0xa7, 0x4f, 0xa4, 0xbb,
+  0x0d, 0x05, 0x93, 0xd2, 0xe7, 0x21, 0x80, 0x0c, 0xdd, 0xbd, 0x6f, 0x4f, 0x8e, 0x5c, 0x4c, 0x41,
+  0x2b, 0x66, 0x76, 0x8c, 0xa3, 0x3c, 0xec, 0xaa, 0xef, 0xd7, 0x49, 0xc8, 0x5f, 0xc0, 0xd6, 0xc5,
+  0x1e, 0x09, 0xd2, 0xa1, 0x0b, 0xac, 0x70, 0xfd, 0x69, 0x1a, 0x24, 0xf3, 0x60, 0xe2, 0x1a, 0x07,
+  0xdb, 0xe9, 0xe8, 0x0b, 0x9f, 0x88, 0x0c, 0x6f, 0xa8, 0x32, 0x14, 0x0d, 0xfd, 0x27, 0x3b, 0x1d,
+  0xf8, 0x78, 0x15, 0x4d, 0x8a, 0x80, 0xbe, 0x7b, 0xf8, 0xf9, 0x06, 0x4f, 0x5c, 0x41, 0xb2, 0xc7,
+  0x39, 0x7c, 0xcf, 0xf8, 0x88, 0xe3, 0x04, 0x66, 0xcb, 0x79, 0x94, 0x11, 0xd0, 0xe3, 0x5d, 0x95,
+  0x0a, 0x9f, 0x47, 0xe3, 0x31, 0x2c, 0x13, 0x1a, 0x12, 0x1a, 0xfb, 0x5a, 0x48, 0x4c, 0x6e, 0x4e,
+  0x9a, 0x90, 0xc3, 0xc9, 0xdb, 0x28, 0x94, 0xe9, 0x24, 0x08, 0x42, 0x60, 0xbd, 0xeb, 0x0f, 0x11,
+  0x31, 0xae, 0x5d, 0x60, 0xfa, 0xbb, 0xa2, 0x26, 0xe5, 0x55, 0x9c, 0x8f, 0xd0, 0xac, 0x71, 0x6d,
+  0x67, 0x61, 0x77, 0x62, 0x57, 0xd9, 0xa9, 0x19, 0xe3, 0x7d, 0x93, 0xce, 0xb3, 0xfe, 0x03, 0xf9,
+  0x75, 0x48, 0xa7, 0xdf, 0xfd, 0xee, 0x42, 0xf7, 0x4a, 0x92, 0x5e, 0x0d, 0xb5, 0x19, 0x0e, 0xc4,
+  0x43, 0x10, 0x0e, 0x93, 0xe1, 0xb3, 0x76, 0xf2, 0x74, 0xbb, 0xfb, 0xdc, 0xed, 0xba, 0x7d, 0xd8,
+  0xbe, 0xdc, 0x07, 0xa5, 0x65, 0x3c, 0x2d, 0x86, 0xc5, 0xf0, 0xd9, 0x8d, 0x50, 0xa5, 0x87, 0xb8,
+  0xdc, 0x62, 0xb9, 0x76, 0xe1, 0x0d, 0x84, 0x79, 0xe4, 0xf3, 0x37, 0x37, 0x21, 0xaa, 0x09, 0xfb,
+  0xc0, 0xdd, 0x7f, 0x0f, 0xc2, 0xa7, 0xed, 0x2d, 0x36, 0xbf, 0xb9, 0x01, 0x84, 0x6d, 0x4a, 0x3e,
+  0x84, 0x69, 0x7b, 0xd1, 0xf6, 0xee, 0x6f, 0xdb, 0xc9, 0x84, 0xc4, 0xf3, 0x16, 0x8e, 0x91, 0x86,
+  0x54, 0xe7, 0x98, 0xd8, 0x37, 0xcb, 0xf3, 0xd1, 0x7d, 0x39, 0xf9, 0x98, 0x0f, 0xee, 0x31, 0xf9,
+  0xf3, 0xc2, 0x36, 0xb6, 0x0f, 0xf1, 0xd8, 0x68, 0x0c, 0x02, 0x87, 0xec, 0xec, 0xc3, 0xee, 0x20,
+  0x7e, 0xfa, 0xe4, 0xd1, 0x20, 0xbe, 0x7f, 0xdf, 0x13, 0xcd, 0x28, 0x86, 0xd0, 0xea, 0xcd, 0xf6,
+  0x93, 0x9d, 0xcd, 0xd8, 0xbb, 0xb7, 0xbd, 0x73, 0xef, 0x51, 0xf7, 0x1e, 0xed, 0xf5, 0x0d, 0x5b,
+  0x3a, 0x34, 0x0a, 0x9a, 0x0e, 0xad, 0x5c, 0x74, 0x80, 0x55, 0x9e, 0xf4, 0x3a, 0x0f, 0xbb, 0x9d,
+  0xee, 0x67, 0x6f, 0xb0, 0x30, 0xb8, 0x4a, 0xd8, 0x23, 0x86, 0x2d, 0x75, 0x2a, 0xd2, 0xd1, 0xe7,
+  0x1d, 0x1d, 0xf3, 0xb4, 0x41, 0xa4, 0xcb, 0x1d, 0x51, 0x87, 0x0f, 0x09, 0xbe, 0x4f, 0x5a, 0xf7,
+  0xa9, 0xc6, 0xdf, 0x82, 0x86, 0xd3, 0x6e, 0xc1, 0xa7, 0x67, 0xb3, 0xed, 0x77, 0x51, 0x50, 0x5c,
+  0x44, 0xd9, 0xf0, 0x46, 0x9c, 0x7a, 0x1d, 0x40, 0x56, 0xbf, 0xf5, 0x2f, 0xff, 0xf5, 0xdf, 0xff,
+  0xef, 0xff, 0xf5, 0x9f, 0x5a, 0x1d, 0x91, 0xc8, 0x9c, 0xd9, 0xf3, 0x1f, 0xca, 0x04, 0xb9, 0xc0,
+  0xf4, 0x77, 0x1e, 0x74, 0xe4, 0xe1, 0x72, 0xff, 0xa3, 0x3e, 0x32, 0xee, 0xb7, 0xd5, 0x20, 0x7a,
+  0x1e, 0x0f, 0x05, 0x08, 0xb6, 0x4e, 0xcc, 0xc8, 0xff, 0xf8, 0x07, 0x42, 0x8e, 0x0b, 0xc2, 0xee,
+  0x83, 0x0e, 0x2e, 0x11, 0x8f, 0xba, 0x8b, 0x4e, 0x6d, 0x69, 0xcd, 0x3f, 0xf7, 0xc9, 0xab, 0x04,
+  0x0d, 0xb9, 0x55, 0x84, 0x82, 0x5a, 0x42, 0xb8, 0xbb, 0x36, 0xc2, 0xde, 0xbd, 0xf5, 0x50, 0x3e,
+  0xd9, 0x66, 0x94, 0xbd, 0xc5, 0xa9, 0xc1, 0x05, 0xc4, 0x76, 0xa3, 0x2f, 0xc7, 0xc2, 0x78, 0xe8,
+  0x98, 0x1e, 0x41, 0xb5, 0xfc, 0x1f, 0xa3, 0x28, 0x08, 0xae, 0x87, 0x6d, 0x53, 0xde, 0x3c, 0xeb,
+  0xde, 0xbd, 0x0b, 0xd9, 0x4f, 0xcd, 0xb4, 0xbb, 0x77, 0xb5, 0x04, 0x7a, 0xd6, 0xc5, 0x82, 0x1f,
+  0xe6, 0x49, 0x6d, 0xb1, 0x67, 0x43, 0xbb, 0x9c, 0x81, 0x09, 0xca, 0x7a, 0x30, 0x37, 0x51, 0x53,
+  0x04, 0xa1, 0x31, 0x24, 0xcb, 0x38, 0x34, 0xa6, 0xdd, 0xed, 0x98, 0xbe, 0x37, 0x6d, 0xb3, 0xa6,
+  0xe7, 0xfa, 0xa3, 0xdf, 0xf5, 0x36, 0xd1, 0xbd, 0x71, 0x8b, 0x2c, 0xe7, 0x96, 0xea, 0x4e, 0xf2,
+  0xed, 0x1d, 0x34, 0x8d, 0xc8, 0x7a, 0x8e, 0xe2, 0xa6, 0x2f, 0x44, 0xac, 0x38, 0x2c, 0xe2, 0x29,
+  0x2b, 0xf5, 0x33, 0xe9, 0xcc, 0xf6, 0x1b, 0xd0, 0x37, 0x51, 0x37, 0x68, 0x5d, 0xe2, 0xda, 0xd0,
+  0xdd, 0x0c, 0xa3, 0x69, 0xda, 0x62, 0xa6, 0x95, 0xd2, 0x92, 0x3e, 0x14, 0x6b, 0xc1, 0x6c, 0x10,
+  0xfc, 0xcd, 0xf9, 0x24, 0x3e, 0x8f, 0x92, 0xbe, 0x24, 0xa0, 0x23, 0xe4, 0x78, 0x5f, 0x49, 0xf4,
+  0x0e, 0x91, 0x8f, 0xa2, 0x1a, 0x54, 0x66, 0xab, 0x69, 0x77, 0xef, 0xb6, 0x45, 0xf7, 0xff, 0xf8,
+  0x23, 0xd1, 0xed, 0x79, 0x0c, 0xfc, 0x41, 0xf6, 0x10, 0xcc, 0xf5, 0xbe, 0xea, 0x2e, 0xa9, 0xfa,
+  0x6c, 0xb1, 0x6f, 0xea, 0x1e, 0xec, 0x6d, 0x42, 0x3a, 0x56, 0xc3, 0x83, 0x6b, 0xf8, 0xc9, 0x61,
+  0x5b, 0x04, 0x3f, 0x28, 0x1e, 0x71, 0xf9, 0x41, 0x1f, 0x55, 0xa9, 0x74, 0x63, 0xfe, 0x31, 0x65,
+  0xe7, 0xaf, 0x4d, 0xdd, 0xb6, 0x53, 0x03, 0xf1, 0x12, 0x36, 0x64, 0xa0, 0xae, 0xf5, 0xd4, 0xb1,
+  0xd9, 0xe5, 0xf9, 0x41, 0xa2, 0x1a, 0xec, 0xb8, 0x30, 0xe3, 0x7a, 0x6e, 0x25, 0x53, 0x75, 0x90,
+  0xe3, 0x3e, 0xdc, 0xf1, 0x1f, 0xb8, 0xac, 0x3b, 0xc9, 0xe3, 0x26, 0x3d, 0xb3, 0x0f, 0x4c, 0x5a,
+  0x80, 0x41, 0xe5, 0x80, 0xb4, 0x98, 0xfa, 0xbc, 0xd5, 0x57, 0xb6, 0x0a, 0xb6, 0x0d, 0x88, 0x8c,
+  0x83, 0x10, 0x72, 0x5a, 0x93, 0xf8, 0x12, 0x9a, 0xf6, 0x29, 0x4b, 0xd3, 0xe9, 0xa7, 0xee, 0x76,
+  0xab, 0xe3, 0xb4, 0x70, 0x81, 0xc7, 0x9c, 0xb7, 0x94, 0xe3, 0x7c, 0x80, 0x1c, 0x4c, 0x2e, 0xb4,
+  0x16, 0x8c, 0xb9, 0x40, 0xf3, 0x0e, 0x26, 0x4b, 0x39, 0x84, 0x69, 0x40, 0x26, 0x61, 0x88, 0x67,
+  0xc2, 0x83, 0x0f, 0x13, 0xb7, 0x9f, 0xf4, 0xfc, 0xed, 0x47, 0xbb, 0xfe, 0xb6, 0xbf, 0xbd, 0xd3,
+  0xc5, 0x5c, 0xe1, 0x26, 0x75, 0x8c, 0x67, 0x27, 0xdf, 0xce, 0x40, 0x85, 0x42, 0x7c, 0xbd, 0x1d,
+  0x5b, 0x11, 0x2d, 0x51, 0x79, 0x16, 0x85, 0x35, 0x14, 0x1e, 0x06, 0xb8, 0xc6, 0x3a, 0x2f, 0x38,
+  0xb3, 0x8e, 0x48, 0xd8, 0xce, 0x56, 0x88, 0xdc, 0xf5, 0x9f, 0x34, 0x12, 0xb9, 0xbd, 0x94, 0xc8,
+  0x87, 0xcd, 0x44, 0xa6, 0xe3, 0x71, 0x3c, 0x8a, 0x4a, 0x34, 0x1e, 0x51, 0x62, 0x1d, 0x6d, 0x0f,
+  0xfc, 0xdd, 0x0a, 0x6d, 0x3d, 0xbf, 0xdb, 0x48, 0x5b, 0x6f, 0x29, 0x6d, 0x0f, 0xb6, 0xbb, 0x4a,
+  0xcd, 0x3e, 0x05, 0xa0, 0x11, 0xf2, 0x1c, 0xa6, 0xc3, 0xdf, 0x01, 0xac, 0xf8, 0xa0, 0xbf, 0x9e,
+  0x54, 0x46, 0x90, 0xd0, 0x89, 0xdc, 0x37, 0xf6, 0x40, 0x3e, 0x68, 0x6d, 0x08, 0x6e, 0x63, 0x4e,
+  0xdb, 0x1f, 0x0a, 0x6f, 0x0e, 0x32, 0xfa, 0xfb, 0x67, 0xf0, 0xd1, 0xe6, 0x14, 0x92, 0x1a, 0x66,
+  0x26, 0x0a, 0xc9, 0x38, 0x99, 0xcd, 0x0b, 0x90, 0x68, 0x71, 0x61, 0x88, 0x4b, 0x7d, 0xee, 0xa4,
+  0xf8, 0x37, 0x2a, 0x2e, 0xd2, 0x90, 0x0b, 0xc4, 0x05, 0x5a, 0x61, 0xe9, 0x0f, 0x5f, 0xa4, 0xe3,
+  0x61, 0xf3, 0xaf, 0x5e, 0x9f, 0xb8, 0xe8, 0x26, 0xfc, 0xed, 0x0c, 0x88, 0x7f, 0x09, 0xbb, 0x69,
+  0x58, 0x69, 0x54, 0x86, 0xed, 0xc8, 0x0b, 0x9b, 0x1e, 0x44, 0x85, 0xdb, 0x97, 0x74, 0xec, 0x10,
+  0x09, 0xa4, 0x84, 0xba, 0x6c, 0x61, 0x25, 0x7d, 0x9e, 0x53, 0xfb, 0xfc, 0xeb, 0xcf, 0xb3, 0x49,
+  0xc9, 0xc9, 0x58, 0x98, 0x01, 0xbe, 0xfd, 0xf0, 0xb6, 0x0d, 0xe8, 0x3a, 0x5a, 0xad, 0x05, 0x95,
+  0x1f, 0x76, 0xcb, 0x9e, 0x0d, 0x4e, 0xee, 0x1c, 0xb0, 0x89, 0xf3, 0x67, 0x20, 0x6c, 0x49, 0x33,
+  0xbe, 0xef, 0xb4, 0xe7, 0x7e, 0x0e, 0xaa, 0x0b, 0xf4, 0x03, 0x50, 0xd9, 0x6a, 0x79, 0xa6, 0x3d,
+  0x7b, 0xeb, 0xdf, 0x7d, 0xbf, 0x05, 0x42, 0xec, 0xfb, 0xe7, 0x78, 0x32, 0x13, 0x0d, 0x67, 0x40,
+  0xd5, 0xf7, 0x67, 0x5b, 0x3e, 0x0a, 0x98, 0x36, 0xe2, 0xf2, 0xa4, 0x56, 0xec, 0xbc, 0xcf, 0xd2,
+  0x69, 0x9c, 0x47, 0x3e, 0x70, 0x41, 0x3a, 0xb9, 0x8c, 0x68, 0x61, 0xfb, 0x20, 0x9c, 0x4a, 0xda,
+  0xae, 0x8b, 0xa7, 0x73, 0x7c, 0xba, 0x03, 0x73, 0x07, 0x77, 0x71, 0x5e, 0x53, 0x3d, 0xa0, 0x1f,
+  0x94, 0x6a, 0xb9, 0x91, 0xea, 0x32, 0x50, 0x8f, 0x62, 0x6b, 0xa0, 0xf5, 0x65, 0xdc, 0x80, 0x1d,
+  0xee, 0xbd, 0xfb, 0x76, 0xef, 0xad, 0x3b, 0xf8, 0x09, 0xd4, 0x28, 0x6e, 0xac, 0xa3, 0x67, 0x3c,
+  0x6e, 0x22, 0x88, 0x9d, 0xb3, 0xfe, 0xaa, 0x14, 0x05, 0xf3, 0x22, 0x5d, 0x42, 0x92, 0xa4, 0x80,
+  0x76, 0x11, 0x3f, 0x5b, 0xfd, 0xcc, 0x39, 0xc8, 0x9c, 0x5b, 0x0c, 0xe7, 0xae, 0x37, 0xf4, 0xff,
+  0xf6, 0xf8, 0xe8, 0x9d, 0xcf, 0xfc, 0x1c, 0x8f, 0xaf, 0xdb, 0x96, 0x76, 0x02, 0x33, 0xa3, 0x54,
+  0xaf, 0x71, 0x5e, 0x7b, 0xe3, 0xb8, 0x62, 0xd7, 0xbb, 0x79, 0x02, 0x13, 0xc4, 0x85, 0x65, 0x25,
+  0x98, 0xcd, 0x26, 0x31, 0xb3, 0xf7, 0x16, 0xde, 0x0a, 0x70, 0x9d, 0x45, 0x99, 0x91, 0x0c, 0x32,
+  0x79, 0x45, 0xfb, 0x24, 0x56, 0x95, 0xaf, 0x23, 0xb7, 0xb2, 0x5e, 0xfd, 0x25, 0x09, 0x1e, 0xd1,
+  0x4e, 0xcd, 0x45, 0xa9, 0x22, 0xe5, 0x0c, 0xa6, 0x93, 0x40, 0xf9, 0x5a, 0xe2, 0x79, 0xf7, 0xf7,
+  0xaf, 0x40, 0xf5, 0xfb, 0xa3, 0x63, 0x24, 0x5b, 0x5b, 0xc3, 0x4c, 0x61, 0xaa, 0x05, 0xd2, 0x59,
+  0x1a, 0x5e, 0x93, 0xc3, 0x02, 0x4b, 0x53, 0x25, 0x0a, 0x41, 0xa6, 0x72, 0x96, 0x21, 0x0e, 0x41,
+  0x1a, 0x52, 0x0b, 0xf9, 0x38, 0x51, 0xc1, 0x78, 0x74, 0x38, 0x3f, 0x30, 0x50, 0x1f, 0x91, 0xc7,
+  0x99, 0x1f, 0xe4, 0x79, 0x7c, 0x9e, 0x18, 0xdd, 0xd0, 0xe1, 0xea, 0x40, 0xcc, 0xdd, 0x2c, 0x3c,
+  0xb3, 0xc0, 0x5a, 0x73, 0x84, 0x71, 0xcc, 0xb3, 0x40, 0xb9, 0x21, 0x86, 0x77, 0x9a, 0xe4, 0x9a,
+  0x69, 0x11, 0xf2, 0xac, 0xa6, 0xaf, 0x55, 0xdd, 0x41, 0x72, 0x19, 0x4c, 0xe2, 0x90, 0x9a, 0x6c,
+  0x55, 0xf3, 0xb0, 0x52, 0xcd, 0x86, 0xfd, 0x8b, 0x03, 0x64, 0x8e, 0x90, 0x30, 0xc4, 0xf8, 0xa3,
+  0xfc, 0xd2, 0xc5, 0xc6, 0x1b, 0xd2, 0xdf, 0x02, 0x80, 0xe1, 0xfa, 0x6a, 0xd6, 0x33, 0xf6, 0x84,
+  0xb7, 0xe2, 0x35, 0x34, 0x6e, 0x6d, 0x11, 0x61, 0x15, 0x1e, 0xab, 0x90, 0x09, 0xb2, 0xed, 0x6f,
+  0x8a, 0xcd, 0x90, 0x48, 0x2a, 0x0d, 0x18, 0xf1, 0xd7, 0x67, 0xab, 0xb6, 0x44, 0x06, 0x3b, 0x1f,
+  0xd2, 0xf4, 0x43, 0xd7, 0x2b, 0x19, 0x85, 0x85, 0x41, 0x01, 0xd5, 0xfe, 0x43, 0xda, 0xa2, 0x29,
+  0x0f, 0x2e, 0x42, 0x43, 0x19, 0x38, 0x50, 0x5d, 0xf6, 0xe1, 0xc2, 0xbf, 0x3c, 0xe9, 0x4c, 0x8a,
+  0x1b, 0x9f, 0x4e, 0xc9, 0x21, 0x27, 0x14, 0x4c, 0x59, 0x8b, 0x4c, 0x32, 0x6c, 0x03, 0xbe, 0x81,
+  0x85, 0xcf, 0x34, 0x2c, 0x21, 0x3e, 0x42, 0x63, 0x24, 0xa1, 0x2e, 0x63, 0x9a, 0x9b, 0xbc, 0x72,
+  0xf1, 0x9a, 0x55, 0xb0, 0xa6, 0xf9, 0x45, 0x17, 0x00, 0xf4, 0x36, 0xb4, 0x8c, 0x44, 0x6f, 0x1f,
+  0x71, 0xc5, 0xef, 0x82, 0x9e, 0x22, 0xfa, 0xab, 0x16, 0x10, 0x36, 0x53, 0x00, 0x66, 0x95, 0xba,
+  0x6f, 0x74, 0x8b, 0x5d, 0x86, 0xee, 0x65, 0xc8, 0xce, 0x17, 0xae, 0x03, 0x15, 0xf5, 0x62, 0x61,
+  0x5b, 0xdc, 0x91, 0xab, 0xa8, 0xa0, 0x50, 0x1c, 0xe7, 0xa4, 0xc7, 0xf2, 0xa2, 0x00, 0x8d, 0x08,
+  0x3c, 0xd8, 0x7b, 0x15, 0x27, 0x50, 0x3b, 0x6c, 0x0d, 0x97, 0xc1, 0x74, 0x9c, 0x9d, 0x2e, 0xae,
+  0xaa, 0xa6, 0x54, 0x28, 0xd5, 0x63, 0x92, 0x46, 0x77, 0x38, 0x7e, 0xa6, 0x8a, 0x25, 0xce, 0xfb,
+  0xb0, 0x71, 0x59, 0x45, 0x03, 0x79, 0x15, 0x1d, 0xe0, 0x39, 0x0c, 0x08, 0x20, 0x89, 0x52, 0x74,
+  0xed, 0x49, 0x3c, 0xfa, 0x52, 0x1a, 0xaa, 0x2a, 0x00, 0x5d, 0x8b, 0x29, 0x14, 0x06, 0xfb, 0x4a,
+  0x92, 0xcd, 0x04, 0x30, 0xf4, 0x27, 0x0d, 0x6c, 0xc0, 0x1d, 0x62, 0x0d, 0x2b, 0xcc, 0x35, 0x2a,
+  0xf4, 0xac, 0x34, 0xdc, 0x32, 0xfd, 0xa9, 0xc1, 0x12, 0x5e, 0x79, 0x54, 0x97, 0x23, 0x47, 0x06,
+  0xaa, 0xa2, 0x26, 0x1c, 0x37, 0x15, 0xf7, 0xb7, 0x5b, 0xf6, 0x50, 0x0d, 0x43, 0x77, 0x97, 0x42,
+  0x30, 0x27, 0xd7, 0xe4, 0x33, 0xb1, 0xe6, 0xd4, 0x44, 0x31, 0x73, 0x9e, 0x7e, 0x42, 0x55, 0xd0,
+  0x5d, 0xa6, 0xfd, 0x55, 0x94, 0x54, 0xe9, 0x6f, 0xb3, 0x44, 0x5b, 0xad, 0xc2, 0x57, 0x08, 0xf9,
+  0x6b, 0xcd, 0x05, 0xa7, 0xf4, 0xbd, 0xe8, 0xe8, 0x1b, 0x61, 0xb7, 0x5c, 0x4b, 0x9b, 0x97, 0x69,
+  0xb3, 0xa2, 0x65, 0x04, 0xfd, 0xe4, 0x6a, 0x16, 0xb6, 0x5f, 0xdd, 0xbe, 0xd8, 0x71, 0xd2, 0x1a,
+  0xa4, 0x5c, 0xa1, 0xaa, 0xea, 0x42, 0x13, 0x38, 0x6f, 0x78, 0x17, 0x1e, 0xce, 0x1a, 0x72, 0xcf,
+  0x97, 0x66, 0x71, 0x7d, 0x5f, 0x84, 0xac, 0xc0, 0xf9, 0x81, 0x3c, 0x72, 0x4d, 0xce, 0xf1, 0xb0,
+  0xe8, 0x18, 0xd4, 0x0a, 0x72, 0x84, 0x37, 0x80, 0xcc, 0x53, 0x1d, 0x4e, 0x11, 0x16, 0xd5, 0xfd,
+  0x20, 0x41, 0x65, 0xdd, 0xc0, 0xa9, 0xcc, 0x6d, 0x68, 0x92, 0x6d, 0x74, 0xdf, 0x6d, 0x01, 0xd0,
+  0x26, 0xda, 0x2d, 0x71, 0x53, 0xa9, 0x8a, 0xfd, 0x3a, 0xba, 0x1e, 0x67, 0xb0, 0xaa, 0xe7, 0xe2,
+  0x6a, 0xcf, 0xbf, 0xf9, 0xa2, 0x12, 0x72, 0xd8, 0x60, 0x8a, 0xa6, 0x93, 0x1f, 0xda, 0x0d, 0x30,
+  0x5b, 0x90, 0xe4, 0xe8, 0x03, 0x8f, 0x6e, 0xdd, 0x48, 0x47, 0xbb, 0x1b, 0x46, 0xe7, 0x6a, 0x6f,
+  0x52, 0xa4, 0xb5, 0x30, 0x0f, 0x1e, 0x19, 0x50, 0xe8, 0x6b, 0x2a, 0xae, 0xed, 0xe1, 0x6d, 0xe5,
+  0xe3, 0x8b, 0x28, 0x2a, 0x1a, 0xae, 0x2c, 0x11, 0x10, 0x12, 0xac, 0xa1, 0xf9, 0x36, 0xd2, 0x09,
+  0xa8, 0x2a, 0xd4, 0x0b, 0xba, 0x05, 0x83, 0x0d, 0x85, 0x05, 0x95, 0x1c, 0xeb, 0xde, 0x8f, 0x2e,
+  0x8e, 0xc3, 0xa3, 0xfc, 0xaa, 0xcf, 0xe6, 0x90, 0xc9, 0xaa, 0xe4, 0xfb, 0xe0, 0x1a, 0x0f, 0x01,
+  0xdb, 0xe3, 0x38, 0x9a, 0x84, 0xd6, 0x7d, 0xc8, 0x19, 0xe7, 0xa0, 0x71, 0x8c, 0x34, 0x0e, 0x86,
+  0x50, 0xd7, 0xd3, 0xe8, 0xb3, 0x6c, 0xd5, 0x8d, 0x9a, 0x46, 0x82, 0x4a, 0xf8, 0x71, 0x68, 0xb8,
+  0x30, 0xdc, 0x89, 0x26, 0x9e, 0xe5, 0x68, 0x86, 0x83, 0x0e, 0xf2, 0x6c, 0x8e, 0x43, 0x1d, 0x4d,
+  0x7c, 0xd4, 0x91, 0x58, 0xc6, 0x8c, 0x2e, 0xa2, 0xd1, 0x97, 0xb3, 0xf4, 0x07, 0xd4, 0x8c, 0x20,
+  0x83, 0x3e, 0xa3, 0x10, 0xd4, 0x21, 0xf8, 0xa0, 0x02, 0x1a, 0x29, 0xd7, 0x43, 0x1a, 0x88, 0xa7,
+  0x90, 0x19, 0x89, 0x6d, 0x4a, 0x13, 0x54, 0x88, 0x56, 0x7e, 0xe4, 0x7c, 0xe0, 0x82, 0x53, 0x00,
+  0x56, 0x08, 0x59, 0x43, 0x17, 0xfc, 0x2f, 0x40, 0xc9, 0x51, 0x1d, 0xe9, 0x0c, 0x26, 0x93, 0xb2,
+  0x19, 0x11, 0x0f, 0x3e, 0xd0, 0xef, 0x0d, 0x5d, 0x80, 0xc9, 0x26, 0xca, 0x57, 0xee, 0x11, 0x7a,
+  0x12, 0x5f, 0x46, 0xca, 0x1e, 0x0e, 0x3d, 0xea, 0xe8, 0x8b, 0x35, 0x6f, 0xd1, 0x7f, 0x5c, 0xec,
+  0x68, 0xd5, 0x25, 0x98, 0x8e, 0xf3, 0x25, 0x9a, 0xa9, 0x19, 0xe0, 0x9c, 0x5d, 0x3b, 0x5b, 0xd1,
+  0x25, 0xfc, 0x95, 0xe3, 0x3a, 0x5a, 0x04, 0x39, 0x21, 0xa5, 0x94, 0xe3, 0x02, 0x98, 0x67, 0x6a,
+  0xdc, 0xb3, 0x21, 0xa4, 0xaf, 0x29, 0x2b, 0x9d, 0x67, 0xa3, 0x08, 0xfd, 0xd0, 0x45, 0xe1, 0x0e,
+  0x5f, 0xad, 0x21, 0xaf, 0xf1, 0x79, 0x92, 0xcf, 0x67, 0xb3, 0x14, 0x2f, 0xf1, 0x30, 0x85, 0x40,
+  0x06, 0x37, 0xe8, 0x7d, 0x4a, 0x16, 0x1a, 0x75, 0x65, 0xe8, 0xed, 0xc1, 0x6f, 0x5e, 0x7f, 0x7a,
+  0x7b, 0xf4, 0x2b, 0x72, 0x9e, 0x7e, 0x7b, 0xf0, 0xee, 0x35, 0x5e, 0x19, 0xea, 0xa1, 0xce, 0x86,
+  0x17, 0x6f, 0x8e, 0x80, 0xdf, 0x72, 0xf2, 0x4e, 0x97, 0x14, 0xe6, 0x44, 0x91, 0xef, 0x7c, 0x07,
+  0x4c, 0x18, 0x39, 0x31, 0x4e, 0x7f, 0x64, 0x90, 0x44, 0x9c, 0x4c, 0x92, 0xf5, 0xc0, 0x61, 0x27,
+  0x64, 0xbc, 0x72, 0x93, 0x41, 0xd7, 0x38, 0xd0, 0x22, 0xc0, 0xc5, 0x6d, 0x73, 0x02, 0x58, 0x80,
+  0x08, 0xa1, 0xe8, 0x94, 0x19, 0x12, 0x04, 0x48, 0xf2, 0x2f, 0x31, 0x3a, 0xd9, 0x0c, 0xac, 0xd6,
+  0x65, 0x91, 0xc0, 0x9d, 0x63, 0x43, 0x63, 0xfc, 0xb9, 0x4a, 0x8c, 0xdb, 0x3b, 0x7c, 0xd0, 0xa7,
+  0x7b, 0x4a, 0x5c, 0x20, 0xa0, 0xab, 0x30, 0x52, 0x58, 0x81, 0x3e, 0x79, 0x47, 0xac, 0x12, 0x06,
+  0x6a, 0x93, 0x37, 0x4b, 0x5d, 0x8d, 0xfe, 0xc0, 0x1a, 0xb0, 0xed, 0x8a, 0xa6, 0xb3, 0x22, 0x6a,
+  0xc0, 0xfa, 0x41, 0x18, 0x12, 0xe0, 0x5b, 0x10, 0x6e, 0x11, 0xcc, 0xe0, 0xb6, 0x4b, 0xcd, 0xc7,
+  0x83, 0x76, 0x3d, 0x7b, 0xec, 0xcd, 0xa2, 0x66, 0x95, 0x8e, 0xb9, 0x0b, 0x88, 0x7c, 0x3c, 0x3a,
+  0x97, 0xd2, 0x9c, 0x5d, 0x77, 0x84, 0x0d, 0x43, 0x97, 0xf0, 0x34, 0xdb, 0x36, 0x53, 0x31, 0x49,
+  0xcf, 0x25, 0x0d, 0x2c, 0x31, 0xde, 0x02, 0x0e, 0xf4, 0x12, 0xd2, 0xd5, 0x98, 0x37, 0xde, 0x0c,
+  0x64, 0x38, 0xde, 0xa2, 0x0f, 0xc5, 0xcc, 0x30, 0xfb, 0x06, 0x14, 0x18, 0xb3, 0x62, 0x72, 0xfd,
+  0x14, 0xc2, 0x1b, 0xe6, 0xb1, 0xd1, 0x67, 0xfe, 0xd1, 0xfb, 0xd7, 0xef, 0xec, 0x4a, 0x6c, 0x42,
+  0xd0, 0x95, 0xc2, 0x14, 0x48, 0x8d, 0xc2, 0xc5, 0x9d, 0x70, 0x29, 0x7d, 0xcd, 0xa9, 0x24, 0x5b,
+  0xec, 0xab, 0x5a, 0xed, 0xc8, 0xf6, 0x69, 0x20, 0xa1, 0x62, 0x24, 0xc8, 0x5b, 0x3e, 0xdf, 0x27,
+  0xe4, 0x4b, 0xfa, 0xf1, 0xd4, 0x93, 0x7e, 0xc6, 0x44, 0x15, 0x75, 0x6f, 0xd9, 0x2b, 0x82, 0xaf,
+  0x11, 0xe5, 0x93, 0x18, 0xf8, 0x61, 0xb3, 0x3a, 0x65, 0x3c, 0x3e, 0x66, 0x24, 0x94, 0xa2, 0x7c,
+  0x3e, 0xca, 0x80, 0xb1, 0x4f, 0xd2, 0x19, 0x4b, 0x3b, 0xfe, 0x7c, 0x13, 0xa1, 0x7b, 0x88, 0xbc,
+  0xf5, 0xfc, 0x3e, 0xca, 0xe2, 0x34, 0x8c, 0x47, 0xd0, 0x12, 0xba, 0x1c, 0xd2, 0xa7, 0xb9, 0x90,
+  0xab, 0x99, 0x41, 0x17, 0x45, 0xae, 0x68, 0x9e, 0xe1, 0x84, 0xa1, 0xae, 0x17, 0xf3, 0x0f, 0x27,
+  0x0c, 0x30, 0x74, 0xd2, 0xa1, 0xe9, 0x64, 0x9d, 0xce, 0x08, 0x37, 0x5c, 0xe7, 0x41, 0xd7, 0xc9,
+  0xcd, 0x7b, 0x6e, 0x80, 0x5a, 0xab, 0x47, 0xc6, 0x3c, 0xb9, 0x53, 0x19, 0x7e, 0xa9, 0x1d, 0x94,
+  0x75, 0x2a, 0xd6, 0x9e, 0x85, 0x82, 0x47, 0x17, 0x31, 0xf5, 0x5d, 0x93, 0xcd, 0xb2, 0x88, 0x79,
+  0x46, 0x17, 0x0f, 0xbb, 0x5d, 0x1b, 0x99, 0x25, 0x54, 0x05, 0x3e, 0x8b, 0x4d, 0xaa, 0x75, 0x56,
+  0x26, 0xb4, 0xc4, 0xa8, 0xc7, 0x7f, 0xa1, 0x02, 0x7e, 0xb4, 0x44, 0xdf, 0xb5, 0xd6, 0x8e, 0xf5,
+  0x41, 0x2e, 0x2b, 0xc6, 0xfe, 0xc1, 0x92, 0xe5, 0x98, 0xa9, 0x7d, 0xa6, 0x8d, 0x49, 0x49, 0xd3,
+  0xe8, 0xeb, 0xe3, 0x23, 0xb4, 0x4a, 0x87, 0x83, 0x2d, 0xaf, 0xc4, 0x6f, 0xad, 0xcd, 0xcd, 0xd6,
+  0xaa, 0x18, 0x0e, 0x2d, 0x75, 0x86, 0xf8, 0x13, 0x8a, 0xab, 0x53, 0x8e, 0xaf, 0x42, 0x61, 0x9c,
+  0x53, 0x7e, 0x1d, 0x02, 0xb1, 0x04, 0xe2, 0xb0, 0x36, 0x20, 0x60, 0x99, 0xb7, 0x84, 0x83, 0x4c,
+  0xee, 0xa9, 0x8e, 0x91, 0xe2, 0x1e, 0xfc, 0xf2, 0x4b, 0xdd, 0xee, 0x7d, 0xfd, 0x00, 0xd5, 0xa1,
+  0x1b, 0x6c, 0x7c, 0xd5, 0x60, 0x11, 0x2a, 0x95, 0xbd, 0x1a, 0xc9, 0xd2, 0x21, 0xd3, 0x88, 0x24,
+  0x48, 0x23, 0xb2, 0xa6, 0xc1, 0x23, 0x54, 0x06, 0x40, 0xe9, 0x7a, 0xa6, 0xea, 0x00, 0x79, 0xfa,
+  0x5d, 0xa7, 0xcc, 0x8b, 0x2c, 0x1e, 0x36, 0xc8, 0xf9, 0x4d, 0x9c, 0xcf, 0x61, 0x3b, 0xcb, 0x0e,
+  0xe5, 0x8d, 0x94, 0x35, 0x71, 0x85, 0xac, 0x17, 0x33, 0xed, 0x5b, 0xb5, 0x62, 0xdc, 0x9b, 0x2f,
+  0xfc, 0x19, 0x80, 0x7a, 0x39, 0x21, 0x9c, 0xc6, 0x19, 0xba, 0x7d, 0x47, 0xb4, 0x36, 0x7a, 0x87,
+  0x2e, 0x62, 0x9e, 0xa4, 0xeb, 0x38, 0x1e, 0xd5, 0x48, 0x1e, 0x4b, 0x4a, 0xc8, 0xe0, 0x1e, 0xfa,
+  0xee, 0x99, 0xc8, 0x3c, 0xe1, 0xe0, 0x3e, 0x9f, 0x29, 0x1e, 0x00, 0x12, 0xb0, 0x98, 0x3a, 0xdf,
+  0xdc, 0x88, 0x88, 0x04, 0x02, 0xad, 0x07, 0xea, 0x43, 0x48, 0x7b, 0xfe, 0x76, 0xaf, 0xe3, 0xb8,
+  0x5d, 0xd7, 0x5b, 0xe4, 0x9f, 0xb5, 0xb6, 0xac, 0xab, 0xe4, 0x5d, 0x1b, 0x2a, 0xdb, 0x64, 0xa9,
+  0x31, 0x2c, 0x86, 0x56, 0xcf, 0xd9, 0x61, 0x11, 0x90, 0x82, 0x8c, 0x55, 0xac, 0xdc, 0x41, 0x7f,
+  0xc6, 0x6f, 0x6e, 0x2c, 0xea, 0x16, 0x9f, 0x6b, 0xaf, 0xd8, 0xac, 0xc4, 0x18, 0x50, 0x27, 0xa3,
+  0x0e, 0xbd, 0x1c, 0xe5, 0x46, 0x15, 0xd3, 0xb2, 0x78, 0x55, 0x8e, 0x0c, 0x20, 0x02, 0xca, 0xe8,
+  0x65, 0x9c, 0xc7, 0x67, 0x93, 0x68, 0x69, 0x69, 0xe4, 0xa5, 0xbd, 0x09, 0x28, 0x62, 0x58, 0x7e,
+  0x14, 0xe1, 0xbe, 0x95, 0x11, 0xbc, 0xa4, 0xbf, 0x69, 0x9d, 0x45, 0x98, 0xa5, 0x08, 0xa6, 0x41,
+  0x76, 0x1e, 0x27, 0xbc, 0xac, 0xbb, 0xbb, 0xb3, 0x1f, 0xb8, 0xf4, 0x5e, 0x18, 0x3a, 0x79, 0x0a,
+  0xe3, 0x95, 0xcf, 0x02, 0xd0, 0x5a, 0x83, 0xb3, 0xf4, 0x12, 0xc9, 0xd9, 0x28, 0xf5, 0xcd, 0x8a,
+  0xf6, 0x70, 0x6c, 0x2b, 0xbe, 0x84, 0x17, 0xca, 0xf2, 0x16, 0x8b, 0xda, 0x6e, 0x69, 0x72, 0x10,
+  0x97, 0x33, 0x3b, 0xc0, 0x6f, 0xce, 0x82, 0x24, 0x5a, 0x11, 0xee, 0xcb, 0xba, 0x6c, 0xae, 0x76,
+  0xef, 0xcb, 0x83, 0xfb, 0xc4, 0xd3, 0xf9, 0x04, 0x2f, 0xc1, 0xee, 0x49, 0xa1, 0x65, 0x5f, 0xc7,
+  0x11, 0x72, 0xe3, 0x16, 0x88, 0x8e, 0xb4, 0xa4, 0x31, 0xbd, 0xe0, 0xef, 0x2c, 0x31, 0x2d, 0x68,
+  0xee, 0x35, 0x28, 0xf6, 0xe5, 0x76, 0x90, 0xba, 0xaa, 0x4a, 0xe3, 0xc0, 0xbe, 0x7b, 0xdd, 0x58,
+  0xe8, 0xc8, 0x96, 0x7c, 0x92, 0x1f, 0x59, 0x94, 0x61, 0xea, 0x2b, 0xee, 0x46, 0x71, 0x09, 0x7f,
+  0x13, 0x5d, 0x19, 0x36, 0x01, 0x15, 0x68, 0xdd, 0x15, 0x8a, 0x44, 0x7b, 0x6a, 0xca, 0x0a, 0x4a,
+  0xcc, 0xd2, 0x35, 0xc4, 0xa9, 0x0b, 0xd5, 0x79, 0x44, 0x83, 0xdf, 0x36, 0x25, 0x60, 0x47, 0x84,
+  0xa0, 0x21, 0xae, 0x61, 0xdf, 0x07, 0xe7, 0xdb, 0x03, 0x72, 0xf9, 0x07, 0x54, 0xa8, 0x11, 0x92,
+  0x0f, 0x70, 0x00, 0x23, 0x33, 0x9d, 0xa2, 0xaa, 0x88, 0x17, 0x22, 0xac, 0x15, 0x51, 0xda, 0xe8,
+  0x86, 0xda, 0x4a, 0x67, 0x2a, 0xe6, 0x6c, 0x83, 0x3f, 0x4a, 0x5e, 0x14, 0x49, 0x93, 0x21, 0xc6,
+  0x00, 0xb3, 0x1c, 0xed, 0x38, 0x79, 0x3c, 0x5e, 0xaf, 0x38, 0xc1, 0xb5, 0x94, 0x58, 0x36, 0x90,
+  0x7a, 0x26, 0x21, 0xc8, 0xc4, 0x34, 0x01, 0xcc, 0x65, 0xc6, 0x28, 0x40, 0x68, 0x3c, 0xab, 0x72,
+  0xb3, 0xc8, 0x1d, 0x55, 0xc6, 0x9a, 0x9c, 0xd0, 0x81, 0x07, 0x63, 0xf2, 0xb3, 0x8d, 0x13, 0x51,
+  0x96, 0x3c, 0x6a, 0xc9, 0xdd, 0x9b, 0xe2, 0xa7, 0x04, 0xa0, 0xd6, 0x8a, 0x8c, 0xb3, 0x79, 0x51,
+  0x40, 0x0b, 0x15, 0xa7, 0xae, 0x43, 0xaa, 0xb6, 0x10, 0xaf, 0x4f, 0xab, 0x2c, 0xb3, 0x10, 0x5b,
+  0x06, 0xba, 0xbc, 0x4c, 0x3a, 0x3f, 0xec, 0xb0, 0x43, 0xdc, 0x80, 0x5b, 0x8e, 0x59, 0x72, 0x76,
+  0x4f, 0x30, 0x84, 0x60, 0x59, 0xa9, 0x2e, 0x69, 0x4e, 0xd4, 0xec, 0x8a, 0x5d, 0xc0, 0xb6, 0x94,
+  0x4b, 0xa5, 0xda, 0x3e, 0xea, 0x5e, 0x5f, 0xb9, 0x66, 0x7d, 0xcc, 0x3e, 0xe0, 0x36, 0xb5, 0xe5,
+  0x28, 0xcb, 0x2c, 0x75, 0x59, 0xfb, 0xb3, 0xb7, 0xf6, 0x83, 0x18, 0xbb, 0xa0, 0x48, 0xc5, 0xad,
+  0x5a, 0x7b, 0x8f, 0xd3, 0x6f, 0x99, 0xce, 0xec, 0xce, 0x12, 0x7b, 0x8d, 0x11, 0x26, 0xac, 0xa4,
+  0x22, 0xda, 0x7d, 0xa1, 0x35, 0xc5, 0x1a, 0x3c, 0x2c, 0x19, 0xc4, 0xe7, 0x8f, 0x3f, 0x2e, 0xb3,
+  0x03, 0xa9, 0x1b, 0x3e, 0xe8, 0x67, 0x24, 0x8b, 0xf1, 0x07, 0x9e, 0x87, 0x0d, 0x36, 0x74, 0x48,
+  0x8f, 0xcb, 0xf3, 0x57, 0x4a, 0x0a, 0x2f, 0x95, 0x8d, 0xa6, 0xbf, 0x9c, 0x00, 0x77, 0xad, 0x08,
+  0x61, 0x98, 0xb1, 0x7d, 0x4b, 0x44, 0xdb, 0x55, 0x14, 0xbd, 0x5b, 0xa2, 0xe8, 0x21, 0x0a, 0x8e,
+  0x69, 0x40, 0xab, 0x14, 0x4e, 0x0a, 0x0e, 0x0f, 0xc3, 0x7c, 0xad, 0x5b, 0xe7, 0x19, 0x2d, 0x5d,
+  0x1a, 0xc8, 0x91, 0x0b, 0xd9, 0xad, 0xf1, 0x4a, 0xad, 0x5b, 0xab, 0x70, 0xaf, 0x54, 0xb8, 0xb7,
+  0xaa, 0xb0, 0x28, 0xcd, 0x43, 0xf4, 0xcc, 0xe9, 0x79, 0x5a, 0x0e, 0x50, 0x44, 0x4d, 0xe1, 0x06,
+  0xe6, 0x8c, 0x82, 0x2c, 0x54, 0xb3, 0x76, 0xdd, 0xd6, 0x99, 0x6b, 0xeb, 0xd2, 0x6e, 0xb5, 0xdc,
+  0x1e, 0xdd, 0x7a, 0x6d, 0xbe, 0xe2, 0xa9, 0x26, 0x03, 0xfe, 0xad, 0x8b, 0xfb, 0x8d, 0x0a, 0xb1,
+  0xd2, 0x80, 0x5f, 0xdd, 0x9b, 0x31, 0x90, 0x1b, 0xfb, 0x7c, 0xc1, 0xd3, 0xb0, 0x44, 0x54, 0x7a,
+  0xa9, 0xb8, 0x4a, 0x71, 0x6a, 0xc6, 0x97, 0x71, 0x88, 0x72, 0x11, 0x3b, 0x4b, 0x4b, 0xc5, 0xdb,
+  0x0e, 0xeb, 0x5a, 0xbd, 0x66, 0xf1, 0x33, 0x06, 0xfa, 0xaa, 0x6f, 0x99, 0x98, 0xb1, 0x78, 0xdf,
+  0x15, 0x8f, 0xf8, 0x6f, 0x83, 0x74, 0xf9, 0x70, 0x18, 0x48, 0x0d, 0xef, 0xc5, 0xdb, 0xe0, 0x6e,
+  0x1e, 0x0e, 0x03, 0xff, 0x85, 0xda, 0xc2, 0x95, 0xba, 0x73, 0x7d, 0x46, 0xbf, 0x75, 0x77, 0xf6,
+  0x56, 0x77, 0xe7, 0xf6, 0xad, 0xbb, 0xb3, 0xb7, 0xba, 0x3b, 0xb7, 0xbf, 0xb6, 0x3b, 0x7b, 0xeb,
+  0x75, 0xe7, 0xb6, 0xd9, 0x9d, 0x4b, 0x38, 0x7b, 0xbb, 0xcc, 0xd9, 0x20, 0x25, 0xca, 0x9c, 0xfd,
+  0xff, 0x19, 0xfb, 0x67, 0x65, 0x6c, 0x56, 0x6b, 0x4a, 0x5a, 0x8a, 0xb8, 0x97, 0x61, 0xd8, 0xfe,
+  0xc4, 0x0d, 0xae, 0x95, 0x87, 0x81, 0xc2, 0x6a, 0x20, 0x10, 0x1c, 0x88, 0x63, 0x41, 0x65, 0x21,
+  0x80, 0x66, 0xdd, 0xa6, 0x3c, 0x9b, 0x45, 0xaa, 0x81, 0xac, 0x6e, 0x83, 0x43, 0x5b, 0x6a, 0x0c,
+  0xfb, 0x89, 0xb8, 0x35, 0xf2, 0x52, 0x06, 0xf3, 0x6b, 0x3c, 0xdf, 0x2c, 0x03, 0x9b, 0x98, 0xfe,
+  0x16, 0xef, 0xb4, 0xd5, 0xde, 0x47, 0xae, 0x0c, 0x2c, 0x4c, 0xa6, 0x09, 0x28, 0x77, 0xbe, 0xb6,
+  0xc0, 0x98, 0xd7, 0xe0, 0x4c, 0xdb, 0x0b, 0xec, 0xc6, 0x30, 0x82, 0xdd, 0xae, 0xff, 0xb8, 0x67,
+  0xee, 0x30, 0x27, 0xe4, 0x39, 0xb4, 0xb9, 0xdd, 0xdb, 0xf6, 0x1f, 0x3c, 0x32, 0x33, 0x38, 0x3c,
+  0xd1, 0xe7, 0x8b, 0xa2, 0x98, 0xf5, 0xb7, 0xb6, 0x82, 0x59, 0x4c, 0x71, 0x43, 0x37, 0xa7, 0x51,
+  0x11, 0xa5, 0xa0, 0x8d, 0x4d, 0xb7, 0x2e, 0xb7, 0xb7, 0x64, 0xa7, 0x3e, 0x07, 0xe4, 0x71, 0x31,
+  0x0f, 0x31, 0x60, 0x11, 0xfc, 0xb9, 0xb8, 0x0b, 0x58, 0xcf, 0x55, 0x42, 0x9a, 0x2c, 0xee, 0x8a,
+  0xd1, 0x1c, 0x1a, 0x53, 0xe2, 0x53, 0x6f, 0xda, 0xc9, 0x22, 0x2c, 0x79, 0x19, 0x49, 0x96, 0xc0,
+  0xb4, 0x2b, 0x6e, 0xdd, 0x08, 0x36, 0x0c, 0x77, 0xe9, 0x12, 0xda, 0xd0, 0x48, 0xe9, 0xd8, 0x08,
+  0x3e, 0x61, 0x4c, 0xcf, 0x72, 0x52, 0x9c, 0x74, 0xf2, 0x79, 0x92, 0xc5, 0x79, 0x84, 0xbf, 0xb0,
+  0xd7, 0xbb, 0x8b, 0x21, 0xa7, 0x00, 0x4f, 0xa9, 0x72, 0xb3, 0x22, 0x33, 0x6b, 0x9e, 0xc4, 0xc5,
+  0x70, 0x1c, 0x5c, 0x00, 0xc1, 0x17, 0x51, 0x5c, 0xdc, 0xc5, 0x13, 0xaf, 0x7c, 0x16, 0x45, 0x21,
+  0xe7, 0x4c, 0x67, 0x17, 0x77, 0x67, 0xd0, 0xee, 0x78, 0x16, 0x17, 0x34, 0x84, 0x9c, 0x1c, 0x27,
+  0xa3, 0x8b, 0xbb, 0xb2, 0x43, 0x3e, 0x61, 0x68, 0xd7, 0xe1, 0x83, 0xbb, 0x68, 0xa6, 0xf8, 0x3d,
+  0x88, 0x3f, 0x72, 0x02, 0x5e, 0x1d, 0x48, 0xc9, 0x11, 0x24, 0xf1, 0x91, 0x3a, 0x1e, 0x21, 0x6c,
+  0x1e, 0x62, 0x7f, 0xf7, 0x8d, 0x08, 0x4b, 0x0e, 0xa8, 0x4e, 0x14, 0xff, 0xcb, 0xb6, 0x8f, 0xdb,
+  0xce, 0x74, 0x0d, 0xc1, 0x97, 0x96, 0x5f, 0x76, 0xd7, 0xf5, 0xa9, 0xe3, 0x55, 0xe9, 0x22, 0x51,
+  0x1f, 0xf4, 0xc7, 0x0c, 0x5d, 0x61, 0xc5, 0xe5, 0xe1, 0xed, 0xcb, 0x3a, 0x15, 0xd1, 0x65, 0x77,
+  0x11, 0x87, 0xc0, 0xc0, 0xcb, 0x22, 0xaa, 0x24, 0xfe, 0x44, 0xe7, 0xbc, 0x84, 0xf1, 0x3a, 0x49,
+  0x5f, 0x63, 0x5c, 0x50, 0xde, 0x78, 0x0b, 0xde, 0xf2, 0x8d, 0xf1, 0x34, 0x50, 0xb1, 0xb4, 0xaa,
+  0x93, 0xa4, 0xb2, 0x9c, 0xcd, 0x16, 0x46, 0xd8, 0x70, 0x8d, 0x44, 0x8b, 0xac, 0x26, 0x44, 0x35,
+  0xdc, 0xac, 0x51, 0x6c, 0x18, 0x47, 0xd9, 0xc2, 0xbc, 0x20, 0xb8, 0x74, 0x8b, 0xb9, 0x54, 0x6e,
+  0x39, 0x15, 0xa0, 0x38, 0xc0, 0x61, 0xa0, 0x63, 0x82, 0xe1, 0x06, 0xd3, 0xac, 0xf0, 0x45, 0x69,
+  0x58, 0x08, 0xb8, 0xfb, 0x74, 0x32, 0x00, 0x42, 0xaa, 0x57, 0x5f, 0xf7, 0x0b, 0xf4, 0x6a, 0x50,
+  0xb2, 0x13, 0xcf, 0x95, 0x61, 0x61, 0xc5, 0xcd, 0x17, 0x6f, 0xe7, 0x64, 0xc4, 0x19, 0xe3, 0x22,
+  0x82, 0x04, 0x1d, 0x9a, 0xd5, 0x20, 0x67, 0x53, 0x70, 0x13, 0x0a, 0x94, 0x68, 0x46, 0xe0, 0x6d,
+  0x9b, 0x5e, 0x58, 0xfa, 0xfe, 0x9c, 0xa3, 0xef, 0x64, 0x42, 0x01, 0xba, 0x2d, 0xf7, 0xed, 0xc9,
+  0x4b, 0xbe, 0x30, 0x67, 0x7a, 0x6a, 0xe2, 0xdd, 0xb9, 0xa5, 0x43, 0xcd, 0x75, 0x1b, 0x03, 0xfd,
+  0x91, 0xea, 0x3d, 0xb5, 0x50, 0xd0, 0x2d, 0x71, 0x32, 0x30, 0x53, 0xb8, 0x0a, 0xb3, 0x64, 0x55,
+  0x7a, 0xd4, 0x22, 0x40, 0x0b, 0xed, 0x7a, 0x08, 0xe2, 0x44, 0x22, 0xd0, 0x7e, 0x49, 0xa6, 0xc3,
+  0x52, 0x29, 0x06, 0x72, 0x65, 0x15, 0xd2, 0xb1, 0x90, 0x97, 0x0c, 0x17, 0x47, 0xf3, 0x72, 0x58,
+  0x82, 0x29, 0xe0, 0x0d, 0xcb, 0x0b, 0x11, 0xc9, 0x13, 0x00, 0x77, 0xef, 0x3a, 0x7b, 0x38, 0xa2,
+  0x7e, 0x9c, 0xd3, 0xaf, 0x99, 0x49, 0x63, 0xe6, 0x95, 0xfd, 0x9b, 0x29, 0x58, 0x18, 0xe5, 0x2b,
+  0x2a, 0x8d, 0x32, 0x75, 0xbe, 0xcb, 0xf5, 0x97, 0xe7, 0x2b, 0x91, 0x9c, 0x8c, 0x59, 0xce, 0x76,
+  0x87, 0x31, 0xd9, 0x21, 0x40, 0x92, 0x51, 0x5c, 0x4c, 0x7a, 0x03, 0x41, 0xca, 0x3b, 0x29, 0x06,
+  0x4c, 0x43, 0x84, 0x53, 0x5d, 0xe0, 0x6b, 0x02, 0x42, 0x37, 0xc8, 0x0b, 0x79, 0x03, 0x73, 0x85,
+  0x2c, 0x68, 0x3d, 0xde, 0x69, 0xad, 0x31, 0xd3, 0x5b, 0x3b, 0x26, 0x98, 0x39, 0x44, 0x14, 0xc1,
+  0xda, 0x9e, 0xcb, 0x8d, 0x73, 0xb8, 0xd5, 0x7d, 0xd4, 0x7f, 0x40, 0x97, 0xb1, 0xb6, 0x9f, 0xf4,
+  0x1f, 0xee, 0xb4, 0xea, 0x46, 0x5e, 0xdf, 0xc1, 0xdb, 0xd7, 0xd3, 0xcf, 0xbe, 0x6b, 0x57, 0x37,
+  0xb5, 0xec, 0x69, 0x25, 0x26, 0x93, 0xcb, 0xfd, 0xe0, 0x8a, 0xf8, 0x09, 0xee, 0xee, 0x8e, 0x8c,
+  0xaa, 0xe0, 0x3e, 0xda, 0x71, 0xcb, 0xf7, 0xce, 0x0c, 0xb4, 0xed, 0x7a, 0xbc, 0xce, 0x7d, 0x54,
+  0xf1, 0x7f, 0xe9, 0x3c, 0xd6, 0x15, 0xfc, 0xf1, 0x0f, 0x1a, 0x7b, 0x4f, 0x63, 0x7f, 0xf0, 0x75,
+  0xd8, 0x7b, 0x36, 0xf6, 0xff, 0xf3, 0xdf, 0xff, 0xf1, 0x9f, 0x4c, 0xfa, 0x1f, 0xef, 0xea, 0x1a,
+  0xba, 0x66, 0xc0, 0x8c, 0xd3, 0xdb, 0xcc, 0x3b, 0xb3, 0x6f, 0x3b, 0x64, 0x1d, 0xf4, 0x1a, 0x86,
+  0x77, 0xd9, 0xfc, 0x53, 0xbe, 0xb1, 0xc2, 0xdb, 0x85, 0xdb, 0x33, 0xa8, 0x19, 0x47, 0x9e, 0x63,
+  0xaf, 0x78, 0xa9, 0xbc, 0xb1, 0xe2, 0x9d, 0x4c, 0x23, 0xf4, 0x9d, 0xb0, 0xc2, 0x9b, 0x58, 0x62,
+  0xa6, 0x9c, 0x6b, 0xc8, 0x3f, 0xcc, 0xd2, 0x33, 0xd4, 0x9a, 0x3a, 0x3a, 0x80, 0x6b, 0x97, 0x03,
+  0xb8, 0xee, 0xc0, 0xcf, 0xfd, 0xfb, 0x5e, 0x8d, 0xcf, 0x3d, 0xb6, 0xce, 0x6c, 0x00, 0xb4, 0x07,
+  0x87, 0x04, 0x8f, 0x91, 0x68, 0x40, 0x62, 0x1d, 0x1f, 0x59, 0xf8, 0xa1, 0x5b, 0x3e, 0x99, 0xfa,
+  0xe0, 0xf0, 0x98, 0x62, 0xea, 0x23, 0x3a, 0x58, 0x46, 0x0f, 0x8e, 0x8f, 0xc4, 0x19, 0x9b, 0x67,
+  0xc4, 0x22, 0xeb, 0x52, 0x2c, 0x32, 0xb3, 0xb8, 0xdd, 0x3b, 0xbc, 0xb2, 0xd0, 0xed, 0x76, 0x81,
+  0xb1, 0x11, 0xd8, 0x5e, 0xbb, 0xa9, 0xd8, 0xe3, 0x1d, 0x20, 0x99, 0xc5, 0x77, 0x00, 0xfb, 0x2a,
+  0xf4, 0x64, 0x42, 0xa2, 0x9b, 0xd0, 0x18, 0x3d, 0xca, 0x38, 0x3e, 0x22, 0x99, 0xf4, 0xdf, 0x2e,
+  0xfc, 0xf5, 0x68, 0xfb, 0xf4, 0x63, 0x7c, 0x5a, 0x23, 0x0b, 0x97, 0x08, 0x50, 0x1b, 0x7b, 0xc9,
+  0xb1, 0x94, 0xbd, 0x40, 0xab, 0x6e, 0x17, 0xcd, 0x9a, 0xe1, 0x96, 0xa5, 0x1a, 0xe2, 0xd9, 0x03,
+  0x54, 0xec, 0xfb, 0x42, 0xf1, 0xaf, 0x51, 0x09, 0xab, 0x37, 0x22, 0xab, 0xea, 0x60, 0x4b, 0x62,
+  0x6d, 0x35, 0x04, 0x51, 0x94, 0x15, 0xaf, 0xa7, 0x13, 0x7e, 0x9d, 0x46, 0xb8, 0x55, 0x5e, 0x08,
+  0x2c, 0x7d, 0x90, 0xfb, 0x58, 0xec, 0x7a, 0x2c, 0x87, 0x91, 0x75, 0xe3, 0xb8, 0x94, 0x4d, 0xe0,
+  0xb2, 0x3e, 0x7b, 0xcd, 0x21, 0x17, 0x54, 0xaf, 0x2d, 0x43, 0xbf, 0xf3, 0xd2, 0x8b, 0xa1, 0xb5,
+  0xab, 0x7d, 0x40, 0xa3, 0x80, 0x47, 0x9c, 0x72, 0x24, 0xca, 0x66, 0x71, 0x8b, 0xda, 0xc6, 0xb7,
+  0x7a, 0x6a, 0x77, 0xdb, 0x0d, 0x6a, 0xe6, 0xc1, 0x68, 0x85, 0x7f, 0x44, 0xdd, 0xee, 0xbb, 0x01,
+  0xdf, 0x4a, 0x57, 0x89, 0x65, 0x3b, 0xf1, 0x06, 0x9c, 0xa6, 0xd7, 0xc4, 0x46, 0x83, 0xca, 0x0b,
+  0xea, 0x8b, 0x8a, 0x71, 0x63, 0x9e, 0xa5, 0x09, 0x30, 0x54, 0x67, 0xe4, 0x37, 0x80, 0x97, 0xbc,
+  0xa9, 0xaa, 0x8a, 0xb1, 0xdc, 0xf6, 0x59, 0x85, 0xea, 0x8e, 0xa7, 0x5e, 0xe2, 0xb5, 0x00, 0x27,
+  0x48, 0xae, 0x9d, 0xe8, 0x87, 0x98, 0x6f, 0xe0, 0xd7, 0x2b, 0xe3, 0x48, 0x12, 0x31, 0x73, 0x9c,
+  0x27, 0x6e, 0x61, 0x11, 0xab, 0x8c, 0xff, 0x5c, 0xb0, 0xd9, 0x59, 0x42, 0x00, 0xa1, 0x44, 0xb5,
+  0x4f, 0x78, 0xb9, 0xba, 0x95, 0x85, 0x85, 0x9b, 0xbe, 0x79, 0xa4, 0xab, 0xea, 0xf5, 0x34, 0x09,
+  0xe5, 0x68, 0x47, 0xb0, 0x74, 0xfe, 0xc1, 0xd9, 0xdc, 0xec, 0x2b, 0x2b, 0xb7, 0x28, 0x48, 0x55,
+  0x7a, 0xaa, 0xf2, 0x9a, 0x62, 0xff, 0x60, 0x14, 0x5b, 0xf0, 0x28, 0x96, 0xd6, 0xd4, 0xdb, 0x98,
+  0x5a, 0xc4, 0x88, 0x58, 0xba, 0xee, 0x46, 0x83, 0x7e, 0xbb, 0x94, 0x31, 0x84, 0x56, 0xaa, 0xfc,
+  0xd6, 0xd6, 0xd0, 0x5e, 0x2d, 0xcb, 0x58, 0xed, 0x8b, 0x14, 0x07, 0xa8, 0xc1, 0xe3, 0x5b, 0x24,
+  0x27, 0x69, 0x18, 0x5c, 0x6b, 0x47, 0x27, 0x95, 0x20, 0x1c, 0x38, 0x5b, 0xf4, 0xd9, 0xaa, 0xbc,
+  0x73, 0xf3, 0xb1, 0x05, 0x4c, 0x88, 0xfa, 0xdc, 0x61, 0x4a, 0x3f, 0x27, 0x73, 0xba, 0x95, 0xff,
+  0x5d, 0x14, 0xd2, 0xd7, 0xc5, 0x1c, 0x7f, 0xf6, 0xb3, 0x18, 0x7f, 0x8e, 0x83, 0xa2, 0x75, 0x6a,
+  0x3c, 0x39, 0x43, 0x75, 0x73, 0x78, 0x70, 0x62, 0x76, 0x91, 0xf0, 0xd4, 0x79, 0x6c, 0x3b, 0xe7,
+  0x51, 0x5d, 0x1f, 0x65, 0xfe, 0x69, 0xa5, 0x61, 0x35, 0x3b, 0xa6, 0x91, 0xf2, 0xf0, 0x63, 0xfb,
+  0xac, 0x38, 0x9b, 0xee, 0xea, 0xf6, 0x48, 0x05, 0x59, 0x4f, 0x89, 0xfc, 0xcb, 0xb5, 0x09, 0x0f,
+  0x74, 0x6d, 0x23, 0x5d, 0xf4, 0xf1, 0x74, 0xe8, 0x3c, 0x30, 0xca, 0xfe, 0xf1, 0x0f, 0x2d, 0xe1,
+  0x30, 0x12, 0xa3, 0x77, 0x25, 0xdd, 0xb4, 0xc1, 0x08, 0x3d, 0x19, 0x3d, 0x7b, 0x30, 0x49, 0xe7,
+  0xe1, 0x75, 0x87, 0x02, 0x1d, 0x0b, 0x85, 0xc9, 0x44, 0xfa, 0x70, 0xc7, 0xc4, 0xfa, 0x70, 0x57,
+  0xa3, 0x05, 0xd6, 0xfb, 0x9f, 0x8a, 0xa6, 0xfd, 0xf4, 0xbc, 0x54, 0x70, 0xc7, 0x22, 0x67, 0xe7,
+  0xb1, 0x59, 0xf0, 0x3f, 0xff, 0x33, 0x97, 0x7a, 0x95, 0xc5, 0xbf, 0xff, 0xbd, 0x62, 0x1b, 0x59,
+  0xf2, 0x91, 0x55, 0xf2, 0x91, 0x55, 0xf2, 0x1f, 0xff, 0x59, 0x55, 0xf9, 0x01, 0x5a, 0x53, 0x2a,
+  0xf9, 0xd8, 0x2a, 0xf9, 0xd8, 0x28, 0xf9, 0x2f, 0xff, 0xed, 0x3f, 0xa8, 0x82, 0xc7, 0xa0, 0x34,
+  0x95, 0x0a, 0xee, 0x76, 0xcd, 0x82, 0xbb, 0x3d, 0xab, 0xca, 0x7f, 0xb2, 0xaa, 0xa4, 0xb0, 0xaf,
+  0xb0, 0xd8, 0x94, 0x31, 0x58, 0xfd, 0xb4, 0xfb, 0xc8, 0xc2, 0xf0, 0x3f, 0xac, 0xba, 0x97, 0x60,
+  0x78, 0x62, 0x61, 0x78, 0xf2, 0xc4, 0x1c, 0xc0, 0xff, 0xa8, 0x10, 0x00, 0x8f, 0xd2, 0x5a, 0x57,
+  0xa4, 0xd9, 0x54, 0x3b, 0x2c, 0x43, 0xfb, 0xfe, 0x4b, 0xcb, 0x3a, 0xf2, 0x95, 0x8e, 0x13, 0xa0,
+  0x29, 0xb2, 0xcf, 0x04, 0xba, 0x45, 0xbc, 0x14, 0x0e, 0x11, 0x7c, 0xc6, 0x6e, 0x59, 0x9a, 0xf3,
+  0x43, 0x3e, 0xe4, 0x27, 0xdd, 0xb2, 0xe2, 0x1d, 0xd1, 0xb4, 0xea, 0xb8, 0x68, 0x31, 0xc3, 0x12,
+  0x2f, 0x8a, 0xc4, 0xf5, 0x2c, 0xa7, 0x03, 0x89, 0xb5, 0xb1, 0x38, 0xbb, 0x01, 0xd4, 0x22, 0x30,
+  0xcb, 0xd7, 0x79, 0xc3, 0x7e, 0x95, 0x33, 0x9d, 0x68, 0x5f, 0x29, 0x86, 0xca, 0xbf, 0x92, 0xcb,
+  0x87, 0x3c, 0x95, 0xa6, 0x35, 0x23, 0x5b, 0x51, 0xdc, 0x00, 0x6b, 0x19, 0x56, 0x64, 0xee, 0x23,
+  0xe3, 0x28, 0xe7, 0x3b, 0xbc, 0x0d, 0x91, 0x5f, 0xc5, 0x42, 0x21, 0x05, 0x5d, 0x8a, 0x2b, 0xee,
+  0xc8, 0x47, 0x71, 0x84, 0x27, 0x07, 0xa8, 0x44, 0xb9, 0x8e, 0xea, 0x2f, 0x6f, 0x66, 0x8c, 0x83,
+  0x84, 0x6f, 0x34, 0xdc, 0xca, 0xd1, 0xa3, 0xe4, 0x0c, 0x79, 0x5b, 0x9f, 0x8f, 0x3b, 0x4b, 0xcb,
+  0x1b, 0x8d, 0xf6, 0xcc, 0x8e, 0xb2, 0x1d, 0x62, 0xe8, 0x12, 0xd5, 0xff, 0x4b, 0xce, 0x2d, 0xeb,
+  0x37, 0x4e, 0xbb, 0xc3, 0xa8, 0x73, 0x38, 0x39, 0x91, 0xe5, 0x98, 0x63, 0xb2, 0x35, 0x6d, 0xe9,
+  0xa2, 0xa2, 0xf9, 0x28, 0x64, 0x0b, 0x2f, 0x7a, 0x1b, 0x61, 0x2e, 0x70, 0x56, 0x18, 0x9e, 0x2c,
+  0x78, 0xf5, 0xb0, 0x2d, 0xc3, 0xcd, 0xd7, 0xb8, 0xc0, 0x83, 0xb2, 0x6d, 0x7b, 0xaf, 0xd4, 0x7b,
+  0xad, 0xa0, 0x3a, 0x86, 0xd8, 0x39, 0x00, 0xa9, 0x70, 0x57, 0xb1, 0x63, 0x92, 0x57, 0x48, 0xb5,
+  0xfc, 0xaf, 0xc4, 0xb0, 0xbd, 0x07, 0x52, 0xa2, 0xec, 0x32, 0xaa, 0xe7, 0x4b, 0xbe, 0xed, 0x53,
+  0xc3, 0xdf, 0xbe, 0xb5, 0xb3, 0x21, 0x58, 0x50, 0x1e, 0xe8, 0x62, 0x5a, 0xd9, 0x57, 0xf7, 0xb9,
+  0xe3, 0x62, 0x0c, 0x86, 0x3e, 0xfc, 0x8c, 0xc7, 0xee, 0xa0, 0xb6, 0x9f, 0x5a, 0xb0, 0x39, 0xd5,
+  0x48, 0xfe, 0x62, 0x1d, 0x66, 0x70, 0x66, 0xb9, 0xcb, 0xca, 0xaa, 0x03, 0x80, 0x43, 0x0b, 0xda,
+  0x44, 0xd4, 0xf2, 0x3b, 0x02, 0xfa, 0x2e, 0x61, 0x4e, 0x5e, 0xcb, 0x0c, 0xcf, 0xbd, 0x2d, 0x5f,
+  0x92, 0x59, 0xe2, 0xbd, 0x8c, 0x25, 0x4c, 0xb7, 0x3a, 0xec, 0x7f, 0x7e, 0x92, 0xce, 0x10, 0x09,
+  0x35, 0xce, 0xcd, 0x58, 0x4e, 0xe0, 0xb5, 0x0b, 0xf3, 0xb4, 0x72, 0x14, 0x3b, 0x13, 0x96, 0x1c,
+  0x9b, 0x9e, 0x45, 0xe3, 0x49, 0x34, 0xe2, 0xd7, 0x43, 0xd0, 0x9c, 0x61, 0x8b, 0x9d, 0x15, 0xab,
+  0x05, 0x4d, 0x45, 0x7b, 0xad, 0x90, 0xd4, 0xaf, 0x55, 0x9c, 0xa6, 0x65, 0x69, 0xb1, 0xb2, 0x10,
+  0xd8, 0x1b, 0x7e, 0x7a, 0x5d, 0x4c, 0x5c, 0xe1, 0x92, 0x4e, 0x85, 0xe2, 0x4a, 0x57, 0xe2, 0xc4,
+  0xd3, 0x69, 0x14, 0xc6, 0x40, 0x38, 0xbe, 0x70, 0xc2, 0xc1, 0x1d, 0x61, 0x23, 0x2a, 0xae, 0xb3,
+  0x70, 0x5f, 0x91, 0x91, 0x27, 0x30, 0x62, 0xfc, 0x3a, 0xdf, 0x1e, 0xf8, 0xcd, 0x3c, 0x57, 0xe3,
+  0x6e, 0x76, 0x63, 0xc4, 0x71, 0x68, 0x60, 0xbd, 0x9a, 0x0b, 0x1a, 0x86, 0xcb, 0x99, 0xcd, 0x87,
+  0x20, 0xf9, 0xd3, 0xf3, 0x73, 0x90, 0x84, 0x6c, 0xf1, 0xb5, 0x3d, 0xcc, 0xd8, 0x89, 0xac, 0xf4,
+  0x84, 0x0d, 0xde, 0x18, 0x94, 0xef, 0x81, 0xad, 0xba, 0xa5, 0x42, 0x12, 0xb8, 0x12, 0xad, 0x13,
+  0x2f, 0xce, 0x8f, 0x83, 0xf9, 0xa4, 0xe0, 0xd7, 0xa9, 0xe6, 0xb8, 0x04, 0xa9, 0x4d, 0x3a, 0x59,
+  0x8c, 0xd9, 0x3f, 0x35, 0x28, 0xa0, 0x37, 0xcf, 0xd0, 0x09, 0xdc, 0x17, 0xc3, 0x50, 0xf3, 0x64,
+  0x09, 0xef, 0xf1, 0xcb, 0xb6, 0x12, 0x0e, 0x9f, 0x22, 0xcd, 0xb5, 0x18, 0x7a, 0xe5, 0x5a, 0xd0,
+  0xac, 0xec, 0x1c, 0x54, 0x50, 0x7a, 0xef, 0xad, 0x8c, 0x34, 0x6b, 0x4c, 0x59, 0xba, 0x43, 0xca,
+  0x15, 0x98, 0xdd, 0x65, 0xcd, 0x53, 0xb3, 0xc6, 0x35, 0xcc, 0x0a, 0x2a, 0x8a, 0x28, 0x48, 0x65,
+  0xcb, 0x37, 0x57, 0x65, 0x0c, 0x56, 0x14, 0x57, 0x71, 0x47, 0x6b, 0x30, 0xa8, 0xbc, 0x55, 0x48,
+  0x74, 0xb4, 0xd2, 0x1a, 0x2c, 0x3a, 0xb3, 0x11, 0x4d, 0x35, 0xc8, 0x69, 0x19, 0x57, 0x15, 0x62,
+  0x2d, 0x84, 0x2a, 0x3e, 0xea, 0x32, 0x7c, 0x0a, 0x60, 0x1d, 0x74, 0x3a, 0xb4, 0x2a, 0xa0, 0x93,
+  0x77, 0x6f, 0x6d, 0x84, 0x1a, 0xa4, 0xf9, 0x42, 0x49, 0x39, 0x26, 0x6b, 0x15, 0x61, 0x05, 0xa4,
+  0x11, 0x61, 0xc9, 0xdf, 0xbd, 0x8a, 0xae, 0x04, 0xd0, 0x88, 0xac, 0x26, 0x34, 0x6c, 0x15, 0x61,
+  0x0d, 0x50, 0x23, 0x52, 0x23, 0xaa, 0x6c, 0x15, 0x99, 0x91, 0xb9, 0x12, 0x49, 0x39, 0x10, 0x6d,
+  0x3d, 0xb6, 0x32, 0x94, 0x75, 0x81, 0x45, 0x5c, 0xb1, 0x7f, 0x9b, 0x9e, 0xcb, 0xd0, 0x11, 0x87,
+  0xb9, 0xbd, 0x0e, 0xc6, 0x22, 0xfd, 0x80, 0x23, 0xc1, 0x2d, 0xa7, 0xa8, 0x8a, 0xaa, 0xa5, 0x6c,
+  0x38, 0x6d, 0x0b, 0x8b, 0x67, 0x23, 0x55, 0xfc, 0x58, 0x3e, 0x88, 0xac, 0x23, 0x8e, 0x6e, 0xcb,
+  0x48, 0xb3, 0xfc, 0x82, 0xcd, 0x97, 0xfc, 0xf6, 0xd6, 0x0c, 0xe3, 0xbc, 0xb3, 0x24, 0x84, 0xe5,
+  0x03, 0xd8, 0x0f, 0xc4, 0x32, 0x7a, 0x73, 0x6c, 0x9d, 0xa5, 0x69, 0x91, 0x17, 0x59, 0x30, 0xa3,
+  0xe7, 0xfd, 0x60, 0x9c, 0x7c, 0xe7, 0x03, 0x09, 0xd8, 0x5c, 0x44, 0xf4, 0x26, 0x7d, 0x88, 0x6f,
+  0x25, 0xcf, 0x13, 0x65, 0x8c, 0xe9, 0x20, 0xea, 0x3c, 0xe5, 0x45, 0x0b, 0x7d, 0x4f, 0x32, 0x7a,
+  0x9f, 0x6b, 0x8c, 0x4a, 0x2f, 0xda, 0x42, 0xe9, 0xb1, 0xcc, 0x0b, 0xcb, 0xdf, 0x0b, 0xd6, 0x38,
+  0x11, 0x1c, 0xbf, 0x4e, 0xec, 0xbf, 0x90, 0x74, 0xd4, 0x4a, 0x7e, 0xf9, 0xb6, 0x91, 0x54, 0xc5,
+  0xd7, 0x16, 0xd6, 0x56, 0x13, 0x5b, 0xe6, 0x4d, 0x08, 0x25, 0xa6, 0x71, 0xa5, 0x2b, 0xe3, 0x5f,
+  0x66, 0xc0, 0x36, 0x05, 0x7b, 0x55, 0xfe, 0x0b, 0x0f, 0x65, 0x8a, 0xdf, 0x25, 0x6e, 0xe8, 0x97,
+  0xef, 0x3e, 0x0a, 0x3b, 0x79, 0xcd, 0xad, 0x64, 0x23, 0x57, 0x16, 0x6e, 0x76, 0x25, 0x37, 0x18,
+  0xd5, 0x0a, 0x16, 0x6a, 0x86, 0xa2, 0xa8, 0xf7, 0xcc, 0x2e, 0xc1, 0x57, 0x5e, 0xad, 0xa9, 0xb8,
+  0x0e, 0x39, 0x75, 0xae, 0x64, 0x03, 0x7e, 0xd4, 0x9e, 0xa2, 0x94, 0x47, 0x97, 0xd1, 0x24, 0x9d,
+  0x21, 0xbb, 0x8b, 0x4a, 0x73, 0xf3, 0xdc, 0x57, 0x59, 0xf5, 0xe3, 0x0c, 0x94, 0xb2, 0xc9, 0x75,
+  0xdd, 0x1d, 0xa7, 0xaa, 0xb9, 0x5c, 0x9e, 0xc6, 0x58, 0xf4, 0x89, 0x81, 0x52, 0xdb, 0x96, 0xdb,
+  0xac, 0xab, 0x36, 0x33, 0xd8, 0xea, 0x48, 0x99, 0x01, 0x6c, 0xcd, 0xd8, 0x78, 0xa6, 0x74, 0x29,
+  0x73, 0x96, 0x2e, 0xf4, 0xd1, 0x73, 0x28, 0xc3, 0x5b, 0x2c, 0xcb, 0x56, 0x79, 0xb5, 0xac, 0xae,
+  0x40, 0x51, 0x59, 0x9a, 0x2d, 0x2c, 0x7a, 0x59, 0x5d, 0x81, 0xa6, 0xba, 0x38, 0x6b, 0x3c, 0xd5,
+  0x25, 0xb5, 0x09, 0xd9, 0xf2, 0x25, 0xba, 0x8a, 0x51, 0x2d, 0xaa, 0xeb, 0x20, 0xac, 0x2c, 0xd1,
+  0x15, 0x7c, 0x7a, 0x4d, 0x5d, 0x03, 0x5f, 0xdd, 0x1a, 0x6d, 0x3c, 0xcc, 0x59, 0x5e, 0x54, 0x9b,
+  0x30, 0x36, 0x2c, 0xd2, 0xa6, 0xb3, 0xa4, 0xb5, 0xae, 0x36, 0xe1, 0x5b, 0xba, 0x46, 0x9b, 0x06,
+  0xe7, 0xca, 0xa2, 0xda, 0x84, 0xb1, 0x71, 0xa1, 0x36, 0x0c, 0x4d, 0x7a, 0x75, 0x6d, 0xb4, 0x33,
+  0xd5, 0xad, 0xd0, 0x36, 0x96, 0xf2, 0xaa, 0xba, 0x0a, 0xdd, 0xf2, 0xb5, 0xda, 0x08, 0x46, 0x60,
+  0x2c, 0x74, 0xf4, 0xc6, 0xb5, 0x8a, 0x9a, 0x76, 0xab, 0x45, 0x97, 0x99, 0xa7, 0x23, 0x0f, 0x82,
+  0xe5, 0x15, 0x13, 0x23, 0xba, 0x8b, 0x3a, 0x97, 0xd7, 0xf1, 0xf7, 0xcd, 0x77, 0x3f, 0x55, 0xaa,
+  0xf0, 0x15, 0xb2, 0x02, 0xf3, 0x97, 0x00, 0x55, 0x86, 0x86, 0x35, 0xa2, 0xf6, 0x97, 0x80, 0x75,
+  0x8e, 0x80, 0xae, 0x89, 0xe9, 0x6f, 0x16, 0xa9, 0x66, 0x97, 0xca, 0xe9, 0xa8, 0xff, 0x75, 0xc5,
+  0x54, 0xae, 0x5d, 0xca, 0x78, 0x17, 0xa0, 0x9a, 0xc4, 0x90, 0xd5, 0x97, 0x02, 0xaa, 0x49, 0x1d,
+  0xf1, 0x34, 0x78, 0xf5, 0xf1, 0x80, 0xba, 0x44, 0x86, 0x2e, 0xbf, 0x11, 0x50, 0x4e, 0x60, 0x28,
+  0xf3, 0xd9, 0x01, 0xf3, 0x43, 0xe7, 0x56, 0x9e, 0x20, 0xa8, 0x4d, 0x95, 0xc1, 0x87, 0xc5, 0xb5,
+  0xc8, 0x77, 0xc1, 0xbb, 0xb6, 0xcd, 0x62, 0x14, 0x5b, 0xb1, 0xc4, 0x75, 0xcf, 0x9c, 0xae, 0xa1,
+  0x00, 0x6a, 0x9e, 0xa9, 0xd7, 0xc6, 0x86, 0xe5, 0xe2, 0xf7, 0x58, 0x3d, 0x2b, 0x47, 0x58, 0x10,
+  0x3b, 0x4a, 0xf9, 0x1e, 0x10, 0x47, 0x4b, 0xec, 0x8b, 0x50, 0x89, 0xdc, 0xae, 0x5b, 0x46, 0xff,
+  0xe4, 0x42, 0x18, 0x07, 0xb0, 0xef, 0x94, 0x62, 0x8c, 0x5a, 0x74, 0x7b, 0x74, 0xe4, 0x93, 0x66,
+  0x19, 0x05, 0x9b, 0xe9, 0xe3, 0x7e, 0x99, 0xd4, 0x36, 0x19, 0xce, 0x88, 0x5f, 0x82, 0xde, 0x10,
+  0x5b, 0x7e, 0xcb, 0x60, 0x20, 0x03, 0x6b, 0x81, 0xc6, 0xd7, 0xfe, 0xc8, 0x16, 0x83, 0x8e, 0xf1,
+  0x1a, 0xe3, 0xa9, 0xa7, 0x4b, 0xb4, 0x3f, 0x62, 0x1e, 0xa6, 0x9f, 0x1a, 0x9e, 0x09, 0xd8, 0xf1,
+  0xf2, 0x01, 0x4a, 0x7a, 0x9d, 0xe7, 0x22, 0xbd, 0x3a, 0x49, 0xf1, 0xe8, 0xae, 0x55, 0x17, 0xb8,
+  0x53, 0xfb, 0x47, 0xa1, 0x11, 0x48, 0xd0, 0x39, 0x4d, 0x33, 0xd4, 0x31, 0xf9, 0xc9, 0x65, 0x34,
+  0x7d, 0xc8, 0x87, 0x54, 0xd4, 0x9e, 0x9f, 0x4c, 0x7d, 0x99, 0x61, 0xdc, 0x40, 0x32, 0x40, 0x01,
+  0x1a, 0x4d, 0xe6, 0x61, 0x94, 0xb7, 0x5b, 0xe2, 0xd1, 0x89, 0x96, 0xc7, 0xe7, 0x23, 0x09, 0x46,
+  0x20, 0x20, 0x18, 0xe7, 0xbe, 0xd3, 0x72, 0x04, 0x9b, 0xa2, 0x67, 0xcf, 0xf3, 0x16, 0x05, 0xec,
+  0x15, 0xf0, 0xaf, 0xe8, 0x95, 0xda, 0xb6, 0x0a, 0x6b, 0x55, 0xd2, 0x66, 0x8c, 0xb6, 0x1c, 0x07,
+  0x97, 0xd2, 0x02, 0xa2, 0xda, 0xb0, 0x50, 0x3d, 0xba, 0xc2, 0x84, 0xa2, 0x4c, 0x79, 0x88, 0xa4,
+  0x6a, 0x17, 0x58, 0x51, 0x51, 0xe5, 0xa2, 0x9e, 0x45, 0xfa, 0x52, 0x03, 0x4b, 0x00, 0xda, 0x3c,
+  0xe0, 0x93, 0x6d, 0x97, 0x36, 0xa9, 0x1c, 0xb5, 0xbb, 0xb6, 0xb2, 0xb4, 0x78, 0x7e, 0xab, 0xd6,
+  0x7f, 0x85, 0x4f, 0x9d, 0xb8, 0x1f, 0x5b, 0x7b, 0x30, 0x3c, 0xd7, 0xe9, 0xdc, 0xc9, 0xe7, 0xe2,
+  0x8f, 0xab, 0x00, 0x90, 0x90, 0x81, 0x8e, 0x91, 0xeb, 0x17, 0x7f, 0xb9, 0x7f, 0x59, 0x4c, 0x8a,
+  0x79, 0xa1, 0xc6, 0x46, 0xf4, 0xaa, 0xe0, 0xa6, 0x52, 0x74, 0x42, 0x41, 0x2e, 0x37, 0x0b, 0xb7,
+  0x29, 0xa2, 0x18, 0xbe, 0x4a, 0xee, 0x9c, 0x10, 0x33, 0x03, 0x43, 0x5c, 0xc5, 0xb8, 0x33, 0x89,
+  0x46, 0x78, 0xa7, 0x7c, 0x9e, 0x68, 0x63, 0x99, 0xaf, 0xf9, 0xaa, 0x66, 0x44, 0x96, 0x19, 0x56,
+  0xa1, 0x3b, 0x32, 0xbb, 0x7b, 0x2c, 0xeb, 0xea, 0xa2, 0xd4, 0xed, 0xf4, 0x2a, 0x59, 0xb3, 0x55,
+  0x4b, 0xb4, 0x82, 0xe1, 0xb8, 0x0c, 0x56, 0xa5, 0xac, 0x59, 0x3f, 0x63, 0xc7, 0x73, 0x34, 0x2e,
+  0xb4, 0xf7, 0x62, 0x1f, 0xe5, 0x62, 0xab, 0x16, 0x67, 0xc0, 0x3c, 0x23, 0x7a, 0x73, 0x53, 0x56,
+  0xfa, 0x1c, 0xba, 0x0f, 0xfa, 0x53, 0x04, 0x49, 0x85, 0xfd, 0x1d, 0x1e, 0x77, 0x9c, 0x61, 0xff,
+  0x85, 0x69, 0x82, 0x3d, 0x57, 0x33, 0x60, 0x51, 0xf1, 0x49, 0x1a, 0xc8, 0xd6, 0x19, 0x35, 0x7b,
+  0xa6, 0xe3, 0x63, 0x9f, 0x67, 0x51, 0x24, 0xfa, 0x8c, 0x47, 0x4f, 0xbc, 0x07, 0x4d, 0xe3, 0x87,
+  0xe7, 0x9b, 0xa2, 0xdf, 0x7d, 0xd3, 0x5f, 0xd2, 0x88, 0x5e, 0xc8, 0xf5, 0xa8, 0x6b, 0x15, 0x59,
+  0x44, 0x01, 0xdb, 0x3c, 0x8c, 0x5e, 0x88, 0xfb, 0x62, 0xf6, 0x35, 0x20, 0xd9, 0x56, 0x48, 0xd6,
+  0xc0, 0x11, 0xa5, 0x9b, 0x77, 0xc2, 0x58, 0x2c, 0x9a, 0xaf, 0x3a, 0xe8, 0xb6, 0xec, 0xc1, 0x5d,
+  0x6c, 0xcf, 0xd6, 0x2a, 0x5b, 0x00, 0x0c, 0x5f, 0x4a, 0x3f, 0xd0, 0xcf, 0xab, 0xb5, 0xad, 0xeb,
+  0xf9, 0xdc, 0xbb, 0xf2, 0xc8, 0x0d, 0xa9, 0x03, 0xf1, 0x9c, 0xa9, 0xe7, 0xd8, 0x72, 0xba, 0x94,
+  0x8e, 0xdb, 0x79, 0x42, 0xd3, 0xe1, 0x03, 0x12, 0x67, 0x3c, 0x09, 0xce, 0xc5, 0x13, 0xd9, 0x34,
+  0x7a, 0xb0, 0x88, 0x73, 0x9c, 0x31, 0x6a, 0xaf, 0x0c, 0x90, 0x54, 0xb2, 0x20, 0xa3, 0xb4, 0xc4,
+  0xc5, 0xf1, 0x2a, 0x8b, 0xc9, 0x0b, 0x86, 0x24, 0x27, 0xa1, 0x75, 0x73, 0xf5, 0x18, 0x97, 0xc2,
+  0x1a, 0x51, 0x25, 0x62, 0xaa, 0x45, 0x85, 0x0c, 0xab, 0x04, 0x44, 0xb6, 0x84, 0x75, 0x1e, 0xb5,
+  0x8b, 0xbc, 0x45, 0x91, 0xcc, 0x60, 0x69, 0x42, 0x9b, 0x4b, 0x3e, 0x1f, 0x8d, 0x40, 0x36, 0x63,
+  0x90, 0xe3, 0x6b, 0x44, 0xb4, 0x3c, 0xc6, 0xa1, 0x95, 0x63, 0x09, 0x30, 0xbc, 0x79, 0x62, 0xed,
+  0x66, 0x0f, 0xf1, 0xa2, 0x70, 0x9b, 0xda, 0xa7, 0x67, 0x96, 0xf8, 0xa4, 0x1f, 0x5f, 0xb4, 0xfe,
+  0x15, 0x0f, 0x69, 0xdb, 0x33, 0x83, 0x5b, 0xe5, 0x2b, 0xfc, 0x6d, 0xac, 0x5d, 0x32, 0xc6, 0x02,
+  0x33, 0xc2, 0x65, 0x71, 0x69, 0xbd, 0xf7, 0x93, 0x77, 0x75, 0x4b, 0xb7, 0x9d, 0xe5, 0x6b, 0xaf,
+  0x86, 0xde, 0xc0, 0x25, 0x2d, 0x17, 0xe6, 0x4a, 0x29, 0x74, 0xa8, 0x17, 0x17, 0xd0, 0x81, 0xcb,
+  0xe4, 0x6b, 0xde, 0x4f, 0xc3, 0xf8, 0x12, 0xfa, 0x33, 0xc8, 0xf3, 0xa1, 0x78, 0x15, 0x62, 0x93,
+  0x6e, 0x4a, 0x6f, 0xc6, 0x45, 0x34, 0x6d, 0x3d, 0x53, 0xb3, 0x61, 0x29, 0x1c, 0xbd, 0x18, 0xf1,
+  0xec, 0x9b, 0x1b, 0x4e, 0xa4, 0xcb, 0x6e, 0x8b, 0xa7, 0x5b, 0x00, 0xbd, 0x46, 0x59, 0xdc, 0x91,
+  0x1b, 0x75, 0x00, 0x64, 0x3e, 0x0b, 0x12, 0x8d, 0xcc, 0xf0, 0xc0, 0x5c, 0xfc, 0xf9, 0x4f, 0xfb,
+  0x4f, 0xb7, 0x28, 0xdb, 0xd9, 0x2a, 0xc3, 0x49, 0xc7, 0xea, 0xc5, 0x2f, 0x05, 0x88, 0xae, 0xda,
+  0xa4, 0xc4, 0xf8, 0xf8, 0x2c, 0x63, 0x81, 0xb9, 0x55, 0x1f, 0xae, 0x9a, 0xce, 0x74, 0x9f, 0xce,
+  0x9e, 0xbd, 0x4b, 0xcb, 0xd7, 0xf8, 0xed, 0x67, 0xd4, 0x9e, 0x6e, 0xcd, 0x9e, 0x09, 0x97, 0xa6,
+  0x8d, 0x35, 0xaf, 0xe3, 0x31, 0xaf, 0x35, 0x45, 0xfd, 0x30, 0x18, 0x75, 0x34, 0x49, 0xf3, 0xa8,
+  0x86, 0x53, 0x9b, 0x4d, 0xf5, 0x6b, 0xd6, 0x27, 0x6e, 0x5b, 0x93, 0x71, 0x8f, 0xa2, 0xb4, 0xc8,
+  0x6a, 0x73, 0x71, 0x9a, 0x06, 0x93, 0x51, 0x35, 0x95, 0x0e, 0x87, 0xd2, 0x84, 0x66, 0xa1, 0x88,
+  0x70, 0x90, 0xe5, 0x1b, 0x22, 0x78, 0x5f, 0xfd, 0x7c, 0x82, 0x3a, 0xea, 0x33, 0x06, 0xb2, 0xdc,
+  0x92, 0xe6, 0xe1, 0x49, 0x68, 0x7d, 0x8e, 0x19, 0x4e, 0x13, 0x71, 0x9f, 0x88, 0x08, 0x3a, 0xab,
+  0xbb, 0xa4, 0x50, 0x90, 0xb7, 0xe9, 0xfa, 0x9f, 0x0b, 0xbf, 0xea, 0x6a, 0x3b, 0x3c, 0x22, 0xa2,
+  0x0f, 0x3f, 0xcc, 0x13, 0xeb, 0x3a, 0x25, 0xc7, 0x00, 0x5f, 0x15, 0x28, 0xe9, 0x15, 0x07, 0x0b,
+  0x2a, 0x9b, 0x30, 0x54, 0xcc, 0xef, 0x95, 0xe5, 0x05, 0x60, 0x15, 0x85, 0x15, 0x02, 0x7c, 0x29,
+  0x12, 0x84, 0x3a, 0x91, 0x71, 0x99, 0x6c, 0x34, 0xbc, 0x88, 0x73, 0xd0, 0xf6, 0xbf, 0xce, 0x56,
+  0x44, 0xc5, 0x9c, 0x11, 0x6f, 0x8b, 0x5a, 0x21, 0xd8, 0xd5, 0x3b, 0xa8, 0x11, 0x3d, 0x0c, 0xa9,
+  0x77, 0xfb, 0xf8, 0x4d, 0xfb, 0x77, 0x05, 0x21, 0xfa, 0xc4, 0x04, 0x12, 0x49, 0x16, 0x9c, 0xee,
+  0xa1, 0xbe, 0xf1, 0xb7, 0x3e, 0xd1, 0xac, 0xee, 0x71, 0xf4, 0x46, 0x45, 0x1e, 0x89, 0xd6, 0x28,
+  0xf8, 0xc4, 0x0d, 0xf8, 0x80, 0x20, 0x33, 0x87, 0xb5, 0x55, 0xa9, 0x70, 0xe3, 0x60, 0xc5, 0x6e,
+  0xc1, 0x50, 0x32, 0x59, 0x3f, 0xc6, 0xb2, 0xfe, 0x8a, 0x7d, 0xc3, 0x12, 0x2d, 0x55, 0x21, 0x20,
+  0xea, 0x0c, 0x4d, 0xc4, 0xe0, 0x67, 0x3e, 0xa1, 0x3d, 0xc0, 0x57, 0x11, 0x23, 0xe6, 0x13, 0x93,
+  0xa7, 0x01, 0x03, 0x30, 0xd0, 0x41, 0x48, 0x11, 0x17, 0x23, 0xc9, 0x50, 0x7b, 0xf2, 0xec, 0xb4,
+  0xed, 0xa2, 0x5c, 0xdd, 0x64, 0x28, 0x33, 0x10, 0x06, 0xa7, 0x08, 0xc6, 0x6b, 0x60, 0x47, 0x89,
+  0x5f, 0xad, 0xab, 0x56, 0x41, 0xd9, 0xdb, 0x56, 0x62, 0x65, 0x92, 0x36, 0xe6, 0x0e, 0x95, 0x90,
+  0x40, 0xa7, 0x0c, 0x9a, 0xce, 0xe8, 0x96, 0xa1, 0x6f, 0x8f, 0xd7, 0xdc, 0x97, 0x36, 0x23, 0x0a,
+  0x89, 0x56, 0x1f, 0x84, 0x1d, 0x3e, 0x37, 0x6e, 0x96, 0x26, 0x0a, 0xba, 0xec, 0x15, 0x26, 0xe6,
+  0x58, 0x4d, 0x55, 0x39, 0xf9, 0x5d, 0xe7, 0x96, 0x24, 0x09, 0xc4, 0xbb, 0xeb, 0xb7, 0x0a, 0x17,
+  0x55, 0x16, 0x07, 0xa9, 0x7a, 0x86, 0xfd, 0x96, 0xc1, 0xa2, 0xca, 0x02, 0xe1, 0xf3, 0x16, 0xee,
+  0x3c, 0xb6, 0x50, 0xb1, 0xc7, 0x35, 0x3e, 0x7f, 0x4e, 0xe4, 0x0d, 0xbf, 0xb9, 0xa1, 0xdf, 0xc5,
+  0x5d, 0x51, 0x11, 0x24, 0x88, 0xbf, 0x16, 0x9f, 0x1b, 0xdc, 0x0b, 0xa4, 0xb7, 0x33, 0x29, 0x83,
+  0x40, 0x1c, 0xcf, 0xab, 0x41, 0x65, 0x22, 0x48, 0x88, 0xe7, 0x4e, 0x0b, 0x3b, 0x89, 0x6e, 0xc2,
+  0x48, 0x75, 0x35, 0xf4, 0x5b, 0x30, 0x88, 0x52, 0xd5, 0xe4, 0x1d, 0xaf, 0x6f, 0xbf, 0x82, 0x24,
+  0x8a, 0x9b, 0x97, 0x5c, 0x30, 0xf6, 0x6e, 0x22, 0x6b, 0xee, 0xc8, 0x1d, 0x16, 0x1d, 0x51, 0x29,
+  0xfd, 0x9b, 0xf5, 0x5a, 0x71, 0xac, 0x45, 0x51, 0x9f, 0x70, 0x9f, 0x84, 0x67, 0x55, 0xa4, 0x6a,
+  0xeb, 0xcd, 0xaa, 0x13, 0x9c, 0x07, 0x71, 0xe2, 0x9b, 0x1b, 0x90, 0xaa, 0x32, 0x2f, 0x02, 0x49,
+  0x95, 0x6e, 0x7d, 0xac, 0xbd, 0xc7, 0x64, 0xa3, 0x31, 0xb7, 0xdc, 0x9a, 0xbc, 0x22, 0x3c, 0x1a,
+  0x87, 0x04, 0x16, 0x41, 0x4c, 0x27, 0x22, 0x54, 0x6d, 0xce, 0x97, 0x1b, 0x38, 0xb0, 0x09, 0x4f,
+  0xee, 0x9c, 0xdf, 0x9b, 0x93, 0x8e, 0x24, 0x64, 0x4b, 0xd0, 0x51, 0xb0, 0x2b, 0xb1, 0x6e, 0x5b,
+  0xaf, 0x8e, 0x0e, 0x05, 0xe7, 0xbe, 0x85, 0x6d, 0x12, 0x39, 0x2f, 0x4b, 0xb6, 0x15, 0x6c, 0xfa,
+  0xb1, 0xc6, 0x8a, 0xde, 0x71, 0x6a, 0x0c, 0xe1, 0x90, 0x58, 0x67, 0x7b, 0x86, 0x64, 0xd3, 0x88,
+  0x2c, 0x3e, 0x2b, 0x46, 0x60, 0x7a, 0xd1, 0xcc, 0xb6, 0x85, 0x9f, 0xaa, 0x88, 0xda, 0xf1, 0xed,
+  0xc2, 0x69, 0x5b, 0x81, 0xb4, 0xa3, 0x89, 0x66, 0x8c, 0x68, 0x52, 0xd3, 0x05, 0xdc, 0xb5, 0x40,
+  0x80, 0x3e, 0xf9, 0xb1, 0x24, 0x30, 0xc6, 0x70, 0x1f, 0xe8, 0xc9, 0x0c, 0x34, 0x8d, 0xa2, 0xbd,
+  0xf7, 0xe4, 0x12, 0xbb, 0x72, 0x87, 0xbf, 0xf7, 0xde, 0x21, 0xff, 0xb4, 0x26, 0xb3, 0x4a, 0xd3,
+  0xce, 0x9e, 0x36, 0x75, 0xc4, 0x98, 0x54, 0xad, 0xc9, 0x94, 0xc0, 0xc9, 0xa9, 0x03, 0xf8, 0x11,
+  0x0f, 0xb9, 0x10, 0x85, 0xd8, 0xa5, 0x14, 0xed, 0x19, 0x4f, 0x70, 0x69, 0x97, 0x77, 0x8d, 0x77,
+  0xbc, 0xbe, 0x8b, 0xf7, 0x63, 0xdf, 0x31, 0x6d, 0x04, 0x15, 0xeb, 0x8b, 0xcb, 0xd3, 0x9e, 0xea,
+  0xf8, 0x14, 0x80, 0x5c, 0xa8, 0xd9, 0xcd, 0x1b, 0xeb, 0x56, 0x5d, 0xab, 0xd0, 0x40, 0xb0, 0x26,
+  0xb7, 0x73, 0x53, 0x04, 0xe9, 0xcb, 0xf7, 0xcc, 0xe4, 0x5c, 0xfe, 0x2a, 0x0e, 0xce, 0x13, 0x58,
+  0xbe, 0xe3, 0x51, 0xbe, 0x86, 0x3d, 0x85, 0xdc, 0xd9, 0x43, 0x5d, 0xe4, 0xab, 0xfb, 0x7d, 0xa9,
+  0x45, 0x05, 0xb6, 0x3d, 0x80, 0x10, 0xb0, 0x4d, 0xd0, 0x72, 0x32, 0x89, 0x84, 0x73, 0x9a, 0x59,
+  0xe7, 0x24, 0x3d, 0xbf, 0xb5, 0x2d, 0x85, 0xda, 0xfa, 0xc9, 0xc0, 0x52, 0x32, 0xa8, 0x18, 0x61,
+  0xc2, 0xd8, 0xe2, 0x6a, 0x67, 0x93, 0x09, 0xd3, 0xb2, 0xb8, 0xe8, 0xd1, 0xc2, 0x3c, 0xdb, 0xea,
+  0xb5, 0x8e, 0x3b, 0x97, 0x1c, 0xab, 0x51, 0xb9, 0x4b, 0xcb, 0xa1, 0xc3, 0x2c, 0x85, 0x86, 0x9f,
+  0xce, 0xa6, 0x32, 0x68, 0x58, 0x28, 0xf5, 0x8a, 0x65, 0x7d, 0xab, 0x1f, 0x6e, 0xf1, 0x46, 0xd1,
+  0xba, 0x43, 0x2d, 0x0c, 0xf1, 0x7f, 0xb5, 0x61, 0x96, 0xf5, 0x7d, 0xfd, 0x10, 0x0b, 0x0c, 0x7f,
+  0xa1, 0xe1, 0x15, 0xb5, 0xed, 0x25, 0x21, 0x5f, 0xb1, 0x51, 0xdd, 0x29, 0x4c, 0x61, 0x14, 0x27,
+  0x9b, 0xdd, 0x38, 0xf0, 0x25, 0x89, 0x0e, 0x86, 0xc7, 0x1e, 0x5d, 0x20, 0xb6, 0xf9, 0x24, 0x24,
+  0x83, 0x1b, 0xb4, 0x00, 0x96, 0xa0, 0xe2, 0xfa, 0xa7, 0xf1, 0x8b, 0x7c, 0x33, 0xfd, 0x16, 0xbc,
+  0x62, 0x74, 0x6d, 0x33, 0x9f, 0x68, 0x14, 0xc2, 0xfc, 0x6f, 0xe9, 0xb0, 0xa9, 0x08, 0x5a, 0xb0,
+  0xd4, 0xf1, 0x1d, 0x64, 0x3c, 0x95, 0xe6, 0x3a, 0x08, 0xbe, 0xa4, 0xbf, 0x09, 0xb4, 0x3a, 0x9b,
+  0xd5, 0x4c, 0x8a, 0x8d, 0x1a, 0x4f, 0x30, 0xcc, 0xd7, 0xd0, 0x69, 0x89, 0x48, 0xa9, 0x74, 0x2f,
+  0xa8, 0x62, 0x90, 0x14, 0x9a, 0xec, 0xd2, 0xc2, 0x17, 0x71, 0x18, 0x46, 0x09, 0x95, 0x5d, 0x74,
+  0x28, 0xce, 0xb7, 0x57, 0xa3, 0x2f, 0x6a, 0xb7, 0xd8, 0x38, 0xdf, 0xa7, 0xa8, 0xbf, 0x46, 0x43,
+  0xc7, 0xc2, 0xd9, 0x76, 0xe5, 0x03, 0x1f, 0x04, 0xc5, 0x8d, 0xd5, 0x65, 0x4a, 0x2d, 0x16, 0xf8,
+  0x51, 0xff, 0x3a, 0x7a, 0x47, 0xea, 0xd6, 0xd1, 0xfe, 0x7e, 0x4b, 0x5f, 0x0b, 0x30, 0x6a, 0x77,
+  0xf4, 0xcb, 0x22, 0xa2, 0x69, 0x41, 0x12, 0x4f, 0xe5, 0x76, 0xd6, 0xa5, 0x17, 0x42, 0xb6, 0x73,
+  0x0a, 0xf8, 0x1e, 0xa0, 0xf5, 0x72, 0x8c, 0x2f, 0xa2, 0x44, 0x6e, 0xc5, 0x96, 0xd3, 0x88, 0x45,
+  0xc5, 0xa7, 0x5b, 0x54, 0xbd, 0x46, 0x11, 0x5f, 0x1c, 0x4c, 0xe2, 0xdf, 0x47, 0x7b, 0x33, 0xe9,
+  0x3e, 0x44, 0x4e, 0xb5, 0x85, 0xcc, 0x42, 0x5d, 0x8e, 0xfd, 0x94, 0x51, 0x15, 0x82, 0x4a, 0x8a,
+  0x2c, 0x9d, 0xe4, 0x46, 0x04, 0x50, 0xf9, 0x80, 0xbb, 0x11, 0xfb, 0xf3, 0x98, 0xac, 0xa9, 0xc2,
+  0x16, 0xdc, 0x91, 0xe7, 0x07, 0x50, 0x58, 0x1c, 0x96, 0xe1, 0x23, 0x13, 0x14, 0xa6, 0xcf, 0xb6,
+  0xa5, 0x4a, 0x03, 0xa1, 0x70, 0x06, 0x2d, 0xb9, 0x36, 0x29, 0x11, 0xa0, 0x73, 0xe5, 0xc9, 0xc0,
+  0xa0, 0x21, 0x42, 0x7c, 0xbd, 0xff, 0x8d, 0x79, 0x8a, 0x58, 0x33, 0xbf, 0xb9, 0x79, 0xea, 0xd1,
+  0xa3, 0x5a, 0xb0, 0x8e, 0xb3, 0x63, 0x5f, 0xe7, 0x36, 0x85, 0x82, 0x9c, 0x7f, 0x1c, 0xfd, 0x7e,
+  0x07, 0xef, 0xda, 0x23, 0xce, 0xca, 0x03, 0x11, 0xec, 0x08, 0x84, 0xa7, 0x6f, 0xdc, 0xc7, 0x28,
+  0x76, 0x61, 0xce, 0x72, 0x88, 0xff, 0x01, 0xc5, 0xc9, 0x27, 0x9b, 0x72, 0xf0, 0x05, 0x64, 0x1a,
+  0x6a, 0x78, 0x22, 0x04, 0x3f, 0x3b, 0x95, 0x61, 0xd0, 0xfd, 0x12, 0xa9, 0x76, 0x64, 0x7d, 0x35,
+  0x1d, 0x6c, 0xa0, 0x4a, 0x8f, 0x74, 0xf8, 0x70, 0xb5, 0x6b, 0x85, 0x6e, 0x95, 0xae, 0x47, 0xdc,
+  0x86, 0xed, 0xae, 0x8c, 0x3d, 0xcd, 0x6a, 0xf4, 0x4b, 0xdc, 0x9e, 0x73, 0xb8, 0x49, 0x1c, 0x35,
+  0x32, 0xaf, 0x93, 0xa9, 0x2c, 0xc7, 0xfd, 0x53, 0x8e, 0xd1, 0x18, 0xf1, 0xd1, 0xb9, 0x42, 0x19,
+  0xcc, 0x84, 0x21, 0x6d, 0xa8, 0x35, 0x62, 0xc3, 0xf8, 0x2c, 0x2f, 0xf9, 0xb3, 0x29, 0x6c, 0x2d,
+  0x93, 0x13, 0x91, 0xfa, 0x5a, 0xde, 0x3d, 0xa5, 0x9c, 0x52, 0xf4, 0xcb, 0xdc, 0x36, 0xb0, 0xdd,
+  0xca, 0x76, 0x38, 0x30, 0x2d, 0xe2, 0x3e, 0x6f, 0x94, 0x69, 0x4f, 0x4c, 0x55, 0x48, 0x56, 0xa4,
+  0x8f, 0xca, 0xb6, 0xba, 0x85, 0x33, 0xae, 0x25, 0x67, 0x9c, 0x68, 0x7f, 0x55, 0x53, 0xc6, 0x03,
+  0x14, 0x14, 0xbf, 0xe6, 0x26, 0xa1, 0xce, 0x1e, 0xef, 0xcf, 0x30, 0xa2, 0x3b, 0x94, 0x52, 0xd7,
+  0x4a, 0xca, 0xbc, 0xbf, 0x20, 0x9d, 0x9a, 0x9e, 0x48, 0xc1, 0xe3, 0x04, 0x80, 0xc7, 0x53, 0x5d,
+  0x5a, 0x99, 0x5e, 0x1f, 0xbf, 0x77, 0xf0, 0x21, 0x5b, 0x44, 0x87, 0x6b, 0x6a, 0x36, 0x4f, 0x30,
+  0xbc, 0xb5, 0x93, 0x0a, 0xf7, 0x6f, 0x0c, 0xb0, 0xd5, 0x71, 0x54, 0x60, 0xad, 0x8e, 0x03, 0x93,
+  0x9c, 0x22, 0x68, 0x6d, 0x6d, 0x6d, 0xfc, 0xad, 0x46, 0xf6, 0x12, 0x6e, 0x07, 0xb6, 0xa7, 0x5d,
+  0xd5, 0x65, 0x1f, 0x9b, 0x8d, 0x8e, 0x01, 0xda, 0x12, 0x87, 0x2f, 0x3c, 0xc2, 0xc6, 0x24, 0x3e,
+  0x4f, 0x82, 0x49, 0xdf, 0xd9, 0x3b, 0x4b, 0xb3, 0xe2, 0x98, 0x3e, 0x28, 0x62, 0x02, 0xae, 0x38,
+  0x3d, 0x7a, 0x24, 0x62, 0xb1, 0xc2, 0xc9, 0xff, 0x8e, 0x34, 0x69, 0x15, 0x17, 0x19, 0xac, 0xf2,
+  0xf4, 0x46, 0x0b, 0x2f, 0xdd, 0xef, 0x52, 0x7e, 0x80, 0xa7, 0x14, 0x0d, 0xa0, 0x85, 0xc3, 0x10,
+  0x82, 0xde, 0xc3, 0xef, 0xd2, 0xc8, 0x41, 0x00, 0xe9, 0x3e, 0xa1, 0x93, 0x77, 0x0c, 0x9a, 0x60,
+  0x1d, 0xd2, 0xbf, 0x83, 0x5d, 0xec, 0x2c, 0x1a, 0xa1, 0xfc, 0x85, 0x89, 0x3b, 0x9f, 0x41, 0x1d,
+  0x91, 0x7c, 0xfe, 0x5c, 0x17, 0x59, 0xf9, 0xe4, 0x03, 0x8e, 0x60, 0x0a, 0xbc, 0x89, 0xc7, 0xfc,
+  0x4c, 0x04, 0xf2, 0x40, 0x3d, 0x21, 0xf6, 0x65, 0x00, 0x83, 0x1c, 0xe3, 0xa1, 0x2d, 0x7d, 0x49,
+  0x8a, 0xcf, 0xc7, 0xd9, 0x8e, 0x8e, 0x37, 0x37, 0x80, 0xed, 0xd4, 0x41, 0x20, 0x21, 0xa1, 0x48,
+  0xdf, 0x4c, 0x2f, 0x61, 0xbe, 0x8c, 0xa3, 0x2b, 0x3c, 0x56, 0xde, 0xf8, 0x89, 0x01, 0xc2, 0x7f,
+  0x86, 0xe0, 0xe0, 0x3f, 0x53, 0x60, 0xf0, 0xba, 0x70, 0xdf, 0x4f, 0x76, 0x06, 0x1b, 0xf5, 0x31,
+  0xbd, 0x77, 0x77, 0x07, 0xf4, 0xcc, 0x4a, 0x3a, 0x23, 0x64, 0xec, 0x82, 0x81, 0xd7, 0x56, 0x65,
+  0x1b, 0xc9, 0x4c, 0x22, 0x17, 0x5d, 0xea, 0x42, 0x2a, 0x9a, 0x6f, 0x7c, 0xc5, 0x2b, 0x0e, 0x15,
+  0xd2, 0x06, 0x1b, 0x5f, 0xfb, 0xf2, 0x06, 0xc6, 0xec, 0xa1, 0xa8, 0xf2, 0xa0, 0x4f, 0x07, 0x79,
+  0xca, 0xf7, 0x14, 0xc5, 0xd2, 0xbe, 0xf1, 0x55, 0xcf, 0x39, 0xd4, 0xf4, 0x4f, 0x03, 0x79, 0x8d,
+  0x8f, 0x72, 0xa0, 0xea, 0x21, 0x6e, 0x2c, 0x8b, 0x83, 0x67, 0xdc, 0xc5, 0x43, 0x22, 0xf1, 0x70,
+  0xa5, 0xbf, 0x0d, 0xc6, 0xe4, 0x13, 0x5a, 0x67, 0x12, 0x9c, 0x81, 0x1a, 0xb5, 0xf1, 0xb5, 0xb1,
+  0xd4, 0x7f, 0x4a, 0x1c, 0x75, 0x9a, 0x3c, 0x6f, 0xa2, 0xc9, 0x0c, 0x9f, 0x35, 0x18, 0x65, 0xf1,
+  0xac, 0xd0, 0x01, 0x9c, 0x1d, 0xa5, 0xc0, 0x6d, 0xb4, 0xb5, 0x01, 0xe9, 0x46, 0x30, 0xee, 0xd0,
+  0x38, 0x83, 0xd2, 0x06, 0xf2, 0xce, 0x68, 0x68, 0x9e, 0x31, 0xe9, 0x8c, 0x41, 0x2d, 0xf8, 0xd0,
+  0xc0, 0x5b, 0x64, 0xd7, 0x37, 0xeb, 0x1d, 0xf3, 0xd0, 0xf1, 0x26, 0x2e, 0x61, 0xb8, 0x9e, 0xc1,
+  0xd4, 0x80, 0x29, 0xef, 0x7a, 0x0b, 0xb1, 0x9b, 0xf1, 0x6e, 0x16, 0xd2, 0x19, 0x38, 0x7d, 0x9e,
+  0xb6, 0xbd, 0xfe, 0x65, 0x1a, 0x87, 0x4e, 0x77, 0x31, 0xa8, 0xa7, 0xeb, 0xa7, 0x52, 0x90, 0x45,
+  0x53, 0xd0, 0x88, 0x1a, 0x88, 0x18, 0x3d, 0x1f, 0x69, 0x22, 0xc4, 0xcb, 0x81, 0xd5, 0x4e, 0x2f,
+  0x52, 0x43, 0x0b, 0x96, 0x7c, 0x21, 0x27, 0x25, 0x4f, 0x41, 0x47, 0x38, 0xda, 0x37, 0x98, 0xfe,
+  0xdc, 0xb2, 0xe9, 0xcf, 0x35, 0x4d, 0x7f, 0x96, 0x81, 0xfa, 0x6b, 0x5e, 0x33, 0x50, 0x22, 0xeb,
+  0xeb, 0x5e, 0x30, 0xa0, 0xf3, 0xf5, 0xa2, 0xf0, 0x1a, 0xee, 0x8a, 0xdb, 0xec, 0x5e, 0x23, 0x50,
+  0xb4, 0x71, 0x9b, 0xbc, 0xcf, 0xe6, 0x4d, 0xd8, 0x2a, 0x93, 0xa0, 0x46, 0x06, 0x48, 0x7c, 0xac,
+  0xba, 0xdc, 0xbb, 0xb7, 0x01, 0x8a, 0x34, 0x6b, 0x9e, 0xb9, 0x8c, 0xc6, 0x41, 0xea, 0x70, 0x39,
+  0x9a, 0x08, 0xbb, 0x73, 0x48, 0xe5, 0x34, 0x8f, 0x78, 0x23, 0xc3, 0x27, 0x6b, 0x80, 0x63, 0xab,
+  0xf2, 0x7c, 0x93, 0x15, 0xe4, 0x44, 0xc5, 0x37, 0x31, 0xe3, 0xa1, 0x90, 0x22, 0x59, 0xa0, 0xed,
+  0x99, 0xf4, 0x48, 0xb6, 0xf6, 0x1d, 0x1c, 0x1f, 0xe1, 0xd9, 0x77, 0x44, 0x29, 0xa8, 0x3d, 0xd1,
+  0x0a, 0xbc, 0x51, 0x8a, 0x59, 0x22, 0x1e, 0x46, 0x11, 0x5f, 0xda, 0x39, 0xce, 0xc5, 0x87, 0x9a,
+  0x9f, 0xab, 0x74, 0xf1, 0xca, 0x17, 0x24, 0x62, 0xfc, 0x5f, 0x2b, 0x94, 0xd3, 0x0e, 0xbe, 0xfb,
+  0x25, 0xe0, 0x06, 0x1b, 0x76, 0x50, 0x13, 0x8d, 0x3d, 0x8f, 0x8a, 0x3a, 0xe4, 0x98, 0xbc, 0x06,
+  0x6e, 0x71, 0xfb, 0x8a, 0x9b, 0xba, 0x1f, 0x8b, 0x1b, 0x93, 0xa5, 0x3e, 0x54, 0x75, 0x8b, 0xf4,
+  0xe3, 0xa8, 0x72, 0x24, 0xfa, 0xbb, 0x39, 0x6c, 0x05, 0x8e, 0x23, 0xbc, 0x1f, 0x8a, 0xe1, 0x81,
+  0xf0, 0xc2, 0x06, 0x9d, 0x61, 0x0a, 0x0c, 0x9a, 0xd9, 0x6c, 0x14, 0x4a, 0x6f, 0xc5, 0xb7, 0x37,
+  0x69, 0xa0, 0x3e, 0x50, 0xb8, 0x2f, 0x1b, 0xaa, 0x82, 0x5d, 0x64, 0x6f, 0x72, 0x91, 0xcd, 0x0c,
+  0xa7, 0xb9, 0x71, 0x0b, 0x45, 0x61, 0xb2, 0xae, 0x28, 0x7f, 0x20, 0xa9, 0xa0, 0x83, 0xd2, 0x5c,
+  0xf4, 0x10, 0x7a, 0x86, 0x67, 0x16, 0x49, 0x61, 0x9d, 0xa4, 0xa4, 0x93, 0xf0, 0x0d, 0xa1, 0x58,
+  0x49, 0xc9, 0x45, 0x4f, 0xbf, 0xfb, 0xac, 0xdb, 0x20, 0x9e, 0xc8, 0x74, 0xc5, 0x3e, 0xca, 0x91,
+  0xe1, 0x53, 0x5c, 0xf3, 0x34, 0x45, 0x55, 0x62, 0x9e, 0xa7, 0x58, 0xe5, 0x15, 0x84, 0xf5, 0x2c,
+  0x5c, 0x16, 0x01, 0xb7, 0x8f, 0xa2, 0xf6, 0x16, 0xc6, 0x9f, 0xf1, 0xef, 0x61, 0x38, 0x19, 0xff,
+  0xde, 0x56, 0xc7, 0x71, 0x71, 0x2a, 0x65, 0xf1, 0xd4, 0x8c, 0x90, 0xa6, 0x31, 0x08, 0x91, 0x58,
+  0x79, 0x87, 0xd5, 0xec, 0xf4, 0x25, 0x4f, 0x81, 0xba, 0x61, 0x7c, 0xa9, 0x5b, 0xa9, 0x0a, 0xb0,
+  0xbc, 0x7d, 0x47, 0x8a, 0xba, 0xe3, 0xd6, 0x8c, 0x48, 0xb5, 0x84, 0xf5, 0xc8, 0xce, 0x86, 0xe5,
+  0xf3, 0xa2, 0xdc, 0x63, 0x98, 0xdd, 0x37, 0x99, 0x35, 0x5b, 0x4e, 0x1c, 0xaa, 0x34, 0x64, 0xf9,
+  0xd6, 0x33, 0x8a, 0xba, 0xf3, 0xcd, 0x8d, 0x91, 0xb6, 0xa8, 0xf8, 0xbc, 0x98, 0x08, 0x4b, 0x84,
+  0x15, 0x71, 0x31, 0x21, 0x77, 0x1d, 0xdd, 0xd3, 0xcd, 0xe5, 0x97, 0x10, 0x24, 0xa6, 0x20, 0xd1,
+  0xf3, 0x0f, 0x4c, 0x8f, 0x48, 0x2a, 0xa1, 0xfb, 0x2c, 0xbb, 0xa1, 0xc4, 0x48, 0x31, 0xc0, 0x67,
+  0xc5, 0x8b, 0x08, 0xa3, 0xf2, 0xb4, 0x55, 0x17, 0x75, 0xca, 0x60, 0x64, 0x0c, 0xa1, 0x97, 0x54,
+  0xeb, 0x4f, 0xb9, 0x8d, 0xbb, 0xdb, 0xf1, 0x34, 0xe2, 0xc7, 0xf8, 0x4a, 0xa7, 0x82, 0x3a, 0x82,
+  0x92, 0x1e, 0x89, 0x12, 0x1b, 0xff, 0xa2, 0x26, 0x84, 0x52, 0x4d, 0x10, 0xa5, 0xc6, 0xf2, 0xa5,
+  0x28, 0x4a, 0x6b, 0xc7, 0x51, 0xfa, 0x5c, 0x33, 0xa2, 0x9f, 0x4b, 0x38, 0x9a, 0x43, 0x2a, 0x7d,
+  0xae, 0x8e, 0xc1, 0x67, 0xfb, 0x3a, 0xbe, 0x5c, 0x45, 0x64, 0xd4, 0xb1, 0x72, 0x44, 0x24, 0x54,
+  0xaf, 0xd8, 0x51, 0x11, 0x26, 0xde, 0xc3, 0xcd, 0x1d, 0x02, 0xc8, 0xed, 0x35, 0xa3, 0x36, 0x1e,
+  0xd2, 0x85, 0x0e, 0x44, 0xc7, 0x0f, 0x95, 0x44, 0x85, 0x40, 0xbe, 0x4e, 0xe0, 0x6c, 0xf7, 0xc2,
+  0xc2, 0xa6, 0x8a, 0xb8, 0x32, 0x86, 0x13, 0x4b, 0x33, 0x1b, 0x9f, 0x11, 0x35, 0xe4, 0x25, 0xcd,
+  0xd3, 0x4a, 0x6b, 0x46, 0x12, 0xd4, 0x38, 0xc7, 0x5b, 0x5b, 0x72, 0xff, 0x62, 0x5c, 0xa5, 0x06,
+  0x5f, 0xff, 0x04, 0xd0, 0x77, 0x22, 0x06, 0x8b, 0xd3, 0xd4, 0xc4, 0xe5, 0xb2, 0xa3, 0x54, 0xc8,
+  0xc7, 0xc3, 0x46, 0x67, 0x69, 0x17, 0xd4, 0x97, 0xb1, 0x64, 0x0e, 0x67, 0x6e, 0x8e, 0x6d, 0xe9,
+  0xba, 0x61, 0x46, 0x4d, 0x84, 0xc9, 0xde, 0x40, 0xdc, 0xc5, 0x43, 0x49, 0x1b, 0x41, 0x96, 0x23,
+  0x75, 0xf1, 0x58, 0x97, 0xa5, 0x37, 0x83, 0xd6, 0x3c, 0xb3, 0xb5, 0x0d, 0x32, 0x76, 0x29, 0xcc,
+  0x8b, 0xb4, 0x28, 0x52, 0x7c, 0xb6, 0xd5, 0xed, 0xfa, 0x3b, 0x1a, 0x70, 0x63, 0x95, 0x64, 0x20,
+  0x4c, 0x9d, 0x15, 0xab, 0x50, 0xdd, 0x98, 0x89, 0x86, 0x35, 0x4a, 0x1d, 0xbb, 0x73, 0xbf, 0xba,
+  0x16, 0x11, 0xc2, 0xac, 0x32, 0xbe, 0xa5, 0x78, 0xb2, 0x82, 0x9f, 0x8d, 0x71, 0xa5, 0x80, 0x9d,
+  0x77, 0xef, 0x52, 0x8a, 0x1d, 0x59, 0xf7, 0xc2, 0x0e, 0x59, 0xe9, 0xad, 0x86, 0xb2, 0x62, 0x55,
+  0xae, 0x86, 0x37, 0xe3, 0x59, 0x03, 0xa4, 0xa9, 0x87, 0xb0, 0x20, 0x1d, 0x3a, 0x25, 0x1a, 0xf4,
+  0xeb, 0xd0, 0xec, 0x36, 0x61, 0x03, 0x58, 0xd5, 0x6b, 0x50, 0xc4, 0x5f, 0x02, 0x35, 0x6a, 0x16,
+  0x8f, 0x66, 0x08, 0xf7, 0x5f, 0x71, 0xde, 0x3c, 0xcb, 0xd2, 0xcb, 0x18, 0x4b, 0x05, 0xa8, 0x9b,
+  0x6c, 0x8e, 0xe3, 0x09, 0x5e, 0x60, 0x0a, 0x9d, 0x9d, 0x4d, 0x8a, 0x24, 0x2a, 0x07, 0xc1, 0xe7,
+  0x5b, 0xa2, 0x68, 0x2c, 0x73, 0x40, 0xac, 0xb0, 0x27, 0x32, 0x3a, 0x02, 0x3b, 0x8f, 0x7b, 0x25,
+  0xc8, 0x0d, 0xe5, 0xa9, 0x81, 0xb6, 0x18, 0x7c, 0x1c, 0x96, 0xcf, 0x52, 0x29, 0xf4, 0xde, 0x98,
+  0xfe, 0xe6, 0x48, 0xd5, 0x31, 0x1e, 0x1f, 0x82, 0x66, 0xd4, 0x8e, 0xfd, 0xc8, 0x47, 0x76, 0xa0,
+  0x70, 0x0f, 0xca, 0x04, 0x64, 0x5c, 0x48, 0xf5, 0x7c, 0xa5, 0x6d, 0x51, 0x77, 0x69, 0x97, 0xdc,
+  0x1d, 0xaf, 0xe4, 0x96, 0xb2, 0x2c, 0x7e, 0xab, 0x0a, 0xf9, 0x92, 0x15, 0x07, 0xe1, 0x0f, 0x08,
+  0xc2, 0x81, 0x51, 0x71, 0xd6, 0xe5, 0x1a, 0x4c, 0x8e, 0x06, 0x57, 0xc3, 0x4f, 0xdb, 0xca, 0x42,
+  0x1d, 0x5d, 0xfc, 0x3e, 0x54, 0xac, 0xcd, 0x52, 0x3c, 0x3e, 0xf4, 0xbb, 0x5e, 0x11, 0x39, 0x4e,
+  0xf4, 0xbb, 0x4e, 0x91, 0x85, 0x2d, 0x6b, 0xd0, 0x94, 0x36, 0xa1, 0xb8, 0x9b, 0xf6, 0x02, 0x71,
+  0xca, 0x74, 0x63, 0x28, 0x4c, 0xfa, 0xc3, 0x08, 0x4f, 0xd8, 0x50, 0x84, 0x9c, 0x53, 0xb0, 0x08,
+  0xfe, 0xb1, 0x56, 0x11, 0xa2, 0x1b, 0x8b, 0xd0, 0x1f, 0xa2, 0x48, 0x5d, 0x9c, 0x5a, 0x73, 0xb4,
+  0x4a, 0x21, 0x6b, 0x75, 0xb8, 0xda, 0x57, 0xf1, 0x65, 0xc3, 0xcb, 0xf0, 0x20, 0xd2, 0xb5, 0x09,
+  0x50, 0x80, 0x5b, 0x82, 0xb9, 0x25, 0x04, 0x33, 0x79, 0x50, 0x9b, 0xda, 0xb1, 0xd8, 0xa9, 0x89,
+  0xbd, 0x0b, 0x91, 0xf2, 0x31, 0x3e, 0x35, 0xd7, 0x7a, 0x03, 0xc2, 0xde, 0xd4, 0x94, 0x9c, 0x8e,
+  0xe4, 0xa6, 0x8c, 0x19, 0x1d, 0x37, 0x65, 0xee, 0xdf, 0xc3, 0x3f, 0x9b, 0x87, 0x87, 0x9b, 0xaf,
+  0x5e, 0x9d, 0xbc, 0x79, 0xd3, 0x3f, 0x3c, 0x74, 0x15, 0xbc, 0x5c, 0x94, 0x39, 0x80, 0xae, 0x59,
+  0x45, 0xc3, 0x06, 0xa9, 0x67, 0xa8, 0xd1, 0x12, 0x81, 0x79, 0x3f, 0x52, 0x20, 0xec, 0xd8, 0xc1,
+  0x6f, 0xe9, 0x51, 0xf6, 0xe9, 0x6c, 0x2a, 0xa6, 0x3c, 0xc5, 0xf8, 0xeb, 0xa1, 0x97, 0xdc, 0xfb,
+  0x43, 0xf2, 0x91, 0xdb, 0x3b, 0x74, 0xab, 0x68, 0x01, 0x42, 0x80, 0xff, 0x12, 0xa0, 0x07, 0x56,
+  0xfc, 0x71, 0x99, 0xcf, 0xb1, 0x05, 0x15, 0xb4, 0x09, 0x66, 0xf7, 0xea, 0x67, 0x50, 0x6d, 0x09,
+  0x6a, 0x01, 0x1a, 0x11, 0x92, 0xa2, 0x95, 0xa9, 0x85, 0x35, 0xd0, 0x18, 0x00, 0xba, 0x3e, 0xf0,
+  0x3f, 0xf1, 0x90, 0x19, 0x93, 0x57, 0x3f, 0x4d, 0x82, 0xc3, 0x76, 0x3d, 0x8b, 0xd2, 0x31, 0xf3,
+  0x26, 0x00, 0xb1, 0x3b, 0x60, 0x32, 0x9f, 0x9e, 0xc1, 0x7a, 0x00, 0x2d, 0x35, 0x22, 0x2a, 0x48,
+  0x10, 0xdc, 0x6a, 0xca, 0xbf, 0xcb, 0x7c, 0xb3, 0x64, 0x4b, 0x60, 0x38, 0xcc, 0x0b, 0x66, 0x2a,
+  0x62, 0x76, 0xb3, 0x37, 0x5a, 0xdb, 0xe4, 0x66, 0x2f, 0x59, 0x10, 0x03, 0xbe, 0x42, 0x29, 0xfc,
+  0x5d, 0x03, 0x1c, 0xa9, 0x44, 0x70, 0xfc, 0x5d, 0xfc, 0xf9, 0x4f, 0x56, 0x81, 0xcf, 0x26, 0xe9,
+  0xe6, 0x3a, 0xc7, 0x4f, 0x86, 0x93, 0x8e, 0xde, 0x16, 0xcd, 0x32, 0xfd, 0x9a, 0x4c, 0x7d, 0x5d,
+  0x4e, 0xe2, 0x48, 0x04, 0xd1, 0x2d, 0x4f, 0xe3, 0x83, 0xe4, 0x32, 0x98, 0x80, 0x5e, 0x64, 0x2c,
+  0x8f, 0x7c, 0x0b, 0x0f, 0xa7, 0xf6, 0x85, 0x1d, 0xf4, 0x58, 0xbe, 0xb5, 0xf7, 0x3a, 0x21, 0xaf,
+  0x0a, 0xb2, 0x18, 0x03, 0x29, 0xfc, 0xa8, 0x1e, 0xda, 0xef, 0x61, 0x05, 0x19, 0xe3, 0x63, 0xa1,
+  0xaf, 0x8e, 0x0e, 0xf9, 0x56, 0x49, 0x10, 0x5e, 0xdf, 0xd2, 0x4e, 0x65, 0x1d, 0x02, 0x7b, 0x83,
+  0xff, 0x0b, 0xd2, 0xef, 0xd7, 0x2a, 0x0c, 0xc0, 0x00, 0x00
+};
+const size_t ATTICFAN_JS_LEN = sizeof(ATTICFAN_JS);
+#define ATTICFAN_JS_ETAG "\"963c0f0b507ca641\""
 
-      // Hide all first
-      if (avgDisplay) avgDisplay.style.display = 'none';
-      if (sensor1Display) sensor1Display.style.display = 'none';
-      if (sensor2Display) sensor2Display.style.display = 'none';
-
-      if (count > 2) {
-        // Show average card
-        if (avgDisplay) avgDisplay.style.display = 'block';
-        document.getElementById('avgIndoorTemp').textContent = data.averageTemperature || '--';
-        document.getElementById('avgIndoorHumidity').textContent = data.averageHumidity || '--';
-      } else if (count === 2) {
-        // Show two individual cards
-        if (sensor1Display) sensor1Display.style.display = 'block';
-        document.getElementById('indoorSensor1Name').textContent = data.sensors[0].name;
-        document.getElementById('indoorSensor1Temp').textContent = data.sensors[0].temperature;
-        document.getElementById('indoorSensor1Humidity').textContent = data.sensors[0].humidity;
-
-        if (sensor2Display) sensor2Display.style.display = 'block';
-        document.getElementById('indoorSensor2Name').textContent = data.sensors[1].name;
-        document.getElementById('indoorSensor2Temp').textContent = data.sensors[1].temperature;
-        document.getElementById('indoorSensor2Humidity').textContent = data.sensors[1].humidity;
-      } else if (count === 1) {
-        // Show one individual card
-        if (sensor1Display) sensor1Display.style.display = 'block';
-        document.getElementById('indoorSensor1Name').textContent = data.sensors[0].name;
-        document.getElementById('indoorSensor1Temp').textContent = data.sensors[0].temperature;
-        document.getElementById('indoorSensor1Humidity').textContent = data.sensors[0].humidity;
-      }
-    })
-    .catch(err => {
-      debugError("Failed to fetch indoor sensors:", err);
-      allIndoorSensors = [];
-    });
-}
-function updateWeatherData() {
-  const iconEl = document.getElementById("currentWeatherIcon");
-  const tempEl = document.getElementById("currentWeatherTemp");
-  const humidityEl = document.getElementById("currentWeatherHumidity");
-  const forecastContainer = document.getElementById("forecastContainer");
-  const isLocalDev = location.hostname === "" || location.hostname === "localhost" || location.hostname === "127.0.0.1" || location.protocol === "file:";
-  debugLog('[AtticFan] updateWeatherData called.');
-  if (isLocalDev) {
-    const lat = 38.72;
-    const lon = -121.36;
-    const url = `http://api.open-meteo.com/v1/forecast?latitude=${lat}&longitude=${lon}&current=temperature_2m,relativehumidity_2m,weathercode&daily=weathercode,temperature_2m_max,temperature_2m_min,sunrise,sunset&hourly=temperature_2m,weathercode&temperature_unit=fahrenheit&windspeed_unit=mph&precipitation_unit=inch&forecast_days=3&timezone=auto`;
-  debugLog('[AtticFan] Fetching weather from Open-Meteo:', url);
-    (async () => {
-      try {
-        const res = await fetch(url);
-  debugLog('[AtticFan] Open-Meteo response status:', res.status);
-        const data = await res.json();
-  debugLog('[AtticFan] Open-Meteo data:', data);
-        iconEl.textContent = weatherCodeToEmoji(data.current.weathercode);
-        tempEl.textContent = data.current.temperature_2m.toFixed(1);
-        humidityEl.textContent = data.current.relativehumidity_2m;
-        
-        // Update sunrise/sunset display
-        updateSunriseSunset(data.daily.sunrise[0], data.daily.sunset[0]);
-        
-        // Build forecast array for rendering
-        const forecast = data.daily.time.map((time, index) => ({
-          dayOfWeek: new Date(time).getUTCDay(),
-          icon: weatherCodeToEmoji(data.daily.weathercode[index]),
-          max: Math.round(data.daily.temperature_2m_max[index]),
-          min: Math.round(data.daily.temperature_2m_min[index])
-        }));
-        renderForecast(forecastContainer, forecast);
-        
-        // Render hourly forecast
-        if (data.hourly && Array.isArray(data.hourly.time)) {
-          renderHourlyForecast(data.hourly);
-        }
-      } catch (err) {
-  debugWarn('[AtticFan] Open-Meteo fetch failed, using mock weather data:', err);
-        forecastContainer.innerHTML = "";
-        iconEl.textContent = "☀️";
-        tempEl.textContent = "75";
-        humidityEl.textContent = "55";
-        
-        // Mock sunrise/sunset
-        updateSunriseSunset("06:30", "19:45");
-        
-        const mockForecast = [
-          { dayOfWeek: new Date().getUTCDay(), icon: '☀️', max: '85', min: '65' },
-          { dayOfWeek: (new Date().getUTCDay() + 1) % 7, icon: '⛅', max: '82', min: '63' },
-          { dayOfWeek: (new Date().getUTCDay() + 2) % 7, icon: '🌦️', max: '78', min: '60' }
-        ];
-        renderForecast(forecastContainer, mockForecast, true);
-        
-        // Mock hourly forecast
-        const now = new Date();
-        const mockHourlyData = {
-          time: [],
-          temperature_2m: [],
-          weathercode: []
-        };
-        for (let i = 0; i < 5; i++) {
-          const hour = new Date(now.getTime() + i * 60 * 60 * 1000);
-          const timeStr = hour.toISOString().substring(0, 16);
-          mockHourlyData.time.push(timeStr);
-          mockHourlyData.temperature_2m.push(75 + Math.random() * 10);
-          mockHourlyData.weathercode.push([0, 1, 1, 80, 61][i]);
-        }
-        renderHourlyForecast(mockHourlyData);
-      }
-    })();
-    return;
-  }
-  debugLog('[AtticFan] Fetching /weather from backend...');
-  (async () => {
-    try {
-      const res = await fetch("/weather");
-  debugLog('[AtticFan] /weather response status:', res.status);
-      const data = await res.json();
-  debugLog('[AtticFan] /weather data:', data);
-      iconEl.textContent = data.currentIcon;
-      tempEl.textContent = data.currentTemp;
-      humidityEl.textContent = data.currentHumidity;
-      
-      // Update sunrise/sunset if available
-      if (data.sunrise && data.sunset) {
-        updateSunriseSunset(data.sunrise, data.sunset);
-      } else {
-        // Clear any existing sunrise/sunset display if data isn't available
-        const sunriseEl = document.getElementById('sunriseTime');
-        const sunsetEl = document.getElementById('sunsetTime');
-        if (sunriseEl) sunriseEl.textContent = '🌅 --:--';
-        if (sunsetEl) sunsetEl.textContent = '🌇 --:--';
-      }
-      
-      renderForecast(forecastContainer, data.forecast);
-      
-      // Render hourly forecast if available
-      if (data.hourly) {
-        renderHourlyForecast(data.hourly);
-      }
-    } catch (err) {
-  debugError('[AtticFan] Failed to fetch /weather:', err);
-    }
-  })();
-}
-function dayOfWeekToString(dayIndex, isToday) {
-  if (isToday) return "Today";
-  const days = ["Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"];
-  if (dayIndex >= 0 && dayIndex < 7) {
-    return days[dayIndex];
-  }
-}
-function weatherCodeToEmoji(code) {
-  if (code === 0) return "☀️"; // Clear sky
-  if (code >= 1 && code <= 3) return "⛅"; // Mainly clear, partly cloudy, overcast
-  if (code >= 45 && code <= 48) return "🌫️"; // Fog
-  if (code >= 51 && code <= 57) return "💧"; // Drizzle
-  if (code >= 61 && code <= 67) return "🌧️"; // Rain
-  if (code >= 71 && code <= 77) return "❄️"; // Snow
-  if (code >= 80 && code <= 82) return "🌦️"; // Rain showers
-  if (code >= 85 && code <= 86) return "🌨️"; // Snow showers
-  if (code >= 95 && code <= 99) return "⛈️"; // Thunderstorm
-  return "❓";
-}
-function setMode(newMode, sendCommand = true) {
-  const isManual = newMode === 'MANUAL';
-  document.getElementById('autoModeBtn').disabled = !isManual;
-  document.getElementById('manualModeBtn').disabled = isManual;
-  if (testMode) {
-    document.getElementById("currentMode").textContent = newMode;
-  }
-  const manualOnBtn = document.getElementById("manualOnBtn");
-  const manualOffBtn = document.getElementById("manualOffBtn");
-  const setTimerBtn = document.getElementById("setTimerBtn");
-  if (isManual) {
-    // When switching to manual, enable buttons based on the current fan state
-    if (manualOnBtn) manualOnBtn.disabled = currentFanState;
-    if (manualOffBtn) manualOffBtn.disabled = !currentFanState;
-    if (setTimerBtn) setTimerBtn.disabled = false;
-  } else {
-    // If not in manual mode, disable all manual buttons
-    if (manualOnBtn) manualOnBtn.disabled = true;
-    if (manualOffBtn) manualOffBtn.disabled = true;
-    if (setTimerBtn) setTimerBtn.disabled = true;
-  }
-  if (sendCommand) {
-    if (newMode === 'AUTO') {
-  fetch("/fan?state=auto").then(res => { if(res.ok) updateSensorData(); }).catch(err => debugError("Failed to set auto mode:", err));
-    } else if (newMode === 'MANUAL') {
-      // Preserve the current fan state when switching to manual.
-      const stateToSet = currentFanState ? 'on' : 'off';
-  fetch("/fan?state=" + stateToSet).then(res => { if(res.ok) updateSensorData(); }).catch(err => debugError("Failed to set manual mode:", err));
-    }
-  }
-}
-function setFan(state) {
-  if (testMode) {
-    const fanIsOn = (state === 'on');
-    currentFanState = fanIsOn; // Update the global state
-    updateFanVisual(fanIsOn);
-    // Update the button disabled states to reflect the new fan state
-    document.getElementById('manualOnBtn').disabled = fanIsOn;
-    document.getElementById('manualOffBtn').disabled = !fanIsOn;
-    return;
-  }
-  // Send the command and then immediately trigger a status update for a responsive UI.
-  fetch("/fan?state=" + state)
-    .then(res => {
-      if (res.ok) updateSensorData();
-    })
-    .catch(err => {
-  debugError("Fan toggle failed:", err);
-    });
-}
-async function loadConfig() {
-  if (testMode) {
-    return; // In local test mode, defaults are used from the HTML value attributes.
-  }
-  try {
-    const response = await fetch("/config");
-    const data = await response.json();
-    document.getElementById("fanOnTemp").value = data.fanOnTemp;
-    document.getElementById("fanDeltaTemp").value = data.fanDeltaTemp;
-    document.getElementById("fanHysteresis").value = data.fanHysteresis;
-    document.getElementById("preCoolTriggerTemp").value = data.preCoolTriggerTemp;
-    document.getElementById("preCoolTempOffset").value = data.preCoolTempOffset;
-    document.getElementById("preCoolingEnabled").checked = data.preCoolingEnabled;
-    document.getElementById("onboardLedEnabled").checked = data.onboardLedEnabled;
-    document.getElementById("testModeEnabled").checked = data.testModeEnabled;
-    document.getElementById("dailyRestartEnabled").checked = data.dailyRestartEnabled;
-    document.getElementById("mqttEnabled").checked = data.mqttEnabled;
-    document.getElementById("mqttDiscoveryEnabled").checked = data.mqttDiscoveryEnabled;
-    if (data.historyLogIntervalMs) {
-      const intervalInput = document.getElementById("historyLogInterval");
-      if(intervalInput) intervalInput.value = Math.round(data.historyLogIntervalMs / 60000);
-    }
-  } catch (err) {
-  debugError("Failed to load config:", err);
-  }
-}
-function saveConfig() {
-  if (testMode) return;
-  const fanOnTemp = document.getElementById("fanOnTemp").value;
-  const fanDeltaTemp = document.getElementById("fanDeltaTemp").value;
-  const fanHysteresis = document.getElementById("fanHysteresis").value;
-  const preCoolTriggerTemp = document.getElementById("preCoolTriggerTemp").value;
-  const preCoolTempOffset = document.getElementById("preCoolTempOffset").value;
-  const preCoolingEnabled = document.getElementById("preCoolingEnabled").checked;
-  const onboardLedEnabled = document.getElementById("onboardLedEnabled").checked;
-  const testModeEnabled = document.getElementById("testModeEnabled").checked;
-  const dailyRestartEnabled = document.getElementById("dailyRestartEnabled").checked;
-  const mqttEnabled = document.getElementById("mqttEnabled").checked;
-  const mqttDiscoveryEnabled = document.getElementById("mqttDiscoveryEnabled").checked;
-  const logIntervalMin = parseInt(document.getElementById("historyLogInterval").value, 10);
-  const configPayload = {
-    fanOnTemp: parseFloat(fanOnTemp),
-    fanDeltaTemp: parseFloat(fanDeltaTemp),
-    fanHysteresis: parseFloat(fanHysteresis),
-    preCoolTriggerTemp: parseFloat(preCoolTriggerTemp),
-    preCoolTempOffset: parseFloat(preCoolTempOffset),
-    preCoolingEnabled: preCoolingEnabled,
-    onboardLedEnabled: onboardLedEnabled,
-    dailyRestartEnabled: dailyRestartEnabled,
-    testModeEnabled: testModeEnabled,
-    mqttEnabled: mqttEnabled,
-    mqttDiscoveryEnabled: mqttDiscoveryEnabled
-  };
-  if (!isNaN(logIntervalMin) && logIntervalMin > 0) {
-    configPayload.historyLogIntervalMs = logIntervalMin * 60000;
-  }
-  fetch("/config", {
-    method: 'POST',
-    headers: { 'Content-Type': 'application/json' },
-    body: JSON.stringify(configPayload) // Corrected: use the payload object
-  })
-  .then(res => Promise.all([res.ok, res.text()]))
-  .then(([ok, text]) => {
-    if (ok) {
-      showToast("Configuration saved!");
-      // Use the more informative message from the server
-      if (text.includes("restart") && confirm(text + " Restart now?")) { restartDevice(); }
-    } else {
-      showToast("Save failed!");
-    }
-  })
-  .catch(err => {
-  debugError("Failed to save config:", err);
-    showToast("Save failed!");
-  });
-}
-function restartDevice() {
-  if (testMode) {
-    alert("Restart command sent (test mode).");
+#if WEBUI_EMIT_STREAM_HELPER
+#include <ESP8266WebServer.h>
+static void handleAtticfanJs() {
+  extern ESP8266WebServer server;
+  server.sendHeader("Vary", "Accept-Encoding");
+  if (server.header("Accept-Encoding").indexOf("gzip") < 0) {
+    server.send(406, "text/plain", "Only available gzip-compressed; send Accept-Encoding: gzip.");
     return;
   }
-  if (confirm("Are you sure you want to restart the device?")) {
-    fetch("/restart")
-      .then(() => {
-        alert("Device is restarting. The page will become unresponsive.");
-      })
-  .catch(err => debugError("Failed to send restart command:", err));
-  }
-}
-function resetConfig() {
-  if (testMode) {
-    alert("Config reset to defaults (test mode).");
+  server.sendHeader("ETag", ATTICFAN_JS_ETAG);
+  server.sendHeader("Cache-Control", server.hasArg("v") ? "public, max-age=31536000, immutable" : "no-cache");
+  if (server.header("If-None-Match") == ATTICFAN_JS_ETAG) {
+    server.send(304);
     return;
   }
-  if (confirm("Are you sure you want to reset all settings to their factory defaults? This action cannot be undone.")) {
-    fetch("/reset_config")
-      .then(() => {
-        alert("Configuration has been reset. The device will now restart.");
-        setTimeout(() => location.reload(), 5000); // Reload the page to show the new default settings
-      })
-  .catch(err => debugError("Failed to reset config:", err));
-  }
-}
-function setSliderInteraction(isInteracting) {
-  // When the user interacts with a slider, set a flag.
-  // This prevents the periodic status update from overwriting the slider's position.
-  // The flag is reset only when "Update Temps" is clicked successfully.
-  isInteractingWithSlider = isInteracting;
-}
-function openIndoorSensorsModal(event) {
-  if (event) event.preventDefault();
-  const listEl = document.getElementById('indoorSensorsList');
-  if (!listEl) return;
-
-  if (allIndoorSensors.length > 0) {
-    listEl.innerHTML = allIndoorSensors.map(sensor => `
-      <div class="sensor-modal-item">
-        <div class="sensor-modal-name">${sensor.name}</div>
-        <div class="sensor-modal-data">
-          <span>${sensor.temperature}°F</span> / <span>${sensor.humidity}%</span>
-        </div>
-      </div>
-    `).join('');
-  } else {
-    listEl.innerHTML = '<p>No indoor sensor data available.</p>';
-  }
-
-  document.getElementById('indoorSensorsModal').style.display = 'block';
-}
-function closeIndoorSensorsModal() {
-  document.getElementById('indoorSensorsModal').style.display = 'none';
-}
-// Make functions globally available for onclick handlers
-window.openIndoorSensorsModal = openIndoorSensorsModal;
-window.closeIndoorSensorsModal = closeIndoorSensorsModal;
-
-function openTimerModal() {
-  document.getElementById('timerModal').style.display = 'block';
-}
-function closeTimerModal() {
-  document.getElementById('timerModal').style.display = 'none';
-}
-function startTimedRun() {
-  const delay = document.getElementById('timerDelay').value;
-  const duration = document.getElementById('timerDuration').value;
-  const postAction = document.getElementById('postTimerAction').value;
-  fetch('/fan', {
-    method: 'POST',
-    headers: { 'Content-Type': 'application/json' },
-    body: JSON.stringify({
-      action: 'start_timed',
-      delay: parseInt(delay, 10),
-      duration: parseInt(duration, 10),
-      postAction: postAction
-    })
-  })
-  .then(res => {
-    if (res.ok) {
-      showToast("Timed run started!");
-      closeTimerModal();
-    } else {
-      showToast("Failed to start timer.");
-    }
-  })
-  .catch(err => debugError("Failed to start timed run:", err));
-}
-function toggleInfo(element) {
-  const targetId = element.getAttribute('data-target');
-  const targetElement = document.getElementById(targetId);
-  if (targetElement) {
-    targetElement.style.display = targetElement.style.display === 'block' ? 'none' : 'block';
-  }
-}
-function updateTempDisplay(elementId, value) {
-  document.getElementById(elementId).textContent = value;
-}
-function updateTestTemps() {
-  const attic = document.getElementById('simulatedAtticTemp').value;
-  const outdoor = document.getElementById('simulatedOutdoorTemp').value;
-  fetch(`/test/set_temps?attic=${attic}&outdoor=${outdoor}`)
-    .then(res => {
-      const success = res.ok;
-      showToast(success ? "Test temps updated." : "Update failed.");
-      if (success) {
-        // On success, reset the interaction flag so the UI will sync with the device again.
-        setSliderInteraction(false);
-      }
-    })
-  .catch(err => debugError("Failed to set test temps:", err));
-}
-// Add change event listeners to feature toggles for immediate save
-document.addEventListener("DOMContentLoaded", function() {
-  ["preCoolingEnabled", "onboardLedEnabled", "dailyRestartEnabled", "mqttEnabled", "mqttDiscoveryEnabled", "testModeEnabled"].forEach(id => {
-    const el = document.getElementById(id);
-    if (el) {
-      el.addEventListener("change", saveConfig);
-    }
-  });
-});
-function forceAPMode() {
-  if (testMode) {
-    alert("AP Mode command sent (test mode)."); return;
-  }
-  if (confirm("This will force the device into AP mode and disconnect it from your WiFi. Are you sure?")) {
-    fetch('/test/force_ap')
-      .then(() => showToast("AP Mode command sent."))
-  .catch(err => debugError("Failed to force AP mode:", err));
-  }
-}
-function clearDiagnostics() {
-  if (testMode) {
-    alert("Clear diagnostics command sent (test mode)."); return;
-  }
-  if (confirm("Are you sure you want to permanently delete the diagnostics log? This action cannot be undone.")) {
-    fetch("/clear_diagnostics")
-      .then(res => res.text())
-      .then(text => {
-        showToast(text);
-      })
-      .catch(err => {
-  debugError("Failed to clear diagnostics:", err);
-        showToast("Error clearing diagnostics log.");
-      });
-  }
-}
-function clearHistory() {
-  if (testMode) {
-    alert("Clear history command sent (test mode)."); return;
-  }
-  if (confirm("Are you sure you want to permanently delete the history log? This action cannot be undone.")) {
-    fetch("/clear_history")
-      .then(res => res.text())
-      .then(text => {
-        showToast(text);
-        fetchAndRenderHistory(); // Refresh the chart, which should now be empty
-      })
-      .catch(err => {
-  debugError("Failed to clear history:", err);
-        showToast("Error clearing history log.");
-      });
-  }
-}
-function showToast(message) {
-  const toast = document.getElementById("saveToast");
-  toast.textContent = message;
-  toast.style.visibility = "visible";
-  setTimeout(() => {
-    toast.style.visibility = "hidden";
-  }, 3000);
-}
-function updateFanVisual(isFanOn) {
-  const fanStateEl = document.getElementById("fanState");
-  fanStateEl.textContent = isFanOn ? "ON" : "OFF";
-  if (isFanOn) {
-    fanIconEl.style.animation = 'spin 1s linear infinite';
-  } else {
-    fanIconEl.style.animation = 'none';
-  }
-}
-async function initializeApp() {
-  // Set initial UI state for controls
-  setMode('AUTO', false); // Set a default, will be corrected by first status update
-  await loadConfig();
-  updateSensorData();
-  updateWeatherData();
-  fetchAndRenderHistory();
-  setInterval(fetchAndRenderHistory, 5 * 60 * 1000); // Refresh history every 5 min
-  setInterval(updateSensorData, 3000); // Refresh status every 3 seconds for a responsive UI
-  setInterval(updateWeatherData, 600000); // Update weather every 10 minutes
-}
-// Close modal if user clicks outside of it
-window.onclick = function(event) {
-  const modal = document.getElementById('timerModal'); // Existing timer modal
-  const sensorsModal = document.getElementById('indoorSensorsModal');
-  if (event.target === modal) {
-    modal.style.display = "none";
-  }
-}
-window.addEventListener("pageshow", function(event) {
-  if (event.persisted) {
-    loadConfig();
-  }
-});
-
-// Only perform the ESP ping if not running on localhost, 127.0.0.1, or file://
-const isLocalDev = location.hostname === "" || location.hostname === "localhost" || location.hostname === "127.0.0.1" || location.protocol === "file:";
-if (!isLocalDev) {
-  fetch("/fan?state=ping", { method: 'GET', signal: AbortSignal.timeout(2000) })
-    .then(res => {
-      if (!res.ok) throw new Error("Not live");
-  debugLog("ESP detected, running in live mode.");
-      // No special setup needed for live mode.
-    })
-    .catch(() => {
-      console.info("ESP not detected, running in local test mode.");
-      testMode = true;
-    });
-}
-
-// Manually show the test panel for local viewing.
-document.getElementById('test-panel').style.display = 'block';
-const atticSlider = document.getElementById('simulatedAtticTemp');
-const outdoorSlider = document.getElementById('simulatedOutdoorTemp');
-atticSlider.value = 95;
-outdoorSlider.value = 88;
-// Populate the main display with initial test values
-document.getElementById("atticTemp").textContent = atticSlider.value;
-document.getElementById("atticHumidity").textContent = "55"; // A reasonable default
-document.getElementById("outdoorTemp").textContent = outdoorSlider.value;
-document.getElementById("currentMode").textContent = "AUTO"; // Default to AUTO mode
-// Populate the test panel slider labels
-updateTempDisplay('attic-temp-val', atticSlider.value);
-updateTempDisplay('outdoor-temp-val', outdoorSlider.value);
-
-
-// Helper script for modal animation
-(function(){const o=window.openTimerModal,c=window.closeTimerModal;window.openTimerModal=function(){try{document.getElementById('timerModal').classList.add('show')}catch(e){} return o?o():void 0};window.closeTimerModal=function(){try{document.getElementById('timerModal').classList.remove('show')}catch(e){} return c?c():void 0}})();
-
-
-// Helper script to initialize slider display values on load
-document.addEventListener('DOMContentLoaded', function(){
-  const att = document.getElementById('simulatedAtticTemp');
-  const out = document.getElementById('simulatedOutdoorTemp');
-  if (att) document.getElementById('attic-temp-val').textContent = att.value;
-  if (out) document.getElementById('outdoor-temp-val').textContent = out.value;
-});
-
-/**
- * Updates sunrise and sunset display in the weather section header
- */
-function updateSunriseSunset(sunrise, sunset) {
-  // Extract time from ISO datetime if needed
-  const sunriseTime = sunrise.includes('T') ? sunrise.split('T')[1].substring(0, 5) : sunrise;
-  const sunsetTime = sunset.includes('T') ? sunset.split('T')[1].substring(0, 5) : sunset;
-  
-  // Find the weather section
-  const weatherSection = document.querySelector('.content-section');
-  if (weatherSection) {
-    let headerRow = weatherSection.querySelector('.weather-header-row');
-    if (!headerRow) {
-      // Remove existing h2 if present
-      const oldHeader = weatherSection.querySelector('h2');
-      let headerText = 'Weather Forecast';
-      if (oldHeader) {
-        headerText = oldHeader.textContent.replace(/🌅.*🌇.*/, '').trim();
-        oldHeader.remove();
-      }
-      headerRow = document.createElement('div');
-      headerRow.className = 'weather-header-row';
-      headerRow.innerHTML = `
-        <span class="sunrise-sunset" id="sunriseTime">🌅 ${sunriseTime}</span>
-        <span class="weather-header-title">${headerText}</span>
-        <span class="sunrise-sunset" id="sunsetTime">🌇 ${sunsetTime}</span>
-      `;
-      weatherSection.insertBefore(headerRow, weatherSection.firstChild);
-    } else {
-      // Update times only
-      const sunriseEl = headerRow.querySelector('#sunriseTime');
-      const sunsetEl = headerRow.querySelector('#sunsetTime');
-      if (sunriseEl) sunriseEl.textContent = `🌅 ${sunriseTime}`;
-      if (sunsetEl) sunsetEl.textContent = `🌇 ${sunsetTime}`;
-    }
-  }
-}
-
-/**
- * Renders hourly forecast for the next 4-5 hours
- */
-function renderHourlyForecast(hourlyData) {
-  let hourlyContainer = document.getElementById('hourlyForecastContainer');
-  
-  if (!hourlyContainer) {
-    // Create hourly forecast container
-    const weatherSection = document.querySelector('#forecastContainer').parentNode;
-    hourlyContainer = document.createElement('div');
-    hourlyContainer.id = 'hourlyForecastContainer';
-    hourlyContainer.className = 'hourly-forecast';
-    
-    const title = document.createElement('h4');
-    title.textContent = 'Hourly Forecast';
-    title.style.marginTop = '1rem';
-    title.style.marginBottom = '0.5rem';
-    
-    weatherSection.insertBefore(title, weatherSection.querySelector('#forecastContainer'));
-    weatherSection.insertBefore(hourlyContainer, weatherSection.querySelector('#forecastContainer'));
-  }
-  
-  hourlyContainer.innerHTML = "";
-
-  if (
-    hourlyData &&
-    Array.isArray(hourlyData.time) &&
-    Array.isArray(hourlyData.temperature_2m) &&
-    Array.isArray(hourlyData.weathercode)
-  ) {
-    let times = hourlyData.time;
-    let temps = hourlyData.temperature_2m;
-    let codes = hourlyData.weathercode;
-
-    // The device provides a pre-filtered 5-hour forecast. Localhost gets the full 72-hour forecast.
-    // Only slice the data if the array is long (i.e., we are in local development).
-    if (times.length > 5) {
-      const now = new Date();
-      const startIdx = now.getHours();
-      times = times.slice(startIdx, startIdx + 5);
-      temps = temps.slice(startIdx, startIdx + 5);
-      codes = codes.slice(startIdx, startIdx + 5);
-    }
-    
-    console.log('[HourlyForecast] times:', times);
-    console.log('[HourlyForecast] temps:', temps);
-    console.log('[HourlyForecast] codes:', codes);
-    for (let i = 0; i < times.length; i++) {
-      const hourDiv = document.createElement("div");
-      hourDiv.className = "hourly-item";
-      let displayTime = times[i];
-      if (displayTime.includes('T')) {
-        // Extract hour from 'YYYY-MM-DDTHH:MM'
-        let hourStr = displayTime.split('T')[1].substring(0, 2);
-        let hour = parseInt(hourStr, 10);
-        let ampm = hour >= 12 ? 'PM' : 'AM';
-        let hour12 = hour % 12;
-        if (hour12 === 0) hour12 = 12;
-        displayTime = `${hour12} ${ampm}`;
-      }
-      const icon = weatherCodeToEmoji(codes[i]);
-      const temp = typeof temps[i] === 'number' ? Math.round(temps[i]) : temps[i];
-      hourDiv.innerHTML = `
-        <div class="hourly-time">${displayTime}</div>
-        <div class="hourly-icon">${icon}</div>
-        <div class="hourly-temp">${temp}°</div>
-      `;
-      hourlyContainer.appendChild(hourDiv);
-    }
-  } else {
-    console.error('[HourlyForecast] Invalid hourlyData format:', hourlyData);
-  }
-}
-
-// Ensure main app logic runs after DOM is ready
-document.addEventListener('DOMContentLoaded', initializeApp);)EMB1";
-const size_t ATTICFAN_JS_LEN = sizeof(ATTICFAN_JS) - 1;
-
-#if WEBUI_EMIT_STREAM_HELPER
-// NOTE: Assumes you have a global 'ESP8266WebServer server(80);'
-// If your instance is named differently, set WEBUI_EMIT_STREAM_HELPER=0
-// and paste a custom handler in your route file. 
-#include <ESP8266WebServer.h>                                                   
-static void handleAtticfanJs() {
-  extern ESP8266WebServer server;                                              
-  server.sendHeader("Connection", "close");                                   
-  server.send_P(200, "application/javascript",                                               
-                ATTICFAN_JS, ATTICFAN_JS_LEN);
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, "application/javascript", reinterpret_cast<const char*>(ATTICFAN_JS), ATTICFAN_JS_LEN);
 }
 #endif
-
-#define F(string_literal) (FPSTR(PSTR(string_literal)))
@@ -0,0 +1,254 @@
+#pragma once
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+#include "hardware.h"
+
+/**
+ * @brief Long HTTP responses produced incrementally from loop().
+ *
+ * handleClient() runs a handler to completion, so a handler that streamed a
+ * large body held up the rest of loop() until a slow client had taken all of
+ * it. Such a handler now checks the request, then calls
+ * startBackgroundResponse() with a ResponseSource that produces the body piece
+ * by piece, and returns. serviceBackgroundResponses() moves the bodies along
+ * from loop(): it writes only what fits in each connection's TCP send buffer,
+ * takes turns between connections and stops after BACKGROUND_RESPONSE_BUDGET_US.
+ * The response ends by closing the connection ("Connection: close"), so the
+ * body needs no chunked framing.
+ *
+ * A body of known length can be served with startRangedBackgroundResponse(),
+ * which adds Content-Length and Accept-Ranges and answers a single-range Range
+ * request with 206, so an interrupted download can be resumed or just its tail
+ * fetched. The source skips what it can cheaply (see ResponseSource::skip());
+ * the rest of the bytes before the range are produced and dropped from loop()
+ * like the body.
+ */
+
+#define BACKGROUND_RESPONSE_CHUNK 512        // Bytes produced per ResponseSource::read()
+#define BACKGROUND_RESPONSE_STALL_MS 30000UL // A client that takes nothing for this long is dropped
+
+struct ResponseSource {
+  virtual ~ResponseSource() {}
+  /**
+   * @brief Writes the next part of the body into buf.
+   * @return Bytes written; 0 once the body is complete, or when nothing was
+   * ready this time and finished() is false.
+   */
+  virtual size_t read(char* buf, size_t size) = 0;
+  /**
+   * @brief Whether a read() that returned 0 ended the body. A source that works
+   * through its input in bounded steps returns false until the input is used up.
+   */
+  virtual bool finished() { return true; }
+  /**
+   * @brief Moves toward offset bytes into the body without producing them, e.g. by seeking.
+   * Called once, before the first read().
+   * @return Bytes skipped, at most offset; the rest are read and dropped.
+   */
+  virtual size_t skip(size_t offset) { return 0; }
+};
+
+struct BackgroundResponse {
+  WiFiClient client;
+  ResponseSource* source = nullptr;
+  char buf[BACKGROUND_RESPONSE_CHUNK];
+  size_t len = 0;
+  size_t pos = 0;
+  size_t discard = 0;        // Bytes still to drop before the range starts
+  size_t remaining = SIZE_MAX; // Bytes still to send; the body is cut off after its Content-Length
+  bool draining = false;     // Body complete; waiting for the client to acknowledge it before closing
+  size_t emptyRoom = 0;      // availableForWrite() with nothing in flight
+  unsigned long lastProgress = 0;
+};
+
+BackgroundResponse* backgroundResponses[BACKGROUND_RESPONSES_MAX] = {};
+uint32_t backgroundResponsesCompleted = 0;
+uint32_t backgroundResponsesAborted = 0;
+
+inline void endBackgroundResponse(uint8_t slot, bool completed) {
+  BackgroundResponse* response = backgroundResponses[slot];
+  response->client.stop();
+  delete response->source;
+  delete response;
+  backgroundResponses[slot] = nullptr;
+  if (completed) {
+    backgroundResponsesCompleted++;
+  } else {
+    backgroundResponsesAborted++;
+  }
+}
+
+/**
+ * @brief Returns the number of responses in progress.
+ */
+inline uint8_t backgroundResponseCount() {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < BACKGROUND_RESPONSES_MAX; i++) {
+    if (backgroundResponses[i]) count++;
+  }
+  return count;
+}
+
+/**
+ * @brief Sends the status line and headers, then hands the body to loop().
+ * Takes ownership of source. A HEAD request gets the headers only.
+ * @param headers Further header lines, each ending in "\r\n".
+ * @param offset, length The part of the source's output to send.
+ * @return false if all BACKGROUND_RESPONSES_MAX slots are busy; a 503 has been sent instead.
+ */
+inline bool startBackgroundResponse(ESP8266WebServer &server, int code, const char* contentType,
+                                    ResponseSource* source, const String& headers = String(),
+                                    size_t offset = 0, size_t length = SIZE_MAX) {
+  int8_t slot = -1;
+  for (uint8_t i = 0; i < BACKGROUND_RESPONSES_MAX && slot < 0; i++) {
+    if (!backgroundResponses[i]) slot = i;
+  }
+  if (slot < 0) {
+    delete source;
+    server.sendHeader("Retry-After", "10");
+    server.send(503, "text/plain", "Too many downloads in progress; try again shortly.");
+    return false;
+  }
+
+  WiFiClient client = server.client();
+  size_t emptyRoom = client.availableForWrite();
+  String head = "HTTP/1.1 " + String(code) + " " + String(ESP8266WebServer::responseCodeToString(code)) +
+                "\r\nContent-Type: " + contentType + "\r\n" + headers + "Connection: close\r\n\r\n";
+  client.write((const uint8_t*)head.c_str(), head.length());
+  if (server.method() == HTTP_HEAD) {
+    delete source;
+    client.stop();
+    return true;
+  }
+
+  BackgroundResponse* response = new BackgroundResponse();
+  response->client = client;
+  response->source = source;
+  response->discard = offset - source->skip(offset);
+  response->remaining = length;
+  response->emptyRoom = emptyRoom;
+  response->lastProgress = millis();
+  backgroundResponses[slot] = response;
+  return true;
+}
+
+/**
+ * @brief Writes the next pieces of every response in progress. Call from loop().
+ */
+inline void serviceBackgroundResponses() {
+  const uint32_t start = micros();
+  bool progress = true;
+  while (progress && micros() - start < BACKGROUND_RESPONSE_BUDGET_US) {
+    progress = false;
+    for (uint8_t i = 0; i < BACKGROUND_RESPONSES_MAX; i++) {
+      BackgroundResponse* response = backgroundResponses[i];
+      if (!response) continue;
+      if (!response->client.connected()) {
+        endBackgroundResponse(i, response->draining); // Clients may close once they have the whole body
+        continue;
+      }
+      size_t room = response->client.availableForWrite();
+      if (response->draining) {
+        // Closing now would make stop() wait for the last acknowledgements
+        if (room >= response->emptyRoom || millis() - response->lastProgress >= BACKGROUND_RESPONSE_STALL_MS) {
+          endBackgroundResponse(i, true);
+        }
+        continue;
+      }
+      if (response->pos == response->len) {
+        response->len = response->remaining ? response->source->read(response->buf, sizeof(response->buf)) : 0;
+        response->pos = 0;
+        if (response->discard) {
+          response->pos = response->discard < response->len ? response->discard : response->len;
+          response->discard -= response->pos;
+          progress = true;
+        }
+        if (response->len - response->pos > response->remaining) response->len = response->pos + response->remaining;
+        response->remaining -= response->len - response->pos;
+        if (response->len == 0 && response->remaining && !response->source->finished()) {
+          progress = true; // Nothing to send yet; the next turn continues the work
+          continue;
+        }
+        if (response->len == 0) {
+          response->draining = true;
+          response->lastProgress = millis();
+          continue;
+        }
+        if (response->pos == response->len) continue; // All dropped
+      }
+      if (room == 0) {
+        if (millis() - response->lastProgress >= BACKGROUND_RESPONSE_STALL_MS) endBackgroundResponse(i, false);
+        continue;
+      }
+      size_t want = response->len - response->pos;
+      size_t n = response->client.write((const uint8_t*)response->buf + response->pos, want < room ? want : room);
+      if (n > 0) {
+        response->pos += n;
+        response->lastProgress = millis();
+        progress = true;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Parses a single-range "bytes=" Range header against a body of total bytes.
+ * @return 1 with [first, last] set, 0 if the header is absent or not a single byte
+ * range (serve the whole body), -1 if no byte of the range exists (416).
+ */
+inline int8_t parseByteRange(const String& range, size_t total, size_t& first, size_t& last) {
+  if (!range.startsWith("bytes=") || range.indexOf(',') >= 0) return 0;
+  int dash = range.indexOf('-');
+  String from = range.substring(6, dash);
+  String to = dash >= 0 ? range.substring(dash + 1) : String();
+  from.trim();
+  to.trim();
+  if (dash < 0 || (from.length() == 0 && to.length() == 0)) return 0;
+  for (size_t i = 0; i < from.length(); i++) if (!isdigit((unsigned char)from[i])) return 0;
+  for (size_t i = 0; i < to.length(); i++) if (!isdigit((unsigned char)to[i])) return 0;
+  if (from.length() == 0) { // Suffix: the last n bytes
+    size_t n = strtoul(to.c_str(), nullptr, 10);
+    if (n == 0 || total == 0) return -1;
+    first = n < total ? total - n : 0;
+    last = total - 1;
+    return 1;
+  }
+  first = strtoul(from.c_str(), nullptr, 10);
+  last = to.length() ? strtoul(to.c_str(), nullptr, 10) : total - 1;
+  if (to.length() && last < first) return 0;
+  if (first >= total) return -1;
+  if (last >= total) last = total - 1;
+  return 1;
+}
+
+/**
+ * @brief startBackgroundResponse() for a body of known length: sends Content-Length
+ * and Accept-Ranges, and answers a Range request with 206 (or 416). A Range with
+ * an If-Range that does not match etag gets the whole body, as the client's
+ * partial copy is of a different version.
+ * Collect the "Range" and "If-Range" headers for this.
+ */
+inline bool startRangedBackgroundResponse(ESP8266WebServer &server, const char* contentType, ResponseSource* source,
+                                          size_t total, const String& etag = String(), String headers = String()) {
+  headers += "Accept-Ranges: bytes\r\n";
+  size_t first = 0;
+  size_t last = total ? total - 1 : 0;
+  int8_t ranged = 0;
+  if (!server.hasHeader("If-Range") || (etag.length() && server.header("If-Range") == etag)) {
+    ranged = parseByteRange(server.header("Range"), total, first, last);
+  }
+  if (ranged < 0) {
+    delete source;
+    server.sendHeader("Accept-Ranges", "bytes");
+    server.sendHeader("Content-Range", "bytes */" + String((unsigned long)total));
+    server.send(416, "text/plain", "Range not satisfiable");
+    return false;
+  }
+  size_t length = total ? last - first + 1 : 0;
+  if (ranged) {
+    headers += "Content-Range: bytes " + String((unsigned long)first) + "-" + String((unsigned long)last) + "/" +
+               String((unsigned long)total) + "\r\n";
+  }
+  headers += "Content-Length: " + String((unsigned long)length) + "\r\n";
+  return startBackgroundResponse(server, ranged ? 206 : 200, contentType, source, headers, first, length);
+}
@@ -0,0 +1,260 @@
+#!/usr/bin/env python3
+"""
+HTTP Request Latency Benchmark
+
+Measures request latency against the controller (or the host build) in four
+connection patterns:
+  close      a new TCP connection for every request
+  keepalive  one persistent connection, one request at a time
+  pipelined  one persistent connection, --depth requests sent before reading
+  parallel   --clients persistent connections at once, like a browser page load
+
+Usage:
+    python3 bench_http.py [host[:port]] [--requests N] [--clients N] [--depth N] [--path P ...]
+
+Example:
+    ./_gate_build/atticfan_host --port 8080 --quiet &
+    python3 bench_http.py 127.0.0.1:8080
+"""
+
+import argparse
+import socket
+import statistics
+import sys
+import threading
+import time
+
+DEFAULT_PATHS = ["/", "/atticfan.css", "/atticfan.js", "/api/bootstrap", "/status"]
+
+
+def read_response(sock, buf):
+    """Reads one response from sock; returns (status, keep_alive, leftover bytes)."""
+    while b"\r\n\r\n" not in buf:
+        data = sock.recv(65536)
+        if not data:
+            raise ConnectionError("connection closed before response headers")
+        buf += data
+    head, buf = buf.split(b"\r\n\r\n", 1)
+    lines = head.decode("latin-1").split("\r\n")
+    status = int(lines[0].split()[1])
+    headers = {}
+    for line in lines[1:]:
+        name, _, value = line.partition(":")
+        headers[name.strip().lower()] = value.strip()
+    keep_alive = headers.get("connection", "").lower() == "keep-alive"
+
+    if headers.get("transfer-encoding", "").lower() == "chunked":
+        while True:
+            while b"\r\n" not in buf:
+                buf += recv_some(sock)
+            size_line, buf = buf.split(b"\r\n", 1)
+            size = int(size_line.split(b";")[0], 16)
+            while len(buf) < size + 2:
+                buf += recv_some(sock)
+            buf = buf[size + 2:]
+            if size == 0:
+                break
+    elif "content-length" in headers:
+        length = int(headers["content-length"])
+        while len(buf) < length:
+            buf += recv_some(sock)
+        buf = buf[length:]
+    else:
+        # Body ends when the server closes the connection
+        while True:
+            data = sock.recv(65536)
+            if not data:
+                break
+        buf = b""
+        keep_alive = False
+    return status, keep_alive, buf
+
+
+def recv_some(sock):
+    data = sock.recv(65536)
+    if not data:
+        raise ConnectionError("connection closed mid-response")
+    return data
+
+
+def request_bytes(host, path, close=False):
+    connection = "close" if close else "keep-alive"
+    return f"GET {path} HTTP/1.1\r\nHost: {host}\r\nAccept-Encoding: gzip\r\nConnection: {connection}\r\n\r\n".encode()
+
+
+def connect(host, port):
+    sock = socket.create_connection((host, port), timeout=10)
+    sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    return sock
+
+
+class Connection:
+    """A keep-alive connection that reconnects when the server closes it."""
+
+    def __init__(self, host, port):
+        self.host, self.port = host, port
+        self.sock = None
+        self.buf = b""
+        self.connects = 0
+
+    def ensure(self):
+        if self.sock is None:
+            self.sock = connect(self.host, self.port)
+            self.buf = b""
+            self.connects += 1
+
+    def drop(self):
+        if self.sock:
+            self.sock.close()
+        self.sock = None
+
+    def get(self, path):
+        reused = self.sock is not None
+        self.ensure()
+        try:
+            self.sock.sendall(request_bytes(self.host, path))
+            status, keep_alive, self.buf = read_response(self.sock, self.buf)
+        except (ConnectionError, OSError):
+            self.drop()
+            if not reused:
+                raise
+            # The server let an idle connection go; retry on a new one, as browsers do
+            return self.get(path)
+        if not keep_alive:
+            self.drop()
+        return status
+
+
+def run_close(host, port, paths, count):
+    latencies = []
+    for i in range(count):
+        start = time.perf_counter()
+        sock = connect(host, port)
+        sock.sendall(request_bytes(host, paths[i % len(paths)], close=True))
+        read_response(sock, b"")
+        sock.close()
+        latencies.append(time.perf_counter() - start)
+    return latencies, count
+
+
+def run_keepalive(host, port, paths, count):
+    conn = Connection(host, port)
+    latencies = []
+    for i in range(count):
+        start = time.perf_counter()
+        conn.get(paths[i % len(paths)])
+        latencies.append(time.perf_counter() - start)
+    conn.drop()
+    return latencies, conn.connects
+
+
+def run_pipelined(host, port, paths, count, depth):
+    latencies = []
+    connects = 0
+    sent = 0
+    while sent < count:
+        batch = min(depth, count - sent)
+        sock = connect(host, port)
+        connects += 1
+        start = time.perf_counter()
+        sock.sendall(b"".join(request_bytes(host, paths[(sent + i) % len(paths)]) for i in range(batch)))
+        buf = b""
+        done = 0
+        try:
+            while done < batch:
+                _, keep_alive, buf = read_response(sock, buf)
+                latencies.append(time.perf_counter() - start)
+                done += 1
+                if not keep_alive:
+                    break
+        except ConnectionError:
+            pass
+        sock.close()
+        sent += max(done, 1)
+    return latencies, connects
+
+
+def run_parallel(host, port, paths, count, clients):
+    latencies = []
+    connects = []
+    lock = threading.Lock()
+    per_client = max(1, count // clients)
+
+    def worker(offset):
+        conn = Connection(host, port)
+        mine = []
+        for i in range(per_client):
+            start = time.perf_counter()
+            try:
+                conn.get(paths[(offset + i) % len(paths)])
+            except (ConnectionError, OSError):
+                conn.drop()
+                continue
+            mine.append(time.perf_counter() - start)
+        conn.drop()
+        with lock:
+            latencies.extend(mine)
+            connects.append(conn.connects)
+
+    threads = [threading.Thread(target=worker, args=(c,)) for c in range(clients)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    return latencies, sum(connects)
+
+
+def percentile(sorted_values, p):
+    if not sorted_values:
+        return float("nan")
+    index = min(len(sorted_values) - 1, int(round(p / 100.0 * (len(sorted_values) - 1))))
+    return sorted_values[index]
+
+
+def report(name, latencies, connects, elapsed):
+    values = sorted(v * 1000 for v in latencies)
+    rate = len(values) / elapsed if elapsed > 0 else 0
+    print(f"{name:<10} {len(values):>6} {connects:>8} {rate:>8.1f} "
+          f"{percentile(values, 50):>8.2f} {percentile(values, 95):>8.2f} "
+          f"{percentile(values, 99):>8.2f} {max(values) if values else float('nan'):>8.2f} "
+          f"{statistics.mean(values) if values else float('nan'):>8.2f}")
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Request latency benchmark for the attic fan controller web server.")
+    ap.add_argument("target", nargs="?", default="127.0.0.1:8080", help="host[:port] (default 127.0.0.1:8080)")
+    ap.add_argument("--requests", type=int, default=200, help="Requests per pattern")
+    ap.add_argument("--clients", type=int, default=6, help="Connections in the parallel pattern")
+    ap.add_argument("--depth", type=int, default=5, help="Requests per batch in the pipelined pattern")
+    ap.add_argument("--path", action="append", help="Path to request; may be repeated")
+    ap.add_argument("--only", choices=["close", "keepalive", "pipelined", "parallel"], action="append",
+                    help="Run only this pattern; may be repeated")
+    args = ap.parse_args()
+
+    host, _, port = args.target.partition(":")
+    port = int(port) if port else 80
+    paths = args.path or DEFAULT_PATHS
+    patterns = args.only or ["close", "keepalive", "pipelined", "parallel"]
+
+    print(f"Benchmarking http://{host}:{port} with {', '.join(paths)}")
+    print(f"{'pattern':<10} {'reqs':>6} {'connects':>8} {'req/s':>8} {'p50 ms':>8} {'p95 ms':>8} {'p99 ms':>8} {'max ms':>8} {'mean ms':>8}")
+    for pattern in patterns:
+        start = time.perf_counter()
+        try:
+            if pattern == "close":
+                latencies, connects = run_close(host, port, paths, args.requests)
+            elif pattern == "keepalive":
+                latencies, connects = run_keepalive(host, port, paths, args.requests)
+            elif pattern == "pipelined":
+                latencies, connects = run_pipelined(host, port, paths, args.requests, args.depth)
+            else:
+                latencies, connects = run_parallel(host, port, paths, args.requests, args.clients)
+        except (ConnectionError, OSError) as e:
+            print(f"{pattern:<10} failed: {e}")
+            continue
+        report(pattern, latencies, connects, time.perf_counter() - start)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
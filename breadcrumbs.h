@@ -0,0 +1,189 @@
+#pragma once
+#include <Arduino.h>
+#include "hardware.h"
+#include "diagnostics.h"
+#include "profiler.h"
+
+/**
+ * @brief Crash breadcrumbs kept in RTC user memory.
+ *
+ * A small ring of binary records (HTTP request, fan switch, periodic free heap)
+ * plus the loop() stage being run survives a watchdog reset or exception,
+ * which the buffered diagnostics log does not. RTC memory is not flash, so
+ * recording costs no wear. On the next boot, crashes are reported to the
+ * diagnostics log with the reset reason and the ring starts over.
+ *
+ * The ring starts at block 32: blocks 0-31 hold the reset flag and the history
+ * buffer mirror, and are overwritten by OTA updates.
+ */
+
+#define BREADCRUMB_RTC_BLOCK 32
+#define BREADCRUMB_RTC_MAGIC 0xBC17
+#define BREADCRUMB_HEAP_INTERVAL_MS 60000UL // A free-heap crumb is added at least this often
+#define BREADCRUMB_TEXT_LEN 8
+
+enum BreadcrumbType : uint8_t {
+  CRUMB_HTTP,  // arg: method, text: URI without the leading '/'
+  CRUMB_FAN,   // arg: 1 on, 0 off
+  CRUMB_HEAP   // Periodic free heap sample
+};
+
+// RTC memory is copied in 32-bit words, so both structs are 4-byte aligned.
+struct alignas(4) Breadcrumb {
+  uint32_t ms;       // millis() when recorded
+  uint8_t type;      // BreadcrumbType
+  uint8_t arg;
+  uint16_t heap;     // Free heap in bytes, saturated at 65535
+  char text[BREADCRUMB_TEXT_LEN]; // Not NUL-terminated when full
+};
+
+struct alignas(4) BreadcrumbHeader {
+  uint16_t magic;
+  uint8_t head;      // Slot of the oldest crumb
+  uint8_t count;
+  uint8_t stage;     // Last loop() stage entered (LoopStage)
+  uint8_t reserved;
+  uint16_t stageHeap;
+  uint32_t stageMs;
+};
+
+// The stage fields fill header blocks 1-2, so a stage entry rewrites them without touching the ring fields in block 0.
+#define BREADCRUMB_STAGE_BLOCK (BREADCRUMB_RTC_BLOCK + 1)
+static_assert(offsetof(BreadcrumbHeader, stage) == 4 && offsetof(BreadcrumbHeader, stageMs) == 8,
+              "The stage fields must fill blocks 1-2 of the header");
+
+static_assert(BREADCRUMB_RTC_BLOCK + (sizeof(BreadcrumbHeader) + CRASH_BREADCRUMB_COUNT * sizeof(Breadcrumb)) / 4 <= 128,
+              "CRASH_BREADCRUMB_COUNT does not fit in RTC user memory");
+
+#define BREADCRUMB_SLOT_BLOCK(slot) (BREADCRUMB_RTC_BLOCK + (sizeof(BreadcrumbHeader) + (slot) * sizeof(Breadcrumb)) / 4)
+
+BreadcrumbHeader breadcrumbHeader;
+bool breadcrumbsReady = false;
+uint32_t lastHeapBreadcrumb = 0;
+
+inline uint16_t breadcrumbHeap() {
+  uint32_t heap = ESP.getFreeHeap();
+  return heap > 0xFFFF ? 0xFFFF : (uint16_t)heap;
+}
+
+inline void writeBreadcrumbHeader() {
+  ESP.rtcUserMemoryWrite(BREADCRUMB_RTC_BLOCK, (uint32_t*)&breadcrumbHeader, sizeof(breadcrumbHeader));
+}
+
+/**
+ * @brief Appends a crumb to the ring, overwriting the oldest when full.
+ * @param text Copied up to BREADCRUMB_TEXT_LEN characters; may be nullptr.
+ */
+inline void recordBreadcrumb(BreadcrumbType type, uint8_t arg, const char* text = nullptr) {
+  if (!breadcrumbsReady) return;
+  Breadcrumb crumb = {};
+  crumb.ms = millis();
+  crumb.type = type;
+  crumb.arg = arg;
+  crumb.heap = breadcrumbHeap();
+  for (uint8_t i = 0; text && i < sizeof(crumb.text) && text[i]; i++) crumb.text[i] = text[i];
+
+  uint8_t slot = (breadcrumbHeader.head + breadcrumbHeader.count) % CRASH_BREADCRUMB_COUNT;
+  if (breadcrumbHeader.count == CRASH_BREADCRUMB_COUNT) {
+    breadcrumbHeader.head = (breadcrumbHeader.head + 1) % CRASH_BREADCRUMB_COUNT;
+  } else {
+    breadcrumbHeader.count++;
+  }
+  ESP.rtcUserMemoryWrite(BREADCRUMB_SLOT_BLOCK(slot), (uint32_t*)&crumb, sizeof(crumb));
+  writeBreadcrumbHeader();
+}
+
+static const char* const breadcrumbMethods[] = { "GET", "POST", "PUT", "PATCH", "DELETE", "OPTIONS", "HEAD" };
+#define BREADCRUMB_METHOD_COUNT (sizeof(breadcrumbMethods) / sizeof(breadcrumbMethods[0]))
+
+/**
+ * @brief Records an incoming HTTP request. Install with server.addHook() so it runs before the handler.
+ */
+inline void recordHttpBreadcrumb(const String& method, const String& url) {
+  uint8_t m = 0xFF;
+  for (uint8_t i = 0; i < BREADCRUMB_METHOD_COUNT; i++) {
+    if (method == breadcrumbMethods[i]) m = i;
+  }
+  recordBreadcrumb(CRUMB_HTTP, m, url.c_str() + (url.startsWith("/") ? 1 : 0));
+}
+
+/**
+ * @brief Profiler hook: keeps the loop() stage being entered, and adds a heap crumb
+ * once per interval at the start of loop(). One 8-byte RTC write per stage.
+ */
+inline void recordStageBreadcrumb(LoopStage stage) {
+  breadcrumbHeader.stage = stage;
+  breadcrumbHeader.stageMs = millis();
+  breadcrumbHeader.stageHeap = breadcrumbHeap();
+  ESP.rtcUserMemoryWrite(BREADCRUMB_STAGE_BLOCK, (uint32_t*)&breadcrumbHeader.stage, 8);
+  if (stage == STAGE_HTTP && breadcrumbHeader.stageMs - lastHeapBreadcrumb >= BREADCRUMB_HEAP_INTERVAL_MS) {
+    lastHeapBreadcrumb = breadcrumbHeader.stageMs;
+    recordBreadcrumb(CRUMB_HEAP, 0);
+  }
+}
+
+// Logs one line, writing the buffer out first so a long report does not drop lines.
+inline void logCrashLine(const char* msg) {
+  if (diagnosticsBuffer.count == DIAGNOSTICS_BUFFER_RECORDS) flushDiagnostics();
+  logDiagnostics(msg);
+}
+
+/**
+ * @brief Writes the crumbs left by the previous run to the diagnostics log, oldest first.
+ */
+inline void reportBreadcrumbs(const BreadcrumbHeader& header) {
+  char msg[96];
+  snprintf(msg, sizeof(msg), "[CRASH] Running loop stage: %s, entered at %lu ms, heap %u bytes",
+           header.stage == STAGE_LOOP ? "none (between loop() calls)" : stageName(header.stage),
+           (unsigned long)header.stageMs, header.stageHeap);
+  logCrashLine(msg);
+  for (uint8_t i = 0; i < header.count; i++) {
+    Breadcrumb crumb;
+    ESP.rtcUserMemoryRead(BREADCRUMB_SLOT_BLOCK((header.head + i) % CRASH_BREADCRUMB_COUNT), (uint32_t*)&crumb, sizeof(crumb));
+    char text[BREADCRUMB_TEXT_LEN + 1];
+    memcpy(text, crumb.text, BREADCRUMB_TEXT_LEN);
+    text[BREADCRUMB_TEXT_LEN] = '\0';
+    switch (crumb.type) {
+      case CRUMB_HTTP:
+        snprintf(msg, sizeof(msg), "[CRASH] %lu ms: HTTP %s /%s (heap %u)", (unsigned long)crumb.ms,
+                 crumb.arg < BREADCRUMB_METHOD_COUNT ? breadcrumbMethods[crumb.arg] : "?", text, crumb.heap);
+        break;
+      case CRUMB_FAN:
+        snprintf(msg, sizeof(msg), "[CRASH] %lu ms: Fan %s (heap %u)", (unsigned long)crumb.ms, crumb.arg ? "ON" : "OFF", crumb.heap);
+        break;
+      case CRUMB_HEAP:
+        snprintf(msg, sizeof(msg), "[CRASH] %lu ms: Free heap %u", (unsigned long)crumb.ms, crumb.heap);
+        break;
+      default:
+        snprintf(msg, sizeof(msg), "[CRASH] %lu ms: Unknown breadcrumb %u", (unsigned long)crumb.ms, crumb.type);
+        break;
+    }
+    logCrashLine(msg);
+  }
+}
+
+/**
+ * @brief Logs the reset reason, reports the previous run's crumbs if it ended in a
+ * watchdog reset or exception, then starts a new ring. Call once the diagnostics log is usable.
+ */
+inline void initBreadcrumbs() {
+  char msg[96];
+  snprintf(msg, sizeof(msg), "[BOOT] Reset reason: %s", ESP.getResetReason().c_str());
+  logDiagnostics(msg);
+
+  BreadcrumbHeader previous;
+  ESP.rtcUserMemoryRead(BREADCRUMB_RTC_BLOCK, (uint32_t*)&previous, sizeof(previous));
+  uint32_t reason = ESP.getResetInfoPtr()->reason;
+  bool crashed = reason == REASON_WDT_RST || reason == REASON_EXCEPTION_RST || reason == REASON_SOFT_WDT_RST;
+  if (crashed && previous.magic == BREADCRUMB_RTC_MAGIC && previous.count <= CRASH_BREADCRUMB_COUNT &&
+      previous.head < CRASH_BREADCRUMB_COUNT) {
+    reportBreadcrumbs(previous);
+  }
+
+  breadcrumbHeader = BreadcrumbHeader();
+  breadcrumbHeader.magic = BREADCRUMB_RTC_MAGIC;
+  breadcrumbHeader.stage = STAGE_COUNT; // No stage entered yet, i.e. still in setup()
+  writeBreadcrumbHeader();
+  breadcrumbsReady = true;
+  profileStageHook = recordStageBreadcrumb;
+}
@@ -89,62 +89,86 @@ function saveSmartPreCooling() {
 
 window.saveCoreAutomation = saveCoreAutomation;
 window.saveSmartPreCooling = saveSmartPreCooling;
+const HISTORY_WINDOW_SEC = 24 * 60 * 60;
+const HISTORY_MAX_POINTS = 300;
+let historyRows = [];       // Rows currently charted, oldest first
+let historyCursor = null;   // X-History-Cursor of the last response; null forces a full load
+let historyEtag = null;
+
+// Parses /history CSV into row objects; throws if the required columns are missing.
+function parseHistoryCsv(csv) {
+  const lines = csv.trim().split(/\r?\n/);
+  const header = lines[0].split(',');
+  const timeIdx = header.indexOf('timestamp');
+  const atticIdx = header.indexOf('attic_temp');
+  if (timeIdx < 0 || atticIdx < 0) throw new Error('CSV format error: missing columns.');
+  const outdoorIdx = header.indexOf('outdoor_temp');
+  const humidityIdx = header.indexOf('humidity');
+  const fanOnIdx = header.indexOf('fan_on');
+  const rows = [];
+  for (let i = 1; i < lines.length; ++i) {
+    const row = lines[i].split(',');
+    rows.push({
+      ts: row[timeIdx] || '',
+      attic: parseFloat(row[atticIdx]),
+      outdoor: outdoorIdx >= 0 ? parseFloat(row[outdoorIdx]) : undefined,
+      humidity: humidityIdx >= 0 ? parseFloat(row[humidityIdx]) : undefined,
+      fanOn: fanOnIdx >= 0 ? parseInt(row[fanOnIdx], 10) : undefined
+    });
+  }
+  return rows;
+}
+
 async function fetchAndRenderHistory() {
   const chartMsgEl = document.getElementById('historyChartMsg');
   const chartEl = document.getElementById('historyChart');
-  debugLog('[AtticFan] Fetching /history.csv...');
+  // First load: last 24 hours, decimated on the device to what the chart can show.
+  // Refreshes: only the rows after the cursor, or a 304 when nothing was appended.
+  const from = Math.floor(Date.now() / 1000) - HISTORY_WINDOW_SEC;
+  const incremental = historyCursor !== null;
+  const url = incremental ? `/history?since=${historyCursor}&maxPoints=${HISTORY_MAX_POINTS}`
+                          : `/history?from=${from}&maxPoints=${HISTORY_MAX_POINTS}`;
+  debugLog('[AtticFan] Fetching', url);
   try {
-    const res = await fetch('/history.csv');
+    const res = await fetch(url, { cache: 'no-store', headers: incremental && historyEtag ? { 'If-None-Match': historyEtag } : {} });
+    if (res.status === 304) {
+  debugLog('[AtticFan] /history unchanged');
+      return;
+    }
+    if (res.status === 409) { // History was cleared; start over
+      historyCursor = historyEtag = null;
+      historyRows = [];
+      return fetchAndRenderHistory();
+    }
     if (!res.ok) {
-  debugWarn('[AtticFan] /history.csv not found or not OK:', res.status);
+  debugWarn('[AtticFan] /history not found or not OK:', res.status);
       throw new Error('No history log found.');
     }
-  debugLog('[AtticFan] /history.csv fetch OK');
+  debugLog('[AtticFan] /history fetch OK');
     const csv = await res.text();
-  debugLog('[AtticFan] /history.csv loaded, length:', csv.length);
-    const lines = csv.trim().split(/\r?\n/);
-    if (lines.length < 2) {
-  debugWarn('[AtticFan] /history.csv has no data rows.');
+  debugLog('[AtticFan] /history loaded, length:', csv.length);
+    const rows = parseHistoryCsv(csv);
+    historyCursor = res.headers.get('X-History-Cursor');
+    historyEtag = res.headers.get('ETag');
+    if (incremental) {
+      const cutoff = from * 1000;
+      historyRows = historyRows.concat(rows).filter(r => !r.ts || Date.parse(r.ts) >= cutoff);
+    } else {
+      historyRows = rows;
+    }
+    if (historyRows.length === 0) {
+  debugWarn('[AtticFan] /history has no data rows.');
       chartMsgEl.textContent = 'No historical data logged yet.';
       if (historyChart) historyChart.destroy();
+      historyChart = null;
       return;
     }
-    const header = lines[0].split(',');
-    const timeIdx = header.indexOf('timestamp');
-    const atticIdx = header.indexOf('attic_temp');
-    if (timeIdx < 0 || atticIdx < 0) {
-  debugError('[AtticFan] /history.csv missing required columns.');
-      chartMsgEl.textContent = 'CSV format error: missing columns.';
-      return;
-    }
-    const outdoorIdx = header.indexOf('outdoor_temp');
-    const humidityIdx = header.indexOf('humidity');
-    const fanOnIdx = header.indexOf('fan_on');
-    const labels = [];
-    const attic = [];
-    const outdoor = [];
-    const humidity = [];
-    const fanOn = [];
-    for (let i = 1; i < lines.length; ++i) {
-      const row = lines[i].split(',');
-      const ts = row[timeIdx];
-      if (ts) {
-        labels.push(ts.substring(5, 16).replace('T', ' '));
-      } else {
-        labels.push('');
-      }
-      attic.push(parseFloat(row[atticIdx]));
-      if (outdoorIdx >= 0) outdoor.push(parseFloat(row[outdoorIdx]));
-      if (humidityIdx >= 0) humidity.push(parseFloat(row[humidityIdx]));
-      if (fanOnIdx >= 0) fanOn.push(parseInt(row[fanOnIdx], 10));
-    }
-    const N = 100;
-    const start = labels.length > N ? labels.length - N : 0;
-    const chartLabels = labels.slice(start);
-    const chartAttic = attic.slice(start);
-    const chartOutdoor = outdoorIdx >= 0 ? outdoor.slice(start) : undefined;
-    const chartHumidity = humidityIdx >= 0 ? humidity.slice(start) : undefined;
-    const chartFanOn = fanOnIdx >= 0 ? fanOn.slice(start) : undefined;
+    if (incremental && rows.length === 0) return; // Chart already shows everything
+    const chartLabels = historyRows.map(r => r.ts ? r.ts.substring(5, 16).replace('T', ' ') : '');
+    const chartAttic = historyRows.map(r => r.attic);
+    const chartOutdoor = historyRows[0].outdoor !== undefined ? historyRows.map(r => r.outdoor) : undefined;
+    const chartHumidity = historyRows[0].humidity !== undefined ? historyRows.map(r => r.humidity) : undefined;
+    const chartFanOn = historyRows[0].fanOn !== undefined ? historyRows.map(r => r.fanOn) : undefined;
     const datasets = [
       { label: 'Attic Temp (°F)', data: chartAttic, borderColor: '#e67e22', backgroundColor: 'rgba(230,126,34,0.1)', yAxisID: 'y', tension: 0.2 },
       { label: 'Outdoor Temp (°F)', data: chartOutdoor, borderColor: '#2980b9', backgroundColor: 'rgba(41,128,185,0.1)', yAxisID: 'y', tension: 0.2, hidden: chartOutdoor === undefined }
@@ -180,9 +204,11 @@ async function fetchAndRenderHistory() {
     });
     chartMsgEl.textContent = '';
   } catch (err) {
-  debugError('[AtticFan] Error loading /history.csv:', err);
-    chartMsgEl.textContent = 'No historical data available.';
+  debugError('[AtticFan] Error loading /history:', err);
+    chartMsgEl.textContent = err.message.startsWith('CSV') ? err.message : 'No historical data available.';
     if (historyChart) historyChart.destroy();
+    historyChart = null;
+    historyCursor = historyEtag = null;
   }
 }
 
@@ -237,7 +263,7 @@ async function fetchAndRenderHistory() {
           return Promise.resolve(new Response('Invalid JSON', { status: 400 }));
         }
       }
-      if (full === '/history.csv' && method === 'GET') return Promise.resolve(new Response(mockHistory, { status: 200, headers: { 'Content-Type': 'text/csv' } }));
+      if ((full === '/history.csv' || u.pathname === '/history') && method === 'GET') return Promise.resolve(new Response(mockHistory, { status: 200, headers: { 'Content-Type': 'text/csv' } }));
       if (u.pathname === '/fan' && method === 'POST') {
         try {
           const body = init && typeof init.body === 'string' ? JSON.parse(init.body) : {};
@@ -303,6 +329,44 @@ function buildConfigPayload(fields) {
 }
 
 let allIndoorSensors = []; // Cache for modal
+let liveStatus = {};        // Last /status response, kept current by /events deltas
+let eventStream = null;     // EventSource on /events, null when unsupported
+let lastIndoorPoll = 0;
+const LIVE_LOG_MAX_LINES = 200;
+
+// Opens the /events stream. While it is connected, state changes arrive as
+// deltas and the /status poll is skipped; EventSource reconnects on its own.
+function startEventStream() {
+  if (testMode || !window.EventSource) return;
+  eventStream = new EventSource('/events');
+  eventStream.addEventListener('state', e => {
+    Object.assign(liveStatus, JSON.parse(e.data));
+    renderStatus(liveStatus);
+  });
+  eventStream.addEventListener('log', e => appendLiveLog(e.data));
+}
+
+function eventStreamOpen() {
+  return eventStream && eventStream.readyState === EventSource.OPEN;
+}
+
+function appendLiveLog(line) {
+  const el = document.getElementById('liveLog');
+  if (!el) return;
+  const lines = (el.textContent ? el.textContent.split('\n') : []).concat(line);
+  el.textContent = lines.slice(-LIVE_LOG_MAX_LINES).join('\n');
+  el.scrollTop = el.scrollHeight;
+}
+
+// Periodic refresh: polls /status only while the event stream is down, and indoor sensors every 30 s.
+function pollSensorData() {
+  if (!eventStreamOpen()) {
+    updateSensorData();
+  } else if (Date.now() - lastIndoorPoll >= 30000) {
+    updateIndoorSensors();
+  }
+}
+
 function updateSensorData() {
   if (testMode) {
     return;
@@ -310,52 +374,8 @@ function updateSensorData() {
   fetch("/status")
     .then(res => res.json())
     .then(data => {
-      document.getElementById("firmwareVersion").textContent = data.firmwareVersion;
-      document.getElementById("atticTemp").textContent = data.atticTemp;
-      document.getElementById("atticHumidity").textContent = data.atticHumidity;
-      document.getElementById("outdoorTemp").textContent = data.outdoorTemp;
-      const fanOn = data.fanOn;
-      currentFanState = fanOn;
-      updateFanVisual(fanOn);
-      document.getElementById("currentMode").textContent = data.fanMode;
-      const timerStatusEl = document.getElementById('timerStatus');
-      if (data.timerActive) {
-        const minutes = Math.floor(data.timerRemainingSec / 60);
-        const seconds = data.timerRemainingSec % 60;
-        const remainingTime = `${minutes}m ${String(seconds).padStart(2, '0')}s`;
-        if (data.timerMode === 'delay') {
-          timerStatusEl.innerHTML = `Timer starts in: ${remainingTime}`;
-        } else {
-          timerStatusEl.innerHTML = `Timer active for: ${remainingTime}`;
-        }
-        timerStatusEl.style.display = 'block'; // Make it visible
-        timerStatusEl.style.textAlign = 'center'; // Center the text
-        timerStatusEl.style.marginTop = '8px'; // Add some space above it
-      } else {
-        timerStatusEl.style.display = 'none'; // Hide it
-      }
-      if (data.testModeEnabled) {
-        document.getElementById('test-panel').style.display = 'block';
-        const atticSlider = document.getElementById('simulatedAtticTemp');
-        const outdoorSlider = document.getElementById('simulatedOutdoorTemp');
-        if (!isInteractingWithSlider) {
-          atticSlider.value = data.simulatedAtticTemp;
-          outdoorSlider.value = data.simulatedOutdoorTemp;
-        }
-        updateTempDisplay('attic-temp-val', atticSlider.value);
-        updateTempDisplay('outdoor-temp-val', outdoorSlider.value);
-      }
-      setMode(data.fanMode, false); // Update UI without sending a command back
-      if (data.fanMode === 'MANUAL') {
-  const manualOnBtn = document.getElementById("manualOnBtn");
-  const manualOffBtn = document.getElementById("manualOffBtn");
-  if (manualOnBtn) manualOnBtn.disabled = fanOn;
-  if (manualOffBtn) manualOffBtn.disabled = !fanOn;
-      } else {
-        // If not in manual mode, disable all manual buttons
-        if (manualOnBtn) manualOnBtn.disabled = true;
-        if (manualOffBtn) manualOffBtn.disabled = true;
-      }
+      liveStatus = data;
+      renderStatus(data);
     })
     .catch(() => {
       document.getElementById("firmwareVersion").textContent = "--";
@@ -364,52 +384,106 @@ function updateSensorData() {
       document.getElementById("outdoorTemp").textContent = "--";
       document.getElementById("currentMode").textContent = "--";
     });
+  updateIndoorSensors();
+}
 
-  // Fetch and handle indoor sensor display logic
+function renderStatus(data) {
+  if (data.firmwareVersion) document.getElementById("firmwareVersion").textContent = data.firmwareVersion;
+  document.getElementById("atticTemp").textContent = data.atticTemp;
+  document.getElementById("atticHumidity").textContent = data.atticHumidity;
+  document.getElementById("outdoorTemp").textContent = data.outdoorTemp;
+  const fanOn = data.fanOn;
+  currentFanState = fanOn;
+  updateFanVisual(fanOn);
+  document.getElementById("currentMode").textContent = data.fanMode;
+  const timerStatusEl = document.getElementById('timerStatus');
+  if (data.timerActive) {
+    const minutes = Math.floor(data.timerRemainingSec / 60);
+    const seconds = data.timerRemainingSec % 60;
+    const remainingTime = `${minutes}m ${String(seconds).padStart(2, '0')}s`;
+    if (data.timerMode === 'delay') {
+      timerStatusEl.innerHTML = `Timer starts in: ${remainingTime}`;
+    } else {
+      timerStatusEl.innerHTML = `Timer active for: ${remainingTime}`;
+    }
+    timerStatusEl.style.display = 'block'; // Make it visible
+    timerStatusEl.style.textAlign = 'center'; // Center the text
+    timerStatusEl.style.marginTop = '8px'; // Add some space above it
+  } else {
+    timerStatusEl.style.display = 'none'; // Hide it
+  }
+  if (data.testModeEnabled) {
+    document.getElementById('test-panel').style.display = 'block';
+    const atticSlider = document.getElementById('simulatedAtticTemp');
+    const outdoorSlider = document.getElementById('simulatedOutdoorTemp');
+    if (!isInteractingWithSlider) {
+      atticSlider.value = data.simulatedAtticTemp;
+      outdoorSlider.value = data.simulatedOutdoorTemp;
+    }
+    updateTempDisplay('attic-temp-val', atticSlider.value);
+    updateTempDisplay('outdoor-temp-val', outdoorSlider.value);
+  }
+  setMode(data.fanMode, false); // Update UI without sending a command back
+  if (data.fanMode === 'MANUAL') {
+  const manualOnBtn = document.getElementById("manualOnBtn");
+  const manualOffBtn = document.getElementById("manualOffBtn");
+  if (manualOnBtn) manualOnBtn.disabled = fanOn;
+  if (manualOffBtn) manualOffBtn.disabled = !fanOn;
+  } else {
+    // If not in manual mode, disable all manual buttons
+    if (manualOnBtn) manualOnBtn.disabled = true;
+    if (manualOffBtn) manualOffBtn.disabled = true;
+  }
+}
+
+// Fetch and handle indoor sensor display logic
+function updateIndoorSensors() {
+  lastIndoorPoll = Date.now();
   fetch("/indoor_sensors")
     .then(res => res.json())
-    .then(data => {
-      allIndoorSensors = data.sensors || []; // Cache for modal
-      const count = data.count || 0;
-
-      const avgDisplay = document.getElementById('indoorSensorDisplay');
-      const sensor1Display = document.getElementById('indoorSensor1');
-      const sensor2Display = document.getElementById('indoorSensor2');
-
-      // Hide all first
-      if (avgDisplay) avgDisplay.style.display = 'none';
-      if (sensor1Display) sensor1Display.style.display = 'none';
-      if (sensor2Display) sensor2Display.style.display = 'none';
-
-      if (count > 2) {
-        // Show average card
-        if (avgDisplay) avgDisplay.style.display = 'block';
-        document.getElementById('avgIndoorTemp').textContent = data.averageTemperature || '--';
-        document.getElementById('avgIndoorHumidity').textContent = data.averageHumidity || '--';
-      } else if (count === 2) {
-        // Show two individual cards
-        if (sensor1Display) sensor1Display.style.display = 'block';
-        document.getElementById('indoorSensor1Name').textContent = data.sensors[0].name;
-        document.getElementById('indoorSensor1Temp').textContent = data.sensors[0].temperature;
-        document.getElementById('indoorSensor1Humidity').textContent = data.sensors[0].humidity;
-
-        if (sensor2Display) sensor2Display.style.display = 'block';
-        document.getElementById('indoorSensor2Name').textContent = data.sensors[1].name;
-        document.getElementById('indoorSensor2Temp').textContent = data.sensors[1].temperature;
-        document.getElementById('indoorSensor2Humidity').textContent = data.sensors[1].humidity;
-      } else if (count === 1) {
-        // Show one individual card
-        if (sensor1Display) sensor1Display.style.display = 'block';
-        document.getElementById('indoorSensor1Name').textContent = data.sensors[0].name;
-        document.getElementById('indoorSensor1Temp').textContent = data.sensors[0].temperature;
-        document.getElementById('indoorSensor1Humidity').textContent = data.sensors[0].humidity;
-      }
-    })
+    .then(renderIndoorSensors)
     .catch(err => {
       debugError("Failed to fetch indoor sensors:", err);
       allIndoorSensors = [];
     });
 }
+function renderIndoorSensors(data) {
+  allIndoorSensors = data.sensors || []; // Cache for modal
+  const count = data.count || 0;
+
+  const avgDisplay = document.getElementById('indoorSensorDisplay');
+  const sensor1Display = document.getElementById('indoorSensor1');
+  const sensor2Display = document.getElementById('indoorSensor2');
+
+  // Hide all first
+  if (avgDisplay) avgDisplay.style.display = 'none';
+  if (sensor1Display) sensor1Display.style.display = 'none';
+  if (sensor2Display) sensor2Display.style.display = 'none';
+
+  if (count > 2) {
+    // Show average card
+    if (avgDisplay) avgDisplay.style.display = 'block';
+    document.getElementById('avgIndoorTemp').textContent = data.averageTemperature || '--';
+    document.getElementById('avgIndoorHumidity').textContent = data.averageHumidity || '--';
+  } else if (count === 2) {
+    // Show two individual cards
+    if (sensor1Display) sensor1Display.style.display = 'block';
+    document.getElementById('indoorSensor1Name').textContent = data.sensors[0].name;
+    document.getElementById('indoorSensor1Temp').textContent = data.sensors[0].temperature;
+    document.getElementById('indoorSensor1Humidity').textContent = data.sensors[0].humidity;
+
+    if (sensor2Display) sensor2Display.style.display = 'block';
+    document.getElementById('indoorSensor2Name').textContent = data.sensors[1].name;
+    document.getElementById('indoorSensor2Temp').textContent = data.sensors[1].temperature;
+    document.getElementById('indoorSensor2Humidity').textContent = data.sensors[1].humidity;
+  } else if (count === 1) {
+    // Show one individual card
+    if (sensor1Display) sensor1Display.style.display = 'block';
+    document.getElementById('indoorSensor1Name').textContent = data.sensors[0].name;
+    document.getElementById('indoorSensor1Temp').textContent = data.sensors[0].temperature;
+    document.getElementById('indoorSensor1Humidity').textContent = data.sensors[0].humidity;
+  }
+}
 function updateWeatherData() {
   const iconEl = document.getElementById("currentWeatherIcon");
   const tempEl = document.getElementById("currentWeatherTemp");
@@ -491,32 +565,36 @@ function updateWeatherData() {
   debugLog('[AtticFan] /weather response status:', res.status);
       const data = await res.json();
   debugLog('[AtticFan] /weather data:', data);
-      iconEl.textContent = data.currentIcon;
-      tempEl.textContent = data.currentTemp;
-      humidityEl.textContent = data.currentHumidity;
-      
-      // Update sunrise/sunset if available
-      if (data.sunrise && data.sunset) {
-        updateSunriseSunset(data.sunrise, data.sunset);
-      } else {
-        // Clear any existing sunrise/sunset display if data isn't available
-        const sunriseEl = document.getElementById('sunriseTime');
-        const sunsetEl = document.getElementById('sunsetTime');
-        if (sunriseEl) sunriseEl.textContent = '🌅 --:--';
-        if (sunsetEl) sunsetEl.textContent = '🌇 --:--';
-      }
-      
-      renderForecast(forecastContainer, data.forecast);
-      
-      // Render hourly forecast if available
-      if (data.hourly) {
-        renderHourlyForecast(data.hourly);
-      }
+      renderWeather(data);
     } catch (err) {
   debugError('[AtticFan] Failed to fetch /weather:', err);
     }
   })();
 }
+// Renders a /weather response from the backend.
+function renderWeather(data) {
+  document.getElementById("currentWeatherIcon").textContent = data.currentIcon;
+  document.getElementById("currentWeatherTemp").textContent = data.currentTemp;
+  document.getElementById("currentWeatherHumidity").textContent = data.currentHumidity;
+  
+  // Update sunrise/sunset if available
+  if (data.sunrise && data.sunset) {
+    updateSunriseSunset(data.sunrise, data.sunset);
+  } else {
+    // Clear any existing sunrise/sunset display if data isn't available
+    const sunriseEl = document.getElementById('sunriseTime');
+    const sunsetEl = document.getElementById('sunsetTime');
+    if (sunriseEl) sunriseEl.textContent = '🌅 --:--';
+    if (sunsetEl) sunsetEl.textContent = '🌇 --:--';
+  }
+  
+  renderForecast(document.getElementById("forecastContainer"), data.forecast);
+  
+  // Render hourly forecast if available
+  if (data.hourly) {
+    renderHourlyForecast(data.hourly);
+  }
+}
 function dayOfWeekToString(dayIndex, isToday) {
   if (isToday) return "Today";
   const days = ["Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"];
@@ -592,24 +670,52 @@ async function loadConfig() {
   }
   try {
     const response = await fetch("/config");
+    applyConfig(await response.json());
+  } catch (err) {
+  debugError("Failed to load config:", err);
+  }
+}
+function applyConfig(data) {
+  document.getElementById("fanOnTemp").value = data.fanOnTemp;
+  document.getElementById("fanDeltaTemp").value = data.fanDeltaTemp;
+  document.getElementById("fanHysteresis").value = data.fanHysteresis;
+  document.getElementById("preCoolTriggerTemp").value = data.preCoolTriggerTemp;
+  document.getElementById("preCoolTempOffset").value = data.preCoolTempOffset;
+  document.getElementById("preCoolingEnabled").checked = data.preCoolingEnabled;
+  document.getElementById("onboardLedEnabled").checked = data.onboardLedEnabled;
+  document.getElementById("testModeEnabled").checked = data.testModeEnabled;
+  document.getElementById("dailyRestartEnabled").checked = data.dailyRestartEnabled;
+  document.getElementById("mqttEnabled").checked = data.mqttEnabled;
+  document.getElementById("mqttDiscoveryEnabled").checked = data.mqttDiscoveryEnabled;
+  if (data.historyLogIntervalMs) {
+    const intervalInput = document.getElementById("historyLogInterval");
+    if(intervalInput) intervalInput.value = Math.round(data.historyLogIntervalMs / 60000);
+  }
+}
+// First paint from a single /api/bootstrap request. Returns false when it is unavailable,
+// so the caller can fall back to the individual endpoints.
+async function loadBootstrap() {
+  if (testMode) return false;
+  try {
+    const response = await fetch("/api/bootstrap");
+    if (!response.ok) return false;
     const data = await response.json();
-    document.getElementById("fanOnTemp").value = data.fanOnTemp;
-    document.getElementById("fanDeltaTemp").value = data.fanDeltaTemp;
-    document.getElementById("fanHysteresis").value = data.fanHysteresis;
-    document.getElementById("preCoolTriggerTemp").value = data.preCoolTriggerTemp;
-    document.getElementById("preCoolTempOffset").value = data.preCoolTempOffset;
-    document.getElementById("preCoolingEnabled").checked = data.preCoolingEnabled;
-    document.getElementById("onboardLedEnabled").checked = data.onboardLedEnabled;
-    document.getElementById("testModeEnabled").checked = data.testModeEnabled;
-    document.getElementById("dailyRestartEnabled").checked = data.dailyRestartEnabled;
-    document.getElementById("mqttEnabled").checked = data.mqttEnabled;
-    document.getElementById("mqttDiscoveryEnabled").checked = data.mqttDiscoveryEnabled;
-    if (data.historyLogIntervalMs) {
-      const intervalInput = document.getElementById("historyLogInterval");
-      if(intervalInput) intervalInput.value = Math.round(data.historyLogIntervalMs / 60000);
+    applyConfig(data.config);
+    liveStatus = data.status;
+    renderStatus(data.status);
+    lastIndoorPoll = Date.now();
+    if (data.indoorSensors) {
+      renderIndoorSensors(data.indoorSensors);
+    }
+    if (isLocalDev) {
+      updateWeatherData(); // Local development renders Open-Meteo weather directly
+    } else {
+      renderWeather(data.weather);
     }
+    return true;
   } catch (err) {
-  debugError("Failed to load config:", err);
+  debugError("Failed to load /api/bootstrap:", err);
+    return false;
   }
 }
 function saveConfig() {
@@ -848,12 +954,15 @@ function updateFanVisual(isFanOn) {
 async function initializeApp() {
   // Set initial UI state for controls
   setMode('AUTO', false); // Set a default, will be corrected by first status update
-  await loadConfig();
-  updateSensorData();
-  updateWeatherData();
+  if (!(await loadBootstrap())) {
+    await loadConfig();
+    updateSensorData();
+    updateWeatherData();
+  }
   fetchAndRenderHistory();
   setInterval(fetchAndRenderHistory, 5 * 60 * 1000); // Refresh history every 5 min
-  setInterval(updateSensorData, 3000); // Refresh status every 3 seconds for a responsive UI
+  startEventStream(); // Live state and log lines; polling takes over while it is down
+  setInterval(pollSensorData, 3000);
   setInterval(updateWeatherData, 600000); // Update weather every 10 minutes
 }
 // Close modal if user clicks outside of it
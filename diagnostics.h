@@ -3,40 +3,431 @@
 #include <Arduino.h> // For millis()
 #include <time.h>
 #include <stdarg.h> // For va_list
+#include "hardware.h"
+#include "background_response.h"
 
 #define DIAGNOSTICS_LOG_PATH "/diagnostics.log"
+// Size-capped rotation: when the current file reaches DIAGNOSTICS_LOG_MAX_BYTES it is
+// renamed to generation 1, generation 1 to 2 and so on; the oldest is deleted. Files
+// are only ever renamed or appended to, never rewritten.
+#define DIAGNOSTICS_LOG_GEN_FMT "/diagnostics.%u.log"
+#define DIAGNOSTICS_LOG_MAX_BYTES 16384
+#define DIAGNOSTICS_LOG_GENERATIONS 2 // Previous files kept besides the current one
+#define DIAGNOSTICS_LOG_SEQ_PATH "/diagnostics.seq" // Counts rotations and clears, for the download validator
+#define DIAGNOSTICS_MESSAGE_LEN 96 // Longer messages are truncated
 
 extern bool ntpHasSynced; // From AtticFanControl.ino
 
 // Forward-declare the logging function from the main .ino file
 void logSerial(const char* format, ...);
 
-inline void logDiagnostics(const char* msg) {
-  File f = LittleFS.open(DIAGNOSTICS_LOG_PATH, "a");
-  if (f) {
-    // --- Timestamp Logic ---
-    char timestamp[30];
-    if (ntpHasSynced) {
-      time_t now;
-      time(&now);
-      struct tm* timeinfo = localtime(&now);
-      strftime(timestamp, sizeof(timestamp), "[%Y-%m-%d %H:%M:%S] ", timeinfo);
-    } else {
-      snprintf(timestamp, sizeof(timestamp), "[%lu] ", millis());
+enum DiagnosticsLevel : uint8_t { DIAG_INFO, DIAG_WARN, DIAG_ERROR };
+
+// One buffered log line. The timestamp is taken when the message is logged, not when it is written.
+struct DiagnosticsRecord {
+  uint32_t time;      // Unix time if the clock was synced, millis() otherwise
+  bool synced;
+  DiagnosticsLevel level;
+  char msg[DIAGNOSTICS_MESSAGE_LEN];
+};
+
+// Log lines are collected in a RAM ring and appended to the file in batches, so
+// a noisy sensor costs one flash write per flush interval instead of one per message.
+struct DiagnosticsBuffer {
+  DiagnosticsRecord records[DIAGNOSTICS_BUFFER_RECORDS];
+  uint8_t head = 0;           // Oldest record
+  uint8_t count = 0;
+  uint32_t dropped = 0;       // Records overwritten before they were written, since the last flush
+  unsigned long lastFlush = 0;
+};
+DiagnosticsBuffer diagnosticsBuffer;
+
+/**
+ * @brief Derives the level from the message's "[LEVEL]" tag.
+ */
+inline DiagnosticsLevel diagnosticsLevelOf(const char* msg) {
+  if (strstr(msg, "[ERROR]")) return DIAG_ERROR;
+  if (strstr(msg, "[WARN]")) return DIAG_WARN;
+  return DIAG_INFO;
+}
+
+/**
+ * @brief Formats a log timestamp: local time once NTP has synced, millis() before.
+ */
+inline void formatDiagnosticsTimestamp(uint32_t time, bool synced, char* buf, size_t size) {
+  if (synced) {
+    time_t ts = (time_t)time;
+    struct tm* timeinfo = localtime(&ts);
+    strftime(buf, size, "[%Y-%m-%d %H:%M:%S] ", timeinfo);
+  } else {
+    snprintf(buf, size, "[%lu] ", (unsigned long)time);
+  }
+}
+
+/**
+ * @brief Returns the path of a log generation: 0 is the current file, higher is older.
+ */
+inline String diagnosticsLogPath(uint8_t generation) {
+  if (generation == 0) return DIAGNOSTICS_LOG_PATH;
+  char path[32];
+  snprintf(path, sizeof(path), DIAGNOSTICS_LOG_GEN_FMT, (unsigned)generation);
+  return String(path);
+}
+
+uint32_t diagnosticsLogSeq = 0;
+bool diagnosticsLogSeqLoaded = false;
+
+/**
+ * @brief Returns the number of times the log has been rotated or cleared.
+ * Between two changes of it the log only grows, so together with the total size
+ * it identifies the log's content.
+ */
+inline uint32_t diagnosticsLogSequence() {
+  if (!diagnosticsLogSeqLoaded) {
+    File f = LittleFS.open(DIAGNOSTICS_LOG_SEQ_PATH, "r");
+    if (!f || f.read((uint8_t*)&diagnosticsLogSeq, sizeof(diagnosticsLogSeq)) != sizeof(diagnosticsLogSeq)) {
+      diagnosticsLogSeq = 0;
     }
-    // --- End Timestamp Logic ---
-    f.print(timestamp);
-    f.println(msg); // Print the original message
     f.close();
+    diagnosticsLogSeqLoaded = true;
   }
+  return diagnosticsLogSeq;
 }
 
-inline void handleDiagnosticsDownload(ESP8266WebServer &server) {
-  if (LittleFS.exists(DIAGNOSTICS_LOG_PATH)) {
-    File f = LittleFS.open(DIAGNOSTICS_LOG_PATH, "r");
-    server.streamFile(f, "text/plain");
+// One 4-byte write per rotation, i.e. per DIAGNOSTICS_LOG_MAX_BYTES logged.
+inline void bumpDiagnosticsLogSequence() {
+  diagnosticsLogSeq = diagnosticsLogSequence() + 1;
+  File f = LittleFS.open(DIAGNOSTICS_LOG_SEQ_PATH, "w");
+  if (f) f.write((const uint8_t*)&diagnosticsLogSeq, sizeof(diagnosticsLogSeq));
+  f.close();
+}
+
+/**
+ * @brief Shifts every generation one step older, dropping the oldest.
+ */
+inline void rotateDiagnosticsLog() {
+  bumpDiagnosticsLogSequence();
+  LittleFS.remove(diagnosticsLogPath(DIAGNOSTICS_LOG_GENERATIONS));
+  for (uint8_t gen = DIAGNOSTICS_LOG_GENERATIONS; gen > 0; gen--) {
+    if (LittleFS.exists(diagnosticsLogPath(gen - 1))) LittleFS.rename(diagnosticsLogPath(gen - 1), diagnosticsLogPath(gen));
+  }
+}
+
+/**
+ * @brief Returns the bytes used by all log generations.
+ */
+inline size_t diagnosticsLogBytes() {
+  size_t total = 0;
+  for (uint8_t gen = 0; gen <= DIAGNOSTICS_LOG_GENERATIONS; gen++) {
+    File f = LittleFS.open(diagnosticsLogPath(gen), "r");
+    if (f) total += f.size();
     f.close();
+  }
+  return total;
+}
+
+/**
+ * @brief Deletes all log generations.
+ */
+inline void clearDiagnosticsLog() {
+  bumpDiagnosticsLogSequence();
+  for (uint8_t gen = 0; gen <= DIAGNOSTICS_LOG_GENERATIONS; gen++) LittleFS.remove(diagnosticsLogPath(gen));
+}
+
+/**
+ * @brief Appends all buffered records to the log file with a single open/close.
+ */
+inline void flushDiagnostics() {
+  diagnosticsBuffer.lastFlush = millis();
+  if (diagnosticsBuffer.count == 0 && diagnosticsBuffer.dropped == 0) return;
+  File f = LittleFS.open(DIAGNOSTICS_LOG_PATH, "a");
+  if (f && f.size() >= DIAGNOSTICS_LOG_MAX_BYTES) {
+    f.close();
+    rotateDiagnosticsLog();
+    f = LittleFS.open(DIAGNOSTICS_LOG_PATH, "a");
+  }
+  if (!f) return; // Keep the records; the next flush retries
+  char timestamp[30];
+  if (diagnosticsBuffer.dropped) {
+    time_t now;
+    time(&now);
+    formatDiagnosticsTimestamp(ntpHasSynced ? (uint32_t)now : millis(), ntpHasSynced, timestamp, sizeof(timestamp));
+    f.print(timestamp);
+    f.printf("[WARN] %lu diagnostics records dropped (buffer full).\n", (unsigned long)diagnosticsBuffer.dropped);
+    diagnosticsBuffer.dropped = 0;
+  }
+  for (uint8_t i = 0; i < diagnosticsBuffer.count; i++) {
+    const DiagnosticsRecord& record = diagnosticsBuffer.records[(diagnosticsBuffer.head + i) % DIAGNOSTICS_BUFFER_RECORDS];
+    formatDiagnosticsTimestamp(record.time, record.synced, timestamp, sizeof(timestamp));
+    f.print(timestamp);
+    f.println(record.msg);
+  }
+  f.close();
+  diagnosticsBuffer.head = 0;
+  diagnosticsBuffer.count = 0;
+}
+
+// Called with each record as it is logged; events.h uses it to stream log lines.
+void (*diagnosticsLogHook)(const DiagnosticsRecord& record) = nullptr;
+
+/**
+ * @brief Queues a message for the diagnostics log. Error-level messages are
+ * written right away; the rest wait for serviceDiagnostics() or a restart.
+ */
+inline void logDiagnostics(const char* msg) {
+  if (diagnosticsBuffer.count == DIAGNOSTICS_BUFFER_RECORDS) { // Full: overwrite the oldest
+    diagnosticsBuffer.head = (diagnosticsBuffer.head + 1) % DIAGNOSTICS_BUFFER_RECORDS;
+    diagnosticsBuffer.count--;
+    diagnosticsBuffer.dropped++;
+  }
+  DiagnosticsRecord& record = diagnosticsBuffer.records[(diagnosticsBuffer.head + diagnosticsBuffer.count++) % DIAGNOSTICS_BUFFER_RECORDS];
+  record.synced = ntpHasSynced;
+  if (record.synced) {
+    time_t now;
+    time(&now);
+    record.time = (uint32_t)now;
   } else {
+    record.time = millis();
+  }
+  record.level = diagnosticsLevelOf(msg);
+  snprintf(record.msg, sizeof(record.msg), "%s", msg);
+  if (diagnosticsLogHook) diagnosticsLogHook(record);
+  if (record.level == DIAG_ERROR) flushDiagnostics();
+}
+
+// === Deduplicated, rate-limited events ===
+// Recurring conditions (a failing or noisy sensor) are logged through
+// logDiagnosticsEvent() with a fixed id. The first occurrence is logged in full;
+// repeats within DIAGNOSTICS_DEDUP_WINDOW_MS are only counted and summarized as
+// "repeated N times in T seconds" when the window closes. On top of that each
+// category has a token bucket, so many different events cannot flood the log either.
+#define DIAGNOSTICS_DEDUP_WINDOW_MS 600000UL // 10 minutes
+
+enum DiagnosticsCategory : uint8_t { DIAG_CATEGORY_SENSOR_READ, DIAG_CATEGORY_SENSOR_JUMP, DIAG_CATEGORY_COUNT };
+
+enum DiagnosticsEventId : uint8_t {
+  DIAG_EVENT_ATTIC_TEMP_INVALID,
+  DIAG_EVENT_ATTIC_HUMIDITY_INVALID,
+  DIAG_EVENT_OUTDOOR_TEMP_INVALID,
+  DIAG_EVENT_ATTIC_BUS_ERROR,   // The SHT21 did not answer or failed its CRC, as opposed to an implausible value
+  DIAG_EVENT_OUTDOOR_BUS_ERROR, // Same for the DS18B20
+  DIAG_EVENT_ATTIC_TEMP_JUMP,
+  DIAG_EVENT_ATTIC_HUMIDITY_JUMP,
+  DIAG_EVENT_OUTDOOR_TEMP_JUMP,
+  DIAG_EVENT_COUNT
+};
+
+struct DiagnosticsEventInfo {
+  const char* name;   // Used in repeat summaries
+  DiagnosticsCategory category;
+};
+
+inline const DiagnosticsEventInfo& diagnosticsEventInfo(DiagnosticsEventId id) {
+  static const DiagnosticsEventInfo info[DIAG_EVENT_COUNT] = {
+    { "Invalid attic temperature reading", DIAG_CATEGORY_SENSOR_READ },
+    { "Invalid attic humidity reading", DIAG_CATEGORY_SENSOR_READ },
+    { "Invalid outdoor temperature reading", DIAG_CATEGORY_SENSOR_READ },
+    { "Attic sensor bus error", DIAG_CATEGORY_SENSOR_READ },
+    { "Outdoor sensor bus error", DIAG_CATEGORY_SENSOR_READ },
+    { "Attic temp jump", DIAG_CATEGORY_SENSOR_JUMP },
+    { "Attic humidity jump", DIAG_CATEGORY_SENSOR_JUMP },
+    { "Outdoor temp jump", DIAG_CATEGORY_SENSOR_JUMP },
+  };
+  return info[id];
+}
+
+// Token bucket limits per category: burst size and one token back per refillMs.
+struct DiagnosticsRateLimit {
+  uint8_t burst;
+  uint32_t refillMs;
+};
+
+inline const DiagnosticsRateLimit& diagnosticsRateLimit(DiagnosticsCategory category) {
+  static const DiagnosticsRateLimit limits[DIAG_CATEGORY_COUNT] = {
+    { 3, 300000UL }, // Sensor read failures: 3, then one per 5 minutes
+    { 5, 120000UL }, // Sensor jumps: 5, then one per 2 minutes
+  };
+  return limits[category];
+}
+
+struct DiagnosticsEventState {
+  unsigned long windowStart = 0; // When the last full message was logged
+  uint32_t repeats = 0;          // Occurrences suppressed since then
+  bool active = false;           // A dedup window is open
+  DiagnosticsLevel level = DIAG_INFO;
+};
+
+struct DiagnosticsBucket {
+  uint8_t tokens = 0;
+  unsigned long lastRefill = 0;
+  bool started = false;
+};
+
+DiagnosticsEventState diagnosticsEvents[DIAG_EVENT_COUNT];
+DiagnosticsBucket diagnosticsBuckets[DIAG_CATEGORY_COUNT];
+
+/**
+ * @brief Takes a token from the category's bucket.
+ * @return false if the category is over its rate limit.
+ */
+inline bool takeDiagnosticsToken(DiagnosticsCategory category) {
+  const DiagnosticsRateLimit& limit = diagnosticsRateLimit(category);
+  DiagnosticsBucket& bucket = diagnosticsBuckets[category];
+  unsigned long now = millis();
+  if (!bucket.started) {
+    bucket.tokens = limit.burst;
+    bucket.lastRefill = now;
+    bucket.started = true;
+  }
+  uint32_t refills = (now - bucket.lastRefill) / limit.refillMs;
+  if (refills) {
+    bucket.tokens = bucket.tokens + refills >= limit.burst ? limit.burst : bucket.tokens + refills;
+    bucket.lastRefill += refills * limit.refillMs;
+  }
+  if (bucket.tokens == 0) return false;
+  if (bucket.tokens == limit.burst) bucket.lastRefill = now; // A full bucket does not bank time
+  bucket.tokens--;
+  return true;
+}
+
+/**
+ * @brief Logs the repeat summary for an event, if any repeats were suppressed, and closes its window.
+ */
+inline void closeDiagnosticsEvent(DiagnosticsEventId id) {
+  DiagnosticsEventState& event = diagnosticsEvents[id];
+  if (event.active && event.repeats > 0) {
+    char msg[DIAGNOSTICS_MESSAGE_LEN];
+    snprintf(msg, sizeof(msg), "%s %s repeated %lu times in %lu s", event.level == DIAG_ERROR ? "[ERROR]" : "[WARN]",
+             diagnosticsEventInfo(id).name, (unsigned long)event.repeats, (millis() - event.windowStart) / 1000UL);
+    logDiagnostics(msg);
+  }
+  event.active = false;
+  event.repeats = 0;
+}
+
+/**
+ * @brief Logs a recurring event through the dedup window and its category's rate limit.
+ * @param id Identifies the condition; msg may differ between occurrences (e.g. values).
+ * @return true if msg was logged, false if it was only counted.
+ */
+inline bool logDiagnosticsEvent(DiagnosticsEventId id, const char* msg) {
+  DiagnosticsEventState& event = diagnosticsEvents[id];
+  if (event.active && millis() - event.windowStart < DIAGNOSTICS_DEDUP_WINDOW_MS) {
+    event.repeats++;
+    return false;
+  }
+  closeDiagnosticsEvent(id);
+  if (!takeDiagnosticsToken(diagnosticsEventInfo(id).category)) {
+    // Over the limit: open a window anyway so the occurrence shows up in a summary
+    event.active = true;
+    event.windowStart = millis();
+    event.repeats = 1;
+    event.level = diagnosticsLevelOf(msg);
+    return false;
+  }
+  logDiagnostics(msg);
+  event.active = true;
+  event.windowStart = millis();
+  event.level = diagnosticsLevelOf(msg);
+  return true;
+}
+
+/**
+ * @brief Writes buffered log records once the flush interval has passed and
+ * summarizes events whose dedup window has closed. Call from loop().
+ */
+inline void serviceDiagnostics() {
+  for (uint8_t i = 0; i < DIAG_EVENT_COUNT; i++) {
+    const DiagnosticsEventState& event = diagnosticsEvents[i];
+    if (event.active && millis() - event.windowStart >= DIAGNOSTICS_DEDUP_WINDOW_MS) {
+      closeDiagnosticsEvent((DiagnosticsEventId)i);
+    }
+  }
+  if (millis() - diagnosticsBuffer.lastFlush >= DIAGNOSTICS_FLUSH_INTERVAL_MS) flushDiagnostics();
+}
+
+/**
+ * @brief Produces all log generations as one text file, oldest first. Every
+ * generation is opened when the source is created and read through that handle,
+ * so a rotation during the download, which renames the files, does not mix
+ * them up. Each file is cut at the size it had then, so lines logged meanwhile
+ * do not make the body longer than its Content-Length.
+ */
+struct DiagnosticsLogSource : ResponseSource {
+  File files[DIAGNOSTICS_LOG_GENERATIONS + 1];
+  size_t sizes[DIAGNOSTICS_LOG_GENERATIONS + 1];
+  size_t total = 0;
+  uint32_t seq = 0;                                  // diagnosticsLogSequence() when opened
+  uint8_t nextGen = DIAGNOSTICS_LOG_GENERATIONS + 1; // Generation after the one being read
+  size_t left = 0;                                   // Bytes still to read from it
+
+  DiagnosticsLogSource() {
+    seq = diagnosticsLogSequence();
+    for (uint8_t gen = 0; gen <= DIAGNOSTICS_LOG_GENERATIONS; gen++) {
+      files[gen] = LittleFS.open(diagnosticsLogPath(gen), "r");
+      sizes[gen] = files[gen] ? files[gen].size() : 0;
+      total += sizes[gen];
+    }
+  }
+  ~DiagnosticsLogSource() {
+    for (uint8_t gen = 0; gen <= DIAGNOSTICS_LOG_GENERATIONS; gen++) files[gen].close();
+  }
+
+  /**
+   * @brief Validator for If-Range: changes whenever a line is appended or the
+   * log is rotated or cleared.
+   */
+  String etag() const {
+    char tag[48];
+    snprintf(tag, sizeof(tag), "\"d%lu-%lu\"", (unsigned long)seq, (unsigned long)total);
+    return String(tag);
+  }
+
+  size_t read(char* buf, size_t size) override {
+    for (;;) {
+      if (left == 0) {
+        if (nextGen == 0) return 0;
+        left = sizes[--nextGen];
+        continue;
+      }
+      size_t n = files[nextGen].read((uint8_t*)buf, size < left ? size : left);
+      if (n > 0) {
+        left -= n;
+        return n;
+      }
+      left = 0; // Read error; the body ends short of its Content-Length
+      nextGen = 0;
+    }
+  }
+
+  // Skips whole generations, then seeks into the file where the range starts.
+  size_t skip(size_t offset) override {
+    size_t skipped = 0;
+    while (nextGen > 0 && skipped + sizes[nextGen - 1] <= offset) skipped += sizes[--nextGen];
+    if (nextGen == 0 || skipped == offset) return skipped;
+    nextGen--;
+    left = sizes[nextGen];
+    if (!files[nextGen].seek(offset - skipped)) return skipped; // Read from the start and let the rest be dropped
+    left -= offset - skipped;
+    return offset;
+  }
+};
+
+/**
+ * @brief Serves all log generations as one text file, oldest first.
+ * The body is written from loop() (see background_response.h). Range requests
+ * are supported, and If-Range is checked against the ETag.
+ */
+inline void handleDiagnosticsDownload(ESP8266WebServer &server) {
+  flushDiagnostics(); // Include what is still buffered
+  DiagnosticsLogSource* source = new DiagnosticsLogSource();
+  size_t total = source->total;
+  if (total == 0) {
+    delete source;
     server.send(404, "text/plain", "No diagnostics log found.");
+    return;
   }
+  String etag = source->etag();
+  startRangedBackgroundResponse(server, "text/plain", source, total, etag,
+                                "ETag: " + etag + "\r\nCache-Control: no-cache\r\n");
 }
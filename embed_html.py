@@ -2,6 +2,8 @@
 import argparse
 from pathlib import Path
 import gzip
+import hashlib
+import re
 
 MAX_DELIM_LEN = 16
 
@@ -26,6 +28,60 @@ HEADER_PREAMBLE = """#pragma once
 #endif
 """
 
+def content_hash(data: bytes) -> str:
+    """Short content hash used for the ETag and for versioned asset URLs (?v=<hash>)."""
+    return hashlib.sha256(data).hexdigest()[:16]
+
+def version_asset_refs(text: str, assets) -> str:
+    """Rewrites references such as href="atticfan.css" to href="atticfan.css?v=<hash>"."""
+    for asset in assets:
+        path = Path(asset)
+        name = re.escape(path.name)
+        text = re.sub(r"""(?<=["'(/])""" + name + r"""(?=["')])""", f"{path.name}?v={content_hash(path.read_bytes())}", text)
+    return text
+
+def format_bytes(data: bytes) -> str:
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]))
+    return ",\n".join(lines)
+
+# Served with a strong ETag. Requests for a versioned URL (?v=<hash>, as rewritten
+# into the embedded pages) are cached for good; anything else is revalidated.
+# A gzipped payload is the only copy on the device, so a client that does not
+# accept gzip gets 406 instead of bytes it cannot decode.
+ASSET_HELPER = r"""
+#if WEBUI_EMIT_STREAM_HELPER
+#include <ESP8266WebServer.h>
+static void {func_name}() {{
+  extern ESP8266WebServer server;
+{negotiate}  server.sendHeader("ETag", {var_name}_ETAG);
+  server.sendHeader("Cache-Control", server.hasArg("v") ? "public, max-age=31536000, immutable" : "no-cache");
+  if (server.header("If-None-Match") == {var_name}_ETAG) {{
+    server.send(304);
+    return;
+  }}
+{encoding_header}  server.send_P(200, "{content_type}", reinterpret_cast<const char*>({var_name}), {var_name}_LEN);
+}}
+#endif
+"""
+
+GZIP_NEGOTIATION = """  server.sendHeader("Vary", "Accept-Encoding");
+  if (server.header("Accept-Encoding").indexOf("gzip") < 0) {
+    server.send(406, "text/plain", "Only available gzip-compressed; send Accept-Encoding: gzip.");
+    return;
+  }
+"""
+
+TEMPLATE_BYTES = """{preamble}
+// {source_bytes} bytes{gzip_note}
+const unsigned char {var_name}[] PROGMEM = {{
+{bytes}
+}};
+const size_t {var_name}_LEN = sizeof({var_name});
+#define {var_name}_ETAG "\\"{etag}\\""
+{stream_helper}"""
+
 STREAM_HELPER = r"""
 #if WEBUI_EMIT_STREAM_HELPER
 // NOTE: Assumes you have a global 'ESP8266WebServer server(80);'
@@ -34,7 +90,6 @@ STREAM_HELPER = r"""
 #include <ESP8266WebServer.h>                                                   
 static void {func_name}() {{
   extern ESP8266WebServer server;                                              
-  server.sendHeader("Connection", "close");                                   
   server.send_P(200, "{content_type}",                                               
                 {var_name}, {var_name}_LEN);
 }}
@@ -49,23 +104,6 @@ const size_t {var_name}_LEN = sizeof({var_name}) - 1;
 #define F(string_literal) (FPSTR(PSTR(string_literal)))
 """
 
-TEMPLATE_GZIP = """{preamble}
-{stream_helper}
-const unsigned char EMBEDDED_WEBUI[] PROGMEM = {{
-{bytes}
-}};
-const size_t EMBEDDED_WEBUI_LEN = sizeof(EMBEDDED_WEBUI);
-"""
-
-BINARY_STREAM_HELPER = r"""
-#if WEBUI_EMIT_STREAM_HELPER
-#include <ESP8266WebServer.h>
-static void {func_name}() {{
-  extern ESP8266WebServer server;
-  server.send_P(200, "{content_type}", reinterpret_cast<const char*>({var_name}), {var_name}_LEN);
-}}
-#endif
-"""
 
 def is_binary_file(path):
     # Simple extension-based check for binary assets
@@ -87,7 +125,9 @@ def main():
     ap.add_argument("--var-name", default="EMBEDDED_WEBUI", help="Name for the PROGMEM char array variable.")
     ap.add_argument("--func-name", default="handleEmbeddedWebUI", help="Name for the generated handler function.")
     ap.add_argument("--no-stream-helper", action="store_true", help="Do not emit the WEBUI_DEFINE_CHUNKED_HANDLER macro")
-    ap.add_argument("--gzip", action="store_true", help="Store gzipped payload instead of plain HTML")
+    ap.add_argument("--gzip", action="store_true", help="Store the payload gzip-compressed (served with Content-Encoding: gzip) when that makes it smaller")
+    ap.add_argument("--version-asset", action="append", default=[], metavar="PATH",
+                    help="Rewrite references to this asset to <name>?v=<content hash>; may be repeated")
     args = ap.parse_args()
 
     src = Path(args.input)
@@ -97,70 +137,54 @@ def main():
 
     preamble = HEADER_PREAMBLE.format(src_name=src.name)
     stream_helper = ""
+    binary = is_binary_file(src)
 
-    if is_binary_file(src):
-        # Read as bytes and emit as unsigned char array
+    if binary:
         data = src.read_bytes()
-        lines = []
-        line = []
-        for b in data:
-            line.append(f"0x{b:02x}")
-            if len(line) == 16:
-                lines.append(", ".join(line))
-                line = []
-        if line:
-            lines.append(", ".join(line))
+    else:
+        html = version_asset_refs(src.read_text(encoding="utf-8"), args.version_asset)
+        data = html.encode("utf-8")
+
+    if binary or args.gzip:
+        # Emit as an unsigned char array, gzipped unless that does not help (e.g. PNG)
+        payload = data
+        gzipped = False
+        if args.gzip:
+            gz = gzip.compress(data, compresslevel=9, mtime=0)  # mtime=0 keeps the output reproducible
+            if len(gz) < len(data):
+                payload, gzipped = gz, True
 
         if not args.no_stream_helper:
-            stream_helper = BINARY_STREAM_HELPER.format(var_name=args.var_name, func_name=args.func_name, content_type=content_type)
-
-        content = (
-            "{preamble}\n"
-            "const unsigned char {var_name}[] PROGMEM = {{\n{bytes}\n}};\n"
-            "const size_t {var_name}_LEN = sizeof({var_name});\n\n"
-            "{stream_helper}"
-        ).format(
-            preamble=preamble, var_name=args.var_name, bytes=',\n'.join(f"  {l}" for l in lines),
-            stream_helper=stream_helper
-        )
+            stream_helper = ASSET_HELPER.format(
+                var_name=args.var_name, func_name=args.func_name, content_type=content_type,
+                negotiate=GZIP_NEGOTIATION if gzipped else "",
+                encoding_header='  server.sendHeader("Content-Encoding", "gzip");\n' if gzipped else "")
+
+        content = TEMPLATE_BYTES.format(
+            preamble=preamble, source_bytes=len(data),
+            gzip_note=f", gzipped to {len(payload)}" if gzipped else "",
+            var_name=args.var_name, bytes=format_bytes(payload), etag=content_hash(data),
+            stream_helper=stream_helper)
         dst.write_text(content, encoding="utf-8")
-        print(f"Wrote {dst} (binary asset; stream helper {'ON' if not args.no_stream_helper else 'OFF'})")
+        print(f"Wrote {dst} ({len(data)} -> {len(payload)} bytes{', gzipped' if gzipped else ''}; "
+              f"stream helper {'ON' if not args.no_stream_helper else 'OFF'})")
         return
 
-    # Text file (HTML, JS, CSS, etc.)
-    html = src.read_text(encoding="utf-8")
-
+    # Plain text (HTML, JS, CSS, etc.)
     if not args.no_stream_helper:
         stream_helper = STREAM_HELPER.format(var_name=args.var_name, func_name=args.func_name, content_type=content_type)
 
-    if args.gzip:
-        gz = gzip.compress(html.encode("utf-8"))
-        lines = []
-        line = []
-        for b in gz:
-            line.append(f"0x{b:02x}")
-            if len(line) == 16:
-                lines.append(", ".join(line))
-                line = []
-        if line:
-            lines.append(", ".join(line))
-        content = TEMPLATE_GZIP.format(
-            preamble=preamble,
-            stream_helper=stream_helper,
-            bytes=",\n".join(lines),
-        )
-    else:
-        delimiter = pick_delimiter(html)
-        content = TEMPLATE_PLAIN_NAMED.format(
-            preamble=preamble,
-            stream_helper=stream_helper,
-            html=html, # This was the bug, it was not using the delimiter
-            delimiter=delimiter,
-            var_name=args.var_name
-        )
+    delimiter = pick_delimiter(html)
+    content = TEMPLATE_PLAIN_NAMED.format(
+        preamble=preamble,
+        stream_helper=stream_helper,
+        html=html, # This was the bug, it was not using the delimiter
+        delimiter=delimiter,
+        var_name=args.var_name
+    )
 
     dst.write_text(content, encoding="utf-8")
-    print(f"Wrote {dst} ({'gzipped' if args.gzip else 'plain'}; stream helper {'ON' if not args.no_stream_helper else 'OFF'})")
+    print(f"Wrote {dst} (plain; stream helper {'ON' if not args.no_stream_helper else 'OFF'})")
 
 if __name__ == "__main__":
     main()
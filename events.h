@@ -0,0 +1,289 @@
+#pragma once
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+#include <math.h>
+#include "hardware.h"
+#include "types.h"
+#include "config.h"
+#include "sensors.h"
+#include "diagnostics.h"
+#include "indoor_sensors.h"
+
+/**
+ * @brief Server-Sent Events stream of dashboard state and log lines (GET /events).
+ *
+ * Up to EVENTS_MAX_SUBSCRIBERS browsers hold a connection open. A subscriber
+ * gets the full state on connect, then only the fields that changed:
+ *   event: state
+ *   data: {"atticTemp":97.5,"fanOn":true}
+ * Every diagnostics log line is pushed as it is logged:
+ *   event: log
+ *   data: [2025-07-01 14:02:11] [ACTION] Fan turned ON manually via web UI.
+ * Writes never block the loop: an event that does not fit in a subscriber's
+ * send buffer is dropped for that subscriber. Since the dashboard merges state
+ * deltas into what it has, a dropped delta would leave a field stale until it
+ * next changes, so such a subscriber is sent the full state again, instead of
+ * deltas, on the next state check its buffer has room for. A subscriber that
+ * keeps falling behind is disconnected (EventSource reconnects on its own).
+ */
+
+#define EVENTS_STATE_INTERVAL_MS 500    // How often the state is compared with what was last sent
+#define EVENTS_KEEPALIVE_MS 15000UL     // Comment line sent on an idle stream, also detects dead peers
+#define EVENTS_RETRY_MS 5000            // Reconnect delay suggested to the browser
+#define EVENTS_MAX_MISSED 8             // Consecutive events a subscriber may miss before it is dropped
+#define EVENTS_NO_VALUE INT16_MIN       // Reading not available
+
+extern ManualTimerState manualTimer;
+extern float simulatedAtticTemp;
+extern float simulatedOutdoorTemp;
+
+struct EventSubscriber {
+  WiFiClient client;
+  bool active = false;
+  bool resync = false; // Missed an event; gets the full state next instead of a delta
+  uint8_t missed = 0;
+};
+
+// The dashboard fields of /status, temperatures in tenths.
+struct EventState {
+  int16_t atticTemp;
+  int16_t atticHumidity;
+  int16_t outdoorTemp;
+  int16_t avgIndoorTemp;
+  int16_t avgIndoorHumidity;
+  int16_t simulatedAtticTemp;
+  int16_t simulatedOutdoorTemp;
+  uint32_t timerRemainingSec;
+  uint8_t fanMode;    // FanMode
+  bool fanOn;
+  bool timerActive;
+  bool timerDelay;    // Timer is still in its delay phase
+  bool testModeEnabled;
+};
+
+EventSubscriber eventSubscribers[EVENTS_MAX_SUBSCRIBERS];
+EventState lastEventState;
+unsigned long lastEventStateCheck = 0;
+unsigned long lastEventWrite = 0;
+uint32_t eventsSent = 0;
+uint32_t eventsMissed = 0;
+
+inline int16_t eventTenths(float value) {
+  return isnan(value) ? EVENTS_NO_VALUE : (int16_t)lroundf(value * 10.0f);
+}
+
+inline EventState captureEventState(FanMode fanMode) {
+  EventState s;
+  s.atticTemp = eventTenths(sensorSnapshot.atticTemp);
+  s.atticHumidity = eventTenths(sensorSnapshot.atticHumidity);
+  s.outdoorTemp = eventTenths(sensorSnapshot.outdoorTemp);
+  s.avgIndoorTemp = config.indoorSensorsEnabled ? eventTenths(getAverageIndoorTemperature()) : EVENTS_NO_VALUE;
+  s.avgIndoorHumidity = config.indoorSensorsEnabled ? eventTenths(getAverageIndoorHumidity()) : EVENTS_NO_VALUE;
+  s.testModeEnabled = config.testModeEnabled;
+  s.simulatedAtticTemp = config.testModeEnabled ? eventTenths(simulatedAtticTemp) : EVENTS_NO_VALUE;
+  s.simulatedOutdoorTemp = config.testModeEnabled ? eventTenths(simulatedOutdoorTemp) : EVENTS_NO_VALUE;
+  s.fanMode = fanMode;
+  s.fanOn = digitalRead(FAN_RELAY_PIN) == HIGH;
+  s.timerActive = manualTimer.isActive;
+  s.timerDelay = false;
+  s.timerRemainingSec = 0;
+  if (manualTimer.isActive) {
+    unsigned long now = millis();
+    s.timerDelay = now < manualTimer.delayEndTime;
+    s.timerRemainingSec = ((s.timerDelay ? manualTimer.delayEndTime : manualTimer.timerEndTime) - now) / 1000;
+  }
+  return s;
+}
+
+// Appends ,"key":value to a JSON object under construction (the caller strips the leading comma).
+inline void appendEventField(char* buf, size_t size, size_t& len, const char* key, const char* fmt, ...) {
+  if (len >= size) return;
+  int n = snprintf(buf + len, size - len, ",\"%s\":", key);
+  if (n < 0) return;
+  len += n;
+  if (len >= size) return;
+  va_list args;
+  va_start(args, fmt);
+  n = vsnprintf(buf + len, size - len, fmt, args);
+  va_end(args);
+  if (n > 0) len += n;
+}
+
+inline void appendEventTenths(char* buf, size_t size, size_t& len, const char* key, int16_t value) {
+  if (value == EVENTS_NO_VALUE) {
+    appendEventField(buf, size, len, key, "null");
+  } else {
+    appendEventField(buf, size, len, key, "%s%d.%d", value < 0 ? "-" : "", abs(value) / 10, abs(value) % 10);
+  }
+}
+
+/**
+ * @brief Writes the fields of s that differ from prev, or all of them if prev is nullptr, as a JSON object.
+ * @return The length written, or 0 if nothing changed.
+ */
+inline size_t formatEventState(const EventState& s, const EventState* prev, char* buf, size_t size) {
+  size_t len = 0;
+#define EVENT_CHANGED(field) (!prev || prev->field != s.field)
+  if (EVENT_CHANGED(atticTemp)) appendEventTenths(buf, size, len, "atticTemp", s.atticTemp);
+  if (EVENT_CHANGED(atticHumidity)) appendEventTenths(buf, size, len, "atticHumidity", s.atticHumidity);
+  if (EVENT_CHANGED(outdoorTemp)) appendEventTenths(buf, size, len, "outdoorTemp", s.outdoorTemp);
+  if (EVENT_CHANGED(avgIndoorTemp)) appendEventTenths(buf, size, len, "avgIndoorTemp", s.avgIndoorTemp);
+  if (EVENT_CHANGED(avgIndoorHumidity)) appendEventTenths(buf, size, len, "avgIndoorHumidity", s.avgIndoorHumidity);
+  if (EVENT_CHANGED(fanOn)) appendEventField(buf, size, len, "fanOn", s.fanOn ? "true" : "false");
+  if (EVENT_CHANGED(fanMode)) {
+    const char* mode = s.fanMode == AUTO ? "AUTO" : "MANUAL";
+    const char* subMode = s.fanMode == MANUAL_ON ? "\"ON\"" : s.fanMode == MANUAL_OFF ? "\"OFF\"" : s.fanMode == MANUAL_TIMED ? "\"TIMED\"" : "null";
+    appendEventField(buf, size, len, "fanMode", "\"%s\"", mode);
+    appendEventField(buf, size, len, "fanSubMode", "%s", subMode);
+  }
+  if (EVENT_CHANGED(timerActive)) appendEventField(buf, size, len, "timerActive", s.timerActive ? "true" : "false");
+  if (s.timerActive && (EVENT_CHANGED(timerActive) || EVENT_CHANGED(timerDelay))) appendEventField(buf, size, len, "timerMode", s.timerDelay ? "\"delay\"" : "\"run\"");
+  if (s.timerActive && EVENT_CHANGED(timerRemainingSec)) appendEventField(buf, size, len, "timerRemainingSec", "%lu", (unsigned long)s.timerRemainingSec);
+  if (EVENT_CHANGED(testModeEnabled)) appendEventField(buf, size, len, "testModeEnabled", s.testModeEnabled ? "true" : "false");
+  if (EVENT_CHANGED(simulatedAtticTemp)) appendEventTenths(buf, size, len, "simulatedAtticTemp", s.simulatedAtticTemp);
+  if (EVENT_CHANGED(simulatedOutdoorTemp)) appendEventTenths(buf, size, len, "simulatedOutdoorTemp", s.simulatedOutdoorTemp);
+#undef EVENT_CHANGED
+  if (len == 0 || len >= size) return 0;
+  buf[0] = '{'; // Replaces the leading comma
+  if (len + 1 >= size) return 0;
+  buf[len++] = '}';
+  buf[len] = '\0';
+  return len;
+}
+
+inline void dropEventSubscriber(EventSubscriber& sub) {
+  sub.client.stop();
+  sub.client = WiFiClient();
+  sub.active = false;
+}
+
+/**
+ * @brief Counts open streams, releasing those whose peer has gone away.
+ */
+inline uint8_t eventSubscriberCount() {
+  uint8_t count = 0;
+  for (EventSubscriber& sub : eventSubscribers) {
+    if (sub.active && !sub.client.connected()) dropEventSubscriber(sub);
+    if (sub.active) count++;
+  }
+  return count;
+}
+
+/**
+ * @brief Writes one event to a subscriber if its send buffer has room; otherwise it
+ * misses the event and is marked for a resync.
+ * @return true if the event was written.
+ */
+inline bool sendEvent(EventSubscriber& sub, const char* text, size_t len) {
+  if (!sub.client.connected()) {
+    dropEventSubscriber(sub);
+    return false;
+  }
+  if ((size_t)sub.client.availableForWrite() < len) {
+    eventsMissed++;
+    sub.resync = true;
+    if (++sub.missed >= EVENTS_MAX_MISSED) dropEventSubscriber(sub);
+    return false;
+  }
+  sub.client.write((const uint8_t*)text, len);
+  sub.missed = 0;
+  eventsSent++;
+  return true;
+}
+
+inline void broadcastEvent(const char* text, size_t len) {
+  for (EventSubscriber& sub : eventSubscribers) {
+    if (sub.active) sendEvent(sub, text, len);
+  }
+  lastEventWrite = millis();
+}
+
+inline size_t formatStateEvent(const EventState& s, const EventState* prev, char* buf, size_t size) {
+  static const char prefix[] = "event: state\ndata: ";
+  const size_t prefixLen = sizeof(prefix) - 1;
+  size_t len = formatEventState(s, prev, buf + prefixLen, size - prefixLen - 2);
+  if (len == 0) return 0;
+  memcpy(buf, prefix, prefixLen);
+  len += prefixLen;
+  buf[len++] = '\n';
+  buf[len++] = '\n';
+  return len;
+}
+
+/**
+ * @brief Diagnostics hook: pushes each log line to the subscribers as it is logged.
+ */
+inline void publishLogEvent(const DiagnosticsRecord& record) {
+  if (eventSubscriberCount() == 0) return;
+  char line[48 + DIAGNOSTICS_MESSAGE_LEN];
+  int len = snprintf(line, sizeof(line), "event: log\ndata: ");
+  formatDiagnosticsTimestamp(record.time, record.synced, line + len, sizeof(line) - len);
+  len += strlen(line + len);
+  for (const char* c = record.msg; *c && len < (int)sizeof(line) - 2; c++) line[len++] = (*c == '\n' || *c == '\r') ? ' ' : *c;
+  line[len++] = '\n';
+  line[len++] = '\n';
+  broadcastEvent(line, len);
+}
+
+/**
+ * @brief Opens an event stream on the current connection. The response has no length
+ * and the connection stays open; the server drops its own reference when the handler returns.
+ */
+inline void handleEvents(ESP8266WebServer &server, FanMode fanMode) {
+  EventSubscriber* slot = nullptr;
+  eventSubscriberCount(); // Frees the slots of closed streams
+  for (EventSubscriber& sub : eventSubscribers) {
+    if (!sub.active) {
+      slot = &sub;
+      break;
+    }
+  }
+  if (!slot) {
+    server.sendHeader("Retry-After", String(EVENTS_RETRY_MS / 1000));
+    server.send(503, "text/plain", "Too many event subscribers");
+    return;
+  }
+
+  WiFiClient client = server.client();
+  client.setNoDelay(true);
+  char buf[448];
+  int len = snprintf(buf, sizeof(buf),
+                     "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\n"
+                     "Connection: keep-alive\r\n\r\nretry: %d\n\n", EVENTS_RETRY_MS);
+  client.write((const uint8_t*)buf, len);
+  slot->client = client;
+  slot->active = true;
+  slot->resync = false;
+  slot->missed = 0;
+
+  size_t stateLen = formatStateEvent(captureEventState(fanMode), nullptr, buf, sizeof(buf));
+  if (stateLen) sendEvent(*slot, buf, stateLen); // Marks it for a resync if it does not fit
+  diagnosticsLogHook = publishLogEvent;
+}
+
+/**
+ * @brief Sends state deltas and keepalives. Call from loop(); does nothing without subscribers.
+ */
+inline void serviceEvents(FanMode fanMode) {
+  if (eventSubscriberCount() == 0) return;
+  unsigned long now = millis();
+  if (now - lastEventStateCheck >= EVENTS_STATE_INTERVAL_MS) {
+    lastEventStateCheck = now;
+    EventState state = captureEventState(fanMode);
+    char buf[448];
+    size_t len = formatStateEvent(state, &lastEventState, buf, sizeof(buf));
+    for (EventSubscriber& sub : eventSubscribers) {
+      if (sub.active && !sub.resync && len) sendEvent(sub, buf, len);
+    }
+    lastEventState = state;
+    // Subscribers that missed an event get the whole state instead
+    size_t fullLen = 0;
+    for (EventSubscriber& sub : eventSubscribers) {
+      if (!sub.active || !sub.resync) continue;
+      if (!fullLen) fullLen = formatStateEvent(state, nullptr, buf, sizeof(buf));
+      if (fullLen && sendEvent(sub, buf, fullLen)) sub.resync = false;
+    }
+    if (len || fullLen) lastEventWrite = now;
+  }
+  if (now - lastEventWrite >= EVENTS_KEEPALIVE_MS) broadcastEvent(":\n\n", 3);
+}
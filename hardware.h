@@ -7,10 +7,15 @@
 #define SHT21_SCL_PIN     D3     // I2C SCL for SHT21
 #define FAN_RELAY_PIN     D5     // Relay control for attic fan
 #define SHT21_I2C_ADDR    0x40   // I2C address for SHT21
+#define DS18B20_RESOLUTION 12    // DS18B20 bits (9-12): 9=94 ms/0.5°C, 10=188 ms/0.25°C, 11=375 ms, 12=750 ms/0.0625°C
 
 // === Sensor Presence Flags ===
+#ifndef HAS_SHT21
 #define HAS_SHT21         false   // Set to false if SHT21 not connected
+#endif
+#ifndef HAS_DS18B20
 #define HAS_DS18B20       false   // Set to false if DS18B20 not connected
+#endif
 
 // === Mock Values for Testing ===
 #define MOCK_ATTIC_TEMP   95.0   // °F, used if SHT21 not present
@@ -27,11 +32,37 @@
 #define ONBOARD_LED_ENABLED_DEFAULT true // Whether the status LED is enabled by default
 #define TEST_MODE_ENABLED_DEFAULT false // Whether test mode is enabled by default
 #define HISTORY_LOG_INTERVAL_DEFAULT 300000UL // 5 minutes in ms
+#define HISTORY_BUFFER_RECORDS 10 // History samples staged in RAM per flash write (max 10 with the RTC mirror)
+#define HISTORY_BUFFER_RTC_MIRROR true // Keep staged samples in RTC memory so a soft reset or crash does not lose them
+#define DIAGNOSTICS_BUFFER_RECORDS 16 // Diagnostics log lines held in RAM between flash writes
+#define DIAGNOSTICS_FLUSH_INTERVAL_MS 60000UL // Buffered log lines are written at least this often
+#define EVENTS_MAX_SUBSCRIBERS 3 // Open /events streams; each holds a TCP connection and its lwIP buffers
+#define CRASH_BREADCRUMB_COUNT 20 // Recent events kept in RTC memory and reported after a watchdog reset or exception
 #define MQTT_ENABLED_DEFAULT false // Whether MQTT is enabled by default
 #define MQTT_DISCOVERY_ENABLED_DEFAULT false // Whether to publish Home Assistant discovery topics
 #define INDOOR_SENSORS_ENABLED_DEFAULT true // Whether indoor sensors are enabled by default
 #define DAILY_RESTART_ENABLED_DEFAULT true // Whether the daily restart is enabled by default
 
+// === Web Server ===
+#define HTTP_PORT                  80
+#define HTTP_MAX_PENDING_CLIENTS   2  // Connections queued behind the one being served; lwIP holds back any beyond this
+#define HTTP_MAX_REQUESTS_PER_PASS 8  // Requests answered back to back in one loop() pass
+#define HTTP_PASS_BUDGET_MS        50 // No new request is started in a loop() pass after this long
+#define BACKGROUND_RESPONSES_MAX   2  // Downloads streamed from loop() at once; each holds a connection and ~600 bytes
+#define BACKGROUND_RESPONSE_BUDGET_US 5000 // Time per loop() pass spent writing download bodies
+
+// === Indoor Sensor Ingest Limits ===
+// Token buckets for POST /indoor_sensors/data: one token per interval, holding up to burst tokens.
+// The IndoorSensorClient posts every 30 s, so these only bite on misconfigured or flooding clients.
+#define INGEST_PER_IP_INTERVAL_MS     2000 // Per client IP; leaves room for several sensors behind one device
+#define INGEST_PER_IP_BURST           5
+#define INGEST_PER_SENSOR_INTERVAL_MS 5000 // Per sensorId
+#define INGEST_PER_SENSOR_BURST       3
+#define INGEST_GLOBAL_RPS             5    // All posts together
+#define INGEST_GLOBAL_BURST           10
+#define INGEST_TRACKED_IPS            8    // Bucket table sizes; the longest idle entry is reused when full
+#define INGEST_TRACKED_SENSORS        16
+
 // === OTA Update Port (optional override) ===
 // #define OTA_PORT        8266
 
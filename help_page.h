@@ -7,164 +7,244 @@
 #define WEBUI_EMIT_STREAM_HELPER 1
 #endif
 
-#undef F
-const char HELP_PAGE[] PROGMEM = R"EMB1(
-<!DOCTYPE html>
-<html>
-<head>
-  <title>Attic Fan - Help</title>
-  <meta charset="UTF-8">
-  <meta name="viewport" content="width=device-width, initial-scale=1">
-  <link rel="stylesheet" href="atticfan.css">
-  <link rel="icon" type="image/png" href="favicon.png">
-  <link rel="icon" href="favicon.ico">
-</head>
-<body>
-  <div class="page-container">
-    <h1>Help &amp; Documentation</h1>
-    <a href="/" class="back-link">&larr; Back to Main Control Page</a>
-
-    <div class="content-section help-section" id="mode-control">
-      <h2>Mode Control</h2>
-      <p>This panel controls the primary operational mode of the fan.</p>
-      <dl>
-        <dt>AUTO</dt>
-        <dd>This is the primary "set and forget" mode. The fan will automatically turn on and off based on the temperature settings and pre-cooling logic.</dd>
-        <dt>MANUAL</dt>
-        <dd>This mode gives you direct control over the fan. In this mode, you can turn the fan on, off, or start a timed run. The automatic logic is disabled.</dd>
-      </dl>
-    </div>
-
-    <div class="content-section help-section" id="manual-timer">
-      <h2>Manual Timer</h2>
-      <p>The "Set Timer" button (available in MANUAL mode) allows you to run the fan for a specific duration, with an optional delayed start.</p>
-      <dl>
-        <dt>Delay Start</dt>
-        <dd>The number of minutes to wait before the fan turns on.</dd>
-        <dt>Run Duration</dt>
-        <dd>The number of minutes the fan will run after the delay period ends.</dd>
-        <dt>After timer ends</dt>
-        <dd>Choose what the controller should do after the timed run is complete. It can either revert to AUTO mode or stay in MANUAL mode with the fan off.</dd>
-      </dl>
-    </div>
-
-    <div class="content-section help-section" id="temp-settings">
-      <h2>Fan Temp Control Settings</h2>
-      <p>These settings fine-tune the automatic fan behavior.</p>
-      <dl>
-        <dt>On Temp</dt>
-        <dd>The primary attic temperature at which the fan is allowed to turn on, provided other conditions are met.</dd>
-        <dt>Delta Temp</dt>
-        <dd>A crucial efficiency setting. The fan will only <strong>turn on and stay on</strong> if the attic is hotter than the outdoors by at least this many degrees. This ensures the fan is always pulling in significantly cooler air and will turn it off if the outdoor temperature rises too close to the attic temperature.</dd>
-        <dt>Hysteresis</dt>
-        <dd>This creates a "turn-off" temperature that is lower than the "turn-on" temperature, preventing the fan from rapidly switching on and off (known as "cycling") when the attic temperature is hovering around the setpoint. For example, if 'On Temp' is 90°F and 'Hysteresis' is 2°F, the fan will turn on at 90°F but will not turn off until the attic cools down to 88°F.</dd>
-        <dt>History Log Interval</dt>
-        <dd>How often (in minutes) to log sensor history to the device. Default is 5 minutes. Range: 1–1440 (24 hours). Lower values provide finer-grained history but use more storage.</dd>
-      </dl>
-    </div>
-
-    <div class="content-section help-section" id="pre-cooling">
-      <h2>Pre-Cooling Logic</h2>
-      <p>Pre-cooling is a smart feature that uses the daily weather forecast to get a head start on cooling the attic on very hot days.</p>
-      <dl>
-        <dt>Pre-Cool Trigger</dt>
-        <dd>If the forecasted high for the day is at or above this temperature, the pre-cooling logic will activate.</dd>
-        <dt>Pre-Cool Offset</dt>
-        <dd>When pre-cooling is active, the <code>On Temp</code> is temporarily lowered by this amount. For example, if On Temp is 90°F and the Offset is 5°F, the fan will start at 85°F on hot days, helping to prevent the attic from reaching extreme temperatures.</dd>
-      </dl>
-    </div>
-
-    <div class="content-section help-section" id="feature-toggles">
-      <h2>Feature Toggles</h2>
-      <p>These switches control optional features of the controller.</p>
-      <dl>
-        <dt>Enable Pre-Cooling</dt>
-        <dd>The master switch to turn the entire pre-cooling feature on or off.</dd>
-        <dt>Enable Status LED</dt>
-        <dd>Controls the onboard status light on the device. You may wish to turn this off if the blinking light is in a visible location.</dd>
-        <dt>Enable Daily Restart</dt>
-        <dd>Automatically restarts the device once every 24 hours. This is a best-practice feature to ensure long-term stability. To avoid interrupting a cooling cycle, the restart will be safely delayed until after the fan has turned off.</dd>
-        <dt>Enable MQTT</dt>
-        <dd>Enables the MQTT client, which allows the controller to integrate with Home Assistant or other MQTT-compatible smart home systems. Requires MQTT broker details to be set in <code>secrets.h</code>.</dd>
-        <dt>Enable Test Mode</dt>
-        <dd>Enables the "Test Panel" at the bottom of the main page, which contains sliders to simulate sensor values. This allows you to test the fan's automation logic without needing physical sensors or specific environmental conditions.</dd>
-      </dl>
-    </div>
-
-    <div class="content-section help-section" id="history">
-      <h2>History Chart &amp; CSV Log</h2>
-      <p>The <strong>History</strong> section on the main page shows a chart of attic temperature, outdoor temperature, and humidity over time. This data is logged at a configurable interval (default: 5 minutes) and stored in a CSV file on the device. You can adjust the logging interval in the configuration section for finer or coarser history detail.</p>
-      <ul>
-        <li><strong>Chart:</strong> Visualizes recent trends (up to 100 points) for quick analysis. The purple shaded area at the bottom indicates when the fan was on.</li>
-        <li><strong>Download:</strong> Click <em>Download History (CSV)</em> in the System &amp; Maintenance section to save the complete log for offline use.</li>
-      </ul>
-      <p>The CSV format is: <code>timestamp,attic_temp,outdoor_temp,humidity,fan_on</code></p>
-    </div>
-
-    <div class="content-section help-section" id="troubleshooting">
-      <h2>Troubleshooting &amp; FAQ</h2>
-      <dl>
-        <dt>Why do I see a simpler UI after flashing?</dt>
-        <dd>The device defaults to a lightweight, embedded UI. To use the full-featured UI (with history chart, etc.), you must set <code>USE_FS_WEBUI</code> to <code>1</code> in the main sketch and upload the `data` folder to the device's filesystem.</dd>
-        <dt>How do I recover WiFi if the device fails to connect?</dt>
-        <dd>The device will fall back to AP mode. Connect to the "AtticFanSetup" WiFi network and use the web page to reconfigure your WiFi credentials.</dd>
-        <dt>How do I update the firmware?</dt>
-        <dd>Use the "Firmware Update" link in the System &amp; Maintenance section of the web UI.</dd>
-      </dl>
-    </div>
-
-    <div class="content-section help-section" id="api-reference">
-      <h2>API Reference</h2>
-      <p>The controller exposes several API endpoints for programmatic control and integration.</p>
-      <dl>
-        <dt><code>GET /status</code></dt>
-        <dd>Returns a JSON object with the current state of all sensors, the fan, and the controller mode. <br><i>Example Response:</i><br><code>{"firmwareVersion":"0.95","atticTemp":"92.1","fanOn":true,"fanMode":"MANUAL","fanSubMode":"TIMED","timerActive":true,...}</code></dd>
-
-        <dt><code>GET /config</code></dt>
-        <dd>Returns a JSON object with all current configuration settings.<br><i>Example Response:</i><br><code>{"fanOnTemp":90,"fanDeltaTemp":5,"preCoolingEnabled":true,...}</code></dd>
-
-        <dt><code>POST /config</code></dt>
-        <dd>Sets new configuration values. The body must be a JSON object containing one or more of the keys from the GET response. The device will respond with a message indicating whether a restart is required.<br><i>Example with curl:</i><br><code>curl -X POST -d '{"fanOnTemp":92.5}' http://&lt;ip&gt;/config</code></dd>
-
-        <dt><code>GET /weather</code></dt>
-        <dd>Returns a JSON object with the current weather conditions and a 3-day forecast.<br><i>Example Response:</i><br><code>{"currentTemp":"75.3","currentIcon":"☀️","forecast":[...]}</code></dd>
-
-        <dt><code>GET /fan?state=...</code></dt>
-        <dd>Provides basic control.
-          <ul>
-            <li><code>/fan?state=on</code>: Turns the fan on and enters MANUAL mode.</li>
-            <li><code>/fan?state=off</code>: Turns the fan off and enters MANUAL mode.</li>
-            <li><code>/fan?state=auto</code>: Switches the controller to AUTO mode.</li>
-          </ul>
-          <i>Example with curl:</i><br><code>curl http://&lt;ip&gt;/fan?state=on</code>
-        </dd>
-
-        <dt><code>POST /fan</code></dt>
-        <dd>Starts a manual timed run. The body must be a JSON object like the one below.<br><i>Example with curl:</i><br><code>curl -X POST -d '{"action":"start_timed", "duration":30}' http://&lt;ip&gt;/fan</code></dd>
-        <dt><code>GET /history.csv</code></dt>
-        <dd>Downloads the complete sensor history log as a CSV file.</dd>
-        <dt><code>GET /restart</code></dt>
-        <dd>Triggers a software restart of the device.</dd>
-        <dt><code>GET /diagnostics</code></dt>
-        <dd>Downloads the persistent diagnostics log as plain text. This log records device errors and warnings, such as sensor failures and file system issues.</dd>
-      </dl>
-    </div>
-  </div>
-</body>
-</html>)EMB1";
-const size_t HELP_PAGE_LEN = sizeof(HELP_PAGE) - 1;
+// 9552 bytes, gzipped to 3450
+const unsigned char HELP_PAGE[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x5a, 0xdd, 0x72, 0xdb, 0xc6,
+  0x15, 0xbe, 0xcf, 0x53, 0x6c, 0x71, 0x61, 0x4b, 0x33, 0x24, 0x25, 0x59, 0xb6, 0x63, 0xcb, 0x94,
+  0x32, 0x8a, 0x7e, 0x6a, 0x75, 0xec, 0x58, 0xb1, 0xa8, 0xb8, 0x99, 0x4e, 0xc7, 0x59, 0x02, 0x0b,
+  0x62, 0x23, 0x00, 0x8b, 0xee, 0x2e, 0x48, 0xb3, 0x9d, 0xcc, 0xe4, 0x0d, 0x7a, 0xd1, 0x9b, 0x3e,
+  0x46, 0x2f, 0x7b, 0xdd, 0x47, 0xc9, 0x0b, 0xf4, 0x15, 0xfa, 0x9d, 0xdd, 0x05, 0x08, 0x50, 0x94,
+  0xe2, 0xc6, 0xbe, 0x91, 0x09, 0xec, 0xdf, 0xd9, 0xef, 0xfc, 0x7d, 0xe7, 0xc0, 0xe3, 0xdf, 0x9d,
+  0xbe, 0x39, 0x99, 0x7c, 0x7f, 0x79, 0xc6, 0x32, 0x5b, 0xe4, 0x47, 0x5f, 0x8c, 0x9b, 0x7f, 0x04,
+  0x4f, 0x8e, 0xbe, 0x60, 0x6c, 0x6c, 0xa5, 0xcd, 0xc5, 0xd1, 0xb1, 0xb5, 0x32, 0x66, 0xe7, 0xbc,
+  0x64, 0x43, 0xf6, 0x52, 0xe4, 0xd5, 0x78, 0xc7, 0xbf, 0xa7, 0x19, 0x85, 0xb0, 0x9c, 0xc5, 0x19,
+  0xd7, 0x46, 0xd8, 0xc3, 0xe8, 0x7a, 0x72, 0x3e, 0x7c, 0x16, 0xad, 0x06, 0x4a, 0x5e, 0x88, 0xc3,
+  0x68, 0x2e, 0xc5, 0xa2, 0x52, 0xda, 0x46, 0x2c, 0x56, 0xa5, 0x15, 0x25, 0x26, 0x2e, 0x64, 0x62,
+  0xb3, 0xc3, 0x44, 0xcc, 0x65, 0x2c, 0x86, 0xee, 0x61, 0xc0, 0x64, 0x29, 0xad, 0xe4, 0xf9, 0xd0,
+  0xc4, 0x3c, 0x17, 0x87, 0x7b, 0x7e, 0x9b, 0x5c, 0x96, 0x37, 0x4c, 0x8b, 0xfc, 0x30, 0x32, 0x76,
+  0x99, 0x0b, 0x93, 0x09, 0x81, 0x7d, 0x32, 0x2d, 0xd2, 0xc3, 0x88, 0x93, 0x5c, 0x29, 0x2f, 0x47,
+  0xb1, 0x31, 0x5f, 0xcd, 0x0f, 0xc5, 0xd3, 0x2f, 0x13, 0xf1, 0x74, 0xf7, 0xe9, 0xf4, 0x4b, 0xf1,
+  0xe4, 0xc9, 0xde, 0xfe, 0xee, 0xfa, 0x06, 0x12, 0xa7, 0x47, 0xcc, 0x2e, 0x2b, 0x88, 0x24, 0x0b,
+  0x3e, 0x13, 0x3b, 0x55, 0x39, 0x6b, 0xf6, 0x4a, 0xf9, 0x9c, 0xc6, 0x47, 0x78, 0x85, 0xad, 0x9e,
+  0xee, 0x4d, 0x77, 0xd3, 0x7d, 0xfe, 0x78, 0x7f, 0x6f, 0xba, 0x9f, 0x3e, 0xda, 0xdf, 0xdf, 0xbc,
+  0x55, 0x7f, 0x25, 0xfe, 0x6c, 0x5e, 0x39, 0xde, 0xf1, 0x78, 0x8e, 0xa7, 0x2a, 0x59, 0xba, 0x8d,
+  0x12, 0x39, 0x67, 0x71, 0xce, 0x8d, 0x39, 0x8c, 0x2a, 0xc8, 0x31, 0x24, 0x58, 0xb8, 0x2c, 0x85,
+  0x76, 0xe7, 0x60, 0x42, 0xb6, 0x77, 0x44, 0x40, 0xb3, 0x07, 0xbc, 0xa8, 0x5e, 0xb0, 0x53, 0x15,
+  0xd7, 0x05, 0x60, 0xe3, 0x56, 0xaa, 0x12, 0xbb, 0xed, 0x85, 0x59, 0x3c, 0x48, 0xb0, 0x13, 0x35,
+  0xbb, 0x4d, 0x79, 0x7c, 0x33, 0x24, 0x31, 0xa3, 0xa3, 0x07, 0x39, 0xd7, 0xfa, 0x05, 0xfb, 0x1a,
+  0x6f, 0x98, 0x55, 0xec, 0x35, 0xf6, 0x67, 0x27, 0x38, 0x47, 0xab, 0x9c, 0x5d, 0xe2, 0xd0, 0xf1,
+  0x0e, 0x3f, 0xfa, 0xc2, 0xef, 0xd3, 0x11, 0x27, 0x28, 0x68, 0x68, 0x44, 0x4c, 0x87, 0xb1, 0x0c,
+  0x52, 0x34, 0x0f, 0x11, 0x93, 0xc9, 0x61, 0x54, 0xa8, 0xc4, 0x0b, 0x8c, 0x8d, 0x82, 0xb8, 0x24,
+  0xf0, 0xa3, 0xa3, 0xd7, 0x18, 0x68, 0x4e, 0x80, 0x90, 0x8f, 0xda, 0xb1, 0xea, 0x68, 0x92, 0x49,
+  0xc3, 0x2a, 0x5e, 0x8a, 0x9c, 0x85, 0x95, 0x86, 0xd9, 0x4c, 0xb0, 0x4a, 0x43, 0x0f, 0x7a, 0xc9,
+  0x54, 0x25, 0xb4, 0xbb, 0x1c, 0xcf, 0x19, 0xed, 0xcf, 0x54, 0xea, 0xc6, 0x49, 0xb7, 0xe3, 0x9d,
+  0xaa, 0xdd, 0x29, 0xc9, 0x9b, 0x9f, 0xf4, 0x60, 0x8f, 0x8e, 0xaf, 0x27, 0x6f, 0xc6, 0x3b, 0xf8,
+  0xd1, 0x79, 0x9b, 0xf8, 0xd3, 0x64, 0xff, 0x84, 0x08, 0xe6, 0xc9, 0x78, 0x99, 0xb0, 0x54, 0xe9,
+  0x19, 0x59, 0x10, 0x1d, 0x33, 0x62, 0x13, 0x7f, 0x08, 0x5b, 0xc8, 0x3c, 0x67, 0xbc, 0xb6, 0xaa,
+  0x80, 0x18, 0x30, 0xbf, 0x7c, 0xc9, 0x6c, 0xad, 0x4b, 0x06, 0x04, 0x68, 0x91, 0x4a, 0x53, 0x36,
+  0xe5, 0x46, 0x24, 0xf4, 0x82, 0xb6, 0xb5, 0xa2, 0x70, 0x22, 0xd7, 0x5a, 0x30, 0xec, 0x6c, 0x65,
+  0x39, 0x33, 0x6e, 0x66, 0xa5, 0x09, 0x1c, 0x05, 0x15, 0xcc, 0x58, 0xae, 0x66, 0x32, 0x86, 0xfc,
+  0x49, 0xd2, 0x97, 0xfa, 0xf5, 0xf1, 0x37, 0xd7, 0xc7, 0xaf, 0xee, 0x90, 0xdb, 0x5d, 0x7f, 0x26,
+  0xe7, 0xc2, 0xb0, 0xa5, 0xaa, 0x59, 0x22, 0x35, 0xc0, 0x6f, 0x50, 0x63, 0x6a, 0x2e, 0x74, 0x8b,
+  0x0c, 0xbb, 0x20, 0x61, 0xc2, 0x9a, 0x81, 0x9b, 0x1e, 0xe3, 0x2e, 0x4e, 0xf0, 0x30, 0x07, 0xf2,
+  0x0e, 0x48, 0x7a, 0xfc, 0xd1, 0xcc, 0x58, 0xae, 0x01, 0x02, 0xb3, 0xb2, 0xc0, 0x4d, 0x74, 0x5d,
+  0xfa, 0xfb, 0xb7, 0xd7, 0xf6, 0x02, 0x13, 0x72, 0x89, 0x34, 0x7c, 0x9a, 0x8b, 0xa4, 0x27, 0x3c,
+  0x7e, 0x07, 0xf8, 0xf1, 0x4b, 0xce, 0x7f, 0x9b, 0xf1, 0xf0, 0xb2, 0x86, 0x87, 0x93, 0x04, 0xba,
+  0x6f, 0x3c, 0x6e, 0x80, 0x4d, 0x68, 0xe0, 0x96, 0xf1, 0x08, 0x16, 0x5d, 0x41, 0x7d, 0x6e, 0x30,
+  0x62, 0xd3, 0xda, 0x5a, 0x6c, 0xbe, 0xc5, 0xe7, 0x5c, 0xe6, 0x24, 0x26, 0x02, 0x07, 0xf3, 0x98,
+  0x3a, 0x24, 0xb6, 0x19, 0xf4, 0xa7, 0x16, 0x1e, 0x3f, 0x58, 0x3e, 0x2e, 0xda, 0xc2, 0x01, 0xed,
+  0x03, 0x00, 0x53, 0x89, 0x58, 0xa6, 0xb8, 0x6a, 0x52, 0x7b, 0xb3, 0x1b, 0xc0, 0x00, 0x6c, 0xc6,
+  0x08, 0xaf, 0x2a, 0x98, 0x61, 0x22, 0x72, 0xbe, 0x04, 0x4c, 0x0e, 0xb4, 0x7b, 0x8d, 0xf0, 0x94,
+  0x66, 0xb2, 0x2b, 0x9a, 0xb7, 0x49, 0xa7, 0x82, 0x95, 0x75, 0x31, 0x85, 0xda, 0x60, 0xd3, 0x85,
+  0x2c, 0x6b, 0x0b, 0xcd, 0x42, 0xaa, 0x05, 0x97, 0x96, 0x4d, 0x05, 0x04, 0x12, 0xad, 0x74, 0xa4,
+  0x39, 0x03, 0x95, 0x6d, 0xb0, 0x99, 0xb7, 0xb8, 0xc4, 0x69, 0x90, 0xf6, 0xa3, 0x4f, 0xe9, 0x1a,
+  0x37, 0xa1, 0xc0, 0x53, 0x1b, 0xcc, 0xc7, 0xdd, 0x8e, 0xc1, 0x84, 0xa5, 0x4a, 0x98, 0x28, 0x13,
+  0xb3, 0xe1, 0xc8, 0x63, 0x3f, 0x9b, 0x40, 0x77, 0x53, 0x6e, 0x1f, 0x7b, 0x92, 0x29, 0x65, 0x04,
+  0x5b, 0x64, 0xdc, 0xba, 0x5d, 0x83, 0x95, 0xe6, 0x58, 0x60, 0x32, 0x55, 0xe7, 0x09, 0x4b, 0x54,
+  0xe7, 0xd0, 0xd6, 0xee, 0xc8, 0xc4, 0x62, 0x55, 0x54, 0xb9, 0xb0, 0xf0, 0xc1, 0x0b, 0xeb, 0xcc,
+  0x56, 0x40, 0x03, 0x98, 0xa8, 0x05, 0x4c, 0xdc, 0x12, 0x42, 0xe4, 0xdc, 0x21, 0x1a, 0x38, 0xdb,
+  0x5d, 0xae, 0xe9, 0xd9, 0xeb, 0xac, 0x35, 0xf4, 0x34, 0xfd, 0xec, 0xd6, 0x4a, 0x5e, 0x3e, 0x6c,
+  0xdc, 0xbb, 0x67, 0xae, 0x94, 0x0b, 0x27, 0x18, 0x6d, 0x23, 0xea, 0x55, 0x98, 0x75, 0xdb, 0x76,
+  0x4d, 0x27, 0x42, 0xa4, 0x88, 0xf1, 0x43, 0x5b, 0x97, 0x5e, 0xe5, 0x2b, 0xc7, 0xa3, 0x0b, 0x4c,
+  0x45, 0x86, 0x44, 0xa2, 0xf4, 0xbd, 0xb6, 0xf6, 0xc6, 0x1f, 0xbb, 0xd9, 0x02, 0x9a, 0x58, 0xe7,
+  0xd2, 0x62, 0x2f, 0x44, 0x41, 0x3f, 0x8b, 0x4c, 0xc6, 0x2b, 0xb4, 0xa0, 0x00, 0xe7, 0x24, 0xd0,
+  0x07, 0x90, 0x0e, 0xa1, 0x6e, 0x80, 0x1d, 0xd4, 0x5c, 0x26, 0x14, 0xe6, 0x9c, 0x2e, 0x80, 0x50,
+  0x22, 0x09, 0x0e, 0xcc, 0xc6, 0x2e, 0xc8, 0xe8, 0x1b, 0xcc, 0x04, 0xe6, 0x8f, 0x44, 0xbf, 0x59,
+  0xaa, 0x63, 0x16, 0xeb, 0x3a, 0x46, 0x4e, 0x67, 0x22, 0x85, 0xbf, 0x49, 0x51, 0xc6, 0xcb, 0x06,
+  0x8d, 0xb5, 0xe0, 0xab, 0x4a, 0xc4, 0xdc, 0xb1, 0x01, 0x98, 0xe5, 0xec, 0xa8, 0x1b, 0x7b, 0x9d,
+  0xe6, 0xc9, 0xe8, 0xc3, 0x18, 0x93, 0x3e, 0x37, 0xf8, 0x5b, 0xe2, 0x22, 0x99, 0xb2, 0xde, 0xc2,
+  0xb8, 0xf7, 0x73, 0x55, 0xdb, 0x44, 0x29, 0x6d, 0xd8, 0x94, 0xa0, 0x60, 0xb9, 0xe0, 0xc6, 0x86,
+  0x38, 0xc9, 0xcb, 0x25, 0x4c, 0x7f, 0xa6, 0x85, 0x30, 0x74, 0x3c, 0x5e, 0x89, 0xd2, 0x00, 0x20,
+  0xd3, 0x07, 0x66, 0xc1, 0x97, 0x48, 0x57, 0x75, 0xee, 0xa2, 0x38, 0x8c, 0xce, 0xc8, 0x59, 0x49,
+  0xf1, 0x82, 0x97, 0x16, 0x42, 0x52, 0x78, 0xc7, 0x79, 0x5c, 0x6a, 0x27, 0x9f, 0x93, 0xde, 0x09,
+  0x0c, 0x87, 0xa6, 0x44, 0x11, 0xe4, 0x0b, 0x62, 0xf4, 0xf4, 0xa0, 0xa5, 0x71, 0xde, 0xaf, 0x60,
+  0x83, 0xe4, 0x39, 0x84, 0x7d, 0x7b, 0x95, 0xce, 0xc4, 0x0d, 0x30, 0xbf, 0x5c, 0x1a, 0xdc, 0x52,
+  0x18, 0x69, 0xee, 0x48, 0x1c, 0xb1, 0x16, 0x9c, 0xbc, 0x9e, 0xb3, 0x88, 0xa4, 0x19, 0x42, 0x94,
+  0xa8, 0x77, 0xb8, 0x25, 0x37, 0xc5, 0x44, 0x52, 0x7b, 0x07, 0xae, 0x30, 0xbb, 0xec, 0x4d, 0x26,
+  0x53, 0x80, 0x23, 0x96, 0xa4, 0xa8, 0x55, 0xf0, 0xd4, 0xaa, 0x60, 0x9a, 0x57, 0x32, 0x01, 0x0a,
+  0x06, 0xde, 0x17, 0x67, 0x34, 0xdc, 0xc9, 0x91, 0x5b, 0x37, 0xa5, 0x5a, 0xe0, 0xd1, 0xb0, 0x28,
+  0x5e, 0xc6, 0x04, 0x5f, 0xb4, 0x0d, 0xcb, 0x13, 0xe5, 0xe6, 0x6b, 0x7a, 0xed, 0xc1, 0xdf, 0x69,
+  0x1b, 0xae, 0x55, 0x8d, 0x6d, 0x68, 0x22, 0x2c, 0xa4, 0x52, 0xb2, 0xb4, 0x23, 0x76, 0x0e, 0x00,
+  0xc5, 0x07, 0x4e, 0xa1, 0x62, 0x40, 0xc0, 0x3e, 0x0c, 0x0e, 0xf0, 0x90, 0x96, 0x3e, 0xdf, 0xfd,
+  0xcf, 0xbf, 0xce, 0xdd, 0xd9, 0x0f, 0x57, 0xe8, 0xb8, 0x91, 0x47, 0x18, 0x18, 0xf4, 0xe3, 0x5f,
+  0x6b, 0x52, 0x36, 0xac, 0x43, 0x1a, 0xf1, 0x23, 0xa5, 0xb2, 0x61, 0x14, 0x37, 0xa8, 0x71, 0xe5,
+  0xbc, 0x23, 0x2d, 0x29, 0x1b, 0xf9, 0x90, 0x6e, 0x05, 0x65, 0x3d, 0x7b, 0x86, 0x95, 0x9b, 0x94,
+  0x23, 0x8d, 0x55, 0xf0, 0xbc, 0x57, 0x6a, 0x86, 0xa4, 0x0c, 0x49, 0xe6, 0x3c, 0xbf, 0xad, 0xa6,
+  0x97, 0x6a, 0x81, 0x33, 0x10, 0x73, 0xd8, 0x16, 0x8c, 0x2a, 0x44, 0xe9, 0x6d, 0xda, 0x17, 0x89,
+  0x17, 0x97, 0x2e, 0x0d, 0x6e, 0x9b, 0x85, 0xad, 0x82, 0x69, 0x78, 0x86, 0x3c, 0x62, 0xa7, 0x22,
+  0xe5, 0x75, 0xee, 0xf4, 0xf7, 0xa4, 0x59, 0x3a, 0x62, 0x6f, 0x79, 0x39, 0x13, 0x07, 0x6c, 0xef,
+  0x97, 0x9f, 0xff, 0xb1, 0xf7, 0xf8, 0xf1, 0x2e, 0xdb, 0x7a, 0xf4, 0x18, 0x80, 0xd6, 0xda, 0x6c,
+  0x8f, 0x20, 0x0b, 0xa9, 0x19, 0x82, 0xd4, 0x30, 0x8a, 0xe0, 0xd8, 0x2e, 0x00, 0xe9, 0xe1, 0x4c,
+  0x13, 0xd9, 0x4c, 0xda, 0xb3, 0x08, 0x8a, 0x1a, 0xe6, 0x58, 0x50, 0x32, 0xa2, 0x57, 0xa0, 0x87,
+  0x9f, 0x3d, 0x98, 0x76, 0x98, 0x51, 0x2f, 0x94, 0x5e, 0xe2, 0xfd, 0x49, 0x60, 0x4c, 0xaf, 0x88,
+  0x80, 0xac, 0x85, 0xd0, 0xcb, 0x0e, 0xa3, 0x22, 0xef, 0x64, 0xa6, 0x20, 0x1a, 0x93, 0x8a, 0x8e,
+  0x55, 0xd7, 0x26, 0xb8, 0x70, 0x02, 0x4a, 0xb0, 0x64, 0x0b, 0x8c, 0x51, 0xfc, 0xa2, 0xe4, 0x1a,
+  0x3b, 0xef, 0x57, 0x6c, 0x46, 0xfc, 0x8f, 0x11, 0x11, 0x0f, 0x3c, 0x08, 0x42, 0x36, 0xdb, 0xae,
+  0xd4, 0x8d, 0x97, 0x30, 0xc7, 0x25, 0xc5, 0x14, 0xec, 0xb5, 0x34, 0xf7, 0x06, 0xe3, 0x46, 0x72,
+  0x36, 0xd1, 0x72, 0x36, 0x23, 0xde, 0xb2, 0xae, 0xf1, 0x8b, 0x40, 0x63, 0x83, 0x1c, 0x0e, 0xf2,
+  0x59, 0xe6, 0x58, 0x88, 0x97, 0x76, 0xe9, 0xae, 0x64, 0x29, 0xc3, 0xf1, 0x29, 0x3c, 0xc1, 0xc7,
+  0xa9, 0x9e, 0x23, 0x7a, 0x16, 0xbb, 0xc6, 0x2a, 0x03, 0x61, 0x05, 0xbc, 0x73, 0x38, 0xfd, 0x06,
+  0x8b, 0x6c, 0x65, 0x7b, 0x93, 0xa6, 0x70, 0xa7, 0xdb, 0xa2, 0xbd, 0x23, 0xaf, 0xac, 0xd6, 0xb0,
+  0xa5, 0xfd, 0xc2, 0x91, 0xe3, 0x18, 0x29, 0x76, 0x95, 0x6f, 0xdc, 0x13, 0x0b, 0xb2, 0xc1, 0x40,
+  0x34, 0xe1, 0xec, 0x22, 0x09, 0x2e, 0x85, 0x40, 0xeb, 0xe4, 0xe6, 0x05, 0x5c, 0x78, 0x83, 0xd7,
+  0x86, 0x5d, 0xfa, 0x3e, 0x4b, 0x87, 0x78, 0xe1, 0x9c, 0x51, 0xdf, 0xf6, 0xd8, 0x40, 0x57, 0x2d,
+  0x7b, 0x46, 0x83, 0xa4, 0x9a, 0x46, 0x2b, 0x03, 0x67, 0x5e, 0x4e, 0x73, 0xaa, 0x09, 0x54, 0x1d,
+  0x25, 0xfa, 0x38, 0x25, 0xb8, 0x0f, 0x4f, 0xe2, 0x83, 0xd5, 0xa2, 0xe8, 0x51, 0x76, 0xf3, 0xd9,
+  0x8d, 0x3b, 0x58, 0xe3, 0xd0, 0xaa, 0xd9, 0x0c, 0x45, 0x6a, 0x9f, 0x2b, 0x04, 0x4b, 0x9d, 0xf8,
+  0xb1, 0xcd, 0x0c, 0xc1, 0x45, 0x53, 0x61, 0x56, 0x44, 0xbf, 0xe1, 0xa1, 0x61, 0x67, 0xd3, 0x94,
+  0x44, 0x2b, 0x8e, 0x75, 0xaf, 0x6d, 0x9e, 0x95, 0x8e, 0x19, 0x77, 0x9c, 0x6b, 0x33, 0x67, 0x28,
+  0xc8, 0x2c, 0x75, 0x38, 0xbf, 0xe5, 0x02, 0x74, 0x10, 0x05, 0x7f, 0xdd, 0x37, 0xbd, 0xc6, 0xe7,
+  0x00, 0x81, 0xd2, 0xb7, 0x18, 0x57, 0xef, 0x60, 0xd0, 0x61, 0x5b, 0x1b, 0xf6, 0xea, 0xec, 0x74,
+  0x03, 0x6d, 0xec, 0x96, 0x80, 0xaa, 0x9c, 0x2a, 0xae, 0x9d, 0x53, 0xd2, 0x82, 0x1c, 0xfe, 0x61,
+  0x9b, 0x2a, 0xab, 0x09, 0x7e, 0xdf, 0x83, 0xc8, 0x17, 0xf0, 0x95, 0x85, 0x34, 0x5d, 0x19, 0xa5,
+  0xe9, 0xe6, 0xdb, 0x29, 0x95, 0xbd, 0xce, 0x41, 0xdc, 0x16, 0x54, 0x02, 0x22, 0xda, 0xb3, 0xb9,
+  0x34, 0x92, 0x04, 0xca, 0x55, 0xec, 0xc8, 0xf3, 0xdd, 0x22, 0x9f, 0xba, 0xd8, 0xf1, 0x56, 0x98,
+  0xcd, 0x4c, 0xfe, 0xb8, 0x57, 0x1d, 0x6a, 0x3f, 0xcd, 0x74, 0xe4, 0x84, 0xd4, 0xf8, 0x23, 0x5c,
+  0xfc, 0x68, 0xe2, 0x70, 0x60, 0x19, 0x2e, 0x6e, 0x4d, 0xb1, 0x64, 0x58, 0x69, 0x72, 0x32, 0xcc,
+  0x6b, 0xe3, 0x97, 0x0a, 0x1c, 0x04, 0x12, 0x96, 0xb3, 0x21, 0x94, 0x51, 0x10, 0x16, 0x53, 0x99,
+  0x4b, 0xbb, 0xc4, 0x72, 0x10, 0xe8, 0xb9, 0x92, 0x09, 0x2e, 0x83, 0x21, 0x5d, 0x57, 0x2e, 0x23,
+  0xf3, 0x36, 0x74, 0x51, 0x9a, 0x0d, 0x1e, 0x1b, 0x44, 0xf2, 0xce, 0x33, 0x85, 0x4d, 0xf1, 0x54,
+  0xe4, 0xcb, 0xb6, 0x90, 0xf1, 0x99, 0x6d, 0xc5, 0xc6, 0xc9, 0xcf, 0x32, 0x64, 0x6a, 0x02, 0x53,
+  0x24, 0xf7, 0x6b, 0xf3, 0xf5, 0xb7, 0x93, 0xc9, 0x6d, 0x44, 0xfc, 0xa0, 0x87, 0x80, 0x66, 0xc0,
+  0x5d, 0xc0, 0xf0, 0xec, 0x20, 0x70, 0xcd, 0x50, 0x85, 0xad, 0x15, 0x06, 0xb8, 0x2f, 0x5d, 0x05,
+  0x29, 0xc8, 0x06, 0x06, 0xff, 0x52, 0xc1, 0x3b, 0x8f, 0x0d, 0x72, 0xb7, 0x05, 0xc1, 0x72, 0x96,
+  0xe5, 0xa2, 0x37, 0x6d, 0x39, 0xa4, 0x32, 0x01, 0xa0, 0x93, 0x10, 0x3e, 0xee, 0x67, 0x34, 0xdb,
+  0x50, 0xba, 0x2f, 0x28, 0x01, 0x8a, 0xbf, 0xd4, 0x92, 0xbc, 0xc3, 0x9d, 0x3f, 0xd5, 0xea, 0x06,
+  0x0b, 0x13, 0x61, 0xa1, 0x4a, 0x57, 0x65, 0x4d, 0x1d, 0x99, 0x20, 0x4b, 0xf0, 0xf1, 0x0c, 0x4e,
+  0xab, 0x85, 0x35, 0xa3, 0x2c, 0x44, 0xb4, 0xbb, 0xaf, 0x3c, 0x01, 0x9a, 0x8c, 0x5a, 0x1a, 0xf7,
+  0xdf, 0x3b, 0x72, 0xf3, 0x2e, 0xa9, 0xb5, 0x11, 0xb1, 0x50, 0x06, 0x4d, 0x41, 0x48, 0x11, 0x81,
+  0x82, 0xc3, 0x16, 0xd4, 0x78, 0xa1, 0x2e, 0x4f, 0x83, 0x4b, 0x68, 0xf6, 0x18, 0x66, 0x72, 0xa4,
+  0x64, 0xed, 0xe4, 0x34, 0xb2, 0xa8, 0x73, 0x42, 0x24, 0xb0, 0x00, 0x9f, 0xb6, 0x83, 0xf5, 0xf4,
+  0xcb, 0x59, 0x2b, 0x8c, 0x6d, 0x14, 0xf8, 0xd0, 0xb4, 0x45, 0x04, 0x5c, 0xa6, 0xc9, 0x0c, 0x16,
+  0xa6, 0x67, 0x59, 0x29, 0x44, 0x42, 0x16, 0x52, 0x65, 0x4b, 0x43, 0x46, 0x1b, 0xb6, 0x36, 0xae,
+  0x9a, 0x6a, 0x0a, 0x60, 0x51, 0xce, 0x25, 0x58, 0xb5, 0x6b, 0x2e, 0xe5, 0x1d, 0xbe, 0xff, 0xd9,
+  0x03, 0x64, 0xa0, 0x1a, 0xbd, 0xc0, 0xd8, 0xb0, 0xa6, 0x93, 0x8c, 0x14, 0xeb, 0x5b, 0x5d, 0x27,
+  0x57, 0xdf, 0x11, 0x0b, 0xd8, 0xd0, 0x02, 0x68, 0x6a, 0x83, 0xb0, 0x6a, 0x55, 0x0f, 0x34, 0x87,
+  0x86, 0xa0, 0xd1, 0xe2, 0x4d, 0x35, 0xe8, 0x82, 0x1c, 0x2f, 0x76, 0xfb, 0x43, 0x1d, 0xb7, 0x08,
+  0xe8, 0x60, 0x13, 0x4b, 0x1f, 0xb8, 0xf4, 0x94, 0xd5, 0x85, 0x04, 0x18, 0xcb, 0xd0, 0x72, 0x41,
+  0xe9, 0x1a, 0xb4, 0x91, 0x70, 0x94, 0x3b, 0x8e, 0x46, 0x23, 0xe7, 0x27, 0xa4, 0x73, 0xf2, 0xc6,
+  0x32, 0x95, 0x33, 0x94, 0xe7, 0xbe, 0x1b, 0xe1, 0x09, 0x20, 0xdb, 0x4a, 0x3c, 0x69, 0x3b, 0x58,
+  0x51, 0xb6, 0xed, 0x50, 0xd2, 0x28, 0x4a, 0x9b, 0x2e, 0x3e, 0xd1, 0x85, 0x53, 0x99, 0x8b, 0x4d,
+  0x31, 0x8f, 0xca, 0x62, 0x9e, 0xfc, 0x58, 0x07, 0x85, 0xd3, 0x89, 0xbe, 0x22, 0x09, 0x07, 0xc8,
+  0xb2, 0xf1, 0x2e, 0x7f, 0xba, 0x83, 0xa1, 0x81, 0x83, 0x48, 0x86, 0xa3, 0x7b, 0xa4, 0xf0, 0x58,
+  0x51, 0x83, 0x76, 0xc5, 0x2e, 0xbd, 0x8b, 0xf4, 0x32, 0x48, 0xdd, 0xcd, 0x20, 0xb9, 0x3c, 0x6a,
+  0xf0, 0x76, 0xda, 0x39, 0x58, 0xc1, 0xfd, 0x9d, 0x34, 0x35, 0xcf, 0xe5, 0x5f, 0xe1, 0x00, 0x60,
+  0x35, 0x2e, 0xf3, 0x6a, 0x6a, 0x0f, 0xb0, 0xad, 0xba, 0x22, 0xfb, 0xdc, 0xdb, 0xdd, 0x65, 0x8e,
+  0xbd, 0xe3, 0xb2, 0x24, 0x03, 0x1c, 0x34, 0xbe, 0xc1, 0xb5, 0x79, 0x0e, 0x3b, 0x34, 0xbe, 0xea,
+  0xab, 0x6a, 0x5d, 0x91, 0x47, 0x67, 0x9c, 0x8a, 0x4d, 0xd4, 0x96, 0x7c, 0xcd, 0x77, 0x24, 0x0c,
+  0x31, 0x76, 0xe5, 0x4c, 0x5b, 0x3d, 0x38, 0x5e, 0xc0, 0x43, 0x7b, 0x04, 0xf2, 0x6d, 0x14, 0xf6,
+  0x14, 0x44, 0x3d, 0x57, 0x3c, 0xe9, 0xc8, 0x7b, 0x92, 0xd3, 0xf9, 0x63, 0x51, 0xb4, 0x83, 0xac,
+  0x31, 0xbc, 0x2d, 0x80, 0xbf, 0x3d, 0xde, 0xc1, 0x50, 0x03, 0xe5, 0x95, 0x0b, 0x2c, 0xc1, 0x16,
+  0xa9, 0x65, 0x0a, 0xb3, 0xe6, 0x14, 0xd6, 0x1b, 0x54, 0xc9, 0x57, 0xf9, 0x5c, 0x04, 0xdc, 0x7d,
+  0x0b, 0xc3, 0xd1, 0xf7, 0xd4, 0x67, 0x44, 0x04, 0x65, 0x41, 0x74, 0xb4, 0x27, 0xe3, 0x78, 0x67,
+  0x05, 0x6e, 0xb0, 0x66, 0xa7, 0x76, 0xa5, 0x0b, 0x57, 0x92, 0x1d, 0x84, 0xe8, 0x44, 0x56, 0x86,
+  0x20, 0x58, 0x54, 0x03, 0x67, 0xa9, 0xef, 0xc9, 0x28, 0x07, 0xc1, 0x42, 0xfd, 0x43, 0x63, 0x95,
+  0x03, 0xa0, 0xf1, 0x9e, 0x8a, 0x62, 0xb7, 0xae, 0x55, 0xe3, 0x27, 0xb4, 0x3a, 0x50, 0x7d, 0x51,
+  0x50, 0xcb, 0x94, 0xb2, 0xeb, 0x0c, 0x7d, 0xd2, 0x1f, 0x0b, 0xe8, 0x9c, 0x1f, 0x7f, 0xdb, 0xf3,
+  0xd2, 0x75, 0x06, 0xf2, 0x2e, 0x5b, 0x52, 0xfb, 0xe7, 0x02, 0xd0, 0x09, 0x62, 0xed, 0x92, 0xc0,
+  0xd2, 0xec, 0xfa, 0x22, 0xe4, 0xa0, 0x14, 0xa2, 0x11, 0x41, 0xfb, 0x6a, 0x33, 0x31, 0x09, 0x39,
+  0x35, 0xb8, 0x90, 0x0b, 0x92, 0xdc, 0xa7, 0xf6, 0x85, 0xa0, 0xbf, 0x03, 0x26, 0x8a, 0xa9, 0x48,
+  0xc8, 0x7e, 0xae, 0x2f, 0x5c, 0x9e, 0xa4, 0x0a, 0xc6, 0x19, 0x0a, 0x0a, 0xf7, 0x61, 0x48, 0xaf,
+  0x34, 0xc8, 0xb6, 0x5c, 0x9a, 0x69, 0x4c, 0xdf, 0x45, 0x03, 0xac, 0xb6, 0xf1, 0x68, 0xdb, 0x37,
+  0x4d, 0x0b, 0x72, 0x30, 0x4a, 0x13, 0x5e, 0x0b, 0xd7, 0x57, 0x67, 0xef, 0xcf, 0xaf, 0xde, 0xbf,
+  0x3b, 0xfb, 0xfa, 0xfa, 0xa2, 0x21, 0xbe, 0x38, 0xdd, 0x0f, 0xee, 0xb5, 0x54, 0xb8, 0x13, 0x6d,
+  0xcc, 0x8d, 0x20, 0xf6, 0x44, 0xae, 0x5d, 0x57, 0xce, 0xc2, 0x68, 0xe8, 0x07, 0x8a, 0x14, 0x3f,
+  0x40, 0xcb, 0x79, 0xe2, 0xf3, 0xde, 0xca, 0xbd, 0x1f, 0x1a, 0xe7, 0xf3, 0x3e, 0x8d, 0x6d, 0xaa,
+  0x27, 0x51, 0x29, 0x3a, 0xec, 0xe0, 0x61, 0x2e, 0xfe, 0xbc, 0x93, 0xe7, 0xb2, 0x21, 0x3a, 0x01,
+  0x99, 0xb4, 0xc9, 0x71, 0x50, 0x6e, 0x09, 0x55, 0xde, 0x8f, 0xa3, 0x23, 0x05, 0x29, 0x27, 0x66,
+  0x10, 0x3e, 0x08, 0x1c, 0x5f, 0x86, 0x1e, 0xf8, 0x89, 0x5f, 0xdf, 0x48, 0x18, 0xb9, 0xaf, 0x3d,
+  0xe7, 0xbc, 0xbc, 0x12, 0xb6, 0xae, 0x22, 0x7f, 0x74, 0x29, 0xec, 0x42, 0xe9, 0x1b, 0x7f, 0xc5,
+  0x80, 0xf3, 0x42, 0x4c, 0x7d, 0x9c, 0xa5, 0x1e, 0xab, 0x68, 0x82, 0x90, 0x20, 0x48, 0x83, 0xc0,
+  0xc8, 0xb5, 0x09, 0xd1, 0x48, 0x9e, 0x9b, 0xfb, 0x2e, 0x59, 0x57, 0x09, 0xa5, 0x3e, 0xa7, 0x3b,
+  0xa9, 0x8b, 0x05, 0xe2, 0xc1, 0x86, 0xcb, 0x5c, 0x87, 0x63, 0xa3, 0xf3, 0x30, 0x87, 0x5d, 0xbb,
+  0x75, 0x11, 0x73, 0x9f, 0x65, 0x3e, 0xd6, 0x81, 0x43, 0x56, 0x26, 0xe1, 0x61, 0x37, 0x9f, 0x3b,
+  0xcd, 0xf1, 0x4a, 0x0e, 0xb5, 0x48, 0x51, 0x15, 0xe1, 0xcc, 0x9e, 0x13, 0x1d, 0x5f, 0x5e, 0x80,
+  0xad, 0x84, 0x91, 0x0d, 0xe9, 0xad, 0x43, 0x91, 0xc4, 0x87, 0x4a, 0x51, 0x41, 0x6b, 0x88, 0x4b,
+  0x22, 0xcc, 0xd3, 0x52, 0x44, 0x58, 0x1f, 0x54, 0x5d, 0xa0, 0x41, 0x39, 0x0f, 0x02, 0x55, 0xf8,
+  0xe6, 0x61, 0x53, 0x32, 0x90, 0x6e, 0x1a, 0x6a, 0xe5, 0x89, 0xee, 0xdd, 0xe5, 0x81, 0x37, 0xe6,
+  0xdf, 0x9f, 0x4d, 0xd8, 0x8e, 0x27, 0xde, 0x6d, 0x24, 0x59, 0x87, 0xfd, 0xad, 0xf0, 0x5d, 0x69,
+  0xce, 0xfe, 0x70, 0xf5, 0xe6, 0x1b, 0xa6, 0xa6, 0x3f, 0x92, 0xad, 0xb4, 0xad, 0xd7, 0xb8, 0xd6,
+  0x9a, 0x72, 0x00, 0xed, 0xe2, 0x3e, 0xdb, 0x90, 0x89, 0x05, 0xa6, 0xd1, 0xd6, 0x73, 0x83, 0xb6,
+  0xe0, 0xeb, 0xdc, 0xd2, 0x1b, 0xdf, 0x78, 0xaa, 0x8f, 0xc6, 0xf2, 0xe8, 0xcc, 0x57, 0x8b, 0xc4,
+  0xbe, 0x2b, 0xd0, 0x0f, 0x81, 0xf8, 0x8d, 0xa0, 0x4e, 0x63, 0x4e, 0xac, 0xbf, 0x45, 0x8d, 0x61,
+  0x7c, 0x07, 0xc2, 0x44, 0x68, 0x1f, 0x44, 0xbb, 0xa3, 0xe7, 0x4f, 0xa2, 0x81, 0xff, 0x06, 0x48,
+  0xd5, 0x25, 0x5e, 0x3d, 0x7f, 0x34, 0xda, 0xc3, 0x2b, 0x9c, 0xf8, 0x06, 0x33, 0xac, 0xae, 0x85,
+  0x7b, 0x20, 0x16, 0x87, 0x51, 0xdf, 0x3a, 0xf6, 0xe3, 0x57, 0xf5, 0x34, 0xbc, 0x9d, 0x5c, 0xbc,
+  0x3e, 0x3b, 0xc5, 0x4b, 0xd7, 0xe7, 0x3e, 0x76, 0x05, 0x70, 0x58, 0x3a, 0x1a, 0x8d, 0x7e, 0x5a,
+  0xc1, 0x92, 0x04, 0x7b, 0xd8, 0x80, 0xa0, 0x37, 0xfd, 0xdf, 0x82, 0x20, 0x81, 0xd5, 0x20, 0xb8,
+  0x9e, 0xc5, 0x7d, 0xcb, 0x78, 0xf4, 0xd1, 0x00, 0xd1, 0xa5, 0x3d, 0x0e, 0xcf, 0x77, 0xdd, 0x1d,
+  0x5d, 0x63, 0xd6, 0xbf, 0x79, 0x32, 0xa0, 0xf6, 0x4b, 0x28, 0x04, 0x3d, 0x7d, 0x4d, 0xfe, 0x8f,
+  0x5b, 0x5e, 0xbe, 0xb9, 0xfa, 0xf5, 0x6b, 0x22, 0x5c, 0x18, 0xc4, 0x89, 0xc5, 0xda, 0x45, 0x56,
+  0x4c, 0x96, 0x92, 0x7b, 0xb2, 0xf4, 0xd1, 0x76, 0x2a, 0xd6, 0xe0, 0x08, 0xa4, 0xd8, 0xf7, 0x13,
+  0x5d, 0xc7, 0xdf, 0x35, 0xa3, 0x82, 0xb7, 0xde, 0x88, 0xa5, 0xf1, 0x65, 0x3d, 0x3d, 0x11, 0xe8,
+  0x3a, 0xe0, 0xe0, 0x37, 0xee, 0x06, 0x39, 0x3f, 0x92, 0x04, 0x80, 0x19, 0x32, 0xaa, 0xa1, 0x20,
+  0x15, 0x18, 0x05, 0x1d, 0x00, 0x4a, 0xe1, 0x0a, 0x0c, 0xde, 0x96, 0x4c, 0x92, 0xb8, 0x8c, 0xab,
+  0x24, 0x92, 0x75, 0xc0, 0xdd, 0x36, 0xd0, 0x51, 0xbe, 0x86, 0x38, 0xbd, 0x62, 0xc3, 0x3f, 0x32,
+  0x87, 0xcd, 0x30, 0x61, 0x0f, 0xfb, 0x2a, 0x78, 0x34, 0x7a, 0xf2, 0xd3, 0x43, 0x96, 0x59, 0x5b,
+  0x1d, 0xec, 0xec, 0x3c, 0xc8, 0xed, 0x0b, 0x59, 0x3d, 0x98, 0xd9, 0x17, 0xb7, 0x40, 0xbc, 0xc7,
+  0xac, 0x42, 0x17, 0xeb, 0x53, 0x3d, 0xb3, 0x69, 0x86, 0x75, 0x9b, 0xf9, 0x80, 0x87, 0xb3, 0xfd,
+  0x21, 0xf5, 0x9f, 0x9a, 0xde, 0xd4, 0x47, 0x1b, 0x5a, 0xd8, 0x37, 0xb8, 0xdc, 0x97, 0x4f, 0x46,
+  0xfb, 0xf0, 0x9e, 0xf0, 0xf2, 0x22, 0x76, 0xae, 0xf9, 0xcb, 0x3f, 0x7f, 0xfe, 0xef, 0xbf, 0xff,
+  0x4e, 0x9e, 0x16, 0x36, 0x8f, 0x0e, 0xfe, 0x04, 0x3b, 0xfb, 0xf3, 0xc7, 0xb9, 0x13, 0x60, 0xfc,
+  0xca, 0x85, 0x93, 0x43, 0xac, 0xb9, 0xf3, 0xf6, 0x97, 0xbe, 0xa3, 0x69, 0xe8, 0xbb, 0xec, 0x2a,
+  0x08, 0x8e, 0xda, 0x39, 0x6b, 0x8c, 0xb6, 0x25, 0x8a, 0x6e, 0xbb, 0xce, 0x19, 0x2d, 0x89, 0x3a,
+  0x60, 0x13, 0x07, 0xe7, 0xea, 0xcb, 0xa9, 0xc3, 0x49, 0x10, 0xd9, 0x36, 0xdd, 0xef, 0x4e, 0x6b,
+  0xf4, 0xf3, 0xee, 0x9d, 0xd3, 0xf4, 0xae, 0xad, 0xd3, 0xf4, 0x13, 0xf7, 0xa6, 0xaa, 0xaf, 0xdd,
+  0xfc, 0xaa, 0x69, 0x1e, 0xdd, 0x2e, 0xb5, 0xdb, 0x6f, 0x68, 0xb7, 0x36, 0xee, 0x72, 0x52, 0xf7,
+  0xfc, 0x91, 0x26, 0x7f, 0xdb, 0xa4, 0x37, 0x60, 0xb9, 0xd2, 0xd4, 0xfd, 0x21, 0x05, 0x4b, 0xef,
+  0x8e, 0x27, 0xbe, 0xbf, 0xc2, 0x99, 0xff, 0x66, 0xbc, 0xfe, 0xd5, 0xfa, 0x9e, 0x58, 0x92, 0xcb,
+  0x1b, 0x11, 0x7a, 0x4b, 0x98, 0x27, 0x50, 0x3c, 0x7f, 0x82, 0x53, 0x73, 0x9f, 0xdd, 0x0f, 0x22,
+  0x17, 0x29, 0xde, 0x3b, 0x29, 0xa2, 0x01, 0x8b, 0x9a, 0x4f, 0xc7, 0xd1, 0xc1, 0xfe, 0xee, 0x46,
+  0x4f, 0xef, 0xdd, 0x2d, 0xb9, 0x33, 0xfd, 0x06, 0x5a, 0x3a, 0x8a, 0xcd, 0xfc, 0x4e, 0x28, 0x9a,
+  0xc2, 0xc5, 0xf4, 0xcb, 0x8e, 0xb5, 0x2f, 0x06, 0x54, 0x85, 0x70, 0xd3, 0x29, 0x29, 0x47, 0xf7,
+  0x1e, 0xac, 0x9b, 0x46, 0xd7, 0x1d, 0x87, 0x86, 0xa6, 0xb6, 0xeb, 0xb8, 0xab, 0xd4, 0x3a, 0xc6,
+  0xd5, 0xc4, 0x4b, 0xd5, 0x65, 0xa2, 0xf7, 0x1f, 0x93, 0x48, 0x3e, 0x2b, 0x95, 0x41, 0x92, 0x36,
+  0x1f, 0x79, 0xbf, 0x8a, 0x52, 0xbc, 0x21, 0xa2, 0xc5, 0x3a, 0x8b, 0x9b, 0xeb, 0x55, 0x39, 0x31,
+  0x6e, 0x2b, 0x3e, 0xd8, 0x50, 0x8f, 0xd3, 0x7b, 0xa2, 0x9f, 0x1a, 0xcb, 0x43, 0x1e, 0x10, 0x5a,
+  0x53, 0xa3, 0xc3, 0x7d, 0x9d, 0xe3, 0x9a, 0x92, 0x0a, 0xb8, 0x88, 0xa9, 0x89, 0xa2, 0x9b, 0x06,
+  0x35, 0xa2, 0xcf, 0xae, 0xaf, 0xea, 0xfe, 0x53, 0x08, 0x15, 0xe0, 0x9e, 0x8d, 0x23, 0x17, 0x98,
+  0xfa, 0xd7, 0x3a, 0xc4, 0xed, 0x8f, 0xf1, 0x8e, 0xff, 0x3f, 0x3d, 0x20, 0x74, 0xf4, 0x3f, 0xa7,
+  0xfe, 0x07, 0x08, 0x6d, 0x89, 0x3c, 0x50, 0x25, 0x00, 0x00
+};
+const size_t HELP_PAGE_LEN = sizeof(HELP_PAGE);
+#define HELP_PAGE_ETAG "\"0b9871aeb7532860\""
 
 #if WEBUI_EMIT_STREAM_HELPER
-// NOTE: Assumes you have a global 'ESP8266WebServer server(80);'
-// If your instance is named differently, set WEBUI_EMIT_STREAM_HELPER=0
-// and paste a custom handler in your route file. 
-#include <ESP8266WebServer.h>                                                   
+#include <ESP8266WebServer.h>
 static void handleHelpPage() {
-  extern ESP8266WebServer server;                                              
-  server.sendHeader("Connection", "close");                                   
-  server.send_P(200, "text/html",                                               
-                HELP_PAGE, HELP_PAGE_LEN);
+  extern ESP8266WebServer server;
+  server.sendHeader("Vary", "Accept-Encoding");
+  if (server.header("Accept-Encoding").indexOf("gzip") < 0) {
+    server.send(406, "text/plain", "Only available gzip-compressed; send Accept-Encoding: gzip.");
+    return;
+  }
+  server.sendHeader("ETag", HELP_PAGE_ETAG);
+  server.sendHeader("Cache-Control", server.hasArg("v") ? "public, max-age=31536000, immutable" : "no-cache");
+  if (server.header("If-None-Match") == HELP_PAGE_ETAG) {
+    server.send(304);
+    return;
+  }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, "text/html", reinterpret_cast<const char*>(HELP_PAGE), HELP_PAGE_LEN);
 }
 #endif
-
-#define F(string_literal) (FPSTR(PSTR(string_literal)))
@@ -3,99 +3,1398 @@
 #include <time.h>
 #include <LittleFS.h>
 #include "diagnostics.h"
+#include "hardware.h"
+#include "history_codec.h"
 
-// Log file path
-#define HISTORY_LOG_PATH "/history.csv"
-#define HISTORY_MAX_SIZE_BYTES (1024 * 1024) // 1MB limit
-#define HISTORY_PRUNE_TO_LINES 5000 // Keep the most recent 5000 lines
+// History is a fixed-size ring of binary segment files holding compressed
+// records (see history_codec.h). Frames are only ever appended to the newest
+// segment; when it fills up, the oldest segment is truncated and reused.
+// Nothing is rewritten or pruned, and LittleFS never has to copy file contents
+// (writing into the middle of a file would copy its tail).
+#define HISTORY_SEGMENT_PATH_FMT "/history_%02u.bin"
+#define HISTORY_SEGMENTS 16            // Segment files in the ring
+#define HISTORY_SEGMENT_BYTES 12288    // Segment size limit; 192 KB for the ring
+#define HISTORY_SEGMENT_MAGIC 0x32484641UL // "AFH2": delta-encoded frames
+#define HISTORY_SEGMENT_FORMAT 3        // 3: the header carries the first record number
+#define HISTORY_UPGRADE_PATH "/history_up.tmp" // Scratch file for upgradeHistorySegments()
+#define HISTORY_CSV_SIZES_PATH "/history.csz" // CSV sizes of the closed segments, so boot need not decode them
+#define HISTORY_ROLLUP_REBUILD_RECORDS 128 // Records the rollup rebuild decodes per loop() pass
+// Sparse index: every HISTORY_INDEX_INTERVAL records the writer starts a keyframe
+// and appends its timestamp and byte offset to a sidecar file, so readers seek
+// straight to the keyframe before a start time instead of decoding the whole segment.
+#define HISTORY_INDEX_PATH "/history.idx"
+#define HISTORY_INDEX_OLD_PATH "/history_idx.old"
+#define HISTORY_INDEX_INTERVAL 256      // Records between keyframes (~21 h at the default interval)
+#define HISTORY_INDEX_MAX_ENTRIES 256   // Per index file; a full file becomes the .old file
+#define HISTORY_LOG_PATH "/history.csv" // Served from the ring; also the pre-ring log, imported once at boot
+#define HISTORY_IMPORT_POS_PATH "/history_import.pos" // How far the import of the pre-ring log got
+#define HISTORY_IMPORT_CHECKPOINT_ROWS 100
+#define HISTORY_QUERY_DEFAULT_POINTS 300 // /history maxPoints when not given
+#define HISTORY_QUERY_MAX_POINTS 2000
+#define HISTORY_QUERY_STEP_RECORDS 256 // Records a /history query decodes per piece of response at most
+#define HISTORY_CSV_HEADER "timestamp,attic_temp,outdoor_temp,humidity,fan_on\n"
+#define ROLLUP_CSV_HEADER "period_start,attic_min,attic_max,attic_mean,outdoor_min,outdoor_max,outdoor_mean,humidity_min,humidity_max,humidity_mean,fan_on_minutes,samples\n"
+
+// Written at the start of each segment file.
+// Every record has a number: records are numbered in the order they were
+// appended, across segments and restarts, so the number is a sync cursor that
+// does not depend on the clock. A segment's records are firstRecord, firstRecord + 1, ...
+struct __attribute__((packed)) HistorySegmentHeader {
+  uint32_t magic;
+  uint32_t seq;         // Position of the segment in the ring; only ever increases
+  uint16_t format;      // HISTORY_SEGMENT_FORMAT
+  uint16_t reserved;
+  uint32_t firstRecord; // Number of the segment's first record
+};
+
+// One keyframe in the sparse index.
+struct __attribute__((packed)) HistoryIndexEntry {
+  uint32_t seq;         // Segment holding the keyframe
+  uint32_t timestamp;   // Of the keyframe's first record
+  uint16_t offset;      // Byte offset of the keyframe in the segment file
+  uint16_t record;      // Position of the keyframe's first record in the segment
+};
+
+// Cursor into the ring, rebuilt from the segment headers and the newest segment at boot.
+struct HistoryStore {
+  uint32_t headSeq = 0;     // Sequence number of the newest segment
+  uint16_t headBytes = 0;   // Size of the newest segment; 0 means it has not been created yet
+  HistoryCodecState codec;  // Encoder state after the newest segment's last record
+  uint16_t sinceKeyframe = 0; // Records written since the last keyframe
+  uint32_t headFirstRecord = 0; // Number of the newest segment's first record
+  uint32_t nextRecord = 0;  // Number the next record written to flash gets
+};
+HistoryStore historyStore;
+
+inline bool historyRingIsEmpty() {
+  return historyStore.headSeq == 0 && historyStore.headBytes == 0;
+}
+
+/**
+ * @brief Returns the oldest segment sequence number still in the ring.
+ */
+inline uint32_t historyOldestSeq() {
+  return historyStore.headSeq >= HISTORY_SEGMENTS - 1 ? historyStore.headSeq - (HISTORY_SEGMENTS - 1) : 0;
+}
+
+inline String historySegmentPath(uint32_t seq) {
+  char path[24];
+  snprintf(path, sizeof(path), HISTORY_SEGMENT_PATH_FMT, (unsigned)(seq % HISTORY_SEGMENTS));
+  return String(path);
+}
+
+/**
+ * @brief Streams the records of one segment, decoding frame by frame.
+ */
+struct HistorySegmentReader {
+  File file;
+  HistoryBitReader bits;
+  HistoryCodecState state;
+  uint8_t frameLeft = 0; // Records left in the current frame
+  uint16_t sinceKeyframe = 0; // Records decoded since the last keyframe
+  bool torn = false;     // The segment ends in an incomplete frame
+  uint32_t firstRecord = 0; // From the header
+  uint32_t number = 0;   // Number of the record next() returns next
+
+  /**
+   * @brief Opens the segment holding sequence number seq.
+   * @param offset Keyframe to start at (from the index); 0 or an offset that
+   * does not hold a keyframe starts at the beginning.
+   * @param position The keyframe's position in the segment (HistoryIndexEntry::record).
+   * @return false if the slot holds a different or invalid segment.
+   */
+  bool open(uint32_t seq, uint16_t offset = 0, uint16_t position = 0) {
+    file = LittleFS.open(historySegmentPath(seq), "r");
+    if (!file) return false;
+    HistorySegmentHeader header;
+    if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) || header.magic != HISTORY_SEGMENT_MAGIC ||
+        header.seq != seq || header.format != HISTORY_SEGMENT_FORMAT) {
+      file.close();
+      return false;
+    }
+    uint8_t flags = 0;
+    if (offset > sizeof(header) && !(file.seek(offset) && file.read(&flags, 1) == 1 && (flags & HISTORY_FRAME_KEYFRAME))) {
+      offset = 0;
+    }
+    file.seek(offset > sizeof(header) ? offset : sizeof(header));
+    bits.begin(&file);
+    firstRecord = header.firstRecord;
+    number = firstRecord + (offset > sizeof(header) ? position : 0);
+    return true;
+  }
+
+  bool next(HistoryRecord& record) {
+    if (frameLeft == 0) {
+      uint32_t count;
+      bits.align();
+      if (!bits.get(count, 8)) return false; // Clean end of the segment
+      if (count & HISTORY_FRAME_KEYFRAME) {
+        state.hasPrev = false;
+        sinceKeyframe = 0;
+      }
+      frameLeft = count & HISTORY_FRAME_COUNT_MASK;
+      if (frameLeft == 0) {
+        torn = true;
+        return false;
+      }
+    }
+    if (!historyDecodeRecord(state, bits, record)) {
+      torn = true;
+      return false;
+    }
+    frameLeft--;
+    sinceKeyframe++;
+    number++;
+    return true;
+  }
+
+  void close() { file.close(); }
+};
+
+// === CSV sizes ===
+// /history.csv is rendered on the fly, so its length is tracked instead: the CSV
+// bytes of each ring segment, kept up to date as frames are written. This gives
+// the download a Content-Length and lets a Range request skip whole segments.
+
+// Closed segments do not change, so their sizes are saved in HISTORY_CSV_SIZES_PATH
+// when the next segment is started, and only the newest segment is decoded at boot.
+
+uint32_t historySegmentCsvBytes[HISTORY_SEGMENTS]; // Indexed like the segment files, by seq % HISTORY_SEGMENTS
+
+// One saved size. check guards against a damaged file; a bad entry is measured again.
+struct __attribute__((packed)) HistoryCsvSize {
+  uint32_t seq;
+  uint32_t bytes;
+  uint32_t check;
+};
+
+inline uint32_t historyCsvSizeCheck(uint32_t seq, uint32_t bytes) {
+  return (seq * 2654435761UL) ^ bytes ^ HISTORY_SEGMENT_MAGIC;
+}
+
+#define HISTORY_CSV_LINE_MAX 48 // Longest /history.csv line, with its terminator
+
+/**
+ * @brief Writes value / 100 with two decimals, like "%.2f" but without floats.
+ * @return The number of characters written (at most 12; no terminator).
+ */
+inline size_t formatHistoryFixed(char* buf, int32_t value) {
+  uint32_t magnitude = value < 0 ? 0 - (uint32_t)value : (uint32_t)value;
+  char digits[10];
+  uint8_t count = 0;
+  do {
+    digits[count++] = '0' + magnitude % 10;
+    magnitude /= 10;
+  } while (magnitude || count < 3); // At least "0.00"
+  size_t len = 0;
+  if (value < 0) buf[len++] = '-';
+  while (count > 2) buf[len++] = digits[--count];
+  buf[len++] = '.';
+  buf[len++] = digits[1];
+  buf[len++] = digits[0];
+  return len;
+}
+
+/**
+ * @brief Formats a record as a /history.csv line.
+ * @return The number of characters written.
+ */
+inline size_t formatHistoryCsvLine(const HistoryRecord& record, char* buf, size_t size) {
+  char line[HISTORY_CSV_LINE_MAX];
+  size_t len = 0; // The timestamp is left blank if time was not synced
+  if (record.timestamp) {
+    time_t ts = (time_t)record.timestamp;
+    struct tm* timeinfo = localtime(&ts);
+    if (timeinfo) len = strftime(line, sizeof(line), "%Y-%m-%dT%H:%M", timeinfo);
+  }
+  line[len++] = ',';
+  len += formatHistoryFixed(line + len, record.atticTemp);
+  line[len++] = ',';
+  len += formatHistoryFixed(line + len, record.outdoorTemp);
+  line[len++] = ',';
+  len += formatHistoryFixed(line + len, record.humidity);
+  line[len++] = ',';
+  line[len++] = (record.flags & HISTORY_FLAG_FAN_ON) ? '1' : '0';
+  line[len++] = '\n';
+  if (size == 0) return 0;
+  if (len >= size) len = size - 1;
+  memcpy(buf, line, len);
+  buf[len] = '\0';
+  return len;
+}
+
+/**
+ * @brief Returns the length of the line formatHistoryCsvLine() writes for record.
+ */
+inline size_t historyCsvLineLength(const HistoryRecord& record) {
+  char line[HISTORY_CSV_LINE_MAX];
+  return formatHistoryCsvLine(record, line, sizeof(line));
+}
+
+/**
+ * @brief Decodes segment seq and returns its CSV bytes; 0 if the slot holds a different or invalid segment.
+ */
+inline uint32_t historyMeasureSegment(uint32_t seq) {
+  HistorySegmentReader reader;
+  if (!reader.open(seq)) return 0;
+  uint32_t total = 0;
+  HistoryRecord record;
+  while (reader.next(record)) total += historyCsvLineLength(record);
+  reader.close();
+  return total;
+}
 
 /**
- * @brief Prunes the history log if it exceeds a defined size.
- * This function reads the end of the large file, stores it in memory,
- * deletes the old file, and writes a new one with the pruned content.
- * This prevents the filesystem from filling up over time.
+ * @brief Saves the CSV sizes of the closed segments, i.e. all but the newest.
  */
-inline void pruneHistoryLog() {
-  File historyFile = LittleFS.open(HISTORY_LOG_PATH, "r");
-  if (!historyFile || historyFile.size() < HISTORY_MAX_SIZE_BYTES) {
-    if (historyFile) historyFile.close();
+inline void saveHistoryCsvSizes() {
+  File f = LittleFS.open(HISTORY_CSV_SIZES_PATH, "w");
+  if (!f) return;
+  for (uint32_t seq = historyOldestSeq(); seq < historyStore.headSeq; seq++) {
+    uint32_t bytes = historySegmentCsvBytes[seq % HISTORY_SEGMENTS];
+    HistoryCsvSize entry = { seq, bytes, historyCsvSizeCheck(seq, bytes) };
+    f.write((const uint8_t*)&entry, sizeof(entry));
+  }
+  f.close();
+}
+
+/**
+ * @brief Fills historySegmentCsvBytes for the closed segments from the saved
+ * sizes, measuring (and then saving again) those without a valid entry.
+ */
+inline void loadHistoryCsvSizes() {
+  HistoryCsvSize saved[HISTORY_SEGMENTS] = {};
+  File f = LittleFS.open(HISTORY_CSV_SIZES_PATH, "r");
+  if (f) {
+    f.read((uint8_t*)saved, sizeof(saved)); // A short file leaves zeroed, invalid entries
+    f.close();
+  }
+  bool measured = false;
+  for (uint32_t seq = historyOldestSeq(); seq < historyStore.headSeq; seq++) {
+    const HistoryCsvSize* entry = nullptr;
+    for (uint8_t i = 0; i < HISTORY_SEGMENTS && !entry; i++) {
+      if (saved[i].seq == seq && saved[i].check == historyCsvSizeCheck(seq, saved[i].bytes)) entry = &saved[i];
+    }
+    if (entry) {
+      historySegmentCsvBytes[seq % HISTORY_SEGMENTS] = entry->bytes;
+    } else {
+      historySegmentCsvBytes[seq % HISTORY_SEGMENTS] = historyMeasureSegment(seq);
+      measured = true;
+    }
+  }
+  if (measured) saveHistoryCsvSizes();
+}
+
+/**
+ * @brief Appends a keyframe to the sparse index, rotating the file when it is full.
+ */
+inline void historyIndexAppend(const HistoryIndexEntry& entry) {
+  File f = LittleFS.open(HISTORY_INDEX_PATH, "a");
+  if (f && (f.size() >= HISTORY_INDEX_MAX_ENTRIES * sizeof(HistoryIndexEntry) || f.size() % sizeof(HistoryIndexEntry))) {
+    f.close(); // Full, or torn by a reset mid-write
+    LittleFS.remove(HISTORY_INDEX_OLD_PATH);
+    LittleFS.rename(HISTORY_INDEX_PATH, HISTORY_INDEX_OLD_PATH);
+    f = LittleFS.open(HISTORY_INDEX_PATH, "a");
+  }
+  if (!f) return; // Readers fall back to the segment start
+  f.write((const uint8_t*)&entry, sizeof(entry));
+  f.close();
+}
+
+/**
+ * @brief Binary-searches one index file for the last keyframe at or before (seq, key).
+ * @param byRecord key is a position in the segment rather than a timestamp.
+ */
+inline bool historyIndexFind(const char* path, uint32_t seq, uint32_t key, bool byRecord, HistoryIndexEntry& found) {
+  File f = LittleFS.open(path, "r");
+  if (!f) return false;
+  size_t lo = 0, hi = f.size() / sizeof(HistoryIndexEntry);
+  bool ok = false;
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    HistoryIndexEntry entry;
+    if (!f.seek(mid * sizeof(entry)) || f.read((uint8_t*)&entry, sizeof(entry)) != sizeof(entry)) break;
+    if (entry.seq < seq || (entry.seq == seq && (byRecord ? entry.record : entry.timestamp) <= key)) {
+      found = entry;
+      ok = true;
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  f.close();
+  return ok;
+}
+
+/**
+ * @brief Finds the last keyframe in segment seq at or before key (a timestamp, or
+ * with byRecord a position in the segment).
+ * @return false if the scan has to start at the beginning of the segment.
+ */
+inline bool historyIndexLookup(uint32_t seq, uint32_t key, bool byRecord, HistoryIndexEntry& entry) {
+  if (!historyIndexFind(HISTORY_INDEX_PATH, seq, key, byRecord, entry) &&
+      !historyIndexFind(HISTORY_INDEX_OLD_PATH, seq, key, byRecord, entry)) {
+    return false;
+  }
+  return entry.seq == seq;
+}
+
+/**
+ * @brief Appends records to the newest segment as one compressed frame, starting
+ * the next segment (and dropping the oldest) when the frame does not fit.
+ * @param count At most HISTORY_BUFFER_RECORDS records.
+ * @return false if the frame could not be written.
+ */
+inline bool historyWriteRecords(const HistoryRecord* records, uint8_t count) {
+  uint8_t frame[1 + HISTORY_BUFFER_RECORDS * HISTORY_CODEC_MAX_RECORD_BYTES];
+  HistoryCodecState codec = historyStore.codec;
+  bool keyframe = historyStore.headBytes == 0 || historyStore.sinceKeyframe >= HISTORY_INDEX_INTERVAL;
+  size_t len = historyEncodeFrame(codec, records, count, keyframe, frame, sizeof(frame));
+  if (len == 0) return false;
+  if (historyStore.headBytes > 0 && historyStore.headBytes + len > HISTORY_SEGMENT_BYTES) {
+    historyStore.headSeq++;
+    historyStore.headBytes = 0;
+    keyframe = true; // Each segment starts from base values
+    codec = historyStore.codec;
+    len = historyEncodeFrame(codec, records, count, keyframe, frame, sizeof(frame));
+  }
+
+  File segment;
+  if (historyStore.headBytes == 0) {
+    segment = LittleFS.open(historySegmentPath(historyStore.headSeq), "w"); // Truncates the oldest segment
+    historySegmentCsvBytes[historyStore.headSeq % HISTORY_SEGMENTS] = 0;
+    HistorySegmentHeader header = { HISTORY_SEGMENT_MAGIC, historyStore.headSeq, HISTORY_SEGMENT_FORMAT, 0,
+                                    historyStore.nextRecord };
+    if (segment && segment.write((const uint8_t*)&header, sizeof(header)) != sizeof(header)) {
+      segment.close();
+      return false;
+    }
+    if (segment) {
+      historyStore.headBytes = sizeof(header);
+      historyStore.headFirstRecord = historyStore.nextRecord;
+      saveHistoryCsvSizes(); // The previous segment is closed now
+    }
+  } else {
+    segment = LittleFS.open(historySegmentPath(historyStore.headSeq), "a");
+  }
+  if (!segment) return false;
+  bool ok = segment.write(frame, len) == len;
+  segment.close();
+  if (!ok) {
+    historyStore.headBytes = HISTORY_SEGMENT_BYTES; // Never append after a partial frame
+    historySegmentCsvBytes[historyStore.headSeq % HISTORY_SEGMENTS] = historyMeasureSegment(historyStore.headSeq);
+    return false;
+  }
+  for (uint8_t i = 0; i < count; i++) {
+    historySegmentCsvBytes[historyStore.headSeq % HISTORY_SEGMENTS] += historyCsvLineLength(records[i]);
+  }
+  if (keyframe && historyStore.headBytes > sizeof(HistorySegmentHeader) && records[0].timestamp) {
+    // Segment starts need no entry; unsynced timestamps would break the index order
+    historyIndexAppend({ historyStore.headSeq, records[0].timestamp, historyStore.headBytes,
+                         (uint16_t)(historyStore.nextRecord - historyStore.headFirstRecord) });
+  }
+  historyStore.headBytes += len;
+  historyStore.nextRecord += count;
+  historyStore.codec = codec;
+  historyStore.sinceKeyframe = keyframe ? count : historyStore.sinceKeyframe + count;
+  return true;
+}
+
+// === Write-back buffer ===
+// Samples are staged in RAM and written to the ring HISTORY_BUFFER_RECORDS at a
+// time, when the fan switches, or before a restart (logAndRestart, OTA). With
+// HISTORY_BUFFER_RTC_MIRROR the buffer is also kept in RTC user memory right after
+// the reset flag in block 0, within the first 32 blocks, so a soft reset or crash
+// does not lose it; a power cut loses at most one buffer.
+#define HISTORY_BUFFER_RTC_BLOCK 1
+#define HISTORY_BUFFER_RTC_MAGIC 0xB5
+
+#if HISTORY_BUFFER_RTC_MIRROR
+static_assert(HISTORY_BUFFER_RTC_BLOCK + 1 + HISTORY_BUFFER_RECORDS * sizeof(HistoryRecord) / 4 <= 32,
+              "HISTORY_BUFFER_RECORDS does not fit in RTC blocks 1-31");
+#endif
+
+// RTC memory is copied in 32-bit words, so everything passed to it is 4-byte aligned.
+struct alignas(4) HistoryBufferRtcHeader {
+  uint8_t magic;
+  uint8_t count;
+  uint16_t checksum;
+};
+
+struct HistoryBuffer {
+  uint8_t count = 0;
+  int8_t lastFanOn = -1; // Fan state of the previous sample; -1 until the first one
+  alignas(4) HistoryRecord records[HISTORY_BUFFER_RECORDS];
+};
+HistoryBuffer historyBuffer;
+
+inline uint16_t historyBufferChecksum() {
+  uint16_t sum = historyBuffer.count;
+  const uint8_t* bytes = (const uint8_t*)historyBuffer.records;
+  for (size_t i = 0; i < historyBuffer.count * sizeof(HistoryRecord); i++) sum = (uint16_t)((sum << 1) | (sum >> 15)) + bytes[i];
+  return sum;
+}
+
+/**
+ * @brief Copies the buffer header and the newest record to RTC memory.
+ */
+inline void mirrorHistoryBuffer() {
+#if HISTORY_BUFFER_RTC_MIRROR
+  if (historyBuffer.count > 0) {
+    uint8_t last = historyBuffer.count - 1;
+    ESP.rtcUserMemoryWrite(HISTORY_BUFFER_RTC_BLOCK + 1 + last * sizeof(HistoryRecord) / 4,
+                           (uint32_t*)&historyBuffer.records[last], sizeof(HistoryRecord));
+  }
+  HistoryBufferRtcHeader header = { HISTORY_BUFFER_RTC_MAGIC, historyBuffer.count, historyBufferChecksum() };
+  ESP.rtcUserMemoryWrite(HISTORY_BUFFER_RTC_BLOCK, (uint32_t*)&header, sizeof(header));
+#endif
+}
+
+/**
+ * @brief Reloads samples staged before a soft reset. Leaves the buffer empty if
+ * RTC memory does not hold a valid copy (e.g. after a power cycle).
+ */
+inline void restoreHistoryBuffer() {
+  historyBuffer.count = 0;
+#if HISTORY_BUFFER_RTC_MIRROR
+  HistoryBufferRtcHeader header;
+  ESP.rtcUserMemoryRead(HISTORY_BUFFER_RTC_BLOCK, (uint32_t*)&header, sizeof(header));
+  if (header.magic != HISTORY_BUFFER_RTC_MAGIC || header.count == 0 || header.count > HISTORY_BUFFER_RECORDS) return;
+  ESP.rtcUserMemoryRead(HISTORY_BUFFER_RTC_BLOCK + 1, (uint32_t*)historyBuffer.records, header.count * sizeof(HistoryRecord));
+  historyBuffer.count = header.count;
+  if (historyBufferChecksum() != header.checksum) historyBuffer.count = 0;
+#endif
+}
+
+/**
+ * @brief Writes all staged samples to the ring. Call before anything that restarts the device.
+ */
+inline void flushHistoryBuffer() {
+  if (historyBuffer.count == 0) return;
+  if (!historyWriteRecords(historyBuffer.records, historyBuffer.count)) {
+    logDiagnostics("[ERROR] Could not write history record.");
+    // The lost records keep their numbers; later ones go to a new segment so
+    // their numbers still follow from its header
+    historyStore.nextRecord += historyBuffer.count;
+    if (historyStore.headBytes > 0) historyStore.headBytes = HISTORY_SEGMENT_BYTES;
+  }
+  historyBuffer.count = 0; // Drop what failed rather than retry a broken filesystem every sample
+  mirrorHistoryBuffer();
+}
+
+/**
+ * @brief Returns true if no samples are stored, on flash or staged.
+ */
+inline bool historyIsEmpty() {
+  return historyRingIsEmpty() && historyBuffer.count == 0;
+}
+
+inline int16_t historyFixedPoint(float value) {
+  float scaled = roundf(value * 100.0f);
+  return scaled > 32767 ? 32767 : (scaled < -32768 ? -32768 : (int16_t)scaled);
+}
+
+/**
+ * @brief Parses one row of the pre-ring /history.csv.
+ * @return false for the header and damaged lines.
+ */
+inline bool parseLegacyHistoryRow(const char* line, HistoryRecord& record) {
+  struct tm tmv = {};
+  float attic, outdoor, humidity;
+  int fanOn;
+  record = {};
+  if (sscanf(line, "%d-%d-%dT%d:%d,%f,%f,%f,%d", &tmv.tm_year, &tmv.tm_mon, &tmv.tm_mday, &tmv.tm_hour,
+             &tmv.tm_min, &attic, &outdoor, &humidity, &fanOn) == 9) {
+    tmv.tm_year -= 1900;
+    tmv.tm_mon -= 1;
+    tmv.tm_isdst = -1;
+    record.timestamp = (uint32_t)mktime(&tmv);
+  } else if (sscanf(line, ",%f,%f,%f,%d", &attic, &outdoor, &humidity, &fanOn) != 4) {
+    return false;
+  }
+  record.atticTemp = historyFixedPoint(attic);
+  record.outdoorTemp = historyFixedPoint(outdoor);
+  record.humidity = (uint16_t)historyFixedPoint(humidity);
+  record.flags = fanOn ? HISTORY_FLAG_FAN_ON : 0;
+  return true;
+}
+
+// Flushes the imported rows and records how far into the CSV they reach.
+inline void checkpointLegacyHistoryImport(uint32_t offset) {
+  flushHistoryBuffer();
+  File pos = LittleFS.open(HISTORY_IMPORT_POS_PATH, "w");
+  if (pos) {
+    pos.write((const uint8_t*)&offset, sizeof(offset));
+    pos.close();
+  }
+}
+
+// Stages one CSV row; offset is where the row ends in the file.
+inline void importLegacyHistoryRow(const char* line, uint32_t offset, uint32_t& imported) {
+  HistoryRecord record;
+  if (!parseLegacyHistoryRow(line, record)) return; // Header or damaged line
+  historyBuffer.records[historyBuffer.count++] = record; // Batched into frames like live samples
+  imported++;
+  if (imported % HISTORY_IMPORT_CHECKPOINT_ROWS == 0) {
+    checkpointLegacyHistoryImport(offset);
+  } else if (historyBuffer.count >= HISTORY_BUFFER_RECORDS) {
+    flushHistoryBuffer();
+  }
+  if (historyBuffer.count == 0) yield(); // A frame was just written; keep the watchdog fed
+}
+
+/**
+ * @brief Imports the pre-ring /history.csv once, keeping its newest rows, then deletes it.
+ * A 1 MB log is ~30k rows and takes a while, so the import yields to the system
+ * as it goes and checkpoints its position in the CSV every
+ * HISTORY_IMPORT_CHECKPOINT_ROWS rows. If the device resets meanwhile, the next
+ * boot resumes from the checkpoint (re-importing at most that many rows)
+ * instead of starting over; the CSV is deleted only once it has been read to the end.
+ */
+inline void importLegacyHistoryLog() {
+  File csv = LittleFS.open(HISTORY_LOG_PATH, "r");
+  if (!csv) {
+    LittleFS.remove(HISTORY_IMPORT_POS_PATH); // Left over if a reset came between the two removes below
     return;
   }
+  uint32_t offset = 0; // File offset of the next unread byte
+  File pos = LittleFS.open(HISTORY_IMPORT_POS_PATH, "r");
+  if (pos) {
+    if (pos.read((uint8_t*)&offset, sizeof(offset)) != sizeof(offset) || offset > csv.size() || !csv.seek(offset)) {
+      offset = 0;
+      csv.seek(0);
+    }
+    pos.close();
+  }
+  char msg[80];
+  snprintf(msg, sizeof(msg), "[INFO] Importing history.csv into the history ring from byte %lu...", (unsigned long)offset);
+  logDiagnostics(msg);
+
+  uint32_t imported = 0;
+  char block[256];
+  char line[96];
+  size_t lineLen = 0;
+  size_t n;
+  while ((n = csv.read((uint8_t*)block, sizeof(block))) > 0) {
+    for (size_t i = 0; i < n; i++) {
+      offset++;
+      if (block[i] != '\n') {
+        if (lineLen < sizeof(line) - 1) line[lineLen++] = block[i];
+        continue;
+      }
+      line[lineLen] = '\0';
+      lineLen = 0;
+      importLegacyHistoryRow(line, offset, imported);
+    }
+  }
+  if (lineLen) { // A final row without a newline
+    line[lineLen] = '\0';
+    importLegacyHistoryRow(line, offset, imported);
+  }
+  csv.close();
+  flushHistoryBuffer();
+  LittleFS.remove(HISTORY_LOG_PATH);
+  LittleFS.remove(HISTORY_IMPORT_POS_PATH);
+  snprintf(msg, sizeof(msg), "[INFO] Imported %lu history rows.", (unsigned long)imported);
+  logDiagnostics(msg);
+}
+
+/**
+ * @brief Returns the newest segment whose first record is no later than timestamp,
+ * i.e. where a scan for records from that time on has to start. Binary search
+ * over the segments' first records; unreadable segments count as older.
+ */
+inline uint32_t historySeqForTimestamp(uint32_t timestamp) {
+  uint32_t lo = historyOldestSeq();
+  uint32_t hi = historyRingIsEmpty() ? lo : historyStore.headSeq;
+  while (lo < hi) {
+    uint32_t mid = lo + (hi - lo + 1) / 2;
+    HistorySegmentReader reader;
+    HistoryRecord first;
+    bool found = reader.open(mid) && reader.next(first);
+    reader.close();
+    if (found && first.timestamp > timestamp) {
+      hi = mid - 1;
+    } else {
+      lo = mid;
+    }
+  }
+  return lo;
+}
+
+/**
+ * @brief Returns the newest segment whose first record number is at most number,
+ * and that number in firstRecord. Binary search over the segment headers;
+ * unreadable segments count as older.
+ */
+inline uint32_t historySeqForRecord(uint32_t number, uint32_t& firstRecord) {
+  uint32_t lo = historyOldestSeq();
+  uint32_t hi = historyRingIsEmpty() ? lo : historyStore.headSeq;
+  firstRecord = number;
+  while (lo < hi) {
+    uint32_t mid = lo + (hi - lo + 1) / 2;
+    HistorySegmentReader reader;
+    bool found = reader.open(mid);
+    reader.close();
+    if (found && reader.firstRecord > number) {
+      hi = mid - 1;
+    } else {
+      lo = mid;
+    }
+  }
+  HistorySegmentReader reader;
+  if (reader.open(lo) && reader.firstRecord <= number) firstRecord = reader.firstRecord;
+  reader.close();
+  return lo;
+}
+
+/**
+ * @brief Returns the number the next appended record gets; records numbered
+ * below it are stored (or were, before the ring wrapped). The /history sync cursor.
+ */
+inline uint32_t historyNextRecord() {
+  return historyStore.nextRecord + historyBuffer.count;
+}
+
+/**
+ * @brief Walks every stored record, oldest first, including samples still in the
+ * write-back buffer, one next() call at a time, so a long walk can be spread over
+ * several loop() iterations. Decodes as it reads, so memory use does not depend
+ * on the history size. Samples flushed while a walk is paused in the buffer are
+ * picked up from the ring by their record number, so none is missed or returned twice.
+ */
+struct HistoryCursor {
+  uint32_t seq = 0;
+  uint32_t firstSeq = 0;
+  uint16_t firstOffset = 0;
+  uint16_t firstPosition = 0; // Of the keyframe at firstOffset
+  bool segmentOpen = false;
+  bool inBuffer = false; // The ring is done; reading the write-back buffer
+  uint32_t number = 0;    // Number of the record next() returned last
+  uint32_t following = 0; // Records numbered below this are skipped
+  HistorySegmentReader reader;
+
+  /**
+   * @param from Skip what can be skipped without decoding before this time: the
+   * walk starts at the last indexed keyframe at or before it, so the caller still
+   * sees some older records and has to filter them itself.
+   */
+  void begin(uint32_t from = 0) {
+    end();
+    firstSeq = from ? historySeqForTimestamp(from) : historyOldestSeq();
+    HistoryIndexEntry entry;
+    bool indexed = from && historyIndexLookup(firstSeq, from, false, entry);
+    firstOffset = indexed ? entry.offset : 0;
+    firstPosition = indexed ? entry.record : 0;
+    seq = firstSeq;
+    inBuffer = false;
+    following = 0;
+  }
+
+  /**
+   * @brief Starts the walk at the record numbered from (see historyNextRecord()),
+   * or the oldest stored record after it.
+   */
+  void beginAtRecord(uint32_t from) {
+    end();
+    uint32_t base;
+    firstSeq = historySeqForRecord(from, base);
+    HistoryIndexEntry entry;
+    bool indexed = from > base && historyIndexLookup(firstSeq, from - base, true, entry);
+    firstOffset = indexed ? entry.offset : 0;
+    firstPosition = indexed ? entry.record : 0;
+    seq = firstSeq;
+    inBuffer = false;
+    following = from;
+  }
+
+  bool next(HistoryRecord& record) {
+    for (;;) {
+      if (inBuffer) {
+        if (following < historyStore.nextRecord) {
+          beginAtRecord(following); // The buffer was flushed since the last call
+          continue;
+        }
+        uint32_t index = following - historyStore.nextRecord;
+        if (index >= historyBuffer.count) return false;
+        record = historyBuffer.records[index];
+        number = following++;
+        return true;
+      }
+      if (!segmentOpen) {
+        if (historyRingIsEmpty() || seq > historyStore.headSeq) {
+          inBuffer = true;
+          // Anything still below nextRecord was lost to a failed write
+          if (following < historyStore.nextRecord) following = historyStore.nextRecord;
+          continue;
+        }
+        reader = HistorySegmentReader();
+        segmentOpen = seq == firstSeq ? reader.open(seq, firstOffset, firstPosition) : reader.open(seq);
+        if (!segmentOpen) {
+          seq++;
+          continue;
+        }
+      }
+      if (reader.next(record)) {
+        if (reader.number <= following) continue;
+        number = reader.number - 1;
+        following = reader.number;
+        return true;
+      }
+      end();
+      seq++;
+    }
+  }
+
+  /**
+   * @brief Continues at the start of segment seq, e.g. to skip segments by their
+   * historySegmentCsvBytes. Only moves forward, and only before the walk has
+   * reached the write-back buffer.
+   */
+  void skipToSegment(uint32_t to) {
+    if (inBuffer || to <= seq) return;
+    end();
+    seq = to;
+  }
+
+  void end() {
+    if (segmentOpen) reader.close();
+    segmentOpen = false;
+  }
+};
+
+/**
+ * @brief Calls fn(const HistoryRecord&) for every stored record, oldest first,
+ * including samples still in the write-back buffer.
+ * Stops early if fn returns false.
+ * @param from See HistoryCursor::begin().
+ */
+template <typename Fn>
+inline void forEachHistoryRecord(Fn fn, uint32_t from = 0) {
+  HistoryCursor cursor;
+  cursor.begin(from);
+  HistoryRecord record;
+  while (cursor.next(record)) {
+    if (!fn(record)) break;
+  }
+  cursor.end();
+}
+
+/**
+ * @brief Returns the length of /history.csv, header included.
+ */
+inline size_t historyCsvBytes() {
+  size_t total = strlen(HISTORY_CSV_HEADER);
+  for (uint32_t seq = historyOldestSeq(); !historyRingIsEmpty() && seq <= historyStore.headSeq; seq++) {
+    total += historySegmentCsvBytes[seq % HISTORY_SEGMENTS];
+  }
+  for (uint8_t i = 0; i < historyBuffer.count; i++) total += historyCsvLineLength(historyBuffer.records[i]);
+  return total;
+}
+
+// === Rollups ===
+// Hourly and daily summaries, updated as each sample is appended so long-range
+// views never need to scan the raw ring. The current period is accumulated in
+// RAM and appended to its tier file when the first sample of the next period
+// arrives. At boot the open periods are rebuilt from the newest raw segments,
+// a slice per loop() pass (serviceHistoryRollups()), so a full rebuild (no tier
+// files yet) does not hold up the boot; until it is done the open periods are partial.
+// Each tier keeps between maxEntries and 2 * maxEntries rows: when the file is
+// full it becomes the .old file and a new one is started.
+#define ROLLUP_MAX_GAP_S 3600 // Longest gap between samples credited to fan-on time
+
+enum RollupTierId : uint8_t { ROLLUP_HOURLY, ROLLUP_DAILY, ROLLUP_TIER_COUNT };
+
+// One summarised period. Temperatures in 1/100 °F, humidity in 1/100 %.
+struct __attribute__((packed)) HistoryRollup {
+  uint32_t periodStart; // Unix time of the start of the hour / local day
+  int16_t atticMin, atticMax, atticMean;
+  int16_t outdoorMin, outdoorMax, outdoorMean;
+  uint16_t humidityMin, humidityMax, humidityMean;
+  uint16_t fanOnMinutes;
+  uint16_t samples;
+};
+
+struct RollupAccumulator {
+  uint32_t periodStart = 0; // 0 while nothing has been accumulated
+  int32_t atticSum = 0, outdoorSum = 0;
+  uint32_t humiditySum = 0, fanOnSeconds = 0;
+  int16_t atticMin = 0, atticMax = 0, outdoorMin = 0, outdoorMax = 0;
+  uint16_t humidityMin = 0, humidityMax = 0;
+  uint16_t samples = 0;
+};
+
+struct RollupTier {
+  const char* path;
+  const char* oldPath;
+  uint16_t maxEntries;
+  uint32_t lastFlushed;     // periodStart of the newest row on flash
+  RollupAccumulator acc;
+};
+
+RollupTier rollupTiers[ROLLUP_TIER_COUNT] = {
+  { "/rollup_hourly.bin", "/rollup_hourly.old", 1024, 0, RollupAccumulator() }, // 42-85 days
+  { "/rollup_daily.bin", "/rollup_daily.old", 512, 0, RollupAccumulator() },    // 1.4-2.8 years
+};
+
+// The previous sample, for crediting fan-on time to the interval it covered.
+uint32_t rollupLastTimestamp = 0;
+bool rollupLastFanOn = false;
+
+// The rebuild after boot. New samples are left to it until it catches up.
+HistoryCursor rollupRebuild;
+bool rollupRebuilding = false;
+
+inline uint32_t rollupPeriodStart(uint8_t tier, uint32_t timestamp) {
+  if (tier == ROLLUP_HOURLY) return timestamp - timestamp % 3600;
+  time_t t = (time_t)timestamp;
+  struct tm day = *localtime(&t);
+  day.tm_hour = day.tm_min = day.tm_sec = 0;
+  day.tm_isdst = -1;
+  return (uint32_t)mktime(&day);
+}
+
+inline HistoryRollup rollupFromAccumulator(const RollupAccumulator& acc) {
+  HistoryRollup row;
+  row.periodStart = acc.periodStart;
+  row.atticMin = acc.atticMin;
+  row.atticMax = acc.atticMax;
+  row.atticMean = (int16_t)lroundf((float)acc.atticSum / acc.samples);
+  row.outdoorMin = acc.outdoorMin;
+  row.outdoorMax = acc.outdoorMax;
+  row.outdoorMean = (int16_t)lroundf((float)acc.outdoorSum / acc.samples);
+  row.humidityMin = acc.humidityMin;
+  row.humidityMax = acc.humidityMax;
+  row.humidityMean = (uint16_t)lroundf((float)acc.humiditySum / acc.samples);
+  row.fanOnMinutes = (uint16_t)((acc.fanOnSeconds + 30) / 60);
+  row.samples = acc.samples;
+  return row;
+}
+
+/**
+ * @brief Appends the accumulated period to the tier file and clears the accumulator.
+ */
+inline void flushRollup(RollupTier& tier) {
+  if (tier.acc.samples == 0) return;
+  HistoryRollup row = rollupFromAccumulator(tier.acc);
+  File f = LittleFS.open(tier.path, "a");
+  if (f && f.size() + sizeof(row) > (size_t)tier.maxEntries * sizeof(row)) {
+    f.close();
+    LittleFS.remove(tier.oldPath);
+    LittleFS.rename(tier.path, tier.oldPath);
+    f = LittleFS.open(tier.path, "w");
+  }
+  if (!f || f.write((const uint8_t*)&row, sizeof(row)) != sizeof(row)) {
+    logDiagnostics("[ERROR] Could not write history rollup.");
+  }
+  if (f) f.close();
+  tier.lastFlushed = row.periodStart;
+  tier.acc = RollupAccumulator();
+}
 
-  logDiagnostics("[INFO] History log exceeds max size. Pruning...");
+/**
+ * @brief Folds one sample into the tiers whose open period it belongs to.
+ */
+inline void updateHistoryRollups(const HistoryRecord& record) {
+  if (record.timestamp == 0) return; // Periods need a synced clock
+  uint32_t gap = record.timestamp - rollupLastTimestamp;
+  uint32_t fanOnSeconds = (rollupLastFanOn && rollupLastTimestamp && record.timestamp > rollupLastTimestamp && gap <= ROLLUP_MAX_GAP_S) ? gap : 0;
+  rollupLastTimestamp = record.timestamp;
+  rollupLastFanOn = record.flags & HISTORY_FLAG_FAN_ON;
 
-  // Create a temporary buffer to hold the last N lines
-  String lastLines = "";
-  int lineCount = 0;
+  for (uint8_t i = 0; i < ROLLUP_TIER_COUNT; i++) {
+    RollupTier& tier = rollupTiers[i];
+    uint32_t period = rollupPeriodStart(i, record.timestamp);
+    if (period <= tier.lastFlushed || period < tier.acc.periodStart) continue; // Clock stepped back
+    if (period != tier.acc.periodStart) flushRollup(tier);
+    RollupAccumulator& acc = tier.acc;
+    if (acc.samples == 0) {
+      acc.periodStart = period;
+      acc.atticMin = acc.atticMax = record.atticTemp;
+      acc.outdoorMin = acc.outdoorMax = record.outdoorTemp;
+      acc.humidityMin = acc.humidityMax = record.humidity;
+    }
+    acc.atticSum += record.atticTemp;
+    acc.outdoorSum += record.outdoorTemp;
+    acc.humiditySum += record.humidity;
+    if (record.atticTemp < acc.atticMin) acc.atticMin = record.atticTemp;
+    if (record.atticTemp > acc.atticMax) acc.atticMax = record.atticTemp;
+    if (record.outdoorTemp < acc.outdoorMin) acc.outdoorMin = record.outdoorTemp;
+    if (record.outdoorTemp > acc.outdoorMax) acc.outdoorMax = record.outdoorTemp;
+    if (record.humidity < acc.humidityMin) acc.humidityMin = record.humidity;
+    if (record.humidity > acc.humidityMax) acc.humidityMax = record.humidity;
+    acc.fanOnSeconds += fanOnSeconds;
+    acc.samples++;
+  }
+}
 
-  // Seek to a position near the end to start reading
-  // This is an optimization to avoid reading the entire large file
-  size_t seekPos = historyFile.size() > 256000 ? historyFile.size() - 256000 : 0; // 5000 lines * ~50 bytes/line
-  historyFile.seek(seekPos, fs::SeekSet);
-  if (seekPos > 0) {
-    historyFile.readStringUntil('\n'); // Discard partial line
+/**
+ * @brief Reads the newest row of a tier, looking in the .old file if the current one is empty.
+ * @return false if the tier has no rows on flash.
+ */
+inline bool readLastRollup(const RollupTier& tier, HistoryRollup& row) {
+  const char* paths[2] = { tier.path, tier.oldPath };
+  for (uint8_t i = 0; i < 2; i++) {
+    File f = LittleFS.open(paths[i], "r");
+    if (!f) continue;
+    size_t rows = f.size() / sizeof(row);
+    bool ok = rows > 0 && f.seek((rows - 1) * sizeof(row), fs::SeekSet) && f.read((uint8_t*)&row, sizeof(row)) == sizeof(row);
+    f.close();
+    if (ok) return true;
   }
+  return false;
+}
 
-  // Read the remaining lines into the buffer
-  while (historyFile.available()) {
-    lastLines += historyFile.readStringUntil('\n') + "\n";
-    lineCount++;
+/**
+ * @brief Starts restoring the open rollup periods after boot; serviceHistoryRollups()
+ * does the scan. Scans only the raw records newer than the last flushed period of
+ * each tier, so a missing tier file (first boot after an upgrade or import) is
+ * backfilled from the whole ring.
+ */
+inline void initHistoryRollups() {
+  uint32_t resumeFrom = UINT32_MAX;
+  for (uint8_t i = 0; i < ROLLUP_TIER_COUNT; i++) {
+    RollupTier& tier = rollupTiers[i];
+    tier.acc = RollupAccumulator();
+    tier.lastFlushed = 0;
+    HistoryRollup last;
+    File f = LittleFS.open(tier.path, "r");
+    bool torn = f && f.size() % sizeof(HistoryRollup);
+    if (f) f.close();
+    if (torn) { // Start a fresh file rather than append misaligned rows
+      LittleFS.remove(tier.oldPath);
+      LittleFS.rename(tier.path, tier.oldPath);
+    }
+    if (readLastRollup(tier, last)) tier.lastFlushed = last.periodStart;
+    if (tier.lastFlushed < resumeFrom) resumeFrom = tier.lastFlushed;
   }
-  historyFile.close();
+  rollupLastTimestamp = 0;
+  rollupLastFanOn = false;
+  rollupRebuild.begin(resumeFrom);
+  rollupRebuilding = true;
+}
 
-  // If we have more lines than we want to keep, trim the buffer
-  if (lineCount > HISTORY_PRUNE_TO_LINES) {
-    int firstNewLine = -1;
-    for (int i = 0; i < (lineCount - HISTORY_PRUNE_TO_LINES); i++) {
-      firstNewLine = lastLines.indexOf('\n', firstNewLine + 1);
+/**
+ * @brief Continues the rollup rebuild started by initHistoryRollups(), if any.
+ * Call from loop().
+ */
+inline void serviceHistoryRollups() {
+  if (!rollupRebuilding) return;
+  HistoryRecord record;
+  for (uint16_t i = 0; i < HISTORY_ROLLUP_REBUILD_RECORDS; i++) {
+    if (!rollupRebuild.next(record)) { // Caught up, write-back buffer included
+      rollupRebuild.end();
+      rollupRebuilding = false;
+      return;
+    }
+    updateHistoryRollups(record);
+  }
+}
+
+/**
+ * @brief Reads every row of a tier, oldest first, followed by the open period
+ * (partial) if it has samples. Both files are opened and the open period is
+ * copied when the reader is opened, so rows flushed or files rotated while it
+ * is being read do not show up twice or go missing.
+ */
+struct HistoryRollupReader {
+  File files[2];       // The .old file, then the current one
+  size_t left[2] = {}; // Bytes to read from each, as of open()
+  HistoryRollup partial;
+  bool hasPartial = false;
+
+  void open(uint8_t tierId) {
+    RollupTier& tier = rollupTiers[tierId];
+    const char* paths[2] = { tier.oldPath, tier.path };
+    for (uint8_t i = 0; i < 2; i++) {
+      files[i] = LittleFS.open(paths[i], "r");
+      left[i] = files[i] ? files[i].size() - files[i].size() % sizeof(HistoryRollup) : 0;
     }
-    lastLines = lastLines.substring(firstNewLine + 1);
+    hasPartial = tier.acc.samples > 0;
+    if (hasPartial) partial = rollupFromAccumulator(tier.acc);
   }
 
-  // Write the pruned content back to a new file
-  historyFile = LittleFS.open(HISTORY_LOG_PATH, "w"); // "w" to overwrite
-  historyFile.print("timestamp,attic_temp,outdoor_temp,humidity,fan_on\n" + lastLines);
-  historyFile.close();
-  logDiagnostics("[INFO] History log pruning complete.");
+  bool next(HistoryRollup& row) {
+    for (uint8_t i = 0; i < 2; i++) {
+      if (left[i] < sizeof(row)) continue;
+      if (files[i].read((uint8_t*)&row, sizeof(row)) == sizeof(row)) {
+        left[i] -= sizeof(row);
+        return true;
+      }
+      left[i] = 0;
+    }
+    if (!hasPartial) return false;
+    row = partial;
+    hasPartial = false;
+    return true;
+  }
+
+  void close() {
+    files[0].close();
+    files[1].close();
+  }
+};
+
+/**
+ * @brief Formats a rollup row as a /history_rollup.csv line.
+ * @return The number of characters written.
+ */
+inline size_t formatRollupCsvLine(const HistoryRollup& row, char* buf, size_t size) {
+  char timestampStr[20];
+  time_t ts = (time_t)row.periodStart;
+  struct tm* timeinfo = localtime(&ts);
+  if (!timeinfo || !strftime(timestampStr, sizeof(timestampStr), "%Y-%m-%dT%H:%M", timeinfo)) timestampStr[0] = '\0';
+  int len = snprintf(buf, size, "%s,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%u,%u\n", timestampStr,
+                     row.atticMin / 100.0f, row.atticMax / 100.0f, row.atticMean / 100.0f,
+                     row.outdoorMin / 100.0f, row.outdoorMax / 100.0f, row.outdoorMean / 100.0f,
+                     row.humidityMin / 100.0f, row.humidityMax / 100.0f, row.humidityMean / 100.0f,
+                     (unsigned)row.fanOnMinutes, (unsigned)row.samples);
+  return len < 0 ? 0 : ((size_t)len < size ? (size_t)len : size - 1);
 }
 
 /**
- * @brief Appends a new entry to the history log file.
+ * @brief Rewrites segments from before record numbers (format 2, a 12-byte
+ * header without firstRecord) in the current format, numbering their records
+ * in ring order from 0. The index offsets move with the header, so the index
+ * is dropped; queries then scan from segment starts until it fills again.
+ * A segment that cannot be rewritten is left for initHistoryStore() to remove.
+ */
+inline void upgradeHistorySegments() {
+  uint32_t seqs[HISTORY_SEGMENTS];
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < HISTORY_SEGMENTS; i++) {
+    File f = LittleFS.open(historySegmentPath(i), "r");
+    if (!f) continue;
+    HistorySegmentHeader header;
+    bool old = f.read((uint8_t*)&header, 12) == 12 && header.magic == HISTORY_SEGMENT_MAGIC &&
+               header.format == 2 && header.seq % HISTORY_SEGMENTS == i;
+    f.close();
+    if (!old) continue;
+    uint8_t at = count++;
+    for (; at > 0 && seqs[at - 1] > header.seq; at--) seqs[at] = seqs[at - 1]; // Oldest first
+    seqs[at] = header.seq;
+  }
+  if (count == 0) return;
+  LittleFS.remove(HISTORY_INDEX_PATH);
+  LittleFS.remove(HISTORY_INDEX_OLD_PATH);
+  uint32_t nextRecord = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    String path = historySegmentPath(seqs[i]);
+    File in = LittleFS.open(path, "r");
+    File out = LittleFS.open(HISTORY_UPGRADE_PATH, "w");
+    HistorySegmentHeader header = { HISTORY_SEGMENT_MAGIC, seqs[i], HISTORY_SEGMENT_FORMAT, 0, nextRecord };
+    bool ok = in && out && in.seek(12) && out.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+    uint8_t chunk[128];
+    size_t n;
+    while (ok && (n = in.read(chunk, sizeof(chunk))) > 0) ok = out.write(chunk, n) == n;
+    in.close();
+    out.close();
+    if (!ok || !LittleFS.remove(path) || !LittleFS.rename(HISTORY_UPGRADE_PATH, path)) {
+      LittleFS.remove(HISTORY_UPGRADE_PATH);
+      continue;
+    }
+    HistorySegmentReader reader;
+    HistoryRecord record;
+    if (reader.open(seqs[i])) {
+      while (reader.next(record)) {}
+      nextRecord = reader.number;
+    }
+    reader.close();
+    yield();
+  }
+  logDiagnostics("[INFO] History segments upgraded to numbered records.");
+}
+
+/**
+ * @brief Finds the newest segment and its fill level. Call once after LittleFS is mounted.
+ */
+inline void initHistoryStore() {
+  historyStore = HistoryStore();
+  memset(historySegmentCsvBytes, 0, sizeof(historySegmentCsvBytes));
+  upgradeHistorySegments();
+  bool found = false;
+  for (uint8_t i = 0; i < HISTORY_SEGMENTS; i++) {
+    char path[24];
+    snprintf(path, sizeof(path), HISTORY_SEGMENT_PATH_FMT, (unsigned)i);
+    File f = LittleFS.open(path, "r");
+    if (!f) continue;
+    HistorySegmentHeader header;
+    bool valid = f.read((uint8_t*)&header, sizeof(header)) == sizeof(header) && header.magic == HISTORY_SEGMENT_MAGIC &&
+                 header.format == HISTORY_SEGMENT_FORMAT && header.seq % HISTORY_SEGMENTS == i;
+    f.close();
+    if (!valid) {
+      LittleFS.remove(path); // Unreadable (e.g. an older segment format); free the space
+      continue;
+    }
+    if (!found || header.seq > historyStore.headSeq) {
+      historyStore.headSeq = header.seq;
+      found = true;
+    }
+  }
+  if (found) {
+    // Decode the newest segment to continue its delta chain. An incomplete
+    // trailing frame marks it full so appends start cleanly in the next one.
+    HistorySegmentReader reader;
+    if (reader.open(historyStore.headSeq)) {
+      HistoryRecord record;
+      uint32_t csvBytes = 0;
+      while (reader.next(record)) csvBytes += historyCsvLineLength(record);
+      historySegmentCsvBytes[historyStore.headSeq % HISTORY_SEGMENTS] = csvBytes;
+      historyStore.headBytes = reader.torn ? HISTORY_SEGMENT_BYTES : reader.file.size();
+      historyStore.codec = reader.state;
+      historyStore.sinceKeyframe = reader.sinceKeyframe;
+      historyStore.headFirstRecord = reader.firstRecord;
+      historyStore.nextRecord = reader.number;
+      reader.close();
+    }
+    loadHistoryCsvSizes(); // From here on the sizes follow the writes
+  } else {
+    LittleFS.remove(HISTORY_INDEX_PATH); // Sequence numbers restart, so old entries would point into new segments
+    LittleFS.remove(HISTORY_INDEX_OLD_PATH);
+    LittleFS.remove(HISTORY_CSV_SIZES_PATH);
+  }
+  restoreHistoryBuffer(); // Samples staged before a soft reset go to flash before the rollups are rebuilt
+  flushHistoryBuffer();
+  importLegacyHistoryLog();
+  initHistoryRollups();
+}
+
+/**
+ * @brief Returns the number of records currently stored, from the record numbers.
+ */
+inline uint32_t historyRecordCount() {
+  uint32_t oldest = historyStore.nextRecord;
+  for (uint32_t seq = historyOldestSeq(); !historyRingIsEmpty() && seq <= historyStore.headSeq; seq++) {
+    HistorySegmentReader reader;
+    bool found = reader.open(seq);
+    reader.close();
+    if (found) {
+      oldest = reader.firstRecord;
+      break;
+    }
+  }
+  return historyNextRecord() - oldest;
+}
+
+/**
+ * @brief Returns the bytes used by the history segment and index files.
+ */
+inline size_t historyStorageBytes() {
+  size_t total = 0;
+  for (uint8_t i = 0; i < HISTORY_SEGMENTS + 2; i++) {
+    char path[24];
+    snprintf(path, sizeof(path), HISTORY_SEGMENT_PATH_FMT, (unsigned)i);
+    File f = LittleFS.open(i < HISTORY_SEGMENTS ? path : (i == HISTORY_SEGMENTS ? HISTORY_INDEX_PATH : HISTORY_INDEX_OLD_PATH), "r");
+    if (f) total += f.size();
+    f.close();
+  }
+  return total;
+}
+
+/**
+ * @brief Deletes all history segments and the index.
+ */
+inline void clearHistoryStore() {
+  for (uint8_t i = 0; i < HISTORY_SEGMENTS; i++) {
+    char path[24];
+    snprintf(path, sizeof(path), HISTORY_SEGMENT_PATH_FMT, (unsigned)i);
+    if (LittleFS.exists(path)) LittleFS.remove(path);
+  }
+  LittleFS.remove(HISTORY_INDEX_PATH);
+  LittleFS.remove(HISTORY_INDEX_OLD_PATH);
+  LittleFS.remove(HISTORY_CSV_SIZES_PATH);
+  uint32_t nextRecord = historyNextRecord(); // Keep numbering so clients' cursors stay valid until restart
+  historyStore = HistoryStore();
+  historyStore.nextRecord = nextRecord;
+  memset(historySegmentCsvBytes, 0, sizeof(historySegmentCsvBytes));
+  historyBuffer.count = 0;
+  mirrorHistoryBuffer();
+  for (uint8_t i = 0; i < ROLLUP_TIER_COUNT; i++) {
+    LittleFS.remove(rollupTiers[i].path);
+    LittleFS.remove(rollupTiers[i].oldPath);
+    rollupTiers[i].lastFlushed = 0;
+    rollupTiers[i].acc = RollupAccumulator();
+  }
+  rollupLastTimestamp = 0;
+  rollupLastFanOn = false;
+  rollupRebuild.end();
+  rollupRebuilding = false;
+}
+
+/**
+ * @brief Returns the timestamp of the oldest stored record, or 0 if there is none.
+ */
+inline uint32_t historyOldestTimestamp() {
+  for (uint32_t seq = historyOldestSeq(); !historyRingIsEmpty() && seq <= historyStore.headSeq; seq++) {
+    HistorySegmentReader reader;
+    HistoryRecord first;
+    bool found = reader.open(seq) && reader.next(first);
+    reader.close();
+    if (found) return first.timestamp;
+  }
+  return historyBuffer.count ? historyBuffer.records[0].timestamp : 0;
+}
+
+/**
+ * @brief Returns the timestamp of the newest stored record with a synced clock, or 0.
+ */
+inline uint32_t historyNewestTimestamp() {
+  for (uint8_t i = historyBuffer.count; i > 0; i--) {
+    if (historyBuffer.records[i - 1].timestamp) return historyBuffer.records[i - 1].timestamp;
+  }
+  return historyStore.headBytes && historyStore.codec.hasPrev ? historyStore.codec.prev.timestamp : 0;
+}
+
+/**
+ * @brief Walks the records between from and to (inclusive), decimated to at most maxPoints.
+ * Uses min/max bucketing: the range is split into maxPoints / 2 equal buckets
+ * and each bucket contributes its coolest and hottest attic sample, in the order
+ * they were recorded, so peaks survive decimation. Only one bucket is held in memory.
+ * The range is either a time range, which skips records without a synced
+ * timestamp, or (beginSince()) a range of record numbers, which keeps them.
+ * Like HistoryCursor, the walk is done one next() call at a time, each decoding
+ * at most a given number of records.
+ */
+struct HistoryQuery {
+  HistoryCursor cursor;
+  uint32_t from = 0;
+  uint32_t to = 0;
+  uint32_t width = 1;
+  uint32_t bucket = 0;
+  bool byRecord = false; // from/to are record numbers; to is exclusive
+  HistoryRecord lo, hi;
+  uint32_t loNumber = 0, hiNumber = 0;
+  HistoryRecord queued; // Later record of a bucket whose earlier one was just returned
+  bool have = false;    // lo/hi hold a bucket in progress
+  bool hasQueued = false;
+  bool scanned = false; // No more records in range
+
+  void begin(uint32_t rangeFrom, uint32_t rangeTo, uint16_t maxPoints) {
+    start(rangeFrom, rangeTo, maxPoints, false);
+    cursor.begin(from);
+  }
+
+  /**
+   * @brief Walks the records numbered since or later that are stored now
+   * (up to historyNextRecord()), whatever their timestamps.
+   */
+  void beginSince(uint32_t since, uint16_t maxPoints) {
+    start(since, historyNextRecord(), maxPoints, true);
+    cursor.beginAtRecord(since);
+  }
+
+  /**
+   * @brief Returns the next kept record, oldest first.
+   * @param steps Records the call may still decode; decremented as it goes.
+   * @return false when done() or when steps ran out first.
+   */
+  bool next(HistoryRecord& out, uint16_t& steps) {
+    if (hasQueued) {
+      out = queued;
+      hasQueued = false;
+      return true;
+    }
+    HistoryRecord record;
+    while (!scanned && steps > 0) {
+      steps--;
+      if (!cursor.next(record) || (byRecord && cursor.number >= to)) {
+        scanned = true;
+        cursor.end();
+        break;
+      }
+      uint32_t key = byRecord ? cursor.number : record.timestamp;
+      // A time range is not a stopping point: after a clock step back, later
+      // records can be older than the range
+      if (!byRecord && (record.timestamp == 0 || record.timestamp < from || record.timestamp > to)) continue;
+      if (key < from) continue;
+      uint32_t b = (key - from) / width;
+      if (have && b != bucket) {
+        takeBucket(out);
+        startBucket(record, b);
+        return true;
+      }
+      if (!have) {
+        startBucket(record, b);
+      } else {
+        if (record.atticTemp < lo.atticTemp) {
+          lo = record;
+          loNumber = cursor.number;
+        }
+        if (record.atticTemp > hi.atticTemp) {
+          hi = record;
+          hiNumber = cursor.number;
+        }
+      }
+    }
+    if (scanned && have) {
+      takeBucket(out);
+      return true;
+    }
+    return false;
+  }
+
+  bool done() const { return scanned && !have && !hasQueued; }
+
+  void end() { cursor.end(); }
+
+  void start(uint32_t rangeFrom, uint32_t rangeTo, uint16_t maxPoints, bool records) {
+    from = rangeFrom;
+    to = rangeTo;
+    byRecord = records;
+    uint16_t buckets = maxPoints >= 2 ? maxPoints / 2 : 1;
+    width = (to - from) / buckets + 1;
+    have = hasQueued = scanned = false;
+  }
+
+  void startBucket(const HistoryRecord& record, uint32_t b) {
+    lo = hi = record;
+    loNumber = hiNumber = cursor.number;
+    bucket = b;
+    have = true;
+  }
+
+  // Returns the bucket's earlier record and queues the later one.
+  void takeBucket(HistoryRecord& out) {
+    have = false;
+    if (loNumber == hiNumber) {
+      out = lo;
+      return;
+    }
+    out = loNumber < hiNumber ? lo : hi;
+    queued = loNumber < hiNumber ? hi : lo;
+    hasQueued = true;
+  }
+};
+
+/**
+ * @brief Appends a new entry to the history, staged in the write-back buffer.
  * @param atticTemp Current attic temperature.
  * @param outdoorTemp Current outdoor temperature.
  * @param humidity Current attic humidity.
  * @param fanOn Current state of the fan.
  */
 inline void appendHistoryLog(float atticTemp, float outdoorTemp, float humidity, bool fanOn) {
-  // Check if the log needs pruning before writing
-  pruneHistoryLog();
+  HistoryRecord record = {};
 
-  File historyFile = LittleFS.open(HISTORY_LOG_PATH, "a");
-  if (!historyFile) {
-    logDiagnostics("[ERROR] Could not open history log for writing.");
-    return;
-  }
-
-  // If the file is empty, write the header first.
-  if (historyFile.size() == 0) {
-    historyFile.println("timestamp,attic_temp,outdoor_temp,humidity,fan_on");
-  }
-
-  // --- Timestamp Logic ---
-  char timestampStr[20]; // Buffer for "YYYY-MM-DDTHH:MM"
+  // Store the timestamp only if the year is valid (time has been synced)
   time_t now;
   time(&now);
   struct tm* timeinfo = localtime(&now);
-
-  // Format the timestamp only if the year is valid (time has been synced)
   if (timeinfo && timeinfo->tm_year > 70) { // Year is since 1900, so >70 is a safe check for a valid year like 2023
-    strftime(timestampStr, sizeof(timestampStr), "%Y-%m-%dT%H:%M", timeinfo);
-  } else {
-    timestampStr[0] = '\0'; // Leave timestamp blank if time not synced
+    record.timestamp = (uint32_t)now;
   }
-  // --- End Timestamp Logic ---
 
-  // Format the data as a CSV line.
-  historyFile.printf("%s,%.2f,%.2f,%.2f,%d\n", timestampStr, atticTemp, outdoorTemp, humidity, fanOn ? 1 : 0);
-  historyFile.close();
+  record.atticTemp = historyFixedPoint(atticTemp);
+  record.outdoorTemp = historyFixedPoint(outdoorTemp);
+  record.humidity = (uint16_t)historyFixedPoint(humidity);
+  record.flags = fanOn ? HISTORY_FLAG_FAN_ON : 0;
+
+  historyBuffer.records[historyBuffer.count++] = record;
+  mirrorHistoryBuffer();
+  if (!rollupRebuilding) updateHistoryRollups(record); // Otherwise the rebuild gets to it
+
+  // Flush when full, and on fan changes so the switch is on flash promptly
+  bool fanChanged = historyBuffer.lastFanOn >= 0 && historyBuffer.lastFanOn != (fanOn ? 1 : 0);
+  historyBuffer.lastFanOn = fanOn ? 1 : 0;
+  if (historyBuffer.count >= HISTORY_BUFFER_RECORDS || fanChanged) flushHistoryBuffer();
 }
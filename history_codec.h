@@ -0,0 +1,227 @@
+#pragma once
+#include <Arduino.h>
+#include <LittleFS.h>
+
+/**
+ * @brief Compressed encoding of history records.
+ *
+ * Segments hold a sequence of frames, one per flush of the write-back buffer:
+ *   [keyframe flag | record count: 1 byte][bit stream, padded to a whole byte]
+ * The first record of a keyframe stores its base values in full. Every later
+ * record stores, for each field, the change in its delta from the previous
+ * record (delta-of-delta), zig-zag mapped and written with a prefix code:
+ *   0 -> 0    10 + 4 bits    110 + 8 bits    1110 + 16 bits    1111 + 32 bits
+ * A steady logging interval costs one bit and a smooth temperature curve a few
+ * bits per field. The fan state is one bit per record, set when it changed.
+ * Decoding is a forward scan that holds one record of state, so readers can
+ * stream a segment straight from the file, starting at any keyframe.
+ */
+
+#define HISTORY_FLAG_FAN_ON 0x01
+
+// One sample. Temperatures in 1/100 °F, humidity in 1/100 %.
+struct __attribute__((packed)) HistoryRecord {
+  uint32_t timestamp;   // Unix time, 0 if the clock was not synced yet
+  int16_t atticTemp;
+  int16_t outdoorTemp;
+  uint16_t humidity;
+  uint8_t flags;        // HISTORY_FLAG_*
+  uint8_t reserved;
+};
+
+#define HISTORY_CODEC_FIELDS 4          // timestamp, attic, outdoor, humidity
+#define HISTORY_CODEC_MAX_RECORD_BYTES 19 // Worst case: 1 + 4 * 36 bits
+#define HISTORY_FRAME_KEYFRAME 0x80     // Frame starts a new delta chain
+#define HISTORY_FRAME_COUNT_MASK 0x7F
+
+// Encoder/decoder state carried from one record to the next within a segment.
+struct HistoryCodecState {
+  HistoryRecord prev = {};
+  uint32_t delta[HISTORY_CODEC_FIELDS] = {}; // Previous deltas, in wrapping 32-bit arithmetic
+  bool hasPrev = false;
+};
+
+inline void historyCodecFields(const HistoryRecord& r, uint32_t* f) {
+  f[0] = r.timestamp;
+  f[1] = (uint32_t)(int32_t)r.atticTemp;
+  f[2] = (uint32_t)(int32_t)r.outdoorTemp;
+  f[3] = r.humidity;
+}
+
+// MSB-first bit writer into a caller-provided buffer.
+struct HistoryBitWriter {
+  uint8_t* buf;
+  size_t cap;
+  size_t bitPos = 0;
+  bool overflow = false;
+
+  HistoryBitWriter(uint8_t* buffer, size_t capacity) : buf(buffer), cap(capacity) {}
+
+  void put(uint32_t value, uint8_t bits) {
+    while (bits--) {
+      size_t byte = bitPos >> 3;
+      if (byte >= cap) {
+        overflow = true;
+        return;
+      }
+      if ((bitPos & 7) == 0) buf[byte] = 0;
+      if ((value >> bits) & 1) buf[byte] |= 0x80 >> (bitPos & 7);
+      bitPos++;
+    }
+  }
+  void align() { bitPos = (bitPos + 7) & ~(size_t)7; }
+  size_t bytes() const { return (bitPos + 7) >> 3; }
+};
+
+// MSB-first bit reader that streams from a file through a small buffer.
+struct HistoryBitReader {
+  File* file = nullptr;
+  uint8_t buf[32];
+  uint8_t len = 0;
+  uint8_t pos = 0;
+  uint8_t bit = 0;       // Next bit within buf[pos]
+  size_t bufStart = 0;   // File offset of buf[0]
+
+  void begin(File* f) {
+    file = f;
+    len = pos = bit = 0;
+    bufStart = f->position();
+  }
+  bool fill() {
+    if (pos < len) return true;
+    bufStart += len;
+    len = file->read(buf, sizeof(buf));
+    pos = 0;
+    return len > 0;
+  }
+  bool get(uint32_t& value, uint8_t bits) {
+    value = 0;
+    while (bits--) {
+      if (!fill()) return false;
+      value = (value << 1) | ((buf[pos] >> (7 - bit)) & 1);
+      if (++bit == 8) {
+        bit = 0;
+        pos++;
+      }
+    }
+    return true;
+  }
+  void align() {
+    if (bit) {
+      bit = 0;
+      pos++;
+    }
+  }
+  // File offset of the next unread bit's byte (after align(), of the next byte).
+  size_t position() const { return bufStart + pos; }
+};
+
+inline void historyPutCode(HistoryBitWriter& w, uint32_t dod) {
+  uint32_t z = (dod << 1) ^ (uint32_t)((int32_t)dod >> 31); // Zig-zag
+  if (z == 0) {
+    w.put(0, 1);
+  } else if (z < 16) {
+    w.put(0x2, 2);
+    w.put(z, 4);
+  } else if (z < 256) {
+    w.put(0x6, 3);
+    w.put(z, 8);
+  } else if (z < 65536) {
+    w.put(0xE, 4);
+    w.put(z, 16);
+  } else {
+    w.put(0xF, 4);
+    w.put(z, 32);
+  }
+}
+
+inline bool historyGetCode(HistoryBitReader& r, uint32_t& dod) {
+  static const uint8_t widths[4] = { 4, 8, 16, 32 };
+  uint32_t b;
+  uint8_t ones = 0;
+  while (ones < 4) {
+    if (!r.get(b, 1)) return false;
+    if (!b) break;
+    ones++;
+  }
+  uint32_t z = 0;
+  if (ones > 0 && !r.get(z, widths[ones - 1])) return false;
+  dod = (z >> 1) ^ (0 - (z & 1));
+  return true;
+}
+
+/**
+ * @brief Encodes records as one frame.
+ * @param keyframe Start a new delta chain, so the frame can be decoded without what precedes it.
+ * @return The frame length in bytes, or 0 if it does not fit in cap.
+ */
+inline size_t historyEncodeFrame(HistoryCodecState& state, const HistoryRecord* records, uint8_t count, bool keyframe,
+                                 uint8_t* out, size_t cap) {
+  HistoryBitWriter w(out, cap);
+  if (keyframe) state.hasPrev = false;
+  w.put((count & HISTORY_FRAME_COUNT_MASK) | (keyframe ? HISTORY_FRAME_KEYFRAME : 0), 8);
+  for (uint8_t i = 0; i < count; i++) {
+    const HistoryRecord& rec = records[i];
+    uint32_t f[HISTORY_CODEC_FIELDS];
+    historyCodecFields(rec, f);
+    if (!state.hasPrev) {
+      w.put(f[0], 32);
+      for (uint8_t k = 1; k < HISTORY_CODEC_FIELDS; k++) w.put(f[k] & 0xFFFF, 16);
+      w.put(rec.flags & HISTORY_FLAG_FAN_ON, 1);
+      memset(state.delta, 0, sizeof(state.delta));
+    } else {
+      uint32_t p[HISTORY_CODEC_FIELDS];
+      historyCodecFields(state.prev, p);
+      w.put((rec.flags ^ state.prev.flags) & HISTORY_FLAG_FAN_ON ? 1 : 0, 1);
+      for (uint8_t k = 0; k < HISTORY_CODEC_FIELDS; k++) {
+        uint32_t delta = f[k] - p[k];
+        historyPutCode(w, delta - state.delta[k]);
+        state.delta[k] = delta;
+      }
+    }
+    state.prev = rec;
+    state.hasPrev = true;
+  }
+  w.align();
+  return w.overflow ? 0 : w.bytes();
+}
+
+/**
+ * @brief Decodes the next record of a frame.
+ * @return false if the bit stream ended early (torn write).
+ */
+inline bool historyDecodeRecord(HistoryCodecState& state, HistoryBitReader& r, HistoryRecord& rec) {
+  rec = HistoryRecord();
+  uint32_t v;
+  if (!state.hasPrev) {
+    uint32_t f[HISTORY_CODEC_FIELDS];
+    for (uint8_t k = 0; k < HISTORY_CODEC_FIELDS; k++) {
+      if (!r.get(f[k], k == 0 ? 32 : 16)) return false;
+    }
+    if (!r.get(v, 1)) return false;
+    rec.timestamp = f[0];
+    rec.atticTemp = (int16_t)f[1];
+    rec.outdoorTemp = (int16_t)f[2];
+    rec.humidity = (uint16_t)f[3];
+    rec.flags = v ? HISTORY_FLAG_FAN_ON : 0;
+    memset(state.delta, 0, sizeof(state.delta));
+  } else {
+    if (!r.get(v, 1)) return false;
+    uint32_t p[HISTORY_CODEC_FIELDS], f[HISTORY_CODEC_FIELDS];
+    historyCodecFields(state.prev, p);
+    for (uint8_t k = 0; k < HISTORY_CODEC_FIELDS; k++) {
+      uint32_t dod;
+      if (!historyGetCode(r, dod)) return false;
+      state.delta[k] += dod;
+      f[k] = p[k] + state.delta[k];
+    }
+    rec.timestamp = f[0];
+    rec.atticTemp = (int16_t)f[1];
+    rec.outdoorTemp = (int16_t)f[2];
+    rec.humidity = (uint16_t)f[3];
+    rec.flags = (state.prev.flags ^ (v ? HISTORY_FLAG_FAN_ON : 0)) & HISTORY_FLAG_FAN_ON;
+  }
+  state.prev = rec;
+  state.hasPrev = true;
+  return true;
+}
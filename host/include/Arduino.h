@@ -0,0 +1,116 @@
+#pragma once
+// Host (Linux) stand-in for the ESP8266 Arduino core.
+// Only the subset of the core API used by the controller sketch is provided.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <time.h>
+#include <functional>
+
+#include "pgmspace.h"
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "IPAddress.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x00
+#define OUTPUT       0x01
+#define INPUT_PULLUP 0x02
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+// NodeMCU pin aliases (GPIO numbers)
+static const uint8_t D0 = 16;
+static const uint8_t D1 = 5;
+static const uint8_t D2 = 4;
+static const uint8_t D3 = 0;
+static const uint8_t D4 = 2;
+static const uint8_t D5 = 14;
+static const uint8_t D6 = 12;
+static const uint8_t D7 = 13;
+static const uint8_t D8 = 15;
+static const uint8_t A0 = 17;
+
+// === Timing ===
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// === GPIO ===
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+void analogWrite(uint8_t pin, int val);
+void analogWriteRange(uint32_t range);
+int analogRead(uint8_t pin);
+
+// === SNTP ===
+void configTime(const char* tz, const char* server1, const char* server2 = nullptr, const char* server3 = nullptr);
+
+// === Serial ===
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long baud);
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  void flush() override;
+  using Print::write;
+};
+extern HardwareSerial Serial;
+
+// === Chip services (ESP object) ===
+enum rst_reason {
+  REASON_DEFAULT_RST = 0,      // Power on
+  REASON_WDT_RST = 1,          // Hardware watchdog
+  REASON_EXCEPTION_RST = 2,    // Exception
+  REASON_SOFT_WDT_RST = 3,     // Software watchdog
+  REASON_SOFT_RESTART = 4,     // ESP.restart()
+  REASON_DEEP_SLEEP_AWAKE = 5,
+  REASON_EXT_SYS_RST = 6       // External reset pin
+};
+
+struct rst_info {
+  uint32_t reason;
+  uint32_t exccause;
+  uint32_t epc1;
+  uint32_t epc2;
+  uint32_t epc3;
+  uint32_t excvaddr;
+  uint32_t depc;
+};
+
+class EspClass {
+public:
+  bool rtcUserMemoryRead(uint32_t offset, uint32_t* data, size_t size);
+  bool rtcUserMemoryWrite(uint32_t offset, uint32_t* data, size_t size);
+  uint32_t getFreeHeap();
+  uint16_t getMaxFreeBlockSize();
+  uint8_t getHeapFragmentation();
+  uint32_t getChipId();
+  uint32_t getCycleCount();
+  uint32_t getCpuFreqMHz() { return 80; }
+  String getResetReason();
+  rst_info* getResetInfoPtr();
+  String getCoreVersion() { return String("host"); }
+  [[noreturn]] void restart();
+  [[noreturn]] void reset() { restart(); }
+};
+extern EspClass ESP;
@@ -0,0 +1,719 @@
+#pragma once
+// Host stand-in for the subset of the ArduinoJson 6 API used by the sketch.
+// Documents are a heap-backed DOM; the fixed capacity of StaticJsonDocument
+// is accepted but not enforced. Point ARDUINOJSON_INCLUDE_DIR at a real
+// ArduinoJson checkout to build against the library itself instead.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+
+namespace ajson_host {
+
+struct Node {
+  enum Type { Null, Bool, Int, UInt, Float, Double, Str, Raw, Object, Array };
+  Type type = Null;
+  bool b = false;
+  long long i = 0;
+  unsigned long long u = 0;
+  double d = 0;
+  std::string s;
+  std::vector<std::string> keys;                  // Object member names
+  std::vector<std::unique_ptr<Node>> children;    // Object values or array items
+
+  void reset() {
+    type = Null; b = false; i = 0; u = 0; d = 0;
+    s.clear(); keys.clear(); children.clear();
+  }
+  void copyFrom(const Node& other) {
+    reset();
+    type = other.type; b = other.b; i = other.i; u = other.u; d = other.d; s = other.s; keys = other.keys;
+    for (const auto& child : other.children) {
+      children.emplace_back(new Node());
+      children.back()->copyFrom(*child);
+    }
+  }
+  bool isNumber() const { return type == Int || type == UInt || type == Float || type == Double; }
+  double number() const {
+    switch (type) {
+      case Int: return static_cast<double>(i);
+      case UInt: return static_cast<double>(u);
+      case Float: case Double: return d;
+      case Bool: return b ? 1 : 0;
+      default: return 0;
+    }
+  }
+  Node* member(const std::string& key, bool create) {
+    if (type == Null && create) type = Object;
+    if (type != Object) return nullptr;
+    for (size_t k = 0; k < keys.size(); k++) {
+      if (keys[k] == key) return children[k].get();
+    }
+    if (!create) return nullptr;
+    keys.push_back(key);
+    children.emplace_back(new Node());
+    return children.back().get();
+  }
+  Node* element(size_t index, bool create) {
+    if (type == Null && create) type = Array;
+    if (type != Array) return nullptr;
+    if (index < children.size()) return children[index].get();
+    if (!create) return nullptr;
+    while (children.size() <= index) children.emplace_back(new Node());
+    return children[index].get();
+  }
+  Node* append() {
+    if (type == Null) type = Array;
+    if (type != Array) return nullptr;
+    children.emplace_back(new Node());
+    return children.back().get();
+  }
+};
+
+inline void writeString(std::string& out, const std::string& s) {
+  out += '"';
+  for (unsigned char c : s) {
+    switch (c) {
+      case '"': out += "\\\""; break;
+      case '\\': out += "\\\\"; break;
+      case '\n': out += "\\n"; break;
+      case '\r': out += "\\r"; break;
+      case '\t': out += "\\t"; break;
+      case '\b': out += "\\b"; break;
+      case '\f': out += "\\f"; break;
+      default:
+        if (c < 0x20) {
+          char buf[8];
+          snprintf(buf, sizeof(buf), "\\u%04x", c);
+          out += buf;
+        } else {
+          out += static_cast<char>(c);
+        }
+    }
+  }
+  out += '"';
+}
+
+inline void serialize(const Node* n, std::string& out) {
+  char buf[32];
+  if (!n) { out += "null"; return; }
+  switch (n->type) {
+    case Node::Null: out += "null"; break;
+    case Node::Bool: out += n->b ? "true" : "false"; break;
+    case Node::Int: snprintf(buf, sizeof(buf), "%lld", n->i); out += buf; break;
+    case Node::UInt: snprintf(buf, sizeof(buf), "%llu", n->u); out += buf; break;
+    case Node::Float:
+    case Node::Double:
+      if (isnan(n->d) || isinf(n->d)) { out += "null"; break; }
+      snprintf(buf, sizeof(buf), n->type == Node::Float ? "%.7g" : "%.15g", n->d);
+      out += buf;
+      break;
+    case Node::Str: writeString(out, n->s); break;
+    case Node::Raw: out += n->s; break;
+    case Node::Object:
+      out += '{';
+      for (size_t k = 0; k < n->keys.size(); k++) {
+        if (k) out += ',';
+        writeString(out, n->keys[k]);
+        out += ':';
+        serialize(n->children[k].get(), out);
+      }
+      out += '}';
+      break;
+    case Node::Array:
+      out += '[';
+      for (size_t k = 0; k < n->children.size(); k++) {
+        if (k) out += ',';
+        serialize(n->children[k].get(), out);
+      }
+      out += ']';
+      break;
+  }
+}
+
+struct SerializedValue { std::string raw; };
+
+} // namespace ajson_host
+
+inline ajson_host::SerializedValue serialized(const String& raw) { return { raw.str() }; }
+inline ajson_host::SerializedValue serialized(const char* raw) { return { raw ? raw : "" }; }
+inline ajson_host::SerializedValue serialized(const char* raw, size_t len) { return { std::string(raw, len) }; }
+
+class JsonArray;
+class JsonObject;
+
+class JsonString {
+public:
+  explicit JsonString(const char* s) : _s(s) {}
+  const char* c_str() const { return _s; }
+  operator const char*() const { return _s; }
+private:
+  const char* _s;
+};
+
+class JsonVariant {
+public:
+  using Node = ajson_host::Node;
+  using Resolver = std::function<Node*(bool)>;
+
+  JsonVariant() : _resolve([](bool) -> Node* { return nullptr; }) {}
+  explicit JsonVariant(Node* node) : _resolve([node](bool) { return node; }) {}
+  explicit JsonVariant(Resolver resolve) : _resolve(std::move(resolve)) {}
+  JsonVariant(const JsonVariant&) = default;
+
+  Node* node() const { return _resolve(false); }
+  Node* nodeOrCreate() const { return _resolve(true); }
+
+  JsonVariant operator[](const char* key) const {
+    Resolver parent = _resolve;
+    std::string k(key);
+    return JsonVariant(Resolver([parent, k](bool create) -> Node* {
+      Node* p = parent(create);
+      return p ? p->member(k, create) : nullptr;
+    }));
+  }
+  JsonVariant operator[](const String& key) const { return (*this)[key.c_str()]; }
+  JsonVariant operator[](int index) const { return at(static_cast<size_t>(index)); }
+  JsonVariant operator[](size_t index) const { return at(index); }
+
+  template <typename T> JsonVariant& operator=(const T& value) {
+    Node* n = nodeOrCreate();
+    if (n) assign(*n, value);
+    return *this;
+  }
+  JsonVariant& operator=(const JsonVariant& other) {
+    Node* n = nodeOrCreate();
+    if (n) assign(*n, other);
+    return *this;
+  }
+
+  bool isNull() const { Node* n = node(); return !n || n->type == Node::Null; }
+  bool containsKey(const char* key) const { Node* n = node(); return n && n->member(key, false); }
+  bool containsKey(const String& key) const { return containsKey(key.c_str()); }
+  size_t size() const { Node* n = node(); return n && (n->type == Node::Object || n->type == Node::Array) ? n->children.size() : 0; }
+  bool add(const JsonVariant& value);
+  template <typename T> bool add(const T& value) {
+    Node* n = nodeOrCreate();
+    Node* item = n ? n->append() : nullptr;
+    if (!item) return false;
+    assign(*item, value);
+    return true;
+  }
+  JsonObject createNestedObject() const;
+  JsonObject createNestedObject(const char* key) const;
+  JsonArray createNestedArray() const;
+  JsonArray createNestedArray(const char* key) const;
+
+  template <typename T> T as() const;
+  template <typename T> bool is() const;
+  template <typename T> operator T() const { return as<T>(); }
+
+  template <typename T> T operator|(const T& fallback) const {
+    return is<T>() ? as<T>() : fallback;
+  }
+  const char* operator|(const char* fallback) const {
+    Node* n = node();
+    return n && n->type == Node::Str ? n->s.c_str() : fallback;
+  }
+
+  static void assign(Node& n, const JsonVariant& value) {
+    Node* src = value.node();
+    if (src) n.copyFrom(*src); else n.reset();
+  }
+  static void assign(Node& n, const char* value) {
+    n.reset();
+    if (value) { n.type = Node::Str; n.s = value; }
+  }
+  static void assign(Node& n, char* value) { assign(n, static_cast<const char*>(value)); }
+  static void assign(Node& n, const String& value) { n.reset(); n.type = Node::Str; n.s = value.str(); }
+  static void assign(Node& n, const std::string& value) { n.reset(); n.type = Node::Str; n.s = value; }
+  static void assign(Node& n, std::nullptr_t) { n.reset(); }
+  static void assign(Node& n, const ajson_host::SerializedValue& value) { n.reset(); n.type = Node::Raw; n.s = value.raw; }
+  static void assign(Node& n, const JsonArray& value);
+  static void assign(Node& n, const JsonObject& value);
+  template <size_t N> static void assign(Node& n, const char (&value)[N]) { assign(n, static_cast<const char*>(value)); }
+  template <typename T>
+  static typename std::enable_if<std::is_arithmetic<T>::value>::type assign(Node& n, T value) {
+    n.reset();
+    if (std::is_same<T, bool>::value) { n.type = Node::Bool; n.b = value; }
+    else if (std::is_same<T, float>::value) { n.type = Node::Float; n.d = value; }
+    else if (std::is_floating_point<T>::value) { n.type = Node::Double; n.d = value; }
+    else if (std::is_signed<T>::value) { n.type = Node::Int; n.i = static_cast<long long>(value); }
+    else { n.type = Node::UInt; n.u = static_cast<unsigned long long>(value); }
+  }
+
+private:
+  JsonVariant at(size_t index) const {
+    Resolver parent = _resolve;
+    return JsonVariant(Resolver([parent, index](bool create) -> Node* {
+      Node* p = parent(create);
+      return p ? p->element(index, create) : nullptr;
+    }));
+  }
+
+  Resolver _resolve;
+};
+
+class JsonPair {
+public:
+  JsonPair(const std::string* key, ajson_host::Node* value) : _key(key), _value(value) {}
+  JsonString key() const { return JsonString(_key->c_str()); }
+  JsonVariant value() const { return JsonVariant(_value); }
+private:
+  const std::string* _key;
+  ajson_host::Node* _value;
+};
+
+class JsonObject {
+public:
+  using Node = ajson_host::Node;
+
+  class iterator {
+  public:
+    iterator(Node* node, size_t index) : _node(node), _index(index) {}
+    JsonPair operator*() const { return JsonPair(&_node->keys[_index], _node->children[_index].get()); }
+    iterator& operator++() { _index++; return *this; }
+    bool operator!=(const iterator& other) const { return _index != other._index; }
+  private:
+    Node* _node;
+    size_t _index;
+  };
+
+  JsonObject() : _node(nullptr) {}
+  explicit JsonObject(Node* node) : _node(node && node->type == Node::Object ? node : nullptr) {}
+
+  JsonVariant operator[](const char* key) const { return JsonVariant(_node)[key]; }
+  JsonVariant operator[](const String& key) const { return JsonVariant(_node)[key.c_str()]; }
+  bool containsKey(const char* key) const { return _node && _node->member(key, false); }
+  bool containsKey(const String& key) const { return containsKey(key.c_str()); }
+  size_t size() const { return _node ? _node->children.size() : 0; }
+  bool isNull() const { return _node == nullptr; }
+  JsonObject createNestedObject(const char* key) const { return JsonVariant(_node).createNestedObject(key); }
+  JsonArray createNestedArray(const char* key) const;
+  iterator begin() const { return iterator(_node, 0); }
+  iterator end() const { return iterator(_node, size()); }
+  Node* node() const { return _node; }
+
+private:
+  Node* _node;
+};
+
+class JsonArray {
+public:
+  using Node = ajson_host::Node;
+
+  class iterator {
+  public:
+    iterator(Node* node, size_t index) : _node(node), _index(index) {}
+    JsonVariant operator*() const { return JsonVariant(_node->children[_index].get()); }
+    iterator& operator++() { _index++; return *this; }
+    bool operator!=(const iterator& other) const { return _index != other._index; }
+  private:
+    Node* _node;
+    size_t _index;
+  };
+
+  JsonArray() : _node(nullptr) {}
+  explicit JsonArray(Node* node) : _node(node && node->type == Node::Array ? node : nullptr) {}
+
+  JsonVariant operator[](size_t index) const { return JsonVariant(_node)[index]; }
+  JsonVariant operator[](int index) const { return JsonVariant(_node)[static_cast<size_t>(index)]; }
+  template <typename T> bool add(const T& value) const { return _node && JsonVariant(_node).add(value); }
+  JsonObject createNestedObject() const { return JsonVariant(_node).createNestedObject(); }
+  JsonArray createNestedArray() const { return JsonVariant(_node).createNestedArray(); }
+  size_t size() const { return _node ? _node->children.size() : 0; }
+  bool isNull() const { return _node == nullptr; }
+  iterator begin() const { return iterator(_node, 0); }
+  iterator end() const { return iterator(_node, size()); }
+  Node* node() const { return _node; }
+
+private:
+  Node* _node;
+};
+
+inline JsonArray JsonObject::createNestedArray(const char* key) const { return JsonVariant(_node).createNestedArray(key); }
+
+inline JsonObject JsonVariant::createNestedObject() const {
+  Node* n = nodeOrCreate();
+  Node* item = n ? n->append() : nullptr;
+  if (item) item->type = Node::Object;
+  return JsonObject(item);
+}
+inline JsonObject JsonVariant::createNestedObject(const char* key) const {
+  Node* n = (*this)[key].nodeOrCreate();
+  if (!n) return JsonObject();
+  n->reset();
+  n->type = Node::Object;
+  return JsonObject(n);
+}
+inline JsonArray JsonVariant::createNestedArray() const {
+  Node* n = nodeOrCreate();
+  Node* item = n ? n->append() : nullptr;
+  if (item) item->type = Node::Array;
+  return JsonArray(item);
+}
+inline JsonArray JsonVariant::createNestedArray(const char* key) const {
+  Node* n = (*this)[key].nodeOrCreate();
+  if (!n) return JsonArray();
+  n->reset();
+  n->type = Node::Array;
+  return JsonArray(n);
+}
+inline bool JsonVariant::add(const JsonVariant& value) {
+  Node* n = nodeOrCreate();
+  Node* item = n ? n->append() : nullptr;
+  if (!item) return false;
+  assign(*item, value);
+  return true;
+}
+inline void JsonVariant::assign(Node& n, const JsonArray& value) {
+  if (value.node()) n.copyFrom(*value.node()); else n.reset();
+}
+inline void JsonVariant::assign(Node& n, const JsonObject& value) {
+  if (value.node()) n.copyFrom(*value.node()); else n.reset();
+}
+
+namespace ajson_host {
+template <typename T, typename Enable = void> struct Converter;
+
+template <typename T>
+struct Converter<T, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>::type> {
+  static T get(const Node* n) {
+    if (!n) return 0;
+    switch (n->type) {
+      case Node::Int: return static_cast<T>(n->i);
+      case Node::UInt: return static_cast<T>(n->u);
+      case Node::Float: case Node::Double: return static_cast<T>(n->d);
+      case Node::Bool: return static_cast<T>(n->b ? 1 : 0);
+      default: return 0;
+    }
+  }
+  static bool is(const Node* n) {
+    if (!n || !n->isNumber()) return false;
+    return std::is_floating_point<T>::value || n->type == Node::Int || n->type == Node::UInt;
+  }
+};
+template <> struct Converter<bool> {
+  static bool get(const Node* n) {
+    if (!n) return false;
+    if (n->type == Node::Bool) return n->b;
+    if (n->isNumber()) return n->number() != 0;
+    return false;
+  }
+  static bool is(const Node* n) { return n && n->type == Node::Bool; }
+};
+template <> struct Converter<const char*> {
+  static const char* get(const Node* n) { return n && n->type == Node::Str ? n->s.c_str() : nullptr; }
+  static bool is(const Node* n) { return n && n->type == Node::Str; }
+};
+template <> struct Converter<String> {
+  static String get(const Node* n) {
+    if (n && n->type == Node::Str) return String(n->s);
+    std::string out;
+    serialize(n, out);
+    return String(out);
+  }
+  static bool is(const Node* n) { return n && n->type == Node::Str; }
+};
+template <> struct Converter<JsonObject> {
+  static JsonObject get(Node* n) { return JsonObject(n); }
+  static bool is(const Node* n) { return n && n->type == Node::Object; }
+};
+template <> struct Converter<JsonArray> {
+  static JsonArray get(Node* n) { return JsonArray(n); }
+  static bool is(const Node* n) { return n && n->type == Node::Array; }
+};
+template <> struct Converter<JsonVariant> {
+  static JsonVariant get(Node* n) { return JsonVariant(n); }
+  static bool is(const Node*) { return true; }
+};
+} // namespace ajson_host
+
+template <typename T> T JsonVariant::as() const {
+  return ajson_host::Converter<typename std::decay<T>::type>::get(node());
+}
+template <typename T> bool JsonVariant::is() const {
+  return ajson_host::Converter<typename std::decay<T>::type>::is(node());
+}
+
+class DeserializationError {
+public:
+  enum Code { Ok, EmptyInput, IncompleteInput, InvalidInput, NoMemory, TooDeep };
+  DeserializationError(Code code = Ok) : _code(code) {}
+  explicit operator bool() const { return _code != Ok; }
+  bool operator==(Code code) const { return _code == code; }
+  bool operator!=(Code code) const { return _code != code; }
+  Code code() const { return _code; }
+  const char* c_str() const {
+    static const char* const names[] = { "Ok", "EmptyInput", "IncompleteInput", "InvalidInput", "NoMemory", "TooDeep" };
+    return names[_code];
+  }
+private:
+  Code _code;
+};
+
+class JsonDocument {
+public:
+  using Node = ajson_host::Node;
+
+  JsonDocument() : _root(new Node()) {}
+  JsonDocument(const JsonDocument& other) : _root(new Node()) { _root->copyFrom(*other._root); }
+  JsonDocument& operator=(const JsonDocument& other) { _root->copyFrom(*other._root); return *this; }
+
+  JsonVariant operator[](const char* key) { return JsonVariant(_root.get())[key]; }
+  JsonVariant operator[](const String& key) { return JsonVariant(_root.get())[key.c_str()]; }
+  JsonVariant operator[](int index) { return JsonVariant(_root.get())[index]; }
+  const JsonVariant operator[](const char* key) const { return JsonVariant(_root.get())[key]; }
+
+  bool containsKey(const char* key) const { return _root->member(key, false) != nullptr; }
+  bool containsKey(const String& key) const { return containsKey(key.c_str()); }
+  JsonObject createNestedObject(const char* key) { return JsonVariant(_root.get()).createNestedObject(key); }
+  JsonObject createNestedObject() { return JsonVariant(_root.get()).createNestedObject(); }
+  JsonArray createNestedArray(const char* key) { return JsonVariant(_root.get()).createNestedArray(key); }
+  JsonArray createNestedArray() { return JsonVariant(_root.get()).createNestedArray(); }
+  template <typename T> bool add(const T& value) { return JsonVariant(_root.get()).add(value); }
+  template <typename T> T to() { _root->reset(); return JsonVariant(_root.get()).as<T>(); }
+  template <typename T> T as() const { return JsonVariant(_root.get()).as<T>(); }
+  template <typename T> bool is() const { return JsonVariant(_root.get()).is<T>(); }
+  bool isNull() const { return _root->type == Node::Null; }
+  size_t size() const { return JsonVariant(_root.get()).size(); }
+  void clear() { _root->reset(); }
+  bool overflowed() const { return false; }
+  size_t memoryUsage() const { std::string out; ajson_host::serialize(_root.get(), out); return out.size(); }
+
+  Node* root() const { return _root.get(); }
+
+private:
+  std::unique_ptr<Node> _root;
+};
+
+template <>
+inline JsonObject JsonDocument::to<JsonObject>() {
+  _root->reset();
+  _root->type = Node::Object;
+  return JsonObject(_root.get());
+}
+template <>
+inline JsonArray JsonDocument::to<JsonArray>() {
+  _root->reset();
+  _root->type = Node::Array;
+  return JsonArray(_root.get());
+}
+
+template <size_t Capacity>
+class StaticJsonDocument : public JsonDocument {};
+
+class DynamicJsonDocument : public JsonDocument {
+public:
+  explicit DynamicJsonDocument(size_t) {}
+};
+
+namespace ajson_host {
+inline const Node* rootOf(const JsonDocument& doc) { return doc.root(); }
+inline const Node* rootOf(const JsonVariant& v) { return v.node(); }
+inline const Node* rootOf(const JsonObject& o) { return o.node(); }
+inline const Node* rootOf(const JsonArray& a) { return a.node(); }
+
+class Parser {
+public:
+  Parser(const char* p, const char* end) : _p(p), _end(end) {}
+
+  DeserializationError parse(Node& root) {
+    skipSpace();
+    if (_p >= _end) return DeserializationError::EmptyInput;
+    DeserializationError err = parseValue(root, 0);
+    if (err) root.reset();
+    return err;
+  }
+
+private:
+  void skipSpace() { while (_p < _end && (*_p == ' ' || *_p == '\t' || *_p == '\n' || *_p == '\r')) _p++; }
+
+  DeserializationError parseValue(Node& n, int depth) {
+    if (depth > 20) return DeserializationError::TooDeep;
+    skipSpace();
+    if (_p >= _end) return DeserializationError::IncompleteInput;
+    char c = *_p;
+    if (c == '{') return parseObject(n, depth);
+    if (c == '[') return parseArray(n, depth);
+    if (c == '"') { n.type = Node::Str; return parseString(n.s); }
+    if (c == '-' || (c >= '0' && c <= '9')) return parseNumber(n);
+    if (matchWord("true")) { n.type = Node::Bool; n.b = true; return DeserializationError::Ok; }
+    if (matchWord("false")) { n.type = Node::Bool; n.b = false; return DeserializationError::Ok; }
+    if (matchWord("null")) { n.type = Node::Null; return DeserializationError::Ok; }
+    return DeserializationError::InvalidInput;
+  }
+
+  bool matchWord(const char* word) {
+    size_t len = strlen(word);
+    if (static_cast<size_t>(_end - _p) < len || strncmp(_p, word, len) != 0) return false;
+    _p += len;
+    return true;
+  }
+
+  DeserializationError parseObject(Node& n, int depth) {
+    n.type = Node::Object;
+    _p++;
+    skipSpace();
+    if (_p < _end && *_p == '}') { _p++; return DeserializationError::Ok; }
+    for (;;) {
+      skipSpace();
+      if (_p >= _end) return DeserializationError::IncompleteInput;
+      if (*_p != '"') return DeserializationError::InvalidInput;
+      std::string key;
+      DeserializationError err = parseString(key);
+      if (err) return err;
+      skipSpace();
+      if (_p >= _end) return DeserializationError::IncompleteInput;
+      if (*_p++ != ':') return DeserializationError::InvalidInput;
+      Node* child = n.member(key, true);
+      child->reset();
+      err = parseValue(*child, depth + 1);
+      if (err) return err;
+      skipSpace();
+      if (_p >= _end) return DeserializationError::IncompleteInput;
+      if (*_p == ',') { _p++; continue; }
+      if (*_p == '}') { _p++; return DeserializationError::Ok; }
+      return DeserializationError::InvalidInput;
+    }
+  }
+
+  DeserializationError parseArray(Node& n, int depth) {
+    n.type = Node::Array;
+    _p++;
+    skipSpace();
+    if (_p < _end && *_p == ']') { _p++; return DeserializationError::Ok; }
+    for (;;) {
+      DeserializationError err = parseValue(*n.append(), depth + 1);
+      if (err) return err;
+      skipSpace();
+      if (_p >= _end) return DeserializationError::IncompleteInput;
+      if (*_p == ',') { _p++; continue; }
+      if (*_p == ']') { _p++; return DeserializationError::Ok; }
+      return DeserializationError::InvalidInput;
+    }
+  }
+
+  DeserializationError parseString(std::string& out) {
+    _p++; // opening quote
+    while (_p < _end) {
+      char c = *_p++;
+      if (c == '"') return DeserializationError::Ok;
+      if (c != '\\') { out += c; continue; }
+      if (_p >= _end) return DeserializationError::IncompleteInput;
+      char e = *_p++;
+      switch (e) {
+        case 'n': out += '\n'; break;
+        case 'r': out += '\r'; break;
+        case 't': out += '\t'; break;
+        case 'b': out += '\b'; break;
+        case 'f': out += '\f'; break;
+        case 'u': {
+          if (_end - _p < 4) return DeserializationError::IncompleteInput;
+          unsigned cp = static_cast<unsigned>(strtoul(std::string(_p, 4).c_str(), nullptr, 16));
+          _p += 4;
+          if (cp < 0x80) {
+            out += static_cast<char>(cp);
+          } else if (cp < 0x800) {
+            out += static_cast<char>(0xC0 | (cp >> 6));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+          } else {
+            out += static_cast<char>(0xE0 | (cp >> 12));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+          }
+          break;
+        }
+        default: out += e; break;
+      }
+    }
+    return DeserializationError::IncompleteInput;
+  }
+
+  DeserializationError parseNumber(Node& n) {
+    const char* start = _p;
+    bool isFloat = false;
+    if (_p < _end && *_p == '-') _p++;
+    while (_p < _end && ((*_p >= '0' && *_p <= '9') || *_p == '.' || *_p == 'e' || *_p == 'E' || *_p == '+' || *_p == '-')) {
+      if (*_p == '.' || *_p == 'e' || *_p == 'E') isFloat = true;
+      _p++;
+    }
+    std::string text(start, _p);
+    if (text == "-") return DeserializationError::InvalidInput;
+    if (isFloat) {
+      n.type = Node::Double;
+      n.d = strtod(text.c_str(), nullptr);
+    } else if (text[0] == '-') {
+      n.type = Node::Int;
+      n.i = strtoll(text.c_str(), nullptr, 10);
+    } else {
+      n.type = Node::UInt;
+      n.u = strtoull(text.c_str(), nullptr, 10);
+    }
+    return DeserializationError::Ok;
+  }
+
+  const char* _p;
+  const char* _end;
+};
+} // namespace ajson_host
+
+template <typename TSource>
+size_t serializeJson(const TSource& source, String& output) {
+  std::string out;
+  ajson_host::serialize(ajson_host::rootOf(source), out);
+  output = String(out);
+  return out.size();
+}
+template <typename TSource>
+size_t serializeJson(const TSource& source, char* buffer, size_t bufferSize) {
+  std::string out;
+  ajson_host::serialize(ajson_host::rootOf(source), out);
+  if (bufferSize == 0) return 0;
+  size_t n = out.size() < bufferSize - 1 ? out.size() : bufferSize - 1;
+  memcpy(buffer, out.data(), n);
+  buffer[n] = '\0';
+  return n;
+}
+template <typename TSource, size_t N>
+size_t serializeJson(const TSource& source, char (&buffer)[N]) {
+  return serializeJson(source, buffer, N);
+}
+template <typename TSource>
+size_t serializeJson(const TSource& source, Print& output) {
+  std::string out;
+  ajson_host::serialize(ajson_host::rootOf(source), out);
+  return output.write(out.data(), out.size());
+}
+template <typename TSource>
+size_t measureJson(const TSource& source) {
+  std::string out;
+  ajson_host::serialize(ajson_host::rootOf(source), out);
+  return out.size();
+}
+
+inline DeserializationError deserializeJson(JsonDocument& doc, const char* input, size_t length) {
+  doc.clear();
+  if (!input) return DeserializationError::EmptyInput;
+  return ajson_host::Parser(input, input + length).parse(*doc.root());
+}
+inline DeserializationError deserializeJson(JsonDocument& doc, const char* input) {
+  return deserializeJson(doc, input, input ? strlen(input) : 0);
+}
+inline DeserializationError deserializeJson(JsonDocument& doc, const String& input) {
+  return deserializeJson(doc, input.c_str(), input.length());
+}
+inline DeserializationError deserializeJson(JsonDocument& doc, Stream& input) {
+  String text = input.readString();
+  return deserializeJson(doc, text);
+}
@@ -0,0 +1,32 @@
+#pragma once
+// Host stand-in for ArduinoOTA (IDE uploads are not supported on the host).
+
+#include <functional>
+#include "Arduino.h"
+
+#define U_FLASH 0
+#define U_FS    100
+
+typedef enum {
+  OTA_AUTH_ERROR,
+  OTA_BEGIN_ERROR,
+  OTA_CONNECT_ERROR,
+  OTA_RECEIVE_ERROR,
+  OTA_END_ERROR
+} ota_error_t;
+
+class ArduinoOTAClass {
+public:
+  void setHostname(const char*) {}
+  void setPassword(const char*) {}
+  void setPort(uint16_t) {}
+  void onStart(std::function<void()>) {}
+  void onEnd(std::function<void()>) {}
+  void onProgress(std::function<void(unsigned int, unsigned int)>) {}
+  void onError(std::function<void(ota_error_t)>) {}
+  void begin() {}
+  void handle() {}
+  int getCommand() const { return U_FLASH; }
+};
+
+extern ArduinoOTAClass ArduinoOTA;
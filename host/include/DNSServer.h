@@ -0,0 +1,12 @@
+#pragma once
+// Host stand-in for the captive-portal DNS server (no-op).
+
+#include "Arduino.h"
+
+class DNSServer {
+public:
+  bool start(uint16_t, const String&, const IPAddress&) { return true; }
+  bool start(uint16_t, const char*, const IPAddress&) { return true; }
+  void processNextRequest() {}
+  void stop() {}
+};
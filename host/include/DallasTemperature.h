@@ -0,0 +1,34 @@
+#pragma once
+// Host stand-in for the DallasTemperature driver. Emulates one DS18B20 probe
+// with a conversion time that depends on the configured resolution.
+
+#include "OneWire.h"
+
+#define DEVICE_DISCONNECTED_C -127
+#define DEVICE_DISCONNECTED_F -196.6
+
+class DallasTemperature {
+public:
+  explicit DallasTemperature(OneWire*) {}
+  void begin() {}
+  uint8_t getDeviceCount() { return 1; }
+  void setResolution(uint8_t bits) { _resolution = bits < 9 ? 9 : (bits > 12 ? 12 : bits); }
+  uint8_t getResolution() { return _resolution; }
+  void setWaitForConversion(bool wait) { _waitForConversion = wait; }
+  bool getWaitForConversion() const { return _waitForConversion; }
+  int16_t millisToWaitForConversion(uint8_t bits) { return 750 / (1 << (12 - bits)); }
+  int16_t millisToWaitForConversion() { return millisToWaitForConversion(_resolution); }
+  void requestTemperatures() {
+    _conversionStart = millis();
+    if (_waitForConversion) delay(millisToWaitForConversion());
+  }
+  bool isConversionComplete() { return millis() - _conversionStart >= static_cast<unsigned long>(millisToWaitForConversion()); }
+  bool isParasitePowerMode() { return false; }
+  float getTempCByIndex(uint8_t) { return 31.0f; }
+  float getTempFByIndex(uint8_t index) { return getTempCByIndex(index) * 1.8f + 32.0f; }
+
+private:
+  uint8_t _resolution = 12;
+  bool _waitForConversion = true;
+  unsigned long _conversionStart = 0;
+};
@@ -0,0 +1,30 @@
+#pragma once
+// Host stand-in for the emulated EEPROM, persisted to <fsDir>/.eeprom.bin on commit().
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+class EEPROMClass {
+public:
+  void begin(size_t size);
+  bool commit();
+  void end() { commit(); }
+  uint8_t read(int address) const { return address >= 0 && static_cast<size_t>(address) < _data.size() ? _data[address] : 0; }
+  void write(int address, uint8_t value) { if (address >= 0 && static_cast<size_t>(address) < _data.size()) _data[address] = value; }
+  size_t length() const { return _data.size(); }
+
+  template <typename T> T& get(int address, T& t) {
+    if (address >= 0 && address + sizeof(T) <= _data.size()) memcpy(&t, &_data[address], sizeof(T));
+    return t;
+  }
+  template <typename T> const T& put(int address, const T& t) {
+    if (address >= 0 && address + sizeof(T) <= _data.size()) memcpy(&_data[address], &t, sizeof(T));
+    return t;
+  }
+
+private:
+  std::vector<uint8_t> _data;
+};
+
+extern EEPROMClass EEPROM;
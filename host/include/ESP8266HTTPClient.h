@@ -0,0 +1,34 @@
+#pragma once
+// Host stand-in for ESP8266HTTPClient: plain http:// GET over the host WiFiClient.
+
+#include "Arduino.h"
+#include "WiFiClient.h"
+
+#define HTTPC_ERROR_CONNECTION_FAILED  (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_NOT_CONNECTED      (-4)
+#define HTTPC_ERROR_CONNECTION_LOST    (-5)
+#define HTTPC_ERROR_READ_TIMEOUT       (-11)
+
+#define HTTP_CODE_OK 200
+#define HTTP_CODE_NOT_MODIFIED 304
+#define HTTP_CODE_NOT_FOUND 404
+
+class HTTPClient {
+public:
+  bool begin(WiFiClient& client, const String& url);
+  void end();
+  int GET();
+  String getString() { return _body; }
+  int getSize() const { return static_cast<int>(_body.length()); }
+  void setTimeout(uint16_t timeoutMs) { _timeoutMs = timeoutMs; }
+  static String errorToString(int error);
+
+private:
+  WiFiClient* _client = nullptr;
+  String _host;
+  String _path;
+  uint16_t _port = 80;
+  String _body;
+  uint16_t _timeoutMs = 5000;
+};
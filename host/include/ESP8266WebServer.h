@@ -0,0 +1,162 @@
+#pragma once
+// Host stand-in for ESP8266WebServer, serving real HTTP/1.1 over a TCP socket.
+// The request state machine mirrors the ESP8266 core (v3.x): one client is
+// served at a time, and a served client is held in HC_WAIT_CLOSE until it
+// closes, another client connects or, with keepAlive(true), it sends its next
+// request, which is then served in the same handleClient() call.
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Arduino.h"
+#include "WiFiClient.h"
+#include "FS.h"
+#include "Uri.h"
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+
+#define HTTP_DOWNLOAD_UNIT_SIZE 1460
+#define HTTP_MAX_DATA_WAIT 5000
+#define HTTP_MAX_DATA_AVAILABLE_WAIT 30
+#define HTTP_MAX_POST_WAIT 5000
+#define HTTP_MAX_SEND_WAIT 5000
+#define HTTP_MAX_CLOSE_WAIT 5000
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t) -1)
+#define CONTENT_LENGTH_NOT_SET ((size_t) -2)
+
+class ESP8266WebServer {
+public:
+  typedef std::function<void(void)> THandlerFunction;
+
+  enum HTTPClientStatus { HC_NONE, HC_WAIT_READ, HC_WAIT_CLOSE };
+  enum ClientFuture { CLIENT_REQUEST_CAN_CONTINUE, CLIENT_REQUEST_IS_HANDLED, CLIENT_MUST_STOP, CLIENT_IS_GIVEN };
+  typedef std::function<String(const String&)> ContentTypeFunction;
+  // Called with every request line before headers are read, as in the ESP8266 core.
+  using HookFunction = std::function<ClientFuture(const String& method, const String& url, WiFiClient* client, ContentTypeFunction contentType)>;
+
+  explicit ESP8266WebServer(int port = 80) : _port(port), _server(port) {}
+
+  void begin();
+  void begin(uint16_t port) { _port = port; begin(); }
+  void close();
+  void stop() { close(); }
+  void handleClient();
+
+  void on(const Uri& uri, THandlerFunction fn) { on(uri, HTTP_ANY, fn); }
+  void on(const Uri& uri, HTTPMethod method, THandlerFunction fn);
+  void on(const Uri& uri, HTTPMethod method, THandlerFunction fn, THandlerFunction) { on(uri, method, fn); }
+  void onNotFound(THandlerFunction fn) { _notFoundHandler = fn; }
+  void addHook(HookFunction hook) {
+    if (!_hook) {
+      _hook = hook;
+      return;
+    }
+    HookFunction previous = _hook;
+    _hook = [previous, hook](const String& method, const String& url, WiFiClient* client, ContentTypeFunction contentType) {
+      ClientFuture whatNow = previous(method, url, client, contentType);
+      return whatNow == CLIENT_REQUEST_CAN_CONTINUE ? hook(method, url, client, contentType) : whatNow;
+    };
+  }
+
+  const String& uri() const { return _currentUri; }
+  HTTPMethod method() const { return _currentMethod; }
+  WiFiClient& client() { return _currentClient; }
+  HTTPClientStatus status() const { return _currentStatus; }
+
+  const String& arg(const String& name) const;
+  const String& arg(int i) const;
+  const String& argName(int i) const;
+  int args() const { return static_cast<int>(_currentArgs.size()); }
+  bool hasArg(const String& name) const;
+  const String& pathArg(unsigned int i) const;
+
+  void collectHeaders(const char* headerKeys[], const size_t headerKeysCount);
+  template <typename... Args> void collectHeaders(const Args&... args) {
+    const char* keys[] = { args... };
+    collectHeaders(keys, sizeof...(args));
+  }
+  const String& header(const String& name) const;
+  bool hasHeader(const String& name) const;
+  int headers() const { return static_cast<int>(_currentHeaders.size()); }
+  const String& hostHeader() const { return _hostHeader; }
+
+  void send(int code, const char* content_type = nullptr, const String& content = emptyString);
+  void send(int code, const String& content_type, const String& content) { send(code, content_type.c_str(), content); }
+  void send(int code, const char* content_type, const char* content) { send_P(code, content_type, content, content ? strlen(content) : 0); }
+  void send(int code, const __FlashStringHelper* content_type, const String& content) {
+    send(code, reinterpret_cast<const char*>(content_type), content);
+  }
+  void send_P(int code, PGM_P content_type, PGM_P content) { send_P(code, content_type, content, content ? strlen(content) : 0); }
+  void send_P(int code, PGM_P content_type, PGM_P content, size_t contentLength);
+
+  void setContentLength(size_t contentLength) { _contentLength = contentLength; }
+  void sendHeader(const String& name, const String& value, bool first = false);
+  void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+  void sendContent(const char* content, size_t size);
+  void sendContent_P(PGM_P content) { sendContent(content, strlen(content)); }
+  void sendContent_P(PGM_P content, size_t size) { sendContent(content, size); }
+
+  template <typename T>
+  size_t streamFile(T& file, const String& contentType, HTTPMethod requestMethod = HTTP_GET) {
+    _streamFileCore(file.size(), file.name(), contentType);
+    if (requestMethod != HTTP_GET) return 0;
+    uint8_t buffer[HTTP_DOWNLOAD_UNIT_SIZE];
+    size_t total = 0;
+    size_t n;
+    while ((n = file.read(buffer, sizeof(buffer))) > 0) {
+      size_t written = _currentClient.write(buffer, n);
+      total += written;
+      if (written < n) break;
+    }
+    return total;
+  }
+
+  WiFiServer& getServer() { return _server; }
+
+  void keepAlive(bool keepAlive) { _keepAlive = keepAlive; }
+  bool getKeepAlive() const { return _keepAlive; }
+  void enableCORS(bool enable) { _corsEnabled = enable; }
+  void enableCrossOrigin(bool enable) { enableCORS(enable); }
+
+  static String urlDecode(const String& text);
+  static const char* responseCodeToString(int code);
+
+private:
+  struct RequestHandler {
+    std::unique_ptr<Uri> uri;
+    HTTPMethod method;
+    THandlerFunction fn;
+  };
+  ClientFuture _parseRequest(WiFiClient& client);
+  void _parseArguments(const String& data);
+  void _handleRequest();
+  void _finalizeResponse();
+  void _prepareHeader(String& response, int code, const char* content_type, size_t contentLength);
+  void _streamFileCore(size_t fileSize, const String& fileName, const String& contentType);
+
+  int _port;
+  WiFiServer _server;
+  WiFiClient _currentClient;
+  HTTPClientStatus _currentStatus = HC_NONE;
+  unsigned long _statusChange = 0;
+  bool _keepAlive = false;
+  bool _corsEnabled = false;
+
+  HTTPMethod _currentMethod = HTTP_ANY;
+  String _currentUri;
+  uint8_t _currentVersion = 1;
+  std::vector<std::pair<String, String>> _currentArgs;
+  std::vector<String> _currentPathArgs;
+  std::vector<std::pair<String, String>> _currentHeaders;
+  String _hostHeader;
+
+  std::vector<RequestHandler> _handlers;
+  THandlerFunction _notFoundHandler;
+  HookFunction _hook;
+
+  String _responseHeaders;
+  size_t _contentLength = CONTENT_LENGTH_NOT_SET;
+  bool _chunked = false;
+};
@@ -0,0 +1,45 @@
+#pragma once
+// Host stand-in for the ESP8266 WiFi stack. The host is always "connected"
+// through its own network interfaces; station and AP calls are recorded only.
+
+#include "Arduino.h"
+#include "WiFiClient.h"
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } WiFiMode_t;
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_SCAN_COMPLETED = 2,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_WRONG_PASSWORD = 6,
+  WL_DISCONNECTED = 7
+} wl_status_t;
+
+class ESP8266WiFiClass {
+public:
+  bool mode(WiFiMode_t m) { _mode = m; return true; }
+  WiFiMode_t getMode() const { return _mode; }
+  wl_status_t begin(const char*, const char* = nullptr) { return WL_CONNECTED; }
+  bool config(IPAddress, IPAddress, IPAddress, IPAddress = IPAddress(), IPAddress = IPAddress()) { return true; }
+  bool setSleep(bool) { return true; }
+  bool hostname(const char* name) { _hostname = name ? name : ""; return true; }
+  const char* getHostname() const { return _hostname.c_str(); }
+  wl_status_t status() const { return _mode == WIFI_AP ? WL_DISCONNECTED : WL_CONNECTED; }
+  bool isConnected() const { return status() == WL_CONNECTED; }
+  bool disconnect(bool = false) { return true; }
+  IPAddress localIP() const { return IPAddress(127, 0, 0, 1); }
+  String macAddress() const { return String("02:00:00:00:00:01"); }
+  int32_t RSSI() const { return -50; }
+  String SSID() const { return String("host"); }
+  bool softAP(const char*, const char* = nullptr) { return true; }
+  IPAddress softAPIP() const { return IPAddress(192, 168, 4, 1); }
+
+private:
+  WiFiMode_t _mode = WIFI_STA;
+  String _hostname;
+};
+
+extern ESP8266WiFiClass WiFi;
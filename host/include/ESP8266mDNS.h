@@ -0,0 +1,15 @@
+#pragma once
+// Host stand-in for the mDNS responder (no-op).
+
+#include "Arduino.h"
+
+class MDNSResponder {
+public:
+  bool begin(const char*) { return true; }
+  bool addService(const char*, const char*, uint16_t) { return true; }
+  bool addServiceTxt(const char*, const char*, const char*, const char*) { return true; }
+  bool update() { return true; }
+  bool announce() { return true; }
+};
+
+extern MDNSResponder MDNS;
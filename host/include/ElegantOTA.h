@@ -0,0 +1,13 @@
+#pragma once
+// Host stand-in for ElegantOTA (the /update page is not served on the host).
+
+#include "ESP8266WebServer.h"
+
+class ElegantOTAClass {
+public:
+  void begin(ESP8266WebServer*, const char* = "", const char* = "") {}
+  void loop() {}
+  void onStart(void (*)()) {}
+};
+
+extern ElegantOTAClass ElegantOTA;
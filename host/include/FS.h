@@ -0,0 +1,79 @@
+#pragma once
+// Host stand-in for the ESP8266 FS API. Paths are mapped into a host directory.
+
+#include <memory>
+#include "Arduino.h"
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+struct FSInfo {
+  size_t totalBytes;
+  size_t usedBytes;
+  size_t blockSize;
+  size_t pageSize;
+  size_t maxOpenFiles;
+  size_t maxPathLength;
+};
+
+struct HostFile;
+
+class File : public Stream {
+public:
+  File() { _timeout = 0; }
+  explicit File(std::shared_ptr<HostFile> impl) : _impl(std::move(impl)) { _timeout = 0; }
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t read(uint8_t* buffer, size_t size);
+  size_t readBytes(char* buffer, size_t length) override { return read(reinterpret_cast<uint8_t*>(buffer), length); }
+  void flush() override;
+  bool seek(uint32_t pos, SeekMode mode);
+  bool seek(uint32_t pos) { return seek(pos, SeekSet); }
+  size_t position() const;
+  size_t size() const;
+  bool truncate(uint32_t size);
+  void close();
+  operator bool() const;
+  const char* name() const;
+  const char* fullName() const;
+  bool isFile() const { return static_cast<bool>(*this); }
+  bool isDirectory() const { return false; }
+
+private:
+  std::shared_ptr<HostFile> _impl;
+};
+
+class FS {
+public:
+  bool begin();
+  void end();
+  bool format();
+  bool info(FSInfo& info);
+  File open(const char* path, const char* mode);
+  File open(const String& path, const char* mode) { return open(path.c_str(), mode); }
+  bool exists(const char* path);
+  bool exists(const String& path) { return exists(path.c_str()); }
+  bool remove(const char* path);
+  bool remove(const String& path) { return remove(path.c_str()); }
+  bool rename(const char* pathFrom, const char* pathTo);
+  bool rename(const String& pathFrom, const String& pathTo) { return rename(pathFrom.c_str(), pathTo.c_str()); }
+
+private:
+  bool _mounted = false;
+};
+
+} // namespace fs
+
+using fs::FS;
+using fs::File;
+using fs::FSInfo;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
@@ -0,0 +1,29 @@
+#pragma once
+// Host stand-in for the Arduino IPAddress class (IPv4 only).
+
+#include <stdint.h>
+#include "WString.h"
+
+class IPAddress {
+public:
+  IPAddress() : _addr(0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+    : _addr(static_cast<uint32_t>(a) | (static_cast<uint32_t>(b) << 8) |
+            (static_cast<uint32_t>(c) << 16) | (static_cast<uint32_t>(d) << 24)) {}
+  explicit IPAddress(uint32_t addr) : _addr(addr) {}
+
+  operator uint32_t() const { return _addr; }
+  uint8_t operator[](int index) const { return (_addr >> (index * 8)) & 0xFF; }
+  bool operator==(const IPAddress& rhs) const { return _addr == rhs._addr; }
+  bool operator!=(const IPAddress& rhs) const { return _addr != rhs._addr; }
+  bool isSet() const { return _addr != 0; }
+
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return String(buf);
+  }
+
+private:
+  uint32_t _addr; // Network byte order, matching lwIP's ip4_addr
+};
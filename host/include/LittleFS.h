@@ -0,0 +1,6 @@
+#pragma once
+// Host stand-in for LittleFS, backed by a directory (see HostOptions::fsDir).
+
+#include "FS.h"
+
+extern fs::FS LittleFS;
@@ -0,0 +1,42 @@
+#pragma once
+// Host stand-in for the OneWire bus. Emulates a single DS18B20 answering skip-ROM
+// commands, enough for the scratchpad read in sensors.h.
+
+#include "Arduino.h"
+
+class OneWire {
+public:
+  explicit OneWire(uint8_t pin) : _pin(pin) {}
+
+  uint8_t reset() { _readPos = 9; return 1; }
+  void skip() {}
+  void write(uint8_t v, uint8_t = 0) {
+    if (v == 0xBE) { // READ SCRATCHPAD: 31.0 C, 12-bit config, valid CRC
+      static const uint8_t scratch[8] = { 0xF0, 0x01, 0x4B, 0x46, 0x7F, 0xFF, 0x10, 0x10 };
+      memcpy(_scratch, scratch, sizeof(scratch));
+      _scratch[8] = crc8(_scratch, 8);
+      _readPos = 0;
+    }
+  }
+  uint8_t read() { return _readPos < 9 ? _scratch[_readPos++] : 0xFF; }
+  void read_bytes(uint8_t* buf, uint16_t count) { for (uint16_t i = 0; i < count; i++) buf[i] = read(); }
+
+  static uint8_t crc8(const uint8_t* addr, uint8_t len) {
+    uint8_t crc = 0;
+    while (len--) {
+      uint8_t inbyte = *addr++;
+      for (uint8_t i = 8; i; i--) {
+        uint8_t mix = (crc ^ inbyte) & 0x01;
+        crc >>= 1;
+        if (mix) crc ^= 0x8C;
+        inbyte >>= 1;
+      }
+    }
+    return crc;
+  }
+
+private:
+  uint8_t _pin;
+  uint8_t _scratch[9] = { 0 };
+  uint8_t _readPos = 9;
+};
@@ -0,0 +1,55 @@
+#pragma once
+// Host stand-in for PubSubClient: a minimal MQTT 3.1.1 client (QoS 0 only)
+// speaking to a real broker through the host WiFiClient.
+
+#include <functional>
+#include "Arduino.h"
+#include "WiFiClient.h"
+
+#define MQTT_CONNECTION_TIMEOUT     -4
+#define MQTT_CONNECTION_LOST        -3
+#define MQTT_CONNECT_FAILED         -2
+#define MQTT_DISCONNECTED           -1
+#define MQTT_CONNECTED               0
+
+#define MQTT_MAX_PACKET_SIZE 256
+#define MQTT_KEEPALIVE 15
+
+class PubSubClient {
+public:
+  typedef std::function<void(char*, uint8_t*, unsigned int)> MQTT_CALLBACK_SIGNATURE_T;
+
+  explicit PubSubClient(WiFiClient& client) : _client(&client) {}
+
+  PubSubClient& setServer(const char* domain, uint16_t port) { _domain = domain ? domain : ""; _port = port; return *this; }
+  PubSubClient& setCallback(MQTT_CALLBACK_SIGNATURE_T callback) { _callback = callback; return *this; }
+  bool setBufferSize(uint16_t size) { _bufferSize = size; return true; }
+
+  bool connect(const char* id) { return connect(id, nullptr, nullptr); }
+  bool connect(const char* id, const char* user, const char* pass);
+  void disconnect();
+  bool connected();
+  int state() const { return _state; }
+  bool loop();
+
+  bool publish(const char* topic, const char* payload) { return publish(topic, payload, false); }
+  bool publish(const char* topic, const char* payload, bool retained);
+  bool publish(const char* topic, const uint8_t* payload, unsigned int length, bool retained);
+  bool subscribe(const char* topic, uint8_t qos = 0);
+  bool unsubscribe(const char* topic);
+
+private:
+  bool writePacket(uint8_t header, const uint8_t* body, size_t length);
+  bool readPacket(uint8_t& header, std::string& body, unsigned long timeoutMs);
+
+  WiFiClient* _client;
+  String _domain;
+  uint16_t _port = 1883;
+  MQTT_CALLBACK_SIGNATURE_T _callback;
+  uint16_t _bufferSize = MQTT_MAX_PACKET_SIZE;
+  uint16_t _nextMsgId = 1;
+  int _state = MQTT_DISCONNECTED;
+  unsigned long _lastOutActivity = 0;
+  unsigned long _lastInActivity = 0;
+  bool _pingOutstanding = false;
+};
@@ -0,0 +1,23 @@
+#pragma once
+// Host stand-in for the Arduino Stream interface.
+
+#include "Print.h"
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  virtual size_t readBytes(char* buffer, size_t length);
+  size_t readBytes(uint8_t* buffer, size_t length) { return readBytes(reinterpret_cast<char*>(buffer), length); }
+
+  void setTimeout(unsigned long timeout) { _timeout = timeout; }
+  unsigned long getTimeout() const { return _timeout; }
+
+  String readString();
+  String readStringUntil(char terminator);
+
+protected:
+  int timedRead();
+  unsigned long _timeout = 1000;
+};
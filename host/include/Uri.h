@@ -0,0 +1,18 @@
+#pragma once
+// Host stand-in for the ESP8266WebServer Uri matcher (exact match).
+
+#include <vector>
+#include "WString.h"
+
+class Uri {
+public:
+  Uri(const char* uri) : _uri(uri) {}
+  Uri(const String& uri) : _uri(uri) {}
+  virtual ~Uri() {}
+
+  virtual Uri* clone() const { return new Uri(_uri); }
+  virtual bool canHandle(const String& requestUri, std::vector<String>&) { return _uri == requestUri; }
+
+protected:
+  const String _uri;
+};
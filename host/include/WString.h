@@ -0,0 +1,113 @@
+#pragma once
+// Host stand-in for the Arduino String class, backed by std::string.
+
+#include <string>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <type_traits>
+
+class __FlashStringHelper;
+
+class String {
+public:
+  String() {}
+  String(const char* cstr) : _s(cstr ? cstr : "") {}
+  String(const char* cstr, size_t len) : _s(cstr ? std::string(cstr, len) : std::string()) {}
+  String(const std::string& s) : _s(s) {}
+  String(const __FlashStringHelper* pstr) : _s(reinterpret_cast<const char*>(pstr)) {}
+  explicit String(char c) : _s(1, c) {}
+  explicit String(unsigned char value, unsigned char base = 10) : _s(fromInteger(value, base)) {}
+  explicit String(int value, unsigned char base = 10) : _s(fromInteger(value, base)) {}
+  explicit String(unsigned int value, unsigned char base = 10) : _s(fromInteger(value, base)) {}
+  explicit String(long value, unsigned char base = 10) : _s(fromInteger(value, base)) {}
+  explicit String(unsigned long value, unsigned char base = 10) : _s(fromInteger(value, base)) {}
+  explicit String(long long value, unsigned char base = 10) : _s(fromInteger(value, base)) {}
+  explicit String(unsigned long long value, unsigned char base = 10) : _s(fromInteger(value, base)) {}
+  explicit String(float value, unsigned char decimalPlaces = 2) : _s(fromDouble(value, decimalPlaces)) {}
+  explicit String(double value, unsigned char decimalPlaces = 2) : _s(fromDouble(value, decimalPlaces)) {}
+
+  const char* c_str() const { return _s.c_str(); }
+  unsigned int length() const { return _s.length(); }
+  bool isEmpty() const { return _s.empty(); }
+  bool reserve(unsigned int size) { _s.reserve(size); return true; }
+  const std::string& str() const { return _s; }
+
+  char charAt(unsigned int index) const { return index < _s.length() ? _s[index] : 0; }
+  char operator[](unsigned int index) const { return charAt(index); }
+  char& operator[](unsigned int index) { return _s[index]; }
+
+  bool concat(const String& s) { _s += s._s; return true; }
+  bool concat(const char* cstr) { if (cstr) _s += cstr; return true; }
+  bool concat(const char* cstr, unsigned int len) { if (cstr) _s.append(cstr, len); return true; }
+  bool concat(char c) { _s += c; return true; }
+  template <typename T, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, char>::value, int>::type = 0>
+  bool concat(T value) { return concat(String(value)); }
+
+  String& operator+=(const String& rhs) { concat(rhs); return *this; }
+  String& operator+=(const char* cstr) { concat(cstr); return *this; }
+  String& operator+=(char c) { concat(c); return *this; }
+  template <typename T, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, char>::value, int>::type = 0>
+  String& operator+=(T value) { concat(value); return *this; }
+
+  bool equals(const String& s) const { return _s == s._s; }
+  bool equals(const char* cstr) const { return _s == (cstr ? cstr : ""); }
+  bool equalsIgnoreCase(const String& s) const;
+  bool operator==(const String& rhs) const { return equals(rhs); }
+  bool operator==(const char* cstr) const { return equals(cstr); }
+  bool operator!=(const String& rhs) const { return !equals(rhs); }
+  bool operator!=(const char* cstr) const { return !equals(cstr); }
+  bool operator<(const String& rhs) const { return _s < rhs._s; }
+
+  bool startsWith(const String& prefix) const { return _s.compare(0, prefix._s.size(), prefix._s) == 0; }
+  bool endsWith(const String& suffix) const {
+    return _s.size() >= suffix._s.size() && _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0;
+  }
+
+  int indexOf(char ch, unsigned int fromIndex = 0) const { return toIndex(_s.find(ch, fromIndex)); }
+  int indexOf(const String& s, unsigned int fromIndex = 0) const { return toIndex(_s.find(s._s, fromIndex)); }
+  int lastIndexOf(char ch) const { return toIndex(_s.rfind(ch)); }
+  int lastIndexOf(const String& s) const { return toIndex(_s.rfind(s._s)); }
+
+  String substring(unsigned int beginIndex) const {
+    return beginIndex < _s.size() ? String(_s.substr(beginIndex)) : String();
+  }
+  String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+  void replace(const String& find, const String& replace);
+  void remove(unsigned int index) { if (index < _s.size()) _s.erase(index); }
+  void remove(unsigned int index, unsigned int count) { if (index < _s.size()) _s.erase(index, count); }
+  void toLowerCase();
+  void toUpperCase();
+  void trim();
+
+  long toInt() const { return strtol(_s.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(_s.c_str(), nullptr); }
+  double toDouble() const { return strtod(_s.c_str(), nullptr); }
+
+  std::string::const_iterator begin() const { return _s.begin(); }
+  std::string::const_iterator end() const { return _s.end(); }
+
+private:
+  static int toIndex(size_t pos) { return pos == std::string::npos ? -1 : static_cast<int>(pos); }
+  static std::string fromInteger(long long value, unsigned char base);
+  static std::string fromInteger(unsigned long long value, unsigned char base);
+  static std::string fromInteger(int value, unsigned char base) { return fromInteger(static_cast<long long>(value), base); }
+  static std::string fromInteger(long value, unsigned char base) { return fromInteger(static_cast<long long>(value), base); }
+  static std::string fromInteger(unsigned char value, unsigned char base) { return fromInteger(static_cast<unsigned long long>(value), base); }
+  static std::string fromInteger(unsigned int value, unsigned char base) { return fromInteger(static_cast<unsigned long long>(value), base); }
+  static std::string fromInteger(unsigned long value, unsigned char base) { return fromInteger(static_cast<unsigned long long>(value), base); }
+  static std::string fromDouble(double value, unsigned char decimalPlaces);
+
+  std::string _s;
+};
+
+inline String operator+(const String& lhs, const String& rhs) { String r(lhs); r += rhs; return r; }
+inline String operator+(const String& lhs, const char* rhs) { String r(lhs); r += rhs; return r; }
+inline String operator+(const char* lhs, const String& rhs) { String r(lhs); r += rhs; return r; }
+inline String operator+(const String& lhs, char rhs) { String r(lhs); r += rhs; return r; }
+template <typename T, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, char>::value, int>::type = 0>
+inline String operator+(const String& lhs, T rhs) { String r(lhs); r += rhs; return r; }
+inline bool operator==(const char* lhs, const String& rhs) { return rhs == lhs; }
+
+extern const String emptyString;
@@ -0,0 +1,80 @@
+#pragma once
+// Host stand-in for WiFiClient, backed by a POSIX TCP socket.
+// Copies share the connection, which closes when the last copy is released,
+// matching the reference-counted ClientContext of the ESP8266 core.
+
+#include <deque>
+#include <memory>
+#include "Arduino.h"
+
+struct HostSocket;
+
+class WiFiClient : public Stream {
+public:
+  WiFiClient() {}
+  explicit WiFiClient(std::shared_ptr<HostSocket> socket) : _sock(std::move(socket)) {}
+
+  int connect(const char* host, uint16_t port);
+  int connect(const String& host, uint16_t port) { return connect(host.c_str(), port); }
+  int connect(IPAddress ip, uint16_t port) { return connect(ip.toString(), port); }
+  uint8_t connected();
+  void stop();
+  operator bool() { return connected(); }
+
+  int available() override;
+  int read() override;
+  int read(uint8_t* buffer, size_t size);
+  int peek() override;
+  size_t readBytes(char* buffer, size_t length) override;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buffer, size_t size) override;
+  int availableForWrite() override;
+  void flush() override {}
+  using Print::write;
+
+  IPAddress remoteIP() const;
+  uint16_t remotePort() const;
+  IPAddress localIP() const;
+  void setNoDelay(bool noDelay);
+  bool getNoDelay() const { return _noDelay; }
+  void keepAlive(uint16_t = 0, uint16_t = 0, uint8_t = 0) {}
+
+  bool operator==(const WiFiClient& rhs) const { return _sock == rhs._sock; }
+  int fd() const;
+
+private:
+  bool fill(int timeoutMs);
+
+  std::shared_ptr<HostSocket> _sock;
+  bool _noDelay = false;
+};
+
+// Like the core's WiFiServer, connections are taken from the listen queue into a
+// pending list of at most `backlog` clients before the sketch accepts them, so
+// hasClientData() can see requests that are already waiting.
+class WiFiServer {
+public:
+  using ClientType = WiFiClient;
+
+  explicit WiFiServer(uint16_t port) : _port(port) {}
+  ~WiFiServer();
+  void begin(uint16_t port = 0, uint8_t backlog = 5);
+  void close();
+  void stop() { close(); }
+  bool hasClient();
+  bool hasClientData();
+  bool hasMaxPendingClients();
+  WiFiClient accept();
+  WiFiClient available() { return accept(); }
+  void setNoDelay(bool noDelay) { _noDelay = noDelay; }
+  uint16_t port() const { return _port; }
+
+private:
+  void takePending();
+
+  uint16_t _port;
+  int _fd = -1;
+  uint8_t _backlog = 5;
+  bool _noDelay = false;
+  std::deque<WiFiClient> _pending;
+};
@@ -0,0 +1,60 @@
+#pragma once
+// Host stand-in for the I2C bus. Emulates an SHT21 at 0x40 using no-hold-master
+// measurements (35.0 C, 45 %RH); every other address NACKs.
+
+#include "Arduino.h"
+
+class TwoWire {
+public:
+  void begin(int = -1, int = -1) {}
+  void setClock(uint32_t) {}
+  void beginTransmission(uint8_t address) { _address = address; _command = 0; }
+  size_t write(uint8_t v) { _command = v; return 1; }
+  size_t write(const uint8_t* data, size_t size) { if (size) _command = data[size - 1]; return size; }
+  uint8_t endTransmission(bool = true) {
+    if (_address != SHT21_ADDRESS) return 2; // NACK on address
+    if (_command == 0xF3 || _command == 0xF5) { // Trigger T / RH measurement, no hold master
+      _measuring = _command;
+      _measureStart = millis();
+    }
+    return 0;
+  }
+  uint8_t requestFrom(int address, int quantity) {
+    _rxLen = _rxPos = 0;
+    if (address != SHT21_ADDRESS || !_measuring) return 0;
+    bool temp = _measuring == 0xF3;
+    if (millis() - _measureStart < (temp ? 85UL : 29UL)) return 0; // Still converting: NACK the read
+    float value = temp ? (35.0f + 46.85f) / 175.72f : (45.0f + 6.0f) / 125.0f;
+    uint16_t raw = (static_cast<uint16_t>(value * 65536.0f) & 0xFFFC) | (temp ? 0 : 0x02);
+    _rx[0] = raw >> 8;
+    _rx[1] = raw & 0xFF;
+    _rx[2] = crc(_rx, 2);
+    _measuring = 0;
+    _rxLen = quantity < 3 ? quantity : 3;
+    return _rxLen;
+  }
+  int available() { return _rxLen - _rxPos; }
+  int read() { return _rxPos < _rxLen ? _rx[_rxPos++] : -1; }
+
+private:
+  static const uint8_t SHT21_ADDRESS = 0x40;
+
+  static uint8_t crc(const uint8_t* data, uint8_t len) {
+    uint8_t crc = 0;
+    while (len--) {
+      crc ^= *data++;
+      for (uint8_t i = 0; i < 8; i++) crc = (crc & 0x80) ? (crc << 1) ^ 0x31 : (crc << 1);
+    }
+    return crc;
+  }
+
+  uint8_t _address = 0;
+  uint8_t _command = 0;
+  uint8_t _measuring = 0;
+  unsigned long _measureStart = 0;
+  uint8_t _rx[3] = { 0 };
+  uint8_t _rxLen = 0;
+  uint8_t _rxPos = 0;
+};
+
+extern TwoWire Wire;
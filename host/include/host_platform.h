@@ -0,0 +1,57 @@
+#pragma once
+// Host build runtime options and hooks shared by the shim implementation and main().
+
+#include <stdint.h>
+#include <string>
+
+struct HostOptions {
+  uint16_t httpPort = 8080;          // Replaces port 80 so the host build runs unprivileged
+  std::string fsDir = "host_fs";     // Directory backing LittleFS, EEPROM and RTC memory
+  unsigned long loopSleepUs = 1000;  // Pause between loop() calls; 0 spins like the device
+  bool warmBoot = false;             // Set when re-executed by ESP.restart(); keeps RTC memory
+  int resetReason = -1;              // rst_info reason to report at boot (e.g. 3 = soft WDT); keeps RTC memory
+  bool quiet = false;                // Drop Serial output
+  bool verbose = false;              // Keep Serial output in simulator runs
+
+  // Simulator (--simulate): loop() runs against a virtual clock instead of real time.
+  bool simulate = false;
+  double simDays = 7.0;              // Simulated duration
+  std::string simScript;             // Optional CSV temperature script
+  int64_t simStartEpoch = 1751328000; // 2025-07-01T00:00:00Z
+  uint32_t simStartMs = 0;           // millis() at first boot, e.g. 4294000000 to approach the wrap
+  double simIndoorSensorHours = 0;   // Feed an indoor sensor for this long, then let it go silent
+
+  int argc = 0;
+  char** argv = nullptr;
+};
+
+HostOptions& hostOptions();
+
+// Parses the host and simulator options (see ReadMe.md). Returns false on an unknown argument.
+bool hostParseArgs(int argc, char** argv);
+
+// Prepares the filesystem directory and RTC memory image. Call before setup().
+void hostInit();
+
+// Microseconds since boot, from the host's monotonic clock or the virtual clock.
+uint64_t hostMicros();
+
+// === Virtual clock (simulator) ===
+// The virtual clock counts microseconds since the start of the simulation and
+// survives ESP.restart(); millis() restarts from zero at every boot as on the device.
+void hostClockEnableVirtual(uint64_t nowUs, uint64_t bootUs);
+bool hostClockIsVirtual();
+uint64_t hostClockNowUs();
+void hostClockAdvanceTo(uint64_t nowUs);
+uint64_t hostClockBootUs();
+
+// Total bytes written to LittleFS files and EEPROM commits since this process started.
+uint64_t hostFlashBytesWritten();
+void hostCountFlashWrite(size_t bytes);
+
+// Flash write operations since this process started: written LittleFS files closed plus EEPROM commits.
+uint64_t hostFlashWriteOps();
+void hostCountFlashOp();
+
+// Called by ESP.restart() before the process re-executes itself.
+void hostSetRestartHook(void (*hook)());
@@ -0,0 +1,23 @@
+#pragma once
+// Host stand-in for <pgmspace.h>. Flash and RAM are the same address space on the host.
+
+#include <string.h>
+#include <stdint.h>
+
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+
+class __FlashStringHelper;
+#define FPSTR(p) (reinterpret_cast<const __FlashStringHelper*>(p))
+#ifndef F
+#define F(string_literal) (FPSTR(PSTR(string_literal)))
+#endif
+
+#define pgm_read_byte(addr)  (*reinterpret_cast<const uint8_t*>(addr))
+#define pgm_read_word(addr)  (*reinterpret_cast<const uint16_t*>(addr))
+#define pgm_read_dword(addr) (*reinterpret_cast<const uint32_t*>(addr))
+#define memcpy_P  memcpy
+#define strlen_P  strlen
+#define strcmp_P  strcmp
+#define strncpy_P strncpy
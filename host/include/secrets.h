@@ -0,0 +1,17 @@
+#pragma once
+// Placeholder credentials for the host build. A real secrets.h next to the
+// sketch takes precedence because quoted includes search the sketch first.
+
+const char* ssid = "host";
+const char* password = "host";
+
+const char* ota_user = "admin";
+const char* ota_password = "admin";
+
+const char* mqtt_broker = "127.0.0.1";
+const int mqtt_port = 1883;
+const char* mqtt_user = "";
+const char* mqtt_password = "";
+
+#define WEATHER_LATITUDE 37.7749
+#define WEATHER_LONGITUDE -122.4194
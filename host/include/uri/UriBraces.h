@@ -0,0 +1,30 @@
+#pragma once
+// Host stand-in for <uri/UriBraces.h>: matches "{}" path segments and captures them.
+
+#include "../Uri.h"
+
+class UriBraces : public Uri {
+public:
+  explicit UriBraces(const char* uri) : Uri(uri) {}
+  explicit UriBraces(const String& uri) : Uri(uri) {}
+
+  Uri* clone() const override { return new UriBraces(_uri); }
+
+  bool canHandle(const String& requestUri, std::vector<String>& pathArgs) override {
+    pathArgs.clear();
+    const char* pattern = _uri.c_str();
+    const char* path = requestUri.c_str();
+    while (*pattern && *path) {
+      if (pattern[0] == '{' && pattern[1] == '}') {
+        const char* end = strchr(path, '/');
+        size_t len = end ? static_cast<size_t>(end - path) : strlen(path);
+        pathArgs.push_back(String(path, len));
+        path += len;
+        pattern += 2;
+      } else if (*pattern++ != *path++) {
+        return false;
+      }
+    }
+    return *pattern == '\0' && *path == '\0';
+  }
+};
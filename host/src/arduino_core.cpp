@@ -0,0 +1,410 @@
+// Host implementation of the Arduino core services: time, GPIO, Serial,
+// String/Print/Stream helpers and the ESP chip object.
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sched.h>
+#include <time.h>
+#include "Arduino.h"
+#include "host_platform.h"
+#include "ESP8266WiFi.h"
+#include "ESP8266mDNS.h"
+#include "ArduinoOTA.h"
+#include "ElegantOTA.h"
+#include "Wire.h"
+
+// ---------------------------------------------------------------------------
+// Host options
+// ---------------------------------------------------------------------------
+
+HostOptions& hostOptions() {
+  static HostOptions options;
+  return options;
+}
+
+bool hostParseArgs(int argc, char** argv) {
+  HostOptions& opt = hostOptions();
+  opt.argc = argc;
+  opt.argv = argv;
+  for (int i = 1; i < argc; i++) {
+    String arg(argv[i]);
+    if (arg == "--port" && i + 1 < argc) {
+      opt.httpPort = static_cast<uint16_t>(atoi(argv[++i]));
+    } else if (arg == "--fs-dir" && i + 1 < argc) {
+      opt.fsDir = argv[++i];
+    } else if (arg == "--loop-sleep-us" && i + 1 < argc) {
+      opt.loopSleepUs = strtoul(argv[++i], nullptr, 10);
+    } else if (arg == "--warm-boot") {
+      opt.warmBoot = true;
+    } else if (arg == "--reset-reason" && i + 1 < argc) {
+      opt.resetReason = atoi(argv[++i]);
+    } else if (arg == "--quiet") {
+      opt.quiet = true;
+    } else if (arg == "--verbose") {
+      opt.verbose = true;
+    } else if (arg == "--simulate") {
+      opt.simulate = true;
+    } else if (arg == "--sim-days" && i + 1 < argc) {
+      opt.simDays = atof(argv[++i]);
+    } else if (arg == "--sim-script" && i + 1 < argc) {
+      opt.simScript = argv[++i];
+    } else if (arg == "--sim-start-epoch" && i + 1 < argc) {
+      opt.simStartEpoch = strtoll(argv[++i], nullptr, 10);
+    } else if (arg == "--start-ms" && i + 1 < argc) {
+      opt.simStartMs = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+    } else if (arg == "--sim-indoor-sensor-hours" && i + 1 < argc) {
+      opt.simIndoorSensorHours = atof(argv[++i]);
+    } else {
+      return false;
+    }
+  }
+  if (opt.simulate && !opt.verbose) opt.quiet = true; // A simulated month prints millions of log lines
+  return true;
+}
+
+// ---------------------------------------------------------------------------
+// Timing
+// ---------------------------------------------------------------------------
+
+static const std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+
+static bool virtualClock = false;
+static uint64_t virtualNowUs = 0;
+static uint64_t virtualBootUs = 0;
+
+void hostClockEnableVirtual(uint64_t nowUs, uint64_t bootUs) {
+  virtualClock = true;
+  virtualNowUs = nowUs;
+  virtualBootUs = bootUs;
+}
+
+bool hostClockIsVirtual() { return virtualClock; }
+uint64_t hostClockNowUs() { return virtualNowUs; }
+uint64_t hostClockBootUs() { return virtualBootUs; }
+
+void hostClockAdvanceTo(uint64_t nowUs) {
+  if (nowUs > virtualNowUs) virtualNowUs = nowUs;
+}
+
+uint64_t hostMicros() {
+  // Unsigned subtraction also covers a boot time "before" zero, used by --start-ms.
+  if (virtualClock) return virtualNowUs - virtualBootUs;
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - bootTime).count();
+}
+
+// The device counters are 32 bits wide: millis() wraps after ~49.7 days, micros() after ~71.6 minutes.
+unsigned long millis() { return static_cast<uint32_t>(hostMicros() / 1000ULL); }
+unsigned long micros() { return static_cast<uint32_t>(hostMicros()); }
+
+void delay(unsigned long ms) {
+  if (virtualClock) {
+    virtualNowUs += ms * 1000ULL;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+  if (virtualClock) {
+    virtualNowUs += us;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield() { if (!virtualClock) sched_yield(); }
+
+// Replaces the C library's time() for the sketch so the simulator can move wall time too.
+extern "C" time_t time(time_t* timer) noexcept {
+  time_t now;
+  if (virtualClock) {
+    now = static_cast<time_t>(hostOptions().simStartEpoch + static_cast<int64_t>(virtualNowUs / 1000000ULL));
+  } else {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    now = ts.tv_sec;
+  }
+  if (timer) *timer = now;
+  return now;
+}
+
+void configTime(const char* tz, const char*, const char*, const char*) {
+  setenv("TZ", tz, 1);
+  tzset();
+}
+
+// ---------------------------------------------------------------------------
+// GPIO (latched in memory)
+// ---------------------------------------------------------------------------
+
+static uint8_t pinModes[18];
+static int pinValues[18];
+
+void pinMode(uint8_t pin, uint8_t mode) { if (pin < 18) pinModes[pin] = mode; }
+void digitalWrite(uint8_t pin, uint8_t val) { if (pin < 18) pinValues[pin] = val ? HIGH : LOW; }
+int digitalRead(uint8_t pin) { return pin < 18 ? pinValues[pin] : LOW; }
+void analogWrite(uint8_t pin, int val) { if (pin < 18) pinValues[pin] = val; }
+void analogWriteRange(uint32_t) {}
+int analogRead(uint8_t) { return 0; }
+
+// ---------------------------------------------------------------------------
+// Serial
+// ---------------------------------------------------------------------------
+
+HardwareSerial Serial;
+
+void HardwareSerial::begin(unsigned long) {}
+size_t HardwareSerial::write(uint8_t c) { return hostOptions().quiet ? 1 : fwrite(&c, 1, 1, stdout); }
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) { return hostOptions().quiet ? size : fwrite(buffer, 1, size, stdout); }
+void HardwareSerial::flush() { fflush(stdout); }
+
+// ---------------------------------------------------------------------------
+// ESP chip object
+// ---------------------------------------------------------------------------
+
+EspClass ESP;
+
+static const size_t RTC_USER_MEMORY_BYTES = 512;
+static uint8_t rtcFallback[RTC_USER_MEMORY_BYTES];
+static uint8_t* rtcUserMemory = rtcFallback;
+
+static std::string rtcImagePath() { return hostOptions().fsDir + "/.rtc_user_memory"; }
+
+void hostInit() {
+  std::string cmd = "mkdir -p '" + hostOptions().fsDir + "'";
+  if (system(cmd.c_str()) != 0) {
+    fprintf(stderr, "[HOST] Could not create %s\n", hostOptions().fsDir.c_str());
+  }
+  // RTC user memory survives a software restart, watchdog reset or crash but not
+  // a power cycle. It is mapped onto the image file so that even a killed process
+  // leaves it behind; start with --warm-boot or --reset-reason to keep it.
+  bool keep = hostOptions().warmBoot || hostOptions().resetReason >= 0;
+  int fd = open(rtcImagePath().c_str(), O_RDWR | O_CREAT, 0644);
+  if (fd >= 0 && ftruncate(fd, RTC_USER_MEMORY_BYTES) == 0) {
+    void* mapped = mmap(nullptr, RTC_USER_MEMORY_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapped != MAP_FAILED) rtcUserMemory = static_cast<uint8_t*>(mapped);
+  }
+  if (fd >= 0) close(fd);
+  if (rtcUserMemory == rtcFallback && keep) {
+    FILE* f = fopen(rtcImagePath().c_str(), "rb");
+    if (f) {
+      if (fread(rtcUserMemory, 1, RTC_USER_MEMORY_BYTES, f) != RTC_USER_MEMORY_BYTES) keep = false;
+      fclose(f);
+    }
+  }
+  if (!keep) memset(rtcUserMemory, 0, RTC_USER_MEMORY_BYTES);
+  setvbuf(stdout, nullptr, _IOLBF, 0);
+}
+
+bool EspClass::rtcUserMemoryRead(uint32_t offset, uint32_t* data, size_t size) {
+  if (offset * 4 + size > RTC_USER_MEMORY_BYTES) return false;
+  memcpy(data, rtcUserMemory + offset * 4, size);
+  return true;
+}
+
+bool EspClass::rtcUserMemoryWrite(uint32_t offset, uint32_t* data, size_t size) {
+  if (offset * 4 + size > RTC_USER_MEMORY_BYTES) return false;
+  memcpy(rtcUserMemory + offset * 4, data, size);
+  return true;
+}
+
+// The host heap is not comparable to the ESP8266's ~40 KB, so report a fixed figure.
+uint32_t EspClass::getFreeHeap() { return 40960; }
+uint16_t EspClass::getMaxFreeBlockSize() { return 32768; }
+uint8_t EspClass::getHeapFragmentation() { return 0; }
+uint32_t EspClass::getChipId() { return 0x00C0FFEE; }
+uint32_t EspClass::getCycleCount() { return static_cast<uint32_t>(hostMicros() * getCpuFreqMHz()); }
+rst_info* EspClass::getResetInfoPtr() {
+  static rst_info info = {};
+  if (hostOptions().resetReason >= 0) info.reason = static_cast<uint32_t>(hostOptions().resetReason);
+  else info.reason = hostOptions().warmBoot ? REASON_SOFT_RESTART : REASON_DEFAULT_RST;
+  return &info;
+}
+
+String EspClass::getResetReason() {
+  static const char* const names[] = { "Power On", "Hardware Watchdog", "Exception", "Software Watchdog",
+                                       "Software/System restart", "Deep-Sleep Wake", "External System" };
+  uint32_t reason = getResetInfoPtr()->reason;
+  return String(reason < sizeof(names) / sizeof(names[0]) ? names[reason] : "Unknown");
+}
+
+static void (*restartHook)() = nullptr;
+
+void hostSetRestartHook(void (*hook)()) { restartHook = hook; }
+
+void EspClass::restart() {
+  if (restartHook) restartHook();
+  fflush(stdout);
+  if (rtcUserMemory == rtcFallback) { // Not mapped: save the image explicitly
+    FILE* f = fopen(rtcImagePath().c_str(), "wb");
+    if (f) {
+      fwrite(rtcUserMemory, 1, RTC_USER_MEMORY_BYTES, f);
+      fclose(f);
+    }
+  }
+  // Re-execute the binary so every global starts from scratch, like a real reset.
+  std::vector<char*> args;
+  HostOptions& opt = hostOptions();
+  for (int i = 0; i < opt.argc; i++) {
+    if (strcmp(opt.argv[i], "--reset-reason") == 0) {
+      i++; // The next boot is a plain software restart
+      continue;
+    }
+    if (strcmp(opt.argv[i], "--warm-boot") != 0) args.push_back(opt.argv[i]);
+  }
+  static char warmBootFlag[] = "--warm-boot";
+  args.push_back(warmBootFlag);
+  args.push_back(nullptr);
+  execv("/proc/self/exe", args.data());
+  perror("[HOST] execv failed");
+  _exit(1);
+}
+
+// ---------------------------------------------------------------------------
+// Network singletons that need no behaviour on the host
+// ---------------------------------------------------------------------------
+
+ESP8266WiFiClass WiFi;
+MDNSResponder MDNS;
+ArduinoOTAClass ArduinoOTA;
+ElegantOTAClass ElegantOTA;
+TwoWire Wire;
+
+// ---------------------------------------------------------------------------
+// String
+// ---------------------------------------------------------------------------
+
+const String emptyString;
+
+std::string String::fromInteger(long long value, unsigned char base) {
+  if (value < 0 && base == 10) return "-" + fromInteger(static_cast<unsigned long long>(-value), base);
+  return fromInteger(static_cast<unsigned long long>(value), base);
+}
+
+std::string String::fromInteger(unsigned long long value, unsigned char base) {
+  if (base < 2 || base > 36) base = 10;
+  char buf[72];
+  char* p = buf + sizeof(buf) - 1;
+  *p = '\0';
+  do {
+    unsigned digit = value % base;
+    *--p = static_cast<char>(digit < 10 ? '0' + digit : 'a' + digit - 10);
+    value /= base;
+  } while (value);
+  return std::string(p);
+}
+
+std::string String::fromDouble(double value, unsigned char decimalPlaces) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, value);
+  return std::string(buf);
+}
+
+bool String::equalsIgnoreCase(const String& s) const {
+  return s._s.size() == _s.size() && strcasecmp(_s.c_str(), s._s.c_str()) == 0;
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const {
+  if (beginIndex > endIndex) std::swap(beginIndex, endIndex);
+  if (beginIndex >= _s.size()) return String();
+  if (endIndex > _s.size()) endIndex = _s.size();
+  return String(_s.substr(beginIndex, endIndex - beginIndex));
+}
+
+void String::replace(const String& find, const String& replace) {
+  if (find._s.empty()) return;
+  size_t pos = 0;
+  while ((pos = _s.find(find._s, pos)) != std::string::npos) {
+    _s.replace(pos, find._s.size(), replace._s);
+    pos += replace._s.size();
+  }
+}
+
+void String::toLowerCase() { for (char& c : _s) c = static_cast<char>(tolower(static_cast<unsigned char>(c))); }
+void String::toUpperCase() { for (char& c : _s) c = static_cast<char>(toupper(static_cast<unsigned char>(c))); }
+
+void String::trim() {
+  size_t begin = _s.find_first_not_of(" \t\r\n");
+  if (begin == std::string::npos) { _s.clear(); return; }
+  size_t end = _s.find_last_not_of(" \t\r\n");
+  _s = _s.substr(begin, end - begin + 1);
+}
+
+// ---------------------------------------------------------------------------
+// Print / Stream
+// ---------------------------------------------------------------------------
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t n = 0;
+  while (size--) {
+    if (!write(*buffer++)) break;
+    n++;
+  }
+  return n;
+}
+
+size_t Print::printf(const char* format, ...) {
+  char stackBuf[256];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(stackBuf, sizeof(stackBuf), format, args);
+  va_end(args);
+  if (len < 0) return 0;
+  if (static_cast<size_t>(len) < sizeof(stackBuf)) return write(stackBuf, len);
+  std::vector<char> heapBuf(len + 1);
+  va_start(args, format);
+  vsnprintf(heapBuf.data(), heapBuf.size(), format, args);
+  va_end(args);
+  return write(heapBuf.data(), len);
+}
+
+size_t Print::print(long n, int base) {
+  return print(String(static_cast<long long>(n), static_cast<unsigned char>(base)));
+}
+
+size_t Print::print(unsigned long n, int base) {
+  return print(String(static_cast<unsigned long long>(n), static_cast<unsigned char>(base)));
+}
+
+size_t Print::print(double n, int digits) {
+  return print(String(n, static_cast<unsigned char>(digits)));
+}
+
+int Stream::timedRead() {
+  unsigned long start = millis();
+  do {
+    int c = read();
+    if (c >= 0) return c;
+    if (available() <= 0 && _timeout == 0) return -1;
+    yield();
+  } while (millis() - start < _timeout);
+  return -1;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+  size_t count = 0;
+  while (count < length) {
+    int c = timedRead();
+    if (c < 0) break;
+    buffer[count++] = static_cast<char>(c);
+  }
+  return count;
+}
+
+String Stream::readString() {
+  std::string out;
+  int c;
+  while ((c = timedRead()) >= 0) out += static_cast<char>(c);
+  return String(out);
+}
+
+String Stream::readStringUntil(char terminator) {
+  std::string out;
+  int c;
+  while ((c = timedRead()) >= 0 && c != terminator) out += static_cast<char>(c);
+  return String(out);
+}
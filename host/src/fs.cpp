@@ -0,0 +1,224 @@
+// Host implementation of LittleFS and EEPROM, backed by files under HostOptions::fsDir.
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "FS.h"
+#include "LittleFS.h"
+#include "EEPROM.h"
+#include "host_platform.h"
+
+static uint64_t flashBytesWritten = 0;
+static uint64_t flashWriteOps = 0;
+
+uint64_t hostFlashBytesWritten() { return flashBytesWritten; }
+void hostCountFlashWrite(size_t bytes) { flashBytesWritten += bytes; }
+uint64_t hostFlashWriteOps() { return flashWriteOps; }
+void hostCountFlashOp() { flashWriteOps++; }
+
+namespace fs {
+
+struct HostFile {
+  FILE* fp = nullptr;
+  std::string name;
+  std::string fullName;
+  bool written = false;
+  // Closing a written file is when LittleFS commits its metadata
+  ~HostFile() {
+    if (fp) fclose(fp);
+    if (written) hostCountFlashOp();
+  }
+};
+
+static const size_t HOST_FS_TOTAL_BYTES = 2048000; // Matches the 2 MB partition built by manage_ui.py
+static const size_t HOST_FS_BLOCK_SIZE = 4096;
+
+static std::string hostPath(const char* path) {
+  std::string p = path ? path : "";
+  if (p.empty() || p[0] != '/') p = "/" + p;
+  return hostOptions().fsDir + p;
+}
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+  if (!_impl || !_impl->fp) return 0;
+  size_t written = fwrite(buffer, 1, size, _impl->fp);
+  hostCountFlashWrite(written);
+  if (written) _impl->written = true;
+  return written;
+}
+
+int File::available() {
+  if (!_impl || !_impl->fp) return 0;
+  long remaining = static_cast<long>(size()) - static_cast<long>(position());
+  return remaining > 0 ? static_cast<int>(remaining) : 0;
+}
+
+int File::read() {
+  if (!_impl || !_impl->fp) return -1;
+  return fgetc(_impl->fp);
+}
+
+int File::peek() {
+  if (!_impl || !_impl->fp) return -1;
+  int c = fgetc(_impl->fp);
+  if (c != EOF) ungetc(c, _impl->fp);
+  return c;
+}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+  if (!_impl || !_impl->fp) return 0;
+  return fread(buffer, 1, size, _impl->fp);
+}
+
+void File::flush() {
+  if (_impl && _impl->fp) fflush(_impl->fp);
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+  if (!_impl || !_impl->fp) return false;
+  int whence = mode == SeekSet ? SEEK_SET : (mode == SeekCur ? SEEK_CUR : SEEK_END);
+  return fseek(_impl->fp, static_cast<long>(pos), whence) == 0;
+}
+
+size_t File::position() const {
+  if (!_impl || !_impl->fp) return 0;
+  long pos = ftell(_impl->fp);
+  return pos < 0 ? 0 : static_cast<size_t>(pos);
+}
+
+size_t File::size() const {
+  if (!_impl || !_impl->fp) return 0;
+  fflush(_impl->fp);
+  struct stat st;
+  return fstat(fileno(_impl->fp), &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+}
+
+bool File::truncate(uint32_t size) {
+  if (!_impl || !_impl->fp) return false;
+  fflush(_impl->fp);
+  return ftruncate(fileno(_impl->fp), size) == 0;
+}
+
+void File::close() {
+  _impl.reset();
+}
+
+File::operator bool() const { return _impl && _impl->fp; }
+
+const char* File::name() const {
+  if (!_impl) return "";
+  size_t slash = _impl->name.rfind('/');
+  return _impl->name.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+}
+
+const char* File::fullName() const { return _impl ? _impl->name.c_str() : ""; }
+
+bool FS::begin() {
+  std::string dir = hostOptions().fsDir;
+  mkdir(dir.c_str(), 0755);
+  struct stat st;
+  _mounted = stat(dir.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+  return _mounted;
+}
+
+void FS::end() { _mounted = false; }
+
+bool FS::format() {
+  DIR* dir = opendir(hostOptions().fsDir.c_str());
+  if (!dir) return false;
+  struct dirent* entry;
+  while ((entry = readdir(dir)) != nullptr) {
+    if (entry->d_name[0] == '.') continue; // Host-only images (EEPROM, RTC) live outside the FS partition
+    unlink((hostOptions().fsDir + "/" + entry->d_name).c_str());
+  }
+  closedir(dir);
+  return true;
+}
+
+bool FS::info(FSInfo& info) {
+  size_t used = 0;
+  DIR* dir = opendir(hostOptions().fsDir.c_str());
+  if (dir) {
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != nullptr) {
+      if (entry->d_name[0] == '.') continue;
+      struct stat st;
+      if (stat((hostOptions().fsDir + "/" + entry->d_name).c_str(), &st) == 0) {
+        used += (static_cast<size_t>(st.st_size) + HOST_FS_BLOCK_SIZE - 1) / HOST_FS_BLOCK_SIZE * HOST_FS_BLOCK_SIZE;
+      }
+    }
+    closedir(dir);
+  }
+  info.totalBytes = HOST_FS_TOTAL_BYTES;
+  info.usedBytes = used;
+  info.blockSize = HOST_FS_BLOCK_SIZE;
+  info.pageSize = 256;
+  info.maxOpenFiles = 5;
+  info.maxPathLength = 32;
+  return _mounted;
+}
+
+File FS::open(const char* path, const char* mode) {
+  std::string m = mode ? mode : "r";
+  std::string hostMode;
+  if (m == "r") hostMode = "rb";
+  else if (m == "w") hostMode = "wb";
+  else if (m == "a") hostMode = "ab";
+  else if (m == "r+") hostMode = "r+b";
+  else if (m == "w+") hostMode = "w+b";
+  else if (m == "a+") hostMode = "a+b";
+  else return File();
+
+  hostMode += "e"; // O_CLOEXEC, so handles do not survive ESP.restart()'s exec
+  std::string full = hostPath(path);
+  FILE* fp = fopen(full.c_str(), hostMode.c_str());
+  if (!fp) return File();
+  std::shared_ptr<HostFile> impl = std::make_shared<HostFile>();
+  impl->fp = fp;
+  impl->name = path;
+  impl->fullName = full;
+  return File(impl);
+}
+
+bool FS::exists(const char* path) {
+  struct stat st;
+  return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char* path) { return unlink(hostPath(path).c_str()) == 0; }
+
+bool FS::rename(const char* pathFrom, const char* pathTo) {
+  return ::rename(hostPath(pathFrom).c_str(), hostPath(pathTo).c_str()) == 0;
+}
+
+} // namespace fs
+
+fs::FS LittleFS;
+
+// ---------------------------------------------------------------------------
+// EEPROM
+// ---------------------------------------------------------------------------
+
+EEPROMClass EEPROM;
+
+static std::string eepromImagePath() { return hostOptions().fsDir + "/.eeprom.bin"; }
+
+void EEPROMClass::begin(size_t size) {
+  _data.assign(size, 0xFF); // Erased flash reads as 0xFF
+  FILE* f = fopen(eepromImagePath().c_str(), "rb");
+  if (f) {
+    size_t n = fread(_data.data(), 1, size, f);
+    (void)n;
+    fclose(f);
+  }
+}
+
+bool EEPROMClass::commit() {
+  FILE* f = fopen(eepromImagePath().c_str(), "wb");
+  if (!f) return false;
+  bool ok = fwrite(_data.data(), 1, _data.size(), f) == _data.size();
+  fclose(f);
+  hostCountFlashWrite(_data.size()); // The core rewrites the whole EEPROM sector on commit
+  hostCountFlashOp();
+  return ok;
+}
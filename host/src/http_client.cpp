@@ -0,0 +1,72 @@
+// Host implementation of the HTTPClient subset used by weather.h (plain-http GET).
+
+#include "ESP8266HTTPClient.h"
+
+bool HTTPClient::begin(WiFiClient& client, const String& url) {
+  _client = &client;
+  _body = String();
+  String rest = url;
+  if (rest.startsWith("http://")) {
+    rest = rest.substring(7);
+  } else {
+    return false; // TLS is not emulated
+  }
+  int slash = rest.indexOf('/');
+  String hostPort = slash == -1 ? rest : rest.substring(0, slash);
+  _path = slash == -1 ? String("/") : rest.substring(slash);
+  int colon = hostPort.indexOf(':');
+  if (colon == -1) {
+    _host = hostPort;
+    _port = 80;
+  } else {
+    _host = hostPort.substring(0, colon);
+    _port = static_cast<uint16_t>(hostPort.substring(colon + 1).toInt());
+  }
+  return true;
+}
+
+void HTTPClient::end() {
+  if (_client) _client->stop();
+}
+
+int HTTPClient::GET() {
+  if (!_client) return HTTPC_ERROR_NOT_CONNECTED;
+  if (!_client->connect(_host.c_str(), _port)) return HTTPC_ERROR_CONNECTION_FAILED;
+
+  String request = String("GET ") + _path + " HTTP/1.0\r\nHost: " + _host +
+                   "\r\nUser-Agent: ESP8266HTTPClient\r\nConnection: close\r\n\r\n";
+  if (_client->write(reinterpret_cast<const uint8_t*>(request.c_str()), request.length()) != request.length()) {
+    return HTTPC_ERROR_SEND_HEADER_FAILED;
+  }
+
+  _client->setTimeout(_timeoutMs);
+  String status = _client->readStringUntil('\n');
+  if (status.length() == 0) return HTTPC_ERROR_READ_TIMEOUT;
+  int space = status.indexOf(' ');
+  int code = space == -1 ? 0 : status.substring(space + 1).toInt();
+  if (code <= 0) return HTTPC_ERROR_CONNECTION_LOST;
+
+  while (true) {
+    String line = _client->readStringUntil('\n');
+    line.trim();
+    if (line.length() == 0) break;
+  }
+  // HTTP/1.0 with Connection: close, so the body runs until the server closes.
+  std::string body;
+  char buf[512];
+  size_t n;
+  while ((n = _client->readBytes(buf, sizeof(buf))) > 0) body.append(buf, n);
+  _body = String(body);
+  return code;
+}
+
+String HTTPClient::errorToString(int error) {
+  switch (error) {
+    case HTTPC_ERROR_CONNECTION_FAILED: return String("connection failed");
+    case HTTPC_ERROR_SEND_HEADER_FAILED: return String("send header failed");
+    case HTTPC_ERROR_NOT_CONNECTED: return String("not connected");
+    case HTTPC_ERROR_CONNECTION_LOST: return String("connection lost");
+    case HTTPC_ERROR_READ_TIMEOUT: return String("read Timeout");
+    default: return String();
+  }
+}
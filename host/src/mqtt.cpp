@@ -0,0 +1,186 @@
+// Host implementation of the PubSubClient subset used by the controller:
+// MQTT 3.1.1 CONNECT/PUBLISH/SUBSCRIBE/PINGREQ at QoS 0.
+
+#include <poll.h>
+#include "PubSubClient.h"
+
+static const unsigned long MQTT_SOCKET_TIMEOUT_MS = 15000;
+
+static void appendString(std::string& out, const char* s) {
+  size_t len = s ? strlen(s) : 0;
+  out += static_cast<char>(len >> 8);
+  out += static_cast<char>(len & 0xFF);
+  if (len) out.append(s, len);
+}
+
+bool PubSubClient::writePacket(uint8_t header, const uint8_t* body, size_t length) {
+  std::string packet;
+  packet += static_cast<char>(header);
+  size_t remaining = length;
+  do {
+    uint8_t digit = remaining % 128;
+    remaining /= 128;
+    if (remaining) digit |= 0x80;
+    packet += static_cast<char>(digit);
+  } while (remaining);
+  packet.append(reinterpret_cast<const char*>(body), length);
+  size_t written = _client->write(reinterpret_cast<const uint8_t*>(packet.data()), packet.size());
+  _lastOutActivity = millis();
+  return written == packet.size();
+}
+
+bool PubSubClient::readPacket(uint8_t& header, std::string& body, unsigned long timeoutMs) {
+  _client->setTimeout(timeoutMs);
+  char byte;
+  if (_client->readBytes(&byte, 1) != 1) return false;
+  header = static_cast<uint8_t>(byte);
+  size_t length = 0;
+  size_t multiplier = 1;
+  do {
+    if (_client->readBytes(&byte, 1) != 1) return false;
+    length += (static_cast<uint8_t>(byte) & 0x7F) * multiplier;
+    multiplier *= 128;
+  } while ((static_cast<uint8_t>(byte) & 0x80) && multiplier <= 128 * 128 * 128);
+  body.assign(length, '\0');
+  if (length && _client->readBytes(&body[0], length) != length) return false;
+  _lastInActivity = millis();
+  return true;
+}
+
+bool PubSubClient::connect(const char* id, const char* user, const char* pass) {
+  if (connected()) return true;
+  if (!_client->connect(_domain.c_str(), _port)) {
+    _state = MQTT_CONNECT_FAILED;
+    return false;
+  }
+
+  std::string body;
+  appendString(body, "MQTT");
+  body += static_cast<char>(4); // Protocol level 3.1.1
+  uint8_t flags = 0x02;         // Clean session
+  if (user && *user) flags |= 0x80;
+  if (user && *user && pass) flags |= 0x40;
+  body += static_cast<char>(flags);
+  body += static_cast<char>(MQTT_KEEPALIVE >> 8);
+  body += static_cast<char>(MQTT_KEEPALIVE & 0xFF);
+  appendString(body, id);
+  if (flags & 0x80) appendString(body, user);
+  if (flags & 0x40) appendString(body, pass);
+
+  uint8_t header = 0;
+  std::string ack;
+  if (!writePacket(0x10, reinterpret_cast<const uint8_t*>(body.data()), body.size()) ||
+      !readPacket(header, ack, MQTT_SOCKET_TIMEOUT_MS)) {
+    _client->stop();
+    _state = MQTT_CONNECTION_TIMEOUT;
+    return false;
+  }
+  if ((header & 0xF0) != 0x20 || ack.size() < 2 || ack[1] != 0) {
+    _client->stop();
+    _state = ack.size() >= 2 ? static_cast<uint8_t>(ack[1]) : MQTT_CONNECT_FAILED;
+    return false;
+  }
+  _pingOutstanding = false;
+  _lastInActivity = millis();
+  _state = MQTT_CONNECTED;
+  return true;
+}
+
+void PubSubClient::disconnect() {
+  static const uint8_t none = 0;
+  if (_state == MQTT_CONNECTED) writePacket(0xE0, &none, 0);
+  _client->stop();
+  _state = MQTT_DISCONNECTED;
+}
+
+bool PubSubClient::connected() {
+  if (_state != MQTT_CONNECTED) return false;
+  if (!_client->connected()) {
+    _state = MQTT_CONNECTION_LOST;
+    _client->stop();
+    return false;
+  }
+  return true;
+}
+
+bool PubSubClient::loop() {
+  if (!connected()) return false;
+  unsigned long now = millis();
+  unsigned long keepAliveMs = MQTT_KEEPALIVE * 1000UL;
+  if (now - _lastInActivity > keepAliveMs || now - _lastOutActivity > keepAliveMs) {
+    if (_pingOutstanding) {
+      _state = MQTT_CONNECTION_TIMEOUT;
+      _client->stop();
+      return false;
+    }
+    static const uint8_t none = 0;
+    writePacket(0xC0, &none, 0);
+    _lastInActivity = now;
+    _pingOutstanding = true;
+  }
+
+  while (_client->available()) {
+    uint8_t header = 0;
+    std::string body;
+    if (!readPacket(header, body, MQTT_SOCKET_TIMEOUT_MS)) {
+      _state = MQTT_CONNECTION_LOST;
+      _client->stop();
+      return false;
+    }
+    uint8_t type = header & 0xF0;
+    if (type == 0x30 && body.size() >= 2) {
+      size_t topicLen = (static_cast<uint8_t>(body[0]) << 8) | static_cast<uint8_t>(body[1]);
+      size_t offset = 2 + topicLen;
+      if ((header & 0x06) != 0) offset += 2; // Packet id present for QoS > 0
+      if (offset > body.size()) continue;
+      std::string topic = body.substr(2, topicLen);
+      std::string payload = body.substr(offset);
+      if (_callback) {
+        _callback(&topic[0], reinterpret_cast<uint8_t*>(&payload[0]), static_cast<unsigned int>(payload.size()));
+      }
+    } else if (type == 0xD0) {
+      _pingOutstanding = false;
+    } else if (type == 0xC0) {
+      static const uint8_t none = 0;
+      writePacket(0xD0, &none, 0);
+    }
+  }
+  return true;
+}
+
+bool PubSubClient::publish(const char* topic, const char* payload, bool retained) {
+  return publish(topic, reinterpret_cast<const uint8_t*>(payload), payload ? strlen(payload) : 0, retained);
+}
+
+bool PubSubClient::publish(const char* topic, const uint8_t* payload, unsigned int length, bool retained) {
+  if (!connected()) return false;
+  std::string body;
+  appendString(body, topic);
+  // Mirror the library's fixed buffer: oversized messages are rejected, not split.
+  if (body.size() + length + 5 > _bufferSize) return false;
+  body.append(reinterpret_cast<const char*>(payload), length);
+  return writePacket(retained ? 0x31 : 0x30, reinterpret_cast<const uint8_t*>(body.data()), body.size());
+}
+
+bool PubSubClient::subscribe(const char* topic, uint8_t qos) {
+  if (!connected()) return false;
+  std::string body;
+  uint16_t id = _nextMsgId++;
+  if (_nextMsgId == 0) _nextMsgId = 1;
+  body += static_cast<char>(id >> 8);
+  body += static_cast<char>(id & 0xFF);
+  appendString(body, topic);
+  body += static_cast<char>(qos > 1 ? 1 : qos);
+  return writePacket(0x82, reinterpret_cast<const uint8_t*>(body.data()), body.size());
+}
+
+bool PubSubClient::unsubscribe(const char* topic) {
+  if (!connected()) return false;
+  std::string body;
+  uint16_t id = _nextMsgId++;
+  if (_nextMsgId == 0) _nextMsgId = 1;
+  body += static_cast<char>(id >> 8);
+  body += static_cast<char>(id & 0xFF);
+  appendString(body, topic);
+  return writePacket(0xA2, reinterpret_cast<const uint8_t*>(body.data()), body.size());
+}
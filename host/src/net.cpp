@@ -0,0 +1,309 @@
+// Host implementation of WiFiClient/WiFiServer over non-blocking POSIX sockets.
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <linux/sockios.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <string>
+#include "WiFiClient.h"
+#include "host_platform.h"
+
+static const int HOST_CONNECT_TIMEOUT_MS = 2000;
+static const int HOST_WRITE_TIMEOUT_MS = 5000; // Mirrors the core's default client timeout
+static const int HOST_SND_BUF = 2920;          // lwIP's TCP_SND_BUF (2 * TCP_MSS) on the ESP8266
+
+struct HostSocket {
+  int fd = -1;
+  bool open = false;
+  std::string rx;    // Bytes received but not yet consumed
+  size_t rxPos = 0;
+  ~HostSocket() { if (fd >= 0) ::close(fd); }
+};
+
+static void setNonBlocking(int fd) {
+  int flags = fcntl(fd, F_GETFL, 0);
+  fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+static void ignoreSigpipe() {
+  static bool done = false;
+  if (!done) {
+    signal(SIGPIPE, SIG_IGN);
+    done = true;
+  }
+}
+
+// ---------------------------------------------------------------------------
+// WiFiClient
+// ---------------------------------------------------------------------------
+
+int WiFiClient::connect(const char* host, uint16_t port) {
+  ignoreSigpipe();
+  stop();
+  if (hostOptions().simulate) return 0; // Simulated runs stay offline so they are repeatable
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo* res = nullptr;
+  char portStr[8];
+  snprintf(portStr, sizeof(portStr), "%u", port);
+  if (getaddrinfo(host, portStr, &hints, &res) != 0 || !res) return 0;
+
+  int fd = socket(res->ai_family, res->ai_socktype | SOCK_CLOEXEC, res->ai_protocol);
+  if (fd < 0) {
+    freeaddrinfo(res);
+    return 0;
+  }
+  setNonBlocking(fd);
+  int rc = ::connect(fd, res->ai_addr, res->ai_addrlen);
+  freeaddrinfo(res);
+  if (rc != 0 && errno != EINPROGRESS) {
+    ::close(fd);
+    return 0;
+  }
+  if (rc != 0) {
+    struct pollfd pfd = { fd, POLLOUT, 0 };
+    int err = 0;
+    socklen_t len = sizeof(err);
+    if (poll(&pfd, 1, HOST_CONNECT_TIMEOUT_MS) != 1 ||
+        getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) != 0 || err != 0) {
+      ::close(fd);
+      return 0;
+    }
+  }
+  _sock = std::make_shared<HostSocket>();
+  _sock->fd = fd;
+  _sock->open = true;
+  setNoDelay(_noDelay);
+  return 1;
+}
+
+bool WiFiClient::fill(int timeoutMs) {
+  if (!_sock || !_sock->open) return false;
+  if (_sock->rxPos > 0 && _sock->rxPos == _sock->rx.size()) {
+    _sock->rx.clear();
+    _sock->rxPos = 0;
+  }
+  if (timeoutMs > 0) {
+    struct pollfd pfd = { _sock->fd, POLLIN, 0 };
+    if (poll(&pfd, 1, timeoutMs) <= 0) return false;
+  }
+  char buf[2048];
+  ssize_t n = recv(_sock->fd, buf, sizeof(buf), 0);
+  if (n > 0) {
+    _sock->rx.append(buf, static_cast<size_t>(n));
+    return true;
+  }
+  if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+    _sock->open = false; // Peer closed; buffered bytes remain readable
+  }
+  return false;
+}
+
+uint8_t WiFiClient::connected() {
+  if (!_sock) return 0;
+  if (_sock->rxPos < _sock->rx.size()) return 1;
+  if (_sock->open) fill(0);
+  return (_sock->open || _sock->rxPos < _sock->rx.size()) ? 1 : 0;
+}
+
+void WiFiClient::stop() {
+  if (_sock && _sock->fd >= 0) {
+    ::close(_sock->fd);
+    _sock->fd = -1;
+    _sock->open = false;
+  }
+  _sock.reset();
+}
+
+int WiFiClient::available() {
+  if (!_sock) return 0;
+  if (_sock->rxPos == _sock->rx.size()) fill(0);
+  return static_cast<int>(_sock->rx.size() - _sock->rxPos);
+}
+
+int WiFiClient::read() {
+  if (available() <= 0) return -1;
+  return static_cast<uint8_t>(_sock->rx[_sock->rxPos++]);
+}
+
+int WiFiClient::read(uint8_t* buffer, size_t size) {
+  int avail = available();
+  if (avail <= 0) return -1;
+  size_t n = std::min(size, static_cast<size_t>(avail));
+  memcpy(buffer, _sock->rx.data() + _sock->rxPos, n);
+  _sock->rxPos += n;
+  return static_cast<int>(n);
+}
+
+int WiFiClient::peek() {
+  if (available() <= 0) return -1;
+  return static_cast<uint8_t>(_sock->rx[_sock->rxPos]);
+}
+
+size_t WiFiClient::readBytes(char* buffer, size_t length) {
+  size_t count = 0;
+  unsigned long start = millis();
+  while (count < length && _sock) {
+    int n = read(reinterpret_cast<uint8_t*>(buffer) + count, length - count);
+    if (n > 0) {
+      count += n;
+      continue;
+    }
+    long remaining = static_cast<long>(_timeout) - static_cast<long>(millis() - start);
+    if (remaining <= 0 || !_sock->open) break;
+    fill(static_cast<int>(remaining));
+  }
+  return count;
+}
+
+size_t WiFiClient::write(const uint8_t* buffer, size_t size) {
+  if (!_sock || !_sock->open) return 0;
+  size_t sent = 0;
+  while (sent < size) {
+    ssize_t n = send(_sock->fd, buffer + sent, size - sent, MSG_NOSIGNAL);
+    if (n > 0) {
+      sent += static_cast<size_t>(n);
+      continue;
+    }
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+      struct pollfd pfd = { _sock->fd, POLLOUT, 0 };
+      if (poll(&pfd, 1, HOST_WRITE_TIMEOUT_MS) > 0) continue;
+    }
+    _sock->open = false;
+    break;
+  }
+  return sent;
+}
+
+int WiFiClient::availableForWrite() {
+  if (!_sock || !_sock->open) return 0;
+  // Like lwIP: room left once unacknowledged bytes are subtracted from the send buffer
+  int queued = 0;
+  if (ioctl(_sock->fd, SIOCOUTQ, &queued) != 0) queued = 0;
+  return queued < HOST_SND_BUF ? HOST_SND_BUF - queued : 0;
+}
+
+IPAddress WiFiClient::remoteIP() const {
+  if (!_sock || _sock->fd < 0) return IPAddress();
+  struct sockaddr_in addr;
+  socklen_t len = sizeof(addr);
+  if (getpeername(_sock->fd, reinterpret_cast<sockaddr*>(&addr), &len) != 0) return IPAddress();
+  return IPAddress(addr.sin_addr.s_addr);
+}
+
+uint16_t WiFiClient::remotePort() const {
+  if (!_sock || _sock->fd < 0) return 0;
+  struct sockaddr_in addr;
+  socklen_t len = sizeof(addr);
+  if (getpeername(_sock->fd, reinterpret_cast<sockaddr*>(&addr), &len) != 0) return 0;
+  return ntohs(addr.sin_port);
+}
+
+IPAddress WiFiClient::localIP() const {
+  if (!_sock || _sock->fd < 0) return IPAddress();
+  struct sockaddr_in addr;
+  socklen_t len = sizeof(addr);
+  if (getsockname(_sock->fd, reinterpret_cast<sockaddr*>(&addr), &len) != 0) return IPAddress();
+  return IPAddress(addr.sin_addr.s_addr);
+}
+
+void WiFiClient::setNoDelay(bool noDelay) {
+  _noDelay = noDelay;
+  if (_sock && _sock->fd >= 0) {
+    int flag = noDelay ? 1 : 0;
+    setsockopt(_sock->fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+  }
+}
+
+int WiFiClient::fd() const { return _sock ? _sock->fd : -1; }
+
+// ---------------------------------------------------------------------------
+// WiFiServer
+// ---------------------------------------------------------------------------
+
+WiFiServer::~WiFiServer() { close(); }
+
+void WiFiServer::begin(uint16_t port, uint8_t backlog) {
+  ignoreSigpipe();
+  close();
+  if (port) _port = port;
+  _backlog = backlog ? backlog : 1; // Bounds the pending list; the kernel queue holds the rest, as lwIP delays them
+  if (hostOptions().simulate) return; // No listener, so several simulations can run side by side
+  // Port 80 needs privileges on the host, so it is remapped to --port.
+  uint16_t hostPort = _port == 80 ? hostOptions().httpPort : _port;
+
+  _fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0); // Must not leak across ESP.restart()'s exec
+  if (_fd < 0) return;
+  int yes = 1;
+  setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(hostPort);
+  if (bind(_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(_fd, SOMAXCONN) != 0) {
+    fprintf(stderr, "[HOST] Could not listen on port %u: %s\n", hostPort, strerror(errno));
+    ::close(_fd);
+    _fd = -1;
+    return;
+  }
+  setNonBlocking(_fd);
+  fprintf(stderr, "[HOST] Listening on http://127.0.0.1:%u/\n", hostPort);
+}
+
+void WiFiServer::close() {
+  if (_fd >= 0) ::close(_fd);
+  _fd = -1;
+  _pending.clear();
+}
+
+// Moves connections from the kernel's listen queue into the pending list while there is room.
+void WiFiServer::takePending() {
+  while (_fd >= 0 && _pending.size() < _backlog) {
+    int fd = ::accept4(_fd, nullptr, nullptr, SOCK_CLOEXEC);
+    if (fd < 0) return;
+    setNonBlocking(fd);
+    std::shared_ptr<HostSocket> sock = std::make_shared<HostSocket>();
+    sock->fd = fd;
+    sock->open = true;
+    WiFiClient client(sock);
+    client.setNoDelay(_noDelay);
+    _pending.push_back(client);
+  }
+}
+
+bool WiFiServer::hasClient() {
+  takePending();
+  return !_pending.empty();
+}
+
+bool WiFiServer::hasClientData() {
+  takePending();
+  for (WiFiClient& client : _pending) {
+    if (client.available()) return true;
+  }
+  return false;
+}
+
+bool WiFiServer::hasMaxPendingClients() {
+  takePending();
+  return _pending.size() >= _backlog;
+}
+
+WiFiClient WiFiServer::accept() {
+  takePending();
+  if (_pending.empty()) return WiFiClient();
+  WiFiClient client = _pending.front();
+  _pending.pop_front();
+  return client;
+}
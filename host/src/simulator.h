@@ -0,0 +1,249 @@
+#pragma once
+// Time-warp simulator for the host build (--simulate).
+//
+// setup()/loop() run against the virtual clock in arduino_core.cpp. After each
+// loop() the clock jumps straight to the next deadline the sketch is waiting
+// on, so months of operation take seconds. Temperatures come from a scripted
+// curve fed through the test-mode hooks (simulatedAtticTemp and friends).
+// ESP.restart() re-executes the binary as usual; the simulator saves its clock
+// and statistics first and resumes from them on the warm boot.
+//
+// Included by sketch.cpp after the sketch, because it reads the sketch's timer globals.
+
+#include <math.h>
+#include <vector>
+#include "host_platform.h"
+
+#define SIM_STATE_FILE "/.sim_state"
+#define SIM_INDOOR_SENSOR_PERIOD_MS 60000UL
+
+struct SimDayStats {
+  uint64_t loops = 0;
+  uint64_t flashBytes = 0;
+  uint64_t flashOps = 0;
+  uint32_t restarts = 0;
+  uint64_t fanOnMs = 0;
+};
+
+struct SimCurvePoint {
+  float hour;
+  float attic;
+  float outdoor;
+  float humidity;
+};
+
+static std::vector<SimDayStats> simDays;
+static std::vector<SimCurvePoint> simCurve;
+static uint64_t simFlashAccounted = 0;
+static uint64_t simFlashOpsAccounted = 0;
+static uint64_t simNextIndoorFeedUs = 0;
+
+static std::string simStatePath() { return hostOptions().fsDir + SIM_STATE_FILE; }
+
+static SimDayStats& simDay(uint64_t nowUs) {
+  size_t day = static_cast<size_t>(nowUs / 86400000000ULL);
+  if (simDays.size() <= day) simDays.resize(day + 1);
+  return simDays[day];
+}
+
+// Charges flash writes since the last call to the day containing nowUs.
+static void simAccountFlash(uint64_t nowUs) {
+  uint64_t written = hostFlashBytesWritten();
+  uint64_t ops = hostFlashWriteOps();
+  simDay(nowUs).flashBytes += written - simFlashAccounted;
+  simDay(nowUs).flashOps += ops - simFlashOpsAccounted;
+  simFlashAccounted = written;
+  simFlashOpsAccounted = ops;
+}
+
+static void simSaveState() {
+  uint64_t nowUs = hostClockNowUs();
+  simAccountFlash(nowUs);
+  simDay(nowUs).restarts++;
+  FILE* f = fopen(simStatePath().c_str(), "w");
+  if (!f) return;
+  fprintf(f, "%llu %llu\n", (unsigned long long)nowUs, (unsigned long long)simNextIndoorFeedUs);
+  for (const SimDayStats& d : simDays) {
+    fprintf(f, "%llu %llu %llu %u %llu\n", (unsigned long long)d.loops, (unsigned long long)d.flashBytes,
+            (unsigned long long)d.flashOps, d.restarts, (unsigned long long)d.fanOnMs);
+  }
+  fclose(f);
+}
+
+static bool simLoadState(uint64_t& nowUs) {
+  FILE* f = fopen(simStatePath().c_str(), "r");
+  if (!f) return false;
+  unsigned long long now = 0, feed = 0;
+  bool ok = fscanf(f, "%llu %llu", &now, &feed) == 2;
+  unsigned long long loops, flash, flashOps, fanOn;
+  unsigned restarts;
+  while (ok && fscanf(f, "%llu %llu %llu %u %llu", &loops, &flash, &flashOps, &restarts, &fanOn) == 5) {
+    SimDayStats d;
+    d.loops = loops;
+    d.flashBytes = flash;
+    d.flashOps = flashOps;
+    d.restarts = restarts;
+    d.fanOnMs = fanOn;
+    simDays.push_back(d);
+  }
+  fclose(f);
+  nowUs = now;
+  simNextIndoorFeedUs = feed;
+  return ok;
+}
+
+// Script rows are "hour,attic_f,outdoor_f[,humidity]" describing one local day.
+static bool simLoadCurve(const std::string& path) {
+  FILE* f = fopen(path.c_str(), "r");
+  if (!f) return false;
+  char line[128];
+  while (fgets(line, sizeof(line), f)) {
+    SimCurvePoint p;
+    p.humidity = 50.0f;
+    if (line[0] == '#') continue;
+    if (sscanf(line, "%f,%f,%f,%f", &p.hour, &p.attic, &p.outdoor, &p.humidity) >= 3) simCurve.push_back(p);
+  }
+  fclose(f);
+  return !simCurve.empty();
+}
+
+// Drives the test-mode temperatures from the script, or from a built-in summer
+// day (attic peaks near 108°F early afternoon, outdoor swings 58-86°F).
+static void simApplyCurve() {
+  time_t now = time(nullptr);
+  struct tm* t = localtime(&now);
+  float hour = t->tm_hour + t->tm_min / 60.0f + t->tm_sec / 3600.0f;
+
+  if (simCurve.empty()) {
+    float outdoor = 72.0f + 14.0f * cosf(2.0f * PI * (hour - 15.0f) / 24.0f);
+    float sun = sinf(PI * (hour - 7.0f) / 14.0f);
+    simulatedOutdoorTemp = outdoor;
+    simulatedAtticTemp = outdoor + 4.0f + (sun > 0 ? 22.0f * sun : 0.0f);
+    simulatedAtticHumidity = 40.0f + 15.0f * cosf(2.0f * PI * (hour - 4.0f) / 24.0f);
+    return;
+  }
+
+  // Linear interpolation, wrapping from the last row back to the first.
+  size_t n = simCurve.size();
+  size_t next = 0;
+  while (next < n && simCurve[next].hour <= hour) next++;
+  const SimCurvePoint& a = simCurve[(next + n - 1) % n];
+  const SimCurvePoint& b = simCurve[next % n];
+  float span = b.hour - a.hour;
+  if (span <= 0) span += 24.0f;
+  float into = hour - a.hour;
+  if (into < 0) into += 24.0f;
+  float k = span > 0 ? into / span : 0.0f;
+  simulatedAtticTemp = a.attic + (b.attic - a.attic) * k;
+  simulatedOutdoorTemp = a.outdoor + (b.outdoor - a.outdoor) * k;
+  simulatedAtticHumidity = a.humidity + (b.humidity - a.humidity) * k;
+}
+
+static void simFeedIndoorSensor(uint64_t nowUs) {
+  if (hostOptions().simIndoorSensorHours <= 0 || nowUs < simNextIndoorFeedUs) return;
+  if (nowUs >= static_cast<uint64_t>(hostOptions().simIndoorSensorHours * 3600e6)) return;
+  registerOrUpdateSensor("sim-1", "Simulated Room", simulatedOutdoorTemp - 8.0f, 45.0f, "127.0.0.1");
+  simNextIndoorFeedUs = nowUs + SIM_INDOOR_SENSOR_PERIOD_MS * 1000ULL;
+}
+
+// Narrows *wait to the time left until start + interval, in the device's 32-bit millis() arithmetic.
+static void simDeadline(uint32_t now, uint32_t start, uint32_t interval, uint32_t* wait) {
+  uint32_t elapsed = now - start;
+  if (elapsed < interval && interval - elapsed < *wait) *wait = interval - elapsed;
+}
+
+// Narrows *wait to an absolute millis() deadline if it lies in the future.
+static void simDeadlineAt(uint32_t now, uint32_t at, uint32_t* wait) {
+  uint32_t ahead = at - now;
+  if (ahead > 0 && ahead < 0x80000000UL && ahead < *wait) *wait = ahead;
+}
+
+// Milliseconds until the next timer in loop() falls due. Timers kept in
+// function-local statics (mDNS announce, sensor cleanup, MQTT) are not visible
+// here; they fire on the next sensor tick after they fall due.
+static uint32_t simNextWakeMs(uint64_t nowUs) {
+  uint32_t now = millis();
+  uint32_t wait = SENSOR_UPDATE_INTERVAL_MS;
+  simDeadline(now, lastSensorRead, SENSOR_UPDATE_INTERVAL_MS, &wait);
+  simDeadline(now, lastWeatherUpdate, WEATHER_UPDATE_INTERVAL_MS, &wait);
+  simDeadline(now, lastDailyRestartCheck, 3600000UL + 1, &wait);
+  if (manualTimer.isActive) {
+    simDeadlineAt(now, manualTimer.delayEndTime, &wait);
+    simDeadlineAt(now, manualTimer.timerEndTime, &wait);
+  }
+  if (hostOptions().simIndoorSensorHours > 0 && simNextIndoorFeedUs > nowUs) {
+    uint64_t feedMs = (simNextIndoorFeedUs - nowUs + 999) / 1000;
+    if (feedMs < wait) wait = static_cast<uint32_t>(feedMs);
+  }
+  return wait ? wait : 1;
+}
+
+static void simPrintReport(uint64_t endUs) {
+  simAccountFlash(endUs > 0 ? endUs - 1 : 0);
+  size_t historyBytes = historyStorageBytes(), diagnosticsBytes = diagnosticsLogBytes();
+
+  time_t start = static_cast<time_t>(hostOptions().simStartEpoch);
+  char startStr[32];
+  strftime(startStr, sizeof(startStr), "%Y-%m-%dT%H:%M:%SZ", gmtime(&start));
+  printf("=== Simulation report: %.2f days from %s ===\n", endUs / 86400e6, startStr);
+  printf("%5s %12s %14s %10s %9s %9s\n", "day", "loops", "flash_bytes", "flash_ops", "restarts", "fan_on_h");
+  SimDayStats total;
+  for (size_t i = 0; i < simDays.size(); i++) {
+    const SimDayStats& d = simDays[i];
+    printf("%5zu %12llu %14llu %10llu %9u %9.2f\n", i, (unsigned long long)d.loops, (unsigned long long)d.flashBytes,
+           (unsigned long long)d.flashOps, d.restarts, d.fanOnMs / 3600000.0);
+    total.loops += d.loops;
+    total.flashBytes += d.flashBytes;
+    total.flashOps += d.flashOps;
+    total.restarts += d.restarts;
+    total.fanOnMs += d.fanOnMs;
+  }
+  double days = endUs / 86400e6;
+  printf("total %12llu %14llu %10llu %9u %9.2f\n", (unsigned long long)total.loops, (unsigned long long)total.flashBytes,
+         (unsigned long long)total.flashOps, total.restarts, total.fanOnMs / 3600000.0);
+  if (days > 0) {
+    printf("per simulated day: %.0f loop iterations, %.0f flash bytes written in %.0f write operations\n",
+           total.loops / days, total.flashBytes / days, total.flashOps / days);
+  }
+  printf("history: %lu records in %zu bytes, diagnostics log: %zu bytes, indoor sensors active: %d\n",
+         (unsigned long)historyRecordCount(), historyBytes, diagnosticsBytes, activeSensorCount);
+}
+
+static int runSimulation() {
+  HostOptions& opt = hostOptions();
+  if (!opt.simScript.empty() && !simLoadCurve(opt.simScript)) {
+    fprintf(stderr, "[SIM] Could not read temperature script %s\n", opt.simScript.c_str());
+    return 2;
+  }
+
+  uint64_t nowUs = 0;
+  if (opt.warmBoot && simLoadState(nowUs)) {
+    hostClockEnableVirtual(nowUs, nowUs); // millis() restarts from zero after a reset
+  } else {
+    simDays.clear();
+    hostClockEnableVirtual(0, 0 - static_cast<uint64_t>(opt.simStartMs) * 1000ULL);
+  }
+  remove(simStatePath().c_str());
+  hostSetRestartHook(simSaveState);
+
+  const uint64_t endUs = static_cast<uint64_t>(opt.simDays * 86400e6);
+  setup();
+  config.testModeEnabled = true; // Route readings through the simulated* hooks; never saved to EEPROM
+  simFlashAccounted = 0;
+  simFlashOpsAccounted = 0;
+
+  while ((nowUs = hostClockNowUs()) < endUs) {
+    simApplyCurve();
+    simFeedIndoorSensor(nowUs);
+    simDay(nowUs).loops++;
+    loop();
+    simAccountFlash(nowUs);
+
+    uint64_t wakeUs = hostClockNowUs() + simNextWakeMs(hostClockNowUs()) * 1000ULL;
+    if (digitalRead(FAN_RELAY_PIN) == HIGH) simDay(nowUs).fanOnMs += (wakeUs - nowUs) / 1000;
+    hostClockAdvanceTo(wakeUs);
+  }
+
+  simPrintReport(endUs);
+  return 0;
+}
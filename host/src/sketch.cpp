@@ -0,0 +1,24 @@
+// Compiles the unmodified sketch as a C++ translation unit and drives it like
+// the ESP8266 core does: setup() once, then loop() forever.
+
+#include "Arduino.h"
+#include "host_platform.h"
+#include "AtticFanControl.ino"
+#include "simulator.h"
+
+int main(int argc, char** argv) {
+  if (!hostParseArgs(argc, argv)) {
+    fprintf(stderr, "usage: %s [--port N] [--fs-dir DIR] [--loop-sleep-us N] [--quiet]\n"
+                    "       %s --simulate [--sim-days N] [--sim-script FILE] [--sim-start-epoch S]\n"
+                    "                     [--start-ms MS] [--sim-indoor-sensor-hours H] [--verbose]\n", argv[0], argv[0]);
+    return 2;
+  }
+  hostInit();
+  if (hostOptions().simulate) return runSimulation();
+  setup();
+  const unsigned long sleepUs = hostOptions().loopSleepUs;
+  for (;;) {
+    loop();
+    if (sleepUs) delayMicroseconds(sleepUs);
+  }
+}
@@ -0,0 +1,352 @@
+// Unit tests for helpers whose output has to match something exactly: the
+// history codec and record numbers, the /history.csv line lengths behind
+// Content-Length, Range parsing, the ingest token buckets and the JSON number
+// formatting. Compiles the sketch like sketch.cpp but never runs setup()/loop();
+// LittleFS is backed by a temporary directory. Run with ctest.
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+#include "Arduino.h"
+#include "host_platform.h"
+#include "AtticFanControl.ino"
+
+static int checks = 0;
+static int failures = 0;
+
+#define CHECK(cond)                                                              \
+  do {                                                                           \
+    checks++;                                                                    \
+    if (!(cond)) {                                                               \
+      fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond);   \
+      failures++;                                                                \
+    }                                                                            \
+  } while (0)
+
+// Deterministic pseudo-random numbers, so failures reproduce.
+static uint32_t testRandomState = 12345;
+static uint32_t testRandom() {
+  testRandomState = testRandomState * 1664525UL + 1013904223UL;
+  return testRandomState;
+}
+
+static bool sameRecord(const HistoryRecord& a, const HistoryRecord& b) {
+  return a.timestamp == b.timestamp && a.atticTemp == b.atticTemp && a.outdoorTemp == b.outdoorTemp &&
+         a.humidity == b.humidity && (a.flags & HISTORY_FLAG_FAN_ON) == (b.flags & HISTORY_FLAG_FAN_ON);
+}
+
+// === History CSV formatting ===
+
+// The "%.2f" formatting formatHistoryCsvLine() replaced.
+static size_t referenceCsvLine(const HistoryRecord& record, char* buf, size_t size) {
+  char timestampStr[20] = "";
+  if (record.timestamp) {
+    time_t ts = (time_t)record.timestamp;
+    strftime(timestampStr, sizeof(timestampStr), "%Y-%m-%dT%H:%M", localtime(&ts));
+  }
+  return snprintf(buf, size, "%s,%.2f,%.2f,%.2f,%d\n", timestampStr, record.atticTemp / 100.0f,
+                  record.outdoorTemp / 100.0f, record.humidity / 100.0f, (record.flags & HISTORY_FLAG_FAN_ON) ? 1 : 0);
+}
+
+static void testHistoryFixed() {
+  for (int32_t value = -32768; value <= 65535; value++) {
+    char ours[16], printed[16];
+    size_t len = formatHistoryFixed(ours, value);
+    ours[len] = '\0';
+    snprintf(printed, sizeof(printed), "%.2f", value / 100.0f);
+    if (strcmp(ours, printed) != 0) {
+      fprintf(stderr, "formatHistoryFixed(%ld) = \"%s\", printf gives \"%s\"\n", (long)value, ours, printed);
+      CHECK(false);
+      return;
+    }
+  }
+  CHECK(true);
+}
+
+static void testCsvLineLength() {
+  const float temps[] = { 0.0f, -0.0f, -0.005f, -0.004f, 0.005f, -0.01f, -9.99f, -10.0f, -40.0f, 99.995f,
+                          123.456f, 327.67f, -327.68f, 1000.0f, -1000.0f };
+  const uint32_t timestamps[] = { 0, 1, 1756509312UL, UINT32_MAX };
+  for (float attic : temps) {
+    for (float outdoor : temps) {
+      for (uint32_t timestamp : timestamps) {
+        HistoryRecord record = {};
+        record.timestamp = timestamp;
+        record.atticTemp = historyFixedPoint(attic);
+        record.outdoorTemp = historyFixedPoint(outdoor);
+        record.humidity = (uint16_t)historyFixedPoint(attic < 0 ? -attic : attic);
+        record.flags = timestamp & 1 ? HISTORY_FLAG_FAN_ON : 0;
+        char line[HISTORY_CSV_LINE_MAX], reference[96];
+        size_t len = formatHistoryCsvLine(record, line, sizeof(line));
+        referenceCsvLine(record, reference, sizeof(reference));
+        CHECK(len == strlen(line));
+        CHECK(historyCsvLineLength(record) == strlen(line));
+        CHECK(strcmp(line, reference) == 0);
+      }
+    }
+  }
+  // A short buffer truncates like snprintf
+  HistoryRecord record = { 1756509312UL, -32768, -32768, 65535, HISTORY_FLAG_FAN_ON, 0 };
+  char small[8];
+  CHECK(formatHistoryCsvLine(record, small, sizeof(small)) == 7);
+  CHECK(strlen(small) == 7);
+}
+
+// === History ring ===
+
+static HistoryRecord randomRecord(uint32_t& clock) {
+  HistoryRecord record = {};
+  switch (testRandom() % 8) {
+    case 0: clock = 0; break;                             // Clock not synced
+    case 1: clock -= testRandom() % 7200; break;          // Clock stepped back
+    case 2: clock += testRandom(); break;                 // Wild jump
+    default: clock += 300 + testRandom() % 5; break;
+  }
+  record.timestamp = clock;
+  uint32_t r = testRandom();
+  record.atticTemp = (r & 3) == 0 ? (int16_t)testRandom() : (int16_t)(9000 + testRandom() % 300);
+  record.outdoorTemp = (r & 12) == 0 ? (int16_t)testRandom() : (int16_t)(7000 + testRandom() % 300);
+  record.humidity = (r & 48) == 0 ? (uint16_t)testRandom() : (uint16_t)(4000 + testRandom() % 100);
+  record.flags = (r >> 8) & 1 ? HISTORY_FLAG_FAN_ON : 0;
+  return record;
+}
+
+static void writeRecords(std::vector<HistoryRecord>& written, uint32_t count, uint32_t& clock) {
+  HistoryRecord batch[HISTORY_BUFFER_RECORDS];
+  while (count) {
+    uint8_t n = (uint8_t)(1 + testRandom() % HISTORY_BUFFER_RECORDS);
+    if (n > count) n = (uint8_t)count;
+    for (uint8_t i = 0; i < n; i++) {
+      batch[i] = randomRecord(clock);
+      written.push_back(batch[i]);
+    }
+    CHECK(historyWriteRecords(batch, n));
+    count -= n;
+  }
+}
+
+// Reads the ring from the oldest record and checks it against the tail of written.
+static void checkRing(const std::vector<HistoryRecord>& written) {
+  uint32_t stored = historyRecordCount();
+  CHECK(stored <= written.size());
+  CHECK(historyNextRecord() == written.size());
+  HistoryCursor cursor;
+  cursor.begin();
+  HistoryRecord record;
+  uint32_t expected = written.size() - stored;
+  size_t csvBytes = strlen(HISTORY_CSV_HEADER);
+  bool matches = true;
+  while (cursor.next(record)) {
+    matches = matches && expected < written.size() && cursor.number == expected && sameRecord(record, written[expected]);
+    csvBytes += historyCsvLineLength(record);
+    expected++;
+  }
+  cursor.end();
+  CHECK(matches);
+  CHECK(expected == written.size());
+  CHECK(historyCsvBytes() == csvBytes);
+}
+
+static void testHistoryRing() {
+  LittleFS.format();
+  initHistoryStore();
+  std::vector<HistoryRecord> written;
+  uint32_t clock = 1751328000UL;
+
+  writeRecords(written, 300, clock);
+  checkRing(written);
+
+  // Enough to wrap the ring
+  while (historyStore.headSeq < HISTORY_SEGMENTS + 2) writeRecords(written, 1000, clock);
+  checkRing(written);
+
+  // A restart keeps the numbering and the CSV sizes, with or without the saved sizes
+  initHistoryStore();
+  checkRing(written);
+  LittleFS.remove(HISTORY_CSV_SIZES_PATH);
+  initHistoryStore();
+  checkRing(written);
+
+  // since returns every newer record, unsynced or out of time order
+  uint32_t since = written.size() - 40;
+  HistoryRecord unsynced = randomRecord(clock);
+  unsynced.timestamp = 0;
+  CHECK(historyWriteRecords(&unsynced, 1));
+  written.push_back(unsynced);
+  HistoryQuery query;
+  query.beginSince(since, HISTORY_QUERY_MAX_POINTS);
+  HistoryRecord record;
+  uint16_t steps = UINT16_MAX;
+  uint32_t expected = since;
+  bool matches = true;
+  while (query.next(record, steps)) {
+    matches = matches && expected < written.size() && sameRecord(record, written[expected]);
+    expected++;
+  }
+  query.end();
+  CHECK(query.done());
+  CHECK(matches);
+  CHECK(expected == written.size());
+
+  // A walk paused in the write-back buffer continues in the ring after a flush
+  for (uint8_t i = 0; i < 3; i++) {
+    historyBuffer.records[historyBuffer.count++] = randomRecord(clock);
+    written.push_back(historyBuffer.records[historyBuffer.count - 1]);
+  }
+  HistoryCursor cursor;
+  cursor.beginAtRecord(written.size() - 4);
+  CHECK(cursor.next(record) && cursor.number == written.size() - 4 && sameRecord(record, written[written.size() - 4]));
+  CHECK(cursor.next(record) && cursor.number == written.size() - 3 && sameRecord(record, written[written.size() - 3]));
+  flushHistoryBuffer();
+  historyBuffer.records[historyBuffer.count++] = randomRecord(clock);
+  written.push_back(historyBuffer.records[historyBuffer.count - 1]);
+  for (uint32_t n = written.size() - 3; n < written.size(); n++) {
+    CHECK(cursor.next(record) && cursor.number == n && sameRecord(record, written[n]));
+  }
+  CHECK(!cursor.next(record));
+  cursor.end();
+  flushHistoryBuffer();
+  checkRing(written);
+
+  // Clearing keeps numbering until the next restart
+  uint32_t next = historyNextRecord();
+  clearHistoryStore();
+  CHECK(historyNextRecord() == next);
+  CHECK(historyRecordCount() == 0);
+}
+
+// === Range parsing ===
+
+static void testByteRange() {
+  size_t first = 0, last = 0;
+  CHECK(parseByteRange("bytes=0-99", 1000, first, last) == 1 && first == 0 && last == 99);
+  CHECK(parseByteRange("bytes=900-", 1000, first, last) == 1 && first == 900 && last == 999);
+  CHECK(parseByteRange("bytes=900-5000", 1000, first, last) == 1 && first == 900 && last == 999);
+  CHECK(parseByteRange("bytes=999-999", 1000, first, last) == 1 && first == 999 && last == 999);
+  CHECK(parseByteRange("bytes=-100", 1000, first, last) == 1 && first == 900 && last == 999);
+  CHECK(parseByteRange("bytes=-2000", 1000, first, last) == 1 && first == 0 && last == 999);
+  CHECK(parseByteRange("bytes= 5 - 9 ", 1000, first, last) == 1 && first == 5 && last == 9);
+  CHECK(parseByteRange("bytes=1000-", 1000, first, last) == -1);
+  CHECK(parseByteRange("bytes=-0", 1000, first, last) == -1);
+  CHECK(parseByteRange("bytes=-5", 0, first, last) == -1);
+  CHECK(parseByteRange("bytes=0-", 0, first, last) == -1);
+  CHECK(parseByteRange("", 1000, first, last) == 0);
+  CHECK(parseByteRange("bytes=9-5", 1000, first, last) == 0);
+  CHECK(parseByteRange("bytes=0-1,5-6", 1000, first, last) == 0);
+  CHECK(parseByteRange("bytes=-", 1000, first, last) == 0);
+  CHECK(parseByteRange("bytes=5", 1000, first, last) == 0);
+  CHECK(parseByteRange("bytes=a-5", 1000, first, last) == 0);
+  CHECK(parseByteRange("items=0-5", 1000, first, last) == 0);
+}
+
+// === Token buckets ===
+
+static void testTokenBuckets() {
+  uint32_t retryAfterMs = 0;
+  TokenBucket bucket;
+  uint32_t now = 5000;
+  for (uint8_t i = 0; i < 3; i++) CHECK(takeToken(bucket, now, 1000, 3, retryAfterMs));
+  CHECK(!tokenAvailable(bucket, now, 1000, 3, retryAfterMs) && retryAfterMs == 1000);
+  CHECK(!takeToken(bucket, now + 999, 1000, 3, retryAfterMs) && retryAfterMs == 1);
+  CHECK(takeToken(bucket, now + 1000, 1000, 3, retryAfterMs));
+  CHECK(!takeToken(bucket, now + 1000, 1000, 3, retryAfterMs));
+  // A long idle bucket is full again, not more than full
+  now += 60000;
+  for (uint8_t i = 0; i < 3; i++) CHECK(takeToken(bucket, now, 1000, 3, retryAfterMs));
+  CHECK(!takeToken(bucket, now, 1000, 3, retryAfterMs));
+  // tokenAvailable() does not take one
+  TokenBucket fresh;
+  for (uint8_t i = 0; i < 5; i++) CHECK(tokenAvailable(fresh, now, 1000, 1, retryAfterMs));
+  // A fresh bucket late in the millis() cycle, and across the wrap
+  TokenBucket wrapping;
+  now = UINT32_MAX - 10000;
+  CHECK(takeToken(wrapping, now, 1000, 2, retryAfterMs));
+  CHECK(takeToken(wrapping, now, 1000, 2, retryAfterMs));
+  CHECK(!takeToken(wrapping, now + 999, 1000, 2, retryAfterMs));
+  now = UINT32_MAX - 500;
+  CHECK(takeToken(wrapping, now, 1000, 2, retryAfterMs));
+  CHECK(takeToken(wrapping, now, 1000, 2, retryAfterMs));
+  CHECK(!takeToken(wrapping, now + 999, 1000, 2, retryAfterMs));
+  CHECK(takeToken(wrapping, now + 1000, 1000, 2, retryAfterMs)); // now + 1000 has wrapped
+  // A bucket idle for more than half the millis() cycle is full
+  TokenBucket idle;
+  now = 1000;
+  CHECK(takeToken(idle, now, 1000, 2, retryAfterMs));
+  CHECK(takeToken(idle, now, 1000, 2, retryAfterMs));
+  now += 0x90000000UL;
+  CHECK(takeToken(idle, now, 1000, 2, retryAfterMs));
+  CHECK(takeToken(idle, now, 1000, 2, retryAfterMs));
+
+  // Keyed buckets: a new key takes over the entry idle the longest
+  KeyedTokenBucket table[2];
+  CHECK(takeKeyedToken(table, 2, 1, 0, 1000, 1, retryAfterMs));
+  CHECK(takeKeyedToken(table, 2, 2, 500, 1000, 1, retryAfterMs));
+  CHECK(!takeKeyedToken(table, 2, 2, 600, 1000, 1, retryAfterMs));
+  CHECK(takeKeyedToken(table, 2, 3, 600, 1000, 1, retryAfterMs)); // Evicts key 1
+  CHECK((table[0].key == 3 && table[1].key == 2) || (table[0].key == 2 && table[1].key == 3));
+  CHECK(!takeKeyedToken(table, 2, 2, 700, 1000, 1, retryAfterMs)); // Key 2 kept its bucket
+  CHECK(hashSensorId("attic") != hashSensorId("attid"));
+}
+
+// === JSON numbers ===
+
+// Compares scaleFixed() with printf("%.*f") for value, when the result fits.
+static bool scaleMatchesPrintf(float value, uint8_t decimals) {
+  static const uint32_t scales[] = { 1, 10, 100, 1000 };
+  if (value * (float)scales[decimals] >= 4.0e9f) return true;
+  uint32_t out;
+  if (!JsonStreamWriter::scaleFixed(value, scales[decimals], out)) return false;
+  char printed[48];
+  snprintf(printed, sizeof(printed), "%.*f", decimals, value);
+  uint64_t expected = 0;
+  for (const char* p = printed; *p; p++) {
+    if (*p != '.') expected = expected * 10 + (*p - '0');
+  }
+  return expected == out;
+}
+
+static void testScaleFixed() {
+  const float exact[] = { 0.0f, 0.125f, 0.375f, 2.5f, 3.5f, 0.005f, 0.015f, 1.0e-30f, 1.0e-45f, 99.995f, 4294967.0f };
+  for (float value : exact) {
+    for (uint8_t decimals = 0; decimals < 4; decimals++) CHECK(scaleMatchesPrintf(value, decimals));
+  }
+  bool matches = true;
+  for (uint32_t i = 0; i < 200000 && matches; i++) {
+    uint32_t bits = testRandom() & 0x4FFFFFFF; // Positive, up to ~2^32
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    if (value != value) continue; // NaN
+    for (uint8_t decimals = 0; decimals < 4 && matches; decimals++) {
+      matches = scaleMatchesPrintf(value, decimals);
+      if (!matches) fprintf(stderr, "scaleFixed(%.9g, %u decimals) differs from printf\n", value, decimals);
+    }
+  }
+  CHECK(matches);
+  uint32_t out;
+  CHECK(!JsonStreamWriter::scaleFixed(5.0e9f, 1, out));
+}
+
+int main(int argc, char** argv) {
+  char dir[] = "/tmp/atticfan_tests_XXXXXX";
+  if (!mkdtemp(dir)) {
+    perror("mkdtemp");
+    return 1;
+  }
+  hostOptions().fsDir = dir;
+  hostOptions().quiet = true;
+  hostInit();
+  LittleFS.begin();
+
+  testHistoryFixed();
+  testCsvLineLength();
+  testHistoryRing();
+  testByteRange();
+  testTokenBuckets();
+  testScaleFixed();
+
+  LittleFS.format();
+  std::string cmd = "rm -rf '" + std::string(dir) + "'";
+  if (system(cmd.c_str()) != 0) fprintf(stderr, "Could not remove %s\n", dir);
+  printf("%d checks, %d failed\n", checks, failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,397 @@
+// Host implementation of ESP8266WebServer. Request parsing, response framing
+// and the client state machine follow the ESP8266 Arduino core (v3.x) so that
+// handlers behave the same on the host as on the device.
+
+#include "ESP8266WebServer.h"
+
+void ESP8266WebServer::begin() {
+  close();
+  _server.begin(_port);
+  _currentStatus = HC_NONE;
+}
+
+void ESP8266WebServer::close() {
+  _server.close();
+  _currentStatus = HC_NONE;
+  _currentClient = WiFiClient();
+}
+
+void ESP8266WebServer::on(const Uri& uri, HTTPMethod method, THandlerFunction fn) {
+  RequestHandler handler;
+  handler.uri.reset(uri.clone());
+  handler.method = method;
+  handler.fn = fn;
+  _handlers.push_back(std::move(handler));
+}
+
+void ESP8266WebServer::handleClient() {
+  if (_currentStatus == HC_NONE) {
+    WiFiClient client = _server.accept();
+    if (!client) return;
+    _currentClient = client;
+    _currentStatus = HC_WAIT_READ;
+    _statusChange = millis();
+  }
+
+  bool keepCurrentClient = false;
+  bool callYield = false;
+
+  if (_currentClient.connected() || _currentClient.available()) {
+    // A kept-alive client that already sent its next request is served right away.
+    if (_currentClient.available() && _keepAlive) _currentStatus = HC_WAIT_READ;
+
+    switch (_currentStatus) {
+      case HC_NONE:
+        break;
+      case HC_WAIT_READ:
+        if (_currentClient.available()) {
+          switch (_parseRequest(_currentClient)) {
+            case CLIENT_REQUEST_CAN_CONTINUE:
+              _currentClient.setTimeout(HTTP_MAX_SEND_WAIT);
+              _contentLength = CONTENT_LENGTH_NOT_SET;
+              _handleRequest();
+              // fallthrough
+            case CLIENT_REQUEST_IS_HANDLED:
+              if (_currentClient.connected() || _currentClient.available()) {
+                _currentStatus = HC_WAIT_CLOSE;
+                _statusChange = millis();
+                keepCurrentClient = true;
+              }
+              break;
+            case CLIENT_MUST_STOP:
+              _currentClient.stop();
+              break;
+            case CLIENT_IS_GIVEN:
+              break;
+          }
+        } else {
+          // Give up on an idle client sooner when another one is waiting with data,
+          // or when the pending list is full.
+          bool othersWaiting = _server.hasClientData() || _server.hasMaxPendingClients();
+          if (millis() - _statusChange <= (othersWaiting ? HTTP_MAX_DATA_AVAILABLE_WAIT : HTTP_MAX_DATA_WAIT)) {
+            keepCurrentClient = true;
+          }
+          callYield = true;
+        }
+        break;
+      case HC_WAIT_CLOSE:
+        // Wait for the client to close the connection, or to send another request on it.
+        if (!_server.hasClient() && (millis() - _statusChange <= HTTP_MAX_CLOSE_WAIT)) {
+          keepCurrentClient = true;
+          callYield = true;
+          if (_currentClient.available()) _currentStatus = HC_WAIT_READ;
+        }
+        break;
+    }
+  }
+
+  if (!keepCurrentClient) {
+    // Drop our reference without stop(), so a handler that kept a copy keeps the connection.
+    _currentClient = WiFiClient();
+    _currentStatus = HC_NONE;
+  }
+  if (callYield) yield();
+}
+
+ESP8266WebServer::ClientFuture ESP8266WebServer::_parseRequest(WiFiClient& client) {
+  client.setTimeout(HTTP_MAX_DATA_WAIT);
+  String req = client.readStringUntil('\r');
+  client.readStringUntil('\n');
+
+  _currentArgs.clear();
+  _currentPathArgs.clear();
+  for (auto& h : _currentHeaders) h.second = String();
+  _hostHeader = String();
+
+  int addrStart = req.indexOf(' ');
+  int addrEnd = req.indexOf(' ', addrStart + 1);
+  if (addrStart == -1 || addrEnd == -1) return CLIENT_MUST_STOP;
+
+  String methodStr = req.substring(0, addrStart);
+  String url = req.substring(addrStart + 1, addrEnd);
+  String versionEnd = req.substring(addrEnd + 8);
+  _currentVersion = versionEnd == "0" ? 0 : 1;
+  String searchStr;
+  int hasSearch = url.indexOf('?');
+  if (hasSearch != -1) {
+    searchStr = url.substring(hasSearch + 1);
+    url = url.substring(0, hasSearch);
+  }
+  _currentUri = url;
+  _chunked = false;
+
+  HTTPMethod method = HTTP_GET;
+  if (methodStr == "HEAD") method = HTTP_HEAD;
+  else if (methodStr == "POST") method = HTTP_POST;
+  else if (methodStr == "DELETE") method = HTTP_DELETE;
+  else if (methodStr == "OPTIONS") method = HTTP_OPTIONS;
+  else if (methodStr == "PUT") method = HTTP_PUT;
+  else if (methodStr == "PATCH") method = HTTP_PATCH;
+  _currentMethod = method;
+
+  if (_hook) {
+    ClientFuture whatNow = _hook(methodStr, url, &client, [](const String&) { return String("application/octet-stream"); });
+    if (whatNow != CLIENT_REQUEST_CAN_CONTINUE) return whatNow;
+  }
+
+  String contentType;
+  size_t contentLength = 0;
+  while (true) {
+    req = client.readStringUntil('\r');
+    client.readStringUntil('\n');
+    if (req.length() == 0) break;
+    int headerDiv = req.indexOf(':');
+    if (headerDiv == -1) break;
+    String headerName = req.substring(0, headerDiv);
+    String headerValue = req.substring(headerDiv + 1);
+    headerValue.trim();
+    for (auto& h : _currentHeaders) {
+      if (h.first.equalsIgnoreCase(headerName)) h.second = headerValue;
+    }
+    if (headerName.equalsIgnoreCase("Content-Type")) {
+      contentType = headerValue;
+    } else if (headerName.equalsIgnoreCase("Content-Length")) {
+      contentLength = static_cast<size_t>(headerValue.toInt());
+    } else if (headerName.equalsIgnoreCase("Host")) {
+      _hostHeader = headerValue;
+    }
+  }
+
+  if (contentLength > 0) {
+    if (contentType.startsWith("multipart/")) return CLIENT_MUST_STOP; // Uploads are not emulated
+    String plainBuf;
+    client.setTimeout(HTTP_MAX_POST_WAIT);
+    std::string body(contentLength, '\0');
+    size_t n = client.readBytes(&body[0], contentLength);
+    if (n < contentLength) return CLIENT_MUST_STOP;
+    plainBuf = String(body);
+    bool isEncoded = contentType.startsWith("application/x-www-form-urlencoded");
+    if (isEncoded) {
+      if (searchStr.length()) searchStr += '&';
+      searchStr += plainBuf;
+    }
+    _parseArguments(searchStr);
+    if (!isEncoded) _currentArgs.push_back(std::make_pair(String("plain"), plainBuf));
+  } else {
+    _parseArguments(searchStr);
+  }
+
+  client.flush();
+  return CLIENT_REQUEST_CAN_CONTINUE;
+}
+
+void ESP8266WebServer::_parseArguments(const String& data) {
+  if (data.length() == 0) return;
+  int pos = 0;
+  while (pos <= static_cast<int>(data.length())) {
+    int next = data.indexOf('&', pos);
+    if (next == -1) next = data.length();
+    String pair = data.substring(pos, next);
+    if (pair.length()) {
+      int eq = pair.indexOf('=');
+      if (eq == -1) {
+        _currentArgs.push_back(std::make_pair(urlDecode(pair), String()));
+      } else {
+        _currentArgs.push_back(std::make_pair(urlDecode(pair.substring(0, eq)), urlDecode(pair.substring(eq + 1))));
+      }
+    }
+    pos = next + 1;
+  }
+}
+
+void ESP8266WebServer::_handleRequest() {
+  bool handled = false;
+  for (auto& handler : _handlers) {
+    if (handler.method != HTTP_ANY && handler.method != _currentMethod) continue;
+    if (!handler.uri->canHandle(_currentUri, _currentPathArgs)) continue;
+    handler.fn();
+    handled = true;
+    break;
+  }
+  if (!handled && _notFoundHandler) {
+    _notFoundHandler();
+    handled = true;
+  }
+  if (!handled) {
+    send(404, "text/html", String("Not found: ") + _currentUri);
+  }
+  _finalizeResponse();
+  _currentUri = String();
+}
+
+void ESP8266WebServer::_finalizeResponse() {
+  if (_chunked) sendContent(emptyString);
+}
+
+void ESP8266WebServer::sendHeader(const String& name, const String& value, bool first) {
+  String headerLine = name + ": " + value + "\r\n";
+  if (first) {
+    _responseHeaders = headerLine + _responseHeaders;
+  } else {
+    _responseHeaders += headerLine;
+  }
+}
+
+void ESP8266WebServer::_prepareHeader(String& response, int code, const char* content_type, size_t contentLength) {
+  response = String("HTTP/1.") + String(static_cast<int>(_currentVersion)) + ' ';
+  response += String(code);
+  response += ' ';
+  response += responseCodeToString(code);
+  response += "\r\n";
+
+  if (!content_type) content_type = "text/html";
+  sendHeader("Content-Type", content_type, true);
+  if (_contentLength == CONTENT_LENGTH_NOT_SET) {
+    sendHeader("Content-Length", String(static_cast<unsigned long>(contentLength)));
+  } else if (_contentLength != CONTENT_LENGTH_UNKNOWN) {
+    sendHeader("Content-Length", String(static_cast<unsigned long>(_contentLength)));
+  } else if (_currentVersion) {
+    _chunked = true;
+    sendHeader("Accept-Ranges", "none");
+    sendHeader("Transfer-Encoding", "chunked");
+  }
+  if (_corsEnabled) sendHeader("Access-Control-Allow-Origin", "*");
+
+  // Keep-alive is skipped while another client is waiting, as on the device.
+  bool keepAlive = _keepAlive && !_server.hasClient();
+  sendHeader("Connection", keepAlive ? "keep-alive" : "close");
+  if (keepAlive) sendHeader("Keep-Alive", String("timeout=") + String(HTTP_MAX_CLOSE_WAIT));
+
+  response += _responseHeaders;
+  response += "\r\n";
+  _responseHeaders = String();
+}
+
+void ESP8266WebServer::send(int code, const char* content_type, const String& content) {
+  String header;
+  _prepareHeader(header, code, content_type, content.length());
+  _currentClient.write(reinterpret_cast<const uint8_t*>(header.c_str()), header.length());
+  if (content.length()) sendContent(content);
+}
+
+void ESP8266WebServer::send_P(int code, PGM_P content_type, PGM_P content, size_t contentLength) {
+  String header;
+  _prepareHeader(header, code, content_type, contentLength);
+  _currentClient.write(reinterpret_cast<const uint8_t*>(header.c_str()), header.length());
+  if (contentLength) sendContent(content, contentLength);
+}
+
+void ESP8266WebServer::sendContent(const char* content, size_t size) {
+  if (_currentMethod == HTTP_HEAD) return;
+  if (_chunked) {
+    char chunkSize[20];
+    int len = snprintf(chunkSize, sizeof(chunkSize), "%zx\r\n", size);
+    _currentClient.write(reinterpret_cast<const uint8_t*>(chunkSize), len);
+  }
+  _currentClient.write(reinterpret_cast<const uint8_t*>(content), size);
+  if (_chunked) {
+    _currentClient.write(reinterpret_cast<const uint8_t*>("\r\n"), 2);
+    if (size == 0) _chunked = false;
+  }
+}
+
+void ESP8266WebServer::_streamFileCore(size_t fileSize, const String& fileName, const String& contentType) {
+  setContentLength(fileSize);
+  if (fileName.endsWith(".gz") && contentType != "application/x-gzip" && contentType != "application/octet-stream") {
+    sendHeader("Content-Encoding", "gzip");
+  }
+  send(200, contentType, emptyString);
+}
+
+const String& ESP8266WebServer::arg(const String& name) const {
+  for (const auto& a : _currentArgs) {
+    if (a.first == name) return a.second;
+  }
+  return emptyString;
+}
+
+const String& ESP8266WebServer::arg(int i) const {
+  return (i >= 0 && i < args()) ? _currentArgs[i].second : emptyString;
+}
+
+const String& ESP8266WebServer::argName(int i) const {
+  return (i >= 0 && i < args()) ? _currentArgs[i].first : emptyString;
+}
+
+bool ESP8266WebServer::hasArg(const String& name) const {
+  for (const auto& a : _currentArgs) {
+    if (a.first == name) return true;
+  }
+  return false;
+}
+
+const String& ESP8266WebServer::pathArg(unsigned int i) const {
+  return i < _currentPathArgs.size() ? _currentPathArgs[i] : emptyString;
+}
+
+void ESP8266WebServer::collectHeaders(const char* headerKeys[], const size_t headerKeysCount) {
+  _currentHeaders.clear();
+  _currentHeaders.push_back(std::make_pair(String("Authorization"), String()));
+  for (size_t i = 0; i < headerKeysCount; i++) {
+    _currentHeaders.push_back(std::make_pair(String(headerKeys[i]), String()));
+  }
+}
+
+const String& ESP8266WebServer::header(const String& name) const {
+  for (const auto& h : _currentHeaders) {
+    if (h.first.equalsIgnoreCase(name)) return h.second;
+  }
+  return emptyString;
+}
+
+bool ESP8266WebServer::hasHeader(const String& name) const {
+  return header(name).length() > 0;
+}
+
+String ESP8266WebServer::urlDecode(const String& text) {
+  std::string decoded;
+  const char* p = text.c_str();
+  size_t len = text.length();
+  for (size_t i = 0; i < len; i++) {
+    char c = p[i];
+    if (c == '+') {
+      decoded += ' ';
+    } else if (c == '%' && i + 2 < len && isxdigit(static_cast<unsigned char>(p[i + 1])) && isxdigit(static_cast<unsigned char>(p[i + 2]))) {
+      char hex[3] = { p[i + 1], p[i + 2], '\0' };
+      decoded += static_cast<char>(strtol(hex, nullptr, 16));
+      i += 2;
+    } else {
+      decoded += c;
+    }
+  }
+  return String(decoded);
+}
+
+const char* ESP8266WebServer::responseCodeToString(int code) {
+  switch (code) {
+    case 100: return "Continue";
+    case 101: return "Switching Protocols";
+    case 200: return "OK";
+    case 201: return "Created";
+    case 202: return "Accepted";
+    case 204: return "No Content";
+    case 206: return "Partial Content";
+    case 301: return "Moved Permanently";
+    case 302: return "Found";
+    case 303: return "See Other";
+    case 304: return "Not Modified";
+    case 307: return "Temporary Redirect";
+    case 400: return "Bad Request";
+    case 401: return "Unauthorized";
+    case 403: return "Forbidden";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 406: return "Not Acceptable";
+    case 408: return "Request Time-out";
+    case 409: return "Conflict";
+    case 411: return "Length Required";
+    case 412: return "Precondition Failed";
+    case 413: return "Request Entity Too Large";
+    case 416: return "Requested range not satisfiable";
+    case 429: return "Too Many Requests";
+    case 500: return "Internal Server Error";
+    case 501: return "Not Implemented";
+    case 503: return "Service Unavailable";
+    default:  return "";
+  }
+}
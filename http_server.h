@@ -0,0 +1,81 @@
+#pragma once
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+#include "hardware.h"
+
+/**
+ * @brief Persistent HTTP connections and back-to-back request handling.
+ *
+ * The core's web server answers one connection at a time. With keep-alive on,
+ * a served connection stays open for the browser's next request instead of
+ * costing a TCP teardown and handshake per asset. Connections that arrive
+ * meanwhile wait in the listener's pending list, which holds at most
+ * HTTP_MAX_PENDING_CLIENTS (lwIP holds back any more). Idle timeouts are the
+ * core's: a kept-alive connection is released after HTTP_MAX_CLOSE_WAIT, or
+ * after HTTP_MAX_DATA_AVAILABLE_WAIT once another connection is waiting with
+ * a request or the pending list is full.
+ *
+ * serviceHttp() calls handleClient() for as long as it keeps receiving
+ * requests, so a browser's queued or pipelined requests are answered in one
+ * loop() pass rather than one per pass. It sees a request arrive through the
+ * counting hook that beginHttpServer() installs.
+ */
+
+#define HTTP_IDLE_CALLS 2 // Calls without a request before serviceHttp() returns; switching connections takes two
+
+uint32_t httpRequests = 0;       // Requests received
+uint32_t httpReusedRequests = 0; // Requests that arrived on an already used connection
+IPAddress lastHttpIP;
+uint16_t lastHttpPort = 0;
+
+/**
+ * @brief Counts a request. beginHttpServer() installs it as the first hook, so it runs for every request line.
+ */
+inline void countHttpRequest(WiFiClient* client) {
+  IPAddress ip = client->remoteIP();
+  uint16_t port = client->remotePort();
+  httpRequests++;
+  if (port == lastHttpPort && ip == lastHttpIP) httpReusedRequests++;
+  lastHttpIP = ip;
+  lastHttpPort = port;
+}
+
+/**
+ * @brief Starts listening with keep-alive on and the pending list bounded to HTTP_MAX_PENDING_CLIENTS.
+ * Equivalent to server.begin(), which would use the core's default backlog.
+ * Call before adding other hooks: a hook that stops a request skips the hooks
+ * added after it, and serviceHttp() depends on countHttpRequest() seeing every request.
+ */
+inline void beginHttpServer(ESP8266WebServer &server) {
+  server.addHook([](const String&, const String&, WiFiClient* client, ESP8266WebServer::ContentTypeFunction) {
+    countHttpRequest(client);
+    return ESP8266WebServer::CLIENT_REQUEST_CAN_CONTINUE;
+  });
+  server.keepAlive(true);
+  server.close();
+  server.getServer().begin(HTTP_PORT, HTTP_MAX_PENDING_CLIENTS);
+  // Headers and body go out in separate writes; with Nagle on, the body of a kept-alive
+  // response would wait for the client's delayed ACK (~40 ms) instead of the connection closing.
+  server.getServer().setNoDelay(true);
+}
+
+/**
+ * @brief Runs server.handleClient() until it stops receiving requests, at most
+ * HTTP_MAX_REQUESTS_PER_PASS requests or HTTP_PASS_BUDGET_MS per call.
+ */
+inline void serviceHttp(ESP8266WebServer &server) {
+  const unsigned long start = millis();
+  uint8_t served = 0;
+  uint8_t idleCalls = 0;
+  while (idleCalls < HTTP_IDLE_CALLS && served < HTTP_MAX_REQUESTS_PER_PASS &&
+         millis() - start < HTTP_PASS_BUDGET_MS) {
+    uint32_t before = httpRequests;
+    server.handleClient();
+    if (httpRequests != before) {
+      served++;
+      idleCalls = 0;
+    } else {
+      idleCalls++;
+    }
+  }
+}
@@ -7,239 +7,194 @@
 #define WEBUI_EMIT_STREAM_HELPER 1
 #endif
 
-#undef F
-const char INDOOR_DASHBOARD_PAGE[] PROGMEM = R"EMB1(
-<!DOCTYPE html>
-<html>
-<head>
-    <title>Indoor Sensors Dashboard</title>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1">
-    <link rel="stylesheet" href="atticfan.css">
-    <link rel="icon" type="image/png" href="favicon.png">
-    <link rel="icon" href="favicon.ico">
-</head>
-<body>
-    <div class="page-container">
-        <h1>🏠 Indoor Sensors Dashboard</h1>
-        <a href="/" class="back-link">&larr; Back to Main Control</a>
-        <section class="content-section">
-            <div class="system-controls">
-                <button class="section-save-btn" onclick="loadSensorData()">🔄 Refresh</button>
-                <button class="section-save-btn" onclick="openSystemInfoModal()">🖥️ System Info</button>
-            </div>
-            
-            <div class="sensor-grid" id="stats" style="margin-top: 20px;">
-                <!-- Stats will be populated by JavaScript -->
-            </div>
-            
-            <div id="sensor-container" style="margin-top: 30px;">
-                <div class="config-grid" id="sensor-grid">
-                    <!-- Sensor cards will be populated by JavaScript -->
-                </div>
-            </div>
-        </section>
-        
-        <div id="error-container" class="error-message" style="display: none;">
-            <!-- Error messages will appear here -->
-        </div>
-    </div>
-    <script>
-        // Get controller IP from URL or use default
-        const controllerIP = window.location.hostname || '192.168.1.100';
-        const apiBase = `http://${controllerIP}`;
-        
-        // --- Mock data for local development ---
-        const MOCK_SENSORS = {
-            "sensors": [
-                { "sensorId": "living_room_01", "name": "Living Room", "temperature": "72.5", "humidity": "45.1", "ipAddress": "192.168.1.150", "secondsSinceUpdate": 25 },
-                { "sensorId": "bedroom_01", "name": "Master Bedroom", "temperature": "70.2", "humidity": "48.9", "ipAddress": "192.168.1.151", "secondsSinceUpdate": 45 },
-                { "sensorId": "office_01", "name": "Office", "temperature": "73.8", "humidity": "42.0", "ipAddress": "192.168.1.152", "secondsSinceUpdate": 310 }
-            ],
-            "count": 3,
-            "averageTemperature": "72.2",
-            "averageHumidity": "45.3"
-        };
-
-        // Check if we are running locally (e.g., from file:// or localhost)
-        const isLocal = !window.location.hostname || window.location.hostname === 'localhost' || window.location.hostname === '127.0.0.1';
-
-        if (isLocal) {
-            console.log("Running in local mode, using mock data.");
-        }
-        // ------------------------------------
-
-        async function loadSensorData() {
-            if (isLocal) {
-                // Simulate a small delay to mimic a network request for a realistic test
-                setTimeout(() => {
-                    console.log("Using mock data to render page.");
-                    updateStats(MOCK_SENSORS);
-                    updateSensorGrid(MOCK_SENSORS.sensors);
-                    hideError();
-                }, 200);
-                return; // Stop here for local mode
-            }
-
-            try {
-                const response = await fetch(`${apiBase}/indoor_sensors`);
-                
-                if (!response.ok) {
-                    throw new Error(`HTTP ${response.status}: ${response.statusText}`);
-                }
-                
-                const data = await response.json();
-                updateStats(data);
-                updateSensorGrid(data.sensors);
-                hideError();
-                
-            } catch (error) {
-                console.error('Error loading sensor data:', error);
-                showError(`Failed to load sensor data: ${error.message}`);
-            }
-        }
-        
-        function updateStats(data) {
-            const statsContainer = document.getElementById('stats');
-            
-            statsContainer.innerHTML = `
-                <div class="sensor-item">
-                    <strong>Active Sensors</strong>
-                    <div class="sensor-value">${data.count}</div>
-                </div>
-                <div class="sensor-item">
-                    <strong>Avg Temperature</strong>
-                    <div class="sensor-value">${data.averageTemperature || '--'}&deg;F</div>
-                </div>
-                <div class="sensor-item">
-                    <strong>Avg Humidity</strong>
-                    <div class="sensor-value">${data.averageHumidity || '--'}%</div>
-                </div>
-            `;
-        }
-        
-        function updateSensorGrid(sensors) {
-            const gridContainer = document.getElementById('sensor-grid');
-            
-            if (!sensors || sensors.length === 0) {
-                gridContainer.innerHTML = `
-                    <div class="error-message">
-                        <h3>No sensors found</h3>
-                        <p>No indoor sensors are currently reporting data.</p>
-                        <p>Check your sensor devices and network connectivity.</p>
-                    </div>
-                `;
-                return;
-            }
-            
-            gridContainer.innerHTML = sensors.map(sensor => {
-                const isOffline = sensor.secondsSinceUpdate > 300; // 5 minutes
-                const lastUpdateText = formatLastUpdate(sensor.secondsSinceUpdate);
-                
-                return `
-                    <div class="config-item sensor-dashboard-card ${isOffline ? 'offline' : ''}">
-                        <button class="sensor-remove-btn" onclick="removeSensor('${sensor.sensorId}')" 
-                                title="Remove this sensor">&times;</button>
-                        <label>${sensor.name}</label>
-                        <div class="sensor-dashboard-data">
-                            <span>Temperature:</span>
-                            <span class="sensor-value">${sensor.temperature}&deg;F</span>
-                        </div>
-                        <div class="sensor-dashboard-data">
-                            <span>Humidity:</span>
-                            <span class="sensor-value">${sensor.humidity}%</span>
-                        </div>
-                        <div class="sensor-dashboard-data">
-                            <span>IP Address:</span>
-                            <span style="font-weight: normal;">${sensor.ipAddress}</span>
-                        </div>
-                        <div class="last-update">
-                            ${isOffline ? '⚠️ OFFLINE - ' : ''}Last update: ${lastUpdateText}
-                        </div>
-                    </div>
-                `;
-            }).join('');
-        }
-        
-        function formatLastUpdate(seconds) {
-            if (seconds < 60) {
-                return `${seconds} seconds ago`;
-            } else if (seconds < 3600) {
-                return `${Math.floor(seconds / 60)} minutes ago`;
-            } else {
-                return `${Math.floor(seconds / 3600)} hours ago`;
-            }
-        }
-        
-        async function removeSensor(sensorId) {
-            if (!confirm(`Remove sensor ${sensorId}?`)) {
-                return;
-            }
-            
-            if (isLocal) {
-                alert(`(Mock Mode) Sensor "${sensorId}" would be removed.`);
-                // For a better local test, remove the sensor from the mock data and re-render
-                MOCK_SENSORS.sensors = MOCK_SENSORS.sensors.filter(s => s.sensorId !== sensorId);
-                MOCK_SENSORS.count = MOCK_SENSORS.sensors.length;
-                // Recalculate averages or just clear them for simplicity in mock mode
-                MOCK_SENSORS.averageTemperature = null;
-                MOCK_SENSORS.averageHumidity = null;
-                loadSensorData();
-                return;
-            }
-            
-            try {
-                const response = await fetch(`${apiBase}/indoor_sensors/${sensorId}`, {
-                    method: 'DELETE'
-                });
-                
-                if (response.ok) {
-                    alert('Sensor removed successfully');
-                    loadSensorData(); // Refresh the display
-                } else {
-                    const errorText = await response.text();
-                    alert(`Failed to remove sensor: ${errorText}`);
-                }
-            } catch (error) {
-                alert(`Error removing sensor: ${error.message}`);
-            }
-        }
-        
-        function showError(message) {
-            const errorContainer = document.getElementById('error-container');
-            errorContainer.textContent = message;
-            errorContainer.style.display = 'block';
-            document.getElementById('sensor-container').style.display = 'none';
-            document.getElementById('stats').style.display = 'none';
-        }
-        
-        function hideError() {
-            document.getElementById('error-container').style.display = 'none';
-            document.getElementById('sensor-container').style.display = 'block';
-            document.getElementById('stats').style.display = 'flex';
-        }
-        
-        // Load data when page loads
-        document.addEventListener('DOMContentLoaded', loadSensorData);
-        
-        // Auto-refresh every 30 seconds
-        setInterval(loadSensorData, 30000);
-    </script>
-</body>
-</html>)EMB1";
-const size_t INDOOR_DASHBOARD_PAGE_LEN = sizeof(INDOOR_DASHBOARD_PAGE) - 1;
+// 9545 bytes, gzipped to 2647
+const unsigned char INDOOR_DASHBOARD_PAGE[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x5a, 0xcd, 0x6e, 0xdb, 0xca,
+  0x15, 0xde, 0xfb, 0x29, 0xc6, 0x44, 0x1a, 0x4a, 0x80, 0x49, 0x49, 0x56, 0xec, 0xe4, 0x5a, 0x3f,
+  0x41, 0xe2, 0xd8, 0x37, 0x6e, 0xed, 0x38, 0xb0, 0x9d, 0x45, 0x51, 0x14, 0xf1, 0x48, 0x1c, 0x49,
+  0x13, 0x93, 0x1c, 0x96, 0x1c, 0x4a, 0x11, 0x7c, 0xb5, 0xeb, 0xfe, 0x6e, 0x8a, 0x2e, 0xba, 0xe9,
+  0xdd, 0xf4, 0x1d, 0xfa, 0x3c, 0x7d, 0x81, 0xf6, 0x11, 0x7a, 0xe6, 0x87, 0x14, 0x7f, 0x25, 0xe5,
+  0xc6, 0x28, 0xea, 0x00, 0x8e, 0x34, 0x9c, 0x39, 0xf3, 0x9d, 0x33, 0xe7, 0xe7, 0x9b, 0x43, 0xf7,
+  0xf7, 0xdf, 0x5d, 0x9f, 0xde, 0xfd, 0xfe, 0xe3, 0x19, 0x9a, 0x71, 0xcf, 0x1d, 0xee, 0xf5, 0x93,
+  0xff, 0x08, 0x76, 0x86, 0x7b, 0x08, 0x7e, 0xfa, 0x9c, 0x72, 0x97, 0x0c, 0x2f, 0x7c, 0x87, 0xb1,
+  0x10, 0xdd, 0x12, 0x3f, 0x62, 0x61, 0x84, 0xde, 0xe1, 0x68, 0x36, 0x62, 0x38, 0x74, 0xfa, 0x2d,
+  0xf5, 0x5c, 0xcd, 0xf5, 0x08, 0xc7, 0x68, 0x3c, 0xc3, 0x61, 0x44, 0xf8, 0xc0, 0xf8, 0x74, 0x77,
+  0x6e, 0xbd, 0x32, 0xb2, 0x8f, 0x7c, 0xec, 0x91, 0x81, 0x31, 0xa7, 0x64, 0x11, 0xb0, 0x90, 0x1b,
+  0x68, 0xcc, 0x7c, 0x4e, 0x7c, 0x98, 0xba, 0xa0, 0x0e, 0x9f, 0x0d, 0x1c, 0x32, 0xa7, 0x63, 0x62,
+  0xc9, 0x2f, 0x07, 0x88, 0xfa, 0x94, 0x53, 0xec, 0x5a, 0xd1, 0x18, 0xbb, 0x64, 0xd0, 0x49, 0x04,
+  0xb9, 0xd4, 0x7f, 0x40, 0x21, 0x71, 0x07, 0x46, 0xc4, 0x97, 0x2e, 0x89, 0x66, 0x84, 0x80, 0xa4,
+  0x59, 0x48, 0x26, 0x03, 0x03, 0x73, 0x4e, 0xc7, 0x13, 0xec, 0xdb, 0xe3, 0x28, 0x7a, 0x3d, 0x1f,
+  0x90, 0xe3, 0x97, 0x0e, 0x39, 0x6e, 0x1f, 0x8f, 0x5e, 0x92, 0xa3, 0xa3, 0x4e, 0xb7, 0x5d, 0x16,
+  0x41, 0x01, 0x81, 0x81, 0xf8, 0x32, 0x00, 0x58, 0xd4, 0xc3, 0x53, 0xd2, 0x0a, 0xfc, 0x69, 0x22,
+  0x6d, 0x82, 0xe7, 0xe2, 0xb9, 0x0d, 0x43, 0x20, 0xec, 0xb8, 0x33, 0x6a, 0x4f, 0xba, 0xf8, 0x45,
+  0xb7, 0x33, 0xea, 0x4e, 0x0e, 0xbb, 0xdd, 0x3a, 0x61, 0xf9, 0xb5, 0xf0, 0xab, 0x7a, 0x6d, 0xbf,
+  0xa5, 0x6c, 0xdc, 0x1f, 0x31, 0x67, 0xa9, 0x45, 0x39, 0x74, 0x8e, 0xc6, 0x2e, 0x8e, 0xa2, 0x81,
+  0x11, 0x00, 0x16, 0x4b, 0x98, 0x07, 0x53, 0x9f, 0x84, 0x7a, 0x2f, 0x39, 0x69, 0xd6, 0x19, 0xfe,
+  0xe7, 0xef, 0x3f, 0xff, 0x82, 0xea, 0x4f, 0x04, 0x66, 0xac, 0xa7, 0x63, 0x0d, 0xa8, 0x65, 0x24,
+  0xa2, 0x47, 0x78, 0xfc, 0x60, 0x09, 0xd4, 0xc6, 0xf0, 0xb9, 0x8b, 0xc3, 0xb0, 0x87, 0xde, 0xc2,
+  0x08, 0xe2, 0x0c, 0x5d, 0xc1, 0x66, 0xe8, 0x14, 0x36, 0x0d, 0x99, 0xdb, 0x6f, 0xe1, 0x8c, 0x94,
+  0x88, 0x8c, 0x39, 0x65, 0x7e, 0x22, 0x42, 0x9f, 0x9b, 0xa5, 0x87, 0x33, 0xf0, 0x8a, 0x7a, 0x44,
+  0xcb, 0x88, 0x13, 0x4f, 0x6a, 0x02, 0x42, 0xa3, 0xc2, 0x4c, 0x39, 0x7b, 0x14, 0x73, 0xbe, 0x16,
+  0xad, 0x45, 0x5a, 0x11, 0x9e, 0x13, 0x6b, 0xc4, 0xc1, 0xa0, 0xcc, 0x1f, 0xbb, 0x74, 0xfc, 0x30,
+  0x30, 0x5c, 0x86, 0x1d, 0xa5, 0xee, 0x3b, 0xcc, 0x71, 0xa3, 0x69, 0x80, 0x21, 0xfe, 0xf2, 0x67,
+  0x74, 0x43, 0x26, 0x21, 0xb8, 0x41, 0xbf, 0xa5, 0x04, 0x7d, 0xcf, 0x0e, 0x2c, 0x20, 0xfe, 0xad,
+  0x44, 0x7c, 0xe1, 0x4f, 0xd8, 0x15, 0x73, 0xb0, 0xab, 0xb6, 0xf9, 0xeb, 0x3f, 0xfe, 0xfd, 0xcf,
+  0x9f, 0x91, 0x7a, 0x84, 0xc4, 0xb3, 0xea, 0xdd, 0xfa, 0x2d, 0x50, 0x3d, 0x3f, 0x54, 0x6f, 0x19,
+  0xa9, 0x89, 0x35, 0x0d, 0xa9, 0x63, 0x20, 0xea, 0x08, 0x77, 0xc6, 0x3c, 0x32, 0x90, 0xf4, 0xea,
+  0x81, 0xe1, 0xe1, 0x70, 0x4a, 0x7d, 0x8b, 0xb3, 0xe0, 0x04, 0x1d, 0xb6, 0x83, 0xaf, 0xbd, 0x2a,
+  0xd3, 0xed, 0x5b, 0x16, 0xba, 0x15, 0xcb, 0xd0, 0x82, 0xba, 0x2e, 0x1a, 0x11, 0x14, 0xb0, 0x20,
+  0x76, 0x31, 0x27, 0x0e, 0x1a, 0x2d, 0xd1, 0x6f, 0xf1, 0x1c, 0xdf, 0x8e, 0x43, 0x1a, 0x70, 0x64,
+  0x59, 0xbf, 0x02, 0xa9, 0x44, 0xa5, 0x60, 0xae, 0x5d, 0xb1, 0x0a, 0x60, 0xb7, 0x0e, 0x60, 0x46,
+  0x5f, 0x90, 0x30, 0xa1, 0xd3, 0xac, 0xbe, 0x19, 0x03, 0x94, 0x97, 0xae, 0xf5, 0x93, 0xd3, 0xd0,
+  0x18, 0x5c, 0xfb, 0xdb, 0xd5, 0xac, 0x51, 0xb5, 0x30, 0xd4, 0x6f, 0x69, 0x9f, 0x58, 0x0f, 0xed,
+  0x95, 0x0c, 0x41, 0xc2, 0x30, 0x6f, 0x07, 0xad, 0x97, 0x1a, 0xf7, 0x48, 0x14, 0x41, 0xc8, 0xa6,
+  0xd6, 0x71, 0x68, 0x14, 0xb8, 0x78, 0x79, 0x82, 0x7c, 0xe6, 0x93, 0xa2, 0x69, 0xa4, 0x5e, 0x67,
+  0x62, 0x1d, 0xd2, 0xeb, 0xb4, 0x66, 0x38, 0x08, 0x08, 0x0e, 0xd1, 0x8c, 0x84, 0x24, 0xa7, 0x4a,
+  0x06, 0x6f, 0xf6, 0x63, 0x24, 0x95, 0x5e, 0x4f, 0x6b, 0xb5, 0xd0, 0x8f, 0x84, 0x23, 0x1d, 0x6c,
+  0x2e, 0x09, 0xd1, 0xc5, 0x47, 0x34, 0x09, 0x99, 0x87, 0x3e, 0xdd, 0x5c, 0x22, 0xd8, 0x2d, 0x8e,
+  0x08, 0x72, 0xc8, 0x04, 0xc7, 0x2e, 0x4f, 0x17, 0xc1, 0xec, 0x28, 0xbb, 0x06, 0x96, 0x0c, 0x00,
+  0x0d, 0x64, 0x97, 0x85, 0xed, 0xb2, 0x31, 0x16, 0x76, 0xb1, 0x67, 0x2c, 0xe2, 0x22, 0x79, 0xa3,
+  0x9f, 0x7e, 0x42, 0x66, 0xe7, 0x87, 0x43, 0xbb, 0x73, 0xfc, 0xca, 0xee, 0xd8, 0x9d, 0x76, 0xdb,
+  0xec, 0x15, 0x24, 0xe1, 0x80, 0xbe, 0xc5, 0xb0, 0xcf, 0x00, 0xdd, 0xcf, 0x38, 0x0f, 0x4e, 0x5a,
+  0xad, 0x67, 0x8f, 0x59, 0xe9, 0xab, 0xfb, 0x5e, 0xd9, 0xca, 0x80, 0xdc, 0x02, 0x9b, 0x5c, 0x31,
+  0x48, 0x44, 0x0e, 0x04, 0x37, 0x9a, 0x00, 0x5a, 0xb1, 0xbb, 0x0b, 0x78, 0xe7, 0xc4, 0x65, 0x81,
+  0x07, 0xf9, 0x46, 0xcc, 0x29, 0xec, 0x76, 0x75, 0x7d, 0xfa, 0xbb, 0xcf, 0xb7, 0x67, 0x1f, 0x6e,
+  0xaf, 0x6f, 0x6e, 0x61, 0xcb, 0xc7, 0x9c, 0x9d, 0xb5, 0x8b, 0x45, 0xc6, 0x09, 0xfa, 0x43, 0xc9,
+  0x2d, 0x1e, 0x93, 0xc7, 0x17, 0x0e, 0x3c, 0x37, 0x5c, 0x3a, 0xa7, 0xfe, 0xf4, 0x73, 0xc8, 0x98,
+  0xf7, 0xb9, 0xdd, 0x31, 0x0e, 0x90, 0x21, 0xf4, 0x15, 0x4f, 0x2e, 0xe5, 0x13, 0x74, 0x03, 0x4f,
+  0xc4, 0x30, 0x64, 0x80, 0x80, 0x84, 0x98, 0xc7, 0xa1, 0x7c, 0xfa, 0xf2, 0xd0, 0x3e, 0x12, 0xc3,
+  0xb3, 0xd8, 0xa3, 0x0e, 0xe5, 0x4b, 0x31, 0xf6, 0xe2, 0xc8, 0x96, 0x12, 0x68, 0xf0, 0xc6, 0x71,
+  0x20, 0x37, 0x09, 0x00, 0x46, 0xc6, 0x6a, 0x47, 0x6d, 0xf1, 0x14, 0x7c, 0x8e, 0xf9, 0x4e, 0x74,
+  0x4b, 0xfd, 0x31, 0xf9, 0x14, 0x80, 0xd6, 0x42, 0xde, 0xe1, 0x11, 0x5a, 0x1d, 0x6c, 0xc3, 0x3a,
+  0x22, 0x4e, 0x05, 0xce, 0x2b, 0x0c, 0xd9, 0x29, 0x44, 0x6f, 0xd5, 0xc3, 0x2a, 0xa8, 0x6d, 0xfb,
+  0xb0, 0x04, 0xf5, 0x95, 0xfd, 0xc3, 0x46, 0xa8, 0x9d, 0x5a, 0xa8, 0x2f, 0x76, 0x81, 0xca, 0x26,
+  0x13, 0x28, 0xe9, 0x05, 0xa4, 0xd7, 0x72, 0xb0, 0x0a, 0x61, 0xd7, 0x7e, 0x55, 0x42, 0x78, 0x68,
+  0xb7, 0x37, 0x22, 0x3c, 0xac, 0x45, 0xd8, 0xed, 0xb4, 0xd1, 0x2a, 0x87, 0xf0, 0x8f, 0x79, 0xc0,
+  0x90, 0x94, 0x62, 0x9f, 0x8b, 0x99, 0x85, 0x71, 0x28, 0x0d, 0x21, 0x84, 0xe5, 0x5d, 0xe9, 0xac,
+  0x61, 0xb3, 0xca, 0x99, 0xef, 0xf3, 0xc7, 0xdf, 0x35, 0xd2, 0x59, 0xab, 0xde, 0x5e, 0xd6, 0xcd,
+  0x4f, 0x67, 0x04, 0x7c, 0x9c, 0x4e, 0xd0, 0x82, 0x20, 0x0c, 0x61, 0x1e, 0xc6, 0xbe, 0x2f, 0xdc,
+  0x4b, 0x3a, 0xbb, 0xbb, 0x44, 0x0d, 0x62, 0x4f, 0xed, 0x03, 0x15, 0xb5, 0x13, 0xea, 0x12, 0x88,
+  0x1f, 0x94, 0xc4, 0x82, 0x88, 0xc2, 0x66, 0x21, 0x00, 0x68, 0x74, 0x29, 0xc3, 0x64, 0x80, 0xf6,
+  0x37, 0x05, 0x6d, 0xed, 0xb3, 0xc1, 0x60, 0x80, 0xcc, 0x54, 0xba, 0xb9, 0x7d, 0x6e, 0xe7, 0xf0,
+  0xa5, 0xdd, 0x86, 0x7f, 0x1d, 0x33, 0xa3, 0x18, 0xe8, 0xd3, 0xd0, 0x48, 0x9a, 0x85, 0x20, 0x14,
+  0x30, 0x99, 0x4b, 0x40, 0xdc, 0xb4, 0x61, 0xdc, 0x68, 0x6d, 0x81, 0x67, 0xa8, 0xe8, 0xf6, 0x98,
+  0x43, 0x0e, 0x20, 0x2f, 0x89, 0x41, 0x2f, 0x89, 0x7e, 0xdb, 0x68, 0xae, 0x73, 0xc4, 0xaa, 0x90,
+  0x24, 0xb6, 0xfe, 0xac, 0x51, 0xe1, 0x68, 0xe9, 0x8f, 0xd1, 0x24, 0xf6, 0x15, 0x79, 0x29, 0xf2,
+  0x87, 0x02, 0xd0, 0x0d, 0x3a, 0xe8, 0xdd, 0x6f, 0xa9, 0x27, 0xab, 0x0e, 0xc2, 0x28, 0xf2, 0xe0,
+  0xb4, 0x20, 0x37, 0x41, 0x8e, 0x17, 0xcc, 0xc9, 0xa3, 0x1e, 0x1d, 0xc3, 0xb0, 0x4f, 0xf8, 0x82,
+  0x85, 0x82, 0x0f, 0xfe, 0x29, 0x26, 0x70, 0x3a, 0x22, 0x8d, 0x61, 0xf8, 0x86, 0x5d, 0x1a, 0x01,
+  0x35, 0x45, 0x1c, 0x06, 0x4b, 0x92, 0x81, 0x2c, 0xdf, 0x51, 0x8f, 0xb0, 0x98, 0x37, 0x00, 0xd4,
+  0x60, 0x58, 0xb1, 0x79, 0xc9, 0x90, 0x9f, 0xf2, 0x16, 0x13, 0x18, 0x42, 0xe2, 0x3b, 0x10, 0xff,
+  0x82, 0x39, 0xe6, 0x0c, 0x98, 0xfd, 0x89, 0x65, 0x68, 0x48, 0xca, 0xd0, 0xc8, 0xa6, 0xce, 0xcd,
+  0xd3, 0xa5, 0xcd, 0x7e, 0x84, 0x3a, 0x9d, 0x5b, 0x63, 0xeb, 0xec, 0x5a, 0xb3, 0x76, 0x46, 0x1d,
+  0x22, 0x6b, 0x5c, 0xa3, 0x62, 0xc2, 0xea, 0x00, 0x48, 0x4d, 0xbb, 0xe2, 0x41, 0x48, 0x20, 0xd8,
+  0xfc, 0x9e, 0xb4, 0x36, 0x50, 0x0b, 0x55, 0x0a, 0xd7, 0xc5, 0x40, 0xb8, 0x4b, 0x6e, 0xcd, 0x6a,
+  0x2f, 0xf7, 0x95, 0x87, 0xcb, 0x0a, 0xeb, 0xa9, 0x48, 0x81, 0xdc, 0x11, 0xc0, 0x07, 0x51, 0x99,
+  0xf0, 0x02, 0x53, 0x38, 0x1c, 0xc2, 0xc7, 0xb3, 0xc6, 0xfd, 0xb3, 0x47, 0x5d, 0xb2, 0x56, 0x2d,
+  0x2a, 0x39, 0xf5, 0x67, 0xad, 0xd8, 0x7d, 0x05, 0xbe, 0xd2, 0x80, 0xf0, 0x9a, 0xfd, 0x44, 0xb4,
+  0xcd, 0x1e, 0x9a, 0x35, 0xa7, 0xc7, 0x67, 0x21, 0x5b, 0x80, 0x7f, 0x2c, 0x54, 0xe1, 0x6f, 0xdc,
+  0xbf, 0xbf, 0xbb, 0xfb, 0x88, 0x9e, 0x3d, 0xa6, 0x4b, 0x05, 0xfd, 0x8b, 0xa3, 0xd5, 0x49, 0x79,
+  0xec, 0x8e, 0x7c, 0xe5, 0xab, 0x2a, 0x30, 0xab, 0xed, 0xf0, 0x94, 0xea, 0xd2, 0x45, 0x12, 0xb5,
+  0x53, 0xe9, 0x5f, 0x22, 0xe6, 0x57, 0x1d, 0x4e, 0xd6, 0x49, 0xc4, 0xca, 0xfa, 0x29, 0x6b, 0xc7,
+  0x90, 0x61, 0x5b, 0xef, 0x10, 0x1b, 0x9d, 0x21, 0x7f, 0xa0, 0xc0, 0xf4, 0xe0, 0x58, 0x20, 0x0f,
+  0x8a, 0xe9, 0xcd, 0x9a, 0xd3, 0x14, 0x71, 0x20, 0x27, 0x34, 0x4c, 0xc5, 0xa3, 0x44, 0x6c, 0x8b,
+  0x88, 0x50, 0x10, 0xa4, 0xc2, 0x27, 0xe6, 0x01, 0x52, 0x42, 0xca, 0x5b, 0x46, 0x33, 0xb6, 0xd0,
+  0xe7, 0x70, 0x8e, 0x21, 0xcb, 0x3a, 0x22, 0x80, 0x84, 0x8c, 0x9c, 0x00, 0x38, 0x0a, 0x29, 0xc0,
+  0xd6, 0x2c, 0xad, 0x74, 0x08, 0xab, 0x8a, 0x2c, 0x95, 0x7e, 0x48, 0xf3, 0x4e, 0xc9, 0x9e, 0x15,
+  0x19, 0x92, 0x23, 0x49, 0xff, 0x4f, 0x13, 0x7a, 0x09, 0xa7, 0xe5, 0xb0, 0x71, 0x2c, 0x58, 0x8f,
+  0x3d, 0x25, 0xfc, 0xcc, 0x25, 0xe2, 0xe3, 0xdb, 0xe5, 0x85, 0xd3, 0x30, 0xe5, 0x4c, 0xb3, 0x00,
+  0x25, 0xf7, 0x25, 0x2f, 0xcb, 0xa6, 0x3e, 0xfc, 0x7e, 0x7f, 0x77, 0x75, 0x29, 0x48, 0xd9, 0x46,
+  0x92, 0xae, 0x39, 0x39, 0x85, 0xba, 0x5c, 0xc7, 0xc9, 0x23, 0x60, 0x72, 0xfe, 0x74, 0xf8, 0x06,
+  0x74, 0x9b, 0x93, 0xe4, 0xfa, 0x09, 0x0c, 0x5a, 0x0d, 0x57, 0xaf, 0x29, 0xef, 0x30, 0xc7, 0x6e,
+  0x4c, 0x8c, 0xe1, 0xb3, 0x47, 0xe9, 0x38, 0xb2, 0x0c, 0xaf, 0x2a, 0x88, 0x7a, 0x0d, 0x7f, 0xff,
+  0x0e, 0xd8, 0xf3, 0x29, 0xca, 0x54, 0xf5, 0xef, 0xc4, 0x5d, 0xa6, 0x09, 0x92, 0x20, 0x5b, 0x96,
+  0xb9, 0x7a, 0xee, 0x90, 0x69, 0xef, 0xfc, 0x7f, 0xa5, 0x52, 0x42, 0x3f, 0x9e, 0x46, 0x9f, 0x44,
+  0x5a, 0xaa, 0xcc, 0x6f, 0x76, 0xd7, 0xe3, 0xbe, 0xf7, 0x2d, 0x31, 0xb1, 0x4e, 0x20, 0x49, 0xee,
+  0xa8, 0x8c, 0x0d, 0x71, 0x47, 0xdc, 0x2d, 0x34, 0xd6, 0x77, 0xca, 0x8d, 0x01, 0x22, 0xb3, 0xb6,
+  0xde, 0x52, 0x68, 0xa9, 0x3f, 0xda, 0x2e, 0xf1, 0xa7, 0x7c, 0x26, 0x89, 0x4e, 0xbb, 0x2a, 0xf7,
+  0xe4, 0x80, 0x6c, 0x89, 0xab, 0xa2, 0xc5, 0xf3, 0x17, 0xc5, 0xea, 0x13, 0x52, 0x1d, 0x9e, 0xee,
+  0xf0, 0x03, 0x4b, 0x20, 0x41, 0xf1, 0x8b, 0x7d, 0xd1, 0xd4, 0xe9, 0x6e, 0x58, 0x11, 0x88, 0x05,
+  0xaa, 0x78, 0xa5, 0xeb, 0x04, 0xb9, 0x1c, 0xc7, 0x21, 0xb0, 0x02, 0x0e, 0xb4, 0x32, 0x24, 0xa2,
+  0xe3, 0x26, 0x32, 0xa4, 0x3c, 0xe8, 0x7e, 0x2b, 0xd8, 0x28, 0x4e, 0xb1, 0xd4, 0x25, 0x8b, 0xc3,
+  0x34, 0x21, 0xca, 0xde, 0x1c, 0x88, 0xf5, 0x9d, 0x94, 0xe5, 0xc0, 0xe1, 0xf8, 0xe2, 0xe2, 0x3c,
+  0x07, 0x5f, 0xa9, 0x17, 0x59, 0xe3, 0x3b, 0xf7, 0xb5, 0xc5, 0x7f, 0xaf, 0xbe, 0xc6, 0xed, 0xed,
+  0x76, 0x18, 0xc9, 0x71, 0x7a, 0x38, 0xd0, 0x8e, 0x55, 0x4d, 0xab, 0x12, 0x0a, 0x0d, 0x17, 0x12,
+  0x17, 0x84, 0xa4, 0x2b, 0xed, 0xf2, 0x75, 0x02, 0x0d, 0x51, 0xb7, 0xdd, 0x96, 0xc4, 0xe4, 0x08,
+  0xe8, 0x9e, 0x1f, 0x03, 0x95, 0xab, 0x91, 0x07, 0xc7, 0xcd, 0xd5, 0x22, 0x51, 0xb9, 0x41, 0x28,
+  0xf0, 0x17, 0x0f, 0xf3, 0xcb, 0x74, 0xb8, 0x51, 0xbb, 0xcb, 0x2e, 0x8c, 0x43, 0x59, 0x69, 0x07,
+  0x87, 0xd3, 0x1d, 0x17, 0x91, 0x42, 0xb4, 0x5e, 0x96, 0x93, 0x74, 0x09, 0x2d, 0xd1, 0x4f, 0x81,
+  0xfa, 0xb6, 0xd6, 0xfd, 0x35, 0x32, 0x99, 0xfa, 0x68, 0xa2, 0x13, 0x64, 0x9a, 0xab, 0x4d, 0x2e,
+  0x5a, 0xec, 0xa8, 0x49, 0xe1, 0x21, 0xf1, 0x58, 0xa9, 0xa5, 0xa6, 0x06, 0x55, 0xa0, 0x37, 0xcc,
+  0x67, 0x8f, 0xa9, 0xea, 0xea, 0x8e, 0xb8, 0x32, 0x9b, 0x06, 0xaa, 0xdd, 0x27, 0x25, 0x4f, 0xa2,
+  0xc7, 0x3c, 0x30, 0x6e, 0xa4, 0x2c, 0xa0, 0x52, 0x34, 0xd2, 0x0a, 0x19, 0xc3, 0xe7, 0x1c, 0xa8,
+  0x73, 0xd4, 0xab, 0xef, 0xfe, 0xa5, 0x98, 0x5d, 0x3c, 0x22, 0xee, 0x30, 0x45, 0x20, 0x6e, 0x34,
+  0x50, 0x72, 0xd4, 0x68, 0xfd, 0xaa, 0x72, 0xca, 0x5c, 0xdb, 0x50, 0x84, 0xd2, 0x06, 0x2b, 0xa9,
+  0x24, 0x1d, 0x60, 0x7f, 0x98, 0x29, 0x10, 0x27, 0x90, 0xa2, 0xc5, 0xd0, 0xf6, 0x55, 0x75, 0x99,
+  0x5a, 0xe3, 0xcf, 0x5c, 0x9d, 0xd3, 0x62, 0xb3, 0x59, 0x72, 0x4d, 0x20, 0x3e, 0xad, 0xaa, 0x49,
+  0xed, 0x78, 0x32, 0x3d, 0x93, 0x5e, 0x80, 0x28, 0x42, 0xff, 0x07, 0xfa, 0x5d, 0x7c, 0x44, 0xba,
+  0x0f, 0xf1, 0x0d, 0x1a, 0xea, 0xa6, 0xe0, 0x04, 0x92, 0x95, 0xb5, 0x20, 0x74, 0x3a, 0xe3, 0xa2,
+  0x31, 0x08, 0x49, 0xc1, 0xed, 0x65, 0x34, 0x4d, 0x3b, 0x1c, 0xab, 0x27, 0xd4, 0x54, 0x24, 0x23,
+  0x4b, 0x55, 0xdb, 0x2d, 0xfa, 0x15, 0x92, 0xc1, 0xbf, 0xfe, 0xf6, 0x8b, 0xe8, 0x79, 0x5f, 0x9f,
+  0x9f, 0x5f, 0x5e, 0x7c, 0x38, 0x43, 0x16, 0xd2, 0x69, 0x41, 0xa4, 0x31, 0x5d, 0xbe, 0x05, 0x41,
+  0xce, 0x27, 0xbb, 0xd5, 0xaf, 0x81, 0xbc, 0x5b, 0x81, 0x58, 0x35, 0xed, 0x2f, 0x8c, 0xfa, 0x0d,
+  0xd3, 0x6c, 0xee, 0x46, 0x31, 0x2a, 0xb2, 0xae, 0x4c, 0xb7, 0x55, 0xf7, 0x7e, 0xfd, 0x08, 0xf5,
+  0xd1, 0x71, 0x65, 0xdd, 0x4f, 0x72, 0xae, 0x38, 0x2b, 0x39, 0x73, 0x85, 0x92, 0x25, 0x78, 0xca,
+  0x8a, 0x48, 0x11, 0x71, 0xe1, 0x9a, 0x99, 0x97, 0xdb, 0x3d, 0x6e, 0x6f, 0x91, 0x7c, 0x85, 0xf9,
+  0xcc, 0x9e, 0xb8, 0x50, 0xc3, 0xd3, 0x65, 0x2d, 0x01, 0x67, 0x95, 0x94, 0x9b, 0xfa, 0xad, 0xbe,
+  0x59, 0xac, 0x44, 0xb3, 0x42, 0x33, 0x28, 0xf0, 0x95, 0x62, 0x37, 0x19, 0xb8, 0xd0, 0x55, 0xc9,
+  0x25, 0xf8, 0x24, 0xad, 0x57, 0xd9, 0x78, 0x5f, 0xd6, 0xa3, 0xd0, 0x6b, 0xdc, 0xeb, 0x3c, 0xae,
+  0x2b, 0x73, 0xe2, 0xff, 0x50, 0x0c, 0x5e, 0xdf, 0x37, 0xeb, 0x6d, 0xb4, 0x33, 0x2f, 0xd8, 0xd2,
+  0xc8, 0xc1, 0x2e, 0x09, 0x79, 0xe3, 0xbe, 0x21, 0x9b, 0xcd, 0x57, 0xcc, 0x21, 0xcd, 0xe4, 0x1d,
+  0x83, 0x91, 0x81, 0x62, 0xa0, 0x05, 0x8b, 0x5d, 0x47, 0xbc, 0x6c, 0x50, 0x1a, 0x3a, 0x76, 0xd5,
+  0x15, 0x1c, 0xe8, 0xc0, 0xb9, 0xec, 0xf1, 0x8c, 0x08, 0x17, 0xdd, 0x57, 0xd5, 0xa6, 0x10, 0x6d,
+  0x9e, 0x03, 0xbd, 0x0e, 0xca, 0x55, 0xaa, 0xaa, 0xec, 0xea, 0x89, 0xef, 0xeb, 0xc6, 0x8d, 0xe0,
+  0x53, 0x21, 0xb1, 0x54, 0xf3, 0xa6, 0x24, 0xbe, 0xaa, 0xdf, 0x02, 0x84, 0xa2, 0x6a, 0xd8, 0x9e,
+  0x50, 0x17, 0x10, 0x34, 0x22, 0x41, 0x75, 0xa2, 0xb4, 0xc0, 0xa2, 0xfd, 0x41, 0xc2, 0x6a, 0xe0,
+  0x58, 0x7a, 0x9b, 0x77, 0x90, 0xf7, 0xb0, 0x3a, 0xf9, 0x8a, 0x1b, 0x57, 0x9a, 0xe0, 0x86, 0x80,
+  0xd6, 0x63, 0xdd, 0x1b, 0x53, 0x77, 0x88, 0x48, 0x74, 0x2d, 0xbf, 0xc4, 0xe2, 0xd5, 0x82, 0x2b,
+  0xde, 0x69, 0x80, 0xd6, 0x9e, 0x6c, 0xe4, 0x44, 0xd4, 0x0b, 0x80, 0x1a, 0x88, 0xeb, 0x05, 0xf5,
+  0x95, 0x21, 0x4a, 0x5d, 0x9d, 0x12, 0xb0, 0x8a, 0x8b, 0xd6, 0x00, 0xf9, 0xb1, 0xeb, 0xf6, 0x76,
+  0x5a, 0x97, 0x5e, 0x68, 0xea, 0x16, 0x15, 0x5b, 0x83, 0xdf, 0xcd, 0x4d, 0x9f, 0xb4, 0x11, 0xd5,
+  0xca, 0xf8, 0xe5, 0xfd, 0x41, 0x4d, 0x83, 0xc9, 0x23, 0x7c, 0xc6, 0x1c, 0x48, 0xd1, 0xef, 0xce,
+  0x2e, 0xcf, 0xee, 0xce, 0xcc, 0x72, 0xb7, 0x68, 0xd7, 0x76, 0xd6, 0x0e, 0xdd, 0x2c, 0x15, 0x43,
+  0xa6, 0x8e, 0x1b, 0x1d, 0x20, 0x28, 0x8a, 0xc7, 0x70, 0x45, 0x88, 0x26, 0x60, 0xe2, 0xa5, 0x59,
+  0xd3, 0x16, 0x2c, 0x59, 0x5a, 0xf9, 0x8f, 0x7c, 0x85, 0x2b, 0x43, 0x43, 0xbf, 0x39, 0x2b, 0xc3,
+  0xaf, 0x4b, 0x75, 0x6b, 0xc3, 0xca, 0x1b, 0x96, 0xe6, 0xdc, 0x85, 0x5e, 0x17, 0x87, 0xd1, 0x46,
+  0x0d, 0x24, 0x9d, 0x10, 0xd6, 0x8d, 0xa0, 0x30, 0x9b, 0x9f, 0xd2, 0x2e, 0xd0, 0x8e, 0x6d, 0xb8,
+  0xed, 0x0d, 0x2c, 0xbd, 0x9f, 0x6a, 0x5c, 0xc9, 0xbd, 0xd6, 0x9d, 0xab, 0xa7, 0xea, 0x39, 0xad,
+  0x1b, 0x5c, 0x5a, 0x4e, 0xf5, 0xc5, 0x5a, 0x6e, 0xb5, 0xd3, 0xcd, 0xba, 0xf0, 0xfa, 0xb3, 0x78,
+  0xbc, 0x79, 0x41, 0xd2, 0xdc, 0xa7, 0xea, 0x8f, 0x04, 0x40, 0xa8, 0x86, 0xb0, 0x71, 0x85, 0xa4,
+  0x48, 0xb6, 0x3e, 0x7c, 0x58, 0x63, 0x8e, 0x20, 0x95, 0x3e, 0x98, 0xf9, 0x35, 0xdb, 0xee, 0xfd,
+  0x19, 0x78, 0x65, 0x81, 0xe2, 0x4d, 0xec, 0xce, 0xf2, 0x54, 0x8b, 0x6d, 0xab, 0x90, 0x4d, 0x47,
+  0x90, 0xe9, 0x79, 0x16, 0x6c, 0xbf, 0xbb, 0x91, 0xbf, 0x53, 0x8b, 0x1d, 0xac, 0xf2, 0x6d, 0x66,
+  0xae, 0x33, 0xcb, 0xc4, 0x25, 0x5f, 0x37, 0x9b, 0x05, 0xa2, 0xfc, 0x52, 0xf4, 0x57, 0x65, 0xd1,
+  0x5b, 0xcc, 0x88, 0x2f, 0x5f, 0x54, 0xc8, 0x74, 0xb0, 0xbe, 0x47, 0xa7, 0x1b, 0x63, 0xc7, 0x39,
+  0x9b, 0xc3, 0x87, 0x4b, 0x1a, 0x81, 0x0f, 0x41, 0x55, 0x33, 0xdf, 0x5d, 0x5f, 0x69, 0x87, 0x12,
+  0x62, 0x88, 0x63, 0x1e, 0x14, 0x52, 0x49, 0xb3, 0xfa, 0xb5, 0xf2, 0x9b, 0x98, 0x33, 0xa8, 0xae,
+  0x2a, 0xbf, 0x10, 0x28, 0x07, 0x4b, 0xb8, 0xc7, 0x27, 0xe4, 0x6d, 0x2f, 0xf3, 0x0a, 0xe6, 0x02,
+  0x84, 0x87, 0x70, 0xf9, 0x68, 0xe4, 0xc5, 0x1e, 0x88, 0x6b, 0x7f, 0xfa, 0xaa, 0x02, 0x88, 0xb9,
+  0x7e, 0xe7, 0x0e, 0x17, 0x4e, 0xf9, 0x87, 0x3b, 0xfd, 0x96, 0xfc, 0x93, 0xa9, 0xff, 0x02, 0x4f,
+  0x5f, 0x72, 0x51, 0x49, 0x25, 0x00, 0x00
+};
+const size_t INDOOR_DASHBOARD_PAGE_LEN = sizeof(INDOOR_DASHBOARD_PAGE);
+#define INDOOR_DASHBOARD_PAGE_ETAG "\"45f6563993346acf\""
 
 #if WEBUI_EMIT_STREAM_HELPER
-// NOTE: Assumes you have a global 'ESP8266WebServer server(80);'
-// If your instance is named differently, set WEBUI_EMIT_STREAM_HELPER=0
-// and paste a custom handler in your route file. 
-#include <ESP8266WebServer.h>                                                   
+#include <ESP8266WebServer.h>
 static void handleIndoorDashboardPage() {
-  extern ESP8266WebServer server;                                              
-  server.sendHeader("Connection", "close");                                   
-  server.send_P(200, "text/html",                                               
-                INDOOR_DASHBOARD_PAGE, INDOOR_DASHBOARD_PAGE_LEN);
+  extern ESP8266WebServer server;
+  server.sendHeader("Vary", "Accept-Encoding");
+  if (server.header("Accept-Encoding").indexOf("gzip") < 0) {
+    server.send(406, "text/plain", "Only available gzip-compressed; send Accept-Encoding: gzip.");
+    return;
+  }
+  server.sendHeader("ETag", INDOOR_DASHBOARD_PAGE_ETAG);
+  server.sendHeader("Cache-Control", server.hasArg("v") ? "public, max-age=31536000, immutable" : "no-cache");
+  if (server.header("If-None-Match") == INDOOR_DASHBOARD_PAGE_ETAG) {
+    server.send(304);
+    return;
+  }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, "text/html", reinterpret_cast<const char*>(INDOOR_DASHBOARD_PAGE), INDOOR_DASHBOARD_PAGE_LEN);
 }
 #endif
-
-#define F(string_literal) (FPSTR(PSTR(string_literal)))
@@ -0,0 +1,191 @@
+#pragma once
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+#include "hardware.h"
+#include "diagnostics.h"
+
+/**
+ * @brief Admission control for POST /indoor_sensors/data.
+ *
+ * Every post costs a JSON parse, several String allocations and possibly a log
+ * line, so a misconfigured client or a crowd of them could take over loop().
+ * Posts pass three token buckets:
+ *   - per client IP, checked from the request hook before the headers and body
+ *     are parsed; a rejected post gets a fixed 429 and the connection is closed
+ *   - a global ceiling on posts per second, checked the same way; a post takes
+ *     a token from its IP bucket and the global one only if both have one
+ *   - per sensorId, checked once the body is parsed, before the sensor table
+ *     is touched
+ * Buckets for IPs and sensor ids live in small fixed tables; when a table is
+ * full the entry that has been idle longest is reused, which only ever makes
+ * the limit more lenient for the client that took over its slot.
+ */
+
+#define INGEST_LOG_INTERVAL_MS 60000UL // At most one log line about rejected posts per minute
+
+/**
+ * @brief A token bucket stored as the time it will be full again.
+ * Each accepted post moves that time intervalMs further ahead; a post is
+ * rejected when it would move it more than burst intervals past now.
+ */
+struct TokenBucket {
+  uint32_t fullAt = 0; // millis(); at or before now means full (see tokenBucketAhead())
+};
+
+struct KeyedTokenBucket {
+  uint32_t key = 0;
+  bool used = false;
+  TokenBucket bucket;
+};
+
+TokenBucket ingestGlobalBucket;
+KeyedTokenBucket ingestIpBuckets[INGEST_TRACKED_IPS];
+KeyedTokenBucket ingestSensorBuckets[INGEST_TRACKED_SENSORS];
+
+uint32_t ingestAdmitted = 0;        // Posts that passed the IP and global limits
+uint32_t ingestLimitedIp = 0;       // Rejected by the per-IP limit
+uint32_t ingestLimitedGlobal = 0;   // Rejected by the global limit
+uint32_t ingestLimitedSensor = 0;   // Rejected by the per-sensorId limit
+uint32_t ingestLimitedLogged = 0;
+unsigned long ingestLastLogMs = 0;
+
+/**
+ * @brief Returns how far fullAt is ahead of now, i.e. how much the bucket is drained.
+ * A bucket is never more than intervalMs * burst ahead, so anything else is a
+ * fullAt in the past, including one millis() has lapped since (a bucket idle
+ * for over 24.8 days, or a fresh one after that much uptime): the bucket is full.
+ */
+inline uint32_t tokenBucketAhead(const TokenBucket& bucket, uint32_t now, uint32_t intervalMs, uint8_t burst) {
+  uint32_t ahead = bucket.fullAt - now;
+  return ahead <= intervalMs * burst ? ahead : 0;
+}
+
+/**
+ * @brief Checks whether a token is available, without taking it.
+ * @param retryAfterMs Set to the wait until the next token when the bucket is empty.
+ */
+inline bool tokenAvailable(const TokenBucket& bucket, uint32_t now, uint32_t intervalMs, uint8_t burst,
+                           uint32_t& retryAfterMs) {
+  uint32_t next = tokenBucketAhead(bucket, now, intervalMs, burst) + intervalMs;
+  uint32_t span = intervalMs * burst;
+  if (next > span) {
+    retryAfterMs = next - span;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Takes a token; call only after tokenAvailable() returned true.
+ */
+inline void spendToken(TokenBucket& bucket, uint32_t now, uint32_t intervalMs, uint8_t burst) {
+  bucket.fullAt = now + tokenBucketAhead(bucket, now, intervalMs, burst) + intervalMs;
+}
+
+/**
+ * @brief Takes a token if one is available.
+ * @param retryAfterMs Set to the wait until the next token when the bucket is empty.
+ */
+inline bool takeToken(TokenBucket& bucket, uint32_t now, uint32_t intervalMs, uint8_t burst,
+                      uint32_t& retryAfterMs) {
+  if (!tokenAvailable(bucket, now, intervalMs, burst, retryAfterMs)) return false;
+  spendToken(bucket, now, intervalMs, burst);
+  return true;
+}
+
+/**
+ * @brief Returns the bucket for key, claiming the longest idle entry for an unknown key.
+ */
+inline TokenBucket& keyedTokenBucket(KeyedTokenBucket* table, uint8_t size, uint32_t key) {
+  KeyedTokenBucket* victim = nullptr;
+  for (uint8_t i = 0; i < size; i++) {
+    KeyedTokenBucket& entry = table[i];
+    if (entry.used && entry.key == key) return entry.bucket;
+    if (!victim || (victim->used && (!entry.used || (int32_t)(entry.bucket.fullAt - victim->bucket.fullAt) < 0))) {
+      victim = &entry;
+    }
+  }
+  victim->key = key;
+  victim->used = true;
+  victim->bucket = TokenBucket();
+  return victim->bucket;
+}
+
+/**
+ * @brief Takes a token from the bucket for key, claiming the longest idle entry for an unknown key.
+ */
+inline bool takeKeyedToken(KeyedTokenBucket* table, uint8_t size, uint32_t key, uint32_t now,
+                           uint32_t intervalMs, uint8_t burst, uint32_t& retryAfterMs) {
+  return takeToken(keyedTokenBucket(table, size, key), now, intervalMs, burst, retryAfterMs);
+}
+
+// FNV-1a, so sensor ids can be tracked without keeping a String per entry.
+inline uint32_t hashSensorId(const char* id) {
+  uint32_t hash = 2166136261UL;
+  for (; *id; id++) hash = (hash ^ (uint8_t)*id) * 16777619UL;
+  return hash;
+}
+
+// Counts a rejection and logs the running total now and then.
+inline void noteIngestLimited(uint32_t& counter) {
+  counter++;
+  uint32_t limited = ingestLimitedIp + ingestLimitedGlobal + ingestLimitedSensor;
+  if (ingestLastLogMs != 0 && millis() - ingestLastLogMs < INGEST_LOG_INTERVAL_MS) return;
+  char msg[128];
+  snprintf(msg, sizeof(msg), "[WARN] Rate-limited %lu indoor sensor posts (totals: ip %lu, global %lu, sensor %lu)",
+           (unsigned long)(limited - ingestLimitedLogged), (unsigned long)ingestLimitedIp,
+           (unsigned long)ingestLimitedGlobal, (unsigned long)ingestLimitedSensor);
+  logDiagnostics(msg);
+  ingestLimitedLogged = limited;
+  ingestLastLogMs = millis();
+  if (ingestLastLogMs == 0) ingestLastLogMs = 1;
+}
+
+/**
+ * @brief Request hook: applies the per-IP and global limits to POST /indoor_sensors/data.
+ * A rejected post is answered with a fixed 429 before its headers and body are
+ * parsed, and its connection is closed.
+ */
+inline ESP8266WebServer::ClientFuture admitIndoorSensorPost(const String& method, const String& url,
+                                                            WiFiClient* client) {
+  if (method != "POST" || url != "/indoor_sensors/data") return ESP8266WebServer::CLIENT_REQUEST_CAN_CONTINUE;
+  uint32_t now = millis();
+  uint32_t retryAfterMs = 0;
+  // Both buckets are checked before either is charged, so a post rejected by
+  // the global limit does not also use up its client's own allowance
+  TokenBucket& ipBucket = keyedTokenBucket(ingestIpBuckets, INGEST_TRACKED_IPS, (uint32_t)client->remoteIP());
+  if (!tokenAvailable(ipBucket, now, INGEST_PER_IP_INTERVAL_MS, INGEST_PER_IP_BURST, retryAfterMs)) {
+    noteIngestLimited(ingestLimitedIp);
+  } else if (!tokenAvailable(ingestGlobalBucket, now, 1000 / INGEST_GLOBAL_RPS, INGEST_GLOBAL_BURST, retryAfterMs)) {
+    noteIngestLimited(ingestLimitedGlobal);
+  } else {
+    spendToken(ipBucket, now, INGEST_PER_IP_INTERVAL_MS, INGEST_PER_IP_BURST);
+    spendToken(ingestGlobalBucket, now, 1000 / INGEST_GLOBAL_RPS, INGEST_GLOBAL_BURST);
+    ingestAdmitted++;
+    return ESP8266WebServer::CLIENT_REQUEST_CAN_CONTINUE;
+  }
+  char head[112];
+  int len = snprintf(head, sizeof(head),
+                     "HTTP/1.1 429 Too Many Requests\r\nRetry-After: %lu\r\nContent-Length: 0\r\nConnection: close\r\n\r\n",
+                     (unsigned long)(retryAfterMs + 999) / 1000);
+  client->write((const uint8_t*)head, len);
+  // Read what has arrived of the request so closing does not reset the connection
+  uint8_t sink[64];
+  while (client->available() > 0) client->read(sink, sizeof(sink));
+  return ESP8266WebServer::CLIENT_MUST_STOP;
+}
+
+/**
+ * @brief Applies the per-sensorId limit to a parsed post.
+ * @param retryAfterS Set to the seconds until the sensor may post again when rejected.
+ */
+inline bool admitIndoorSensorUpdate(const char* sensorId, uint32_t& retryAfterS) {
+  uint32_t retryAfterMs = 0;
+  if (takeKeyedToken(ingestSensorBuckets, INGEST_TRACKED_SENSORS, hashSensorId(sensorId ? sensorId : ""),
+                     millis(), INGEST_PER_SENSOR_INTERVAL_MS, INGEST_PER_SENSOR_BURST, retryAfterMs)) {
+    return true;
+  }
+  retryAfterS = (retryAfterMs + 999) / 1000;
+  noteIngestLimited(ingestLimitedSensor);
+  return false;
+}
@@ -0,0 +1,246 @@
+#pragma once
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+#include <math.h>
+
+/**
+ * @brief Streaming JSON writer for HTTP responses.
+ *
+ * Output is built in a small stack buffer and sent as chunks of a response of
+ * unknown length, so a handler needs no JsonDocument and no response String.
+ * Numbers are formatted with integer arithmetic into the buffer, rounded like
+ * printf("%.*f"); strings are escaped on the way through. Nesting is tracked so commas are placed
+ * automatically:
+ *   JsonStreamWriter json(server);
+ *   json.begin();
+ *   json.beginObject();
+ *   json.addFixed("atticTemp", 97.46f, 1); // "atticTemp":97.5
+ *   json.beginArray("sensors");
+ *   ...
+ *   json.endArray();
+ *   json.endObject();
+ *   json.end();
+ */
+
+#define JSON_WRITER_BUFFER 256 // Bytes per chunk
+#define JSON_WRITER_MAX_DEPTH 8
+
+struct JsonStreamWriter {
+  ESP8266WebServer& server;
+  char buf[JSON_WRITER_BUFFER];
+  size_t len = 0;
+  uint8_t depth = 0;
+  bool needComma[JSON_WRITER_MAX_DEPTH] = {};
+
+  explicit JsonStreamWriter(ESP8266WebServer& s) : server(s) {}
+
+  /**
+   * @brief Sends the response headers. Any sendHeader() calls must come before.
+   */
+  void begin(int code = 200) {
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(code, "application/json", "");
+  }
+
+  /**
+   * @brief Sends what is still buffered. The server ends the chunked response when the handler returns.
+   */
+  void end() { flush(); }
+
+  void flush() {
+    if (len) server.sendContent(buf, len);
+    len = 0;
+  }
+
+  void put(char c) {
+    if (len == sizeof(buf)) flush();
+    buf[len++] = c;
+  }
+
+  void raw(const char* text, size_t n) {
+    while (n--) put(*text++);
+  }
+
+  void raw(const char* text) { raw(text, strlen(text)); }
+
+  void beginObject(const char* key = nullptr) { open(key, '{'); }
+  void endObject() { close('}'); }
+  void beginArray(const char* key = nullptr) { open(key, '['); }
+  void endArray() { close(']'); }
+
+  void addString(const char* key, const char* value) {
+    if (!value) {
+      addNull(key);
+      return;
+    }
+    name(key);
+    putString(value);
+  }
+
+  void addBool(const char* key, bool value) {
+    name(key);
+    raw(value ? "true" : "false");
+  }
+
+  void addNull(const char* key) {
+    name(key);
+    raw("null");
+  }
+
+  void addInt(const char* key, long value) {
+    name(key);
+    if (value < 0) {
+      put('-');
+      putUnsigned(0UL - (unsigned long)value);
+    } else {
+      putUnsigned((unsigned long)value);
+    }
+  }
+
+  void addUInt(const char* key, unsigned long value) {
+    name(key);
+    putUnsigned(value);
+  }
+
+  /**
+   * @brief Writes a number with exactly `decimals` fraction digits (at most 4); NaN is written as null.
+   */
+  void addFixed(const char* key, float value, uint8_t decimals) {
+    name(key);
+    putFixed(value, decimals, false);
+  }
+
+  /**
+   * @brief Writes a number with up to 3 fraction digits and no trailing zeros, like ArduinoJson.
+   */
+  void addFloat(const char* key, float value) {
+    name(key);
+    putFixed(value, 3, true);
+  }
+
+  // Writes the key (inside an object) and the separating comma.
+  void name(const char* key) {
+    if (depth > 0) {
+      if (needComma[depth - 1]) put(',');
+      needComma[depth - 1] = true;
+    }
+    if (key) {
+      putString(key);
+      put(':');
+    }
+  }
+
+  void open(const char* key, char bracket) {
+    name(key);
+    put(bracket);
+    if (depth < JSON_WRITER_MAX_DEPTH) needComma[depth] = false;
+    depth++;
+  }
+
+  void close(char bracket) {
+    if (depth > 0) depth--;
+    put(bracket);
+  }
+
+  void putUnsigned(unsigned long value) {
+    char digits[20];
+    uint8_t n = 0;
+    do {
+      digits[n++] = '0' + value % 10;
+      value /= 10;
+    } while (value);
+    while (n) put(digits[--n]);
+  }
+
+  void putFixed(float value, uint8_t decimals, bool trim) {
+    if (isnan(value) || isinf(value)) {
+      raw("null");
+      return;
+    }
+    if (decimals > 4) decimals = 4;
+    static const uint16_t scales[] = { 1, 10, 100, 1000, 10000 };
+    uint32_t scale = scales[decimals];
+    bool negative = value < 0;
+    uint32_t scaled;
+    if (!scaleFixed(negative ? -value : value, scale, scaled)) {
+      char text[48]; // Beyond 32 bits once scaled; not a reading or setting this device has
+      snprintf(text, sizeof(text), "%.*f", decimals, value);
+      raw(text);
+      return;
+    }
+    unsigned long whole = scaled / scale;
+    unsigned long frac = scaled - whole * scale;
+    if (negative && (whole || frac)) put('-');
+    if (trim) {
+      while (decimals > 0 && frac % 10 == 0) {
+        frac /= 10;
+        decimals--;
+      }
+    }
+    putUnsigned(whole);
+    if (decimals == 0) return;
+    put('.');
+    char digits[4];
+    for (uint8_t i = decimals; i > 0; i--) {
+      digits[i - 1] = '0' + frac % 10;
+      frac /= 10;
+    }
+    raw(digits, decimals);
+  }
+
+  /**
+   * @brief Rounds value * scale (value >= 0) to an integer from the float's bits,
+   * without floating-point math: the ESP8266 has no FPU, and double math is
+   * emulated. Exact ties round to even, as printf("%.*f") does.
+   * @return false if the result does not fit in 32 bits.
+   */
+  static bool scaleFixed(float value, uint32_t scale, uint32_t& out) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    int exponent = (bits >> 23) & 0xFF;
+    uint64_t mantissa = bits & 0x7FFFFF;
+    if (exponent) {
+      mantissa |= 0x800000;
+    } else {
+      exponent = 1; // Subnormal
+    }
+    int shift = exponent - 150; // value = mantissa * 2^shift
+    uint64_t product = mantissa * scale; // < 2^38
+    if (shift >= 0) {
+      if (shift > 8 || (product << shift) > UINT32_MAX) return false;
+      out = (uint32_t)(product << shift);
+      return true;
+    }
+    int right = -shift;
+    if (right >= 40) { // product < 2^38, so this rounds to 0
+      out = 0;
+      return true;
+    }
+    uint64_t q = product >> right;
+    uint64_t rem = product - (q << right);
+    uint64_t half = 1ULL << (right - 1);
+    if (rem > half || (rem == half && (q & 1))) q++;
+    if (q > UINT32_MAX) return false;
+    out = (uint32_t)q;
+    return true;
+  }
+
+  void putString(const char* s) {
+    put('"');
+    for (; *s; s++) {
+      char c = *s;
+      if (c == '"' || c == '\\') {
+        put('\\');
+        put(c);
+      } else if ((uint8_t)c < 0x20) {
+        static const char hex[] = "0123456789abcdef";
+        raw("\\u00", 4);
+        put(hex[(c >> 4) & 0xF]);
+        put(hex[c & 0xF]);
+      } else {
+        put(c);
+      }
+    }
+    put('"');
+  }
+};
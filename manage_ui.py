@@ -17,16 +17,22 @@ import shutil
 # --- Configuration ---
 # Add file pairs here to manage more embedded files.
 # Format: "source_path": {"dest": "dest_path", "var": "VARIABLE_NAME", "func": "functionName"}
+# Every file is embedded gzip-compressed with a content-hash ETag. Pages list the
+# assets they reference under "assets"; those references are rewritten to
+# <name>?v=<hash>, so browsers can cache the assets indefinitely.
+PAGE_ASSETS = ["data/atticfan.js", "data/atticfan.css", "data/favicon.ico", "data/favicon.png"]
 UI_FILES_TO_MANAGE = {
     "data/index.html": {
         "dest": "webui_embedded.h",
         "var": "EMBEDDED_WEBUI",
-        "func": "handleEmbeddedWebUI"
+        "func": "handleEmbeddedWebUI",
+        "assets": PAGE_ASSETS
     },
     "data/help.html": {
         "dest": "help_page.h",
         "var": "HELP_PAGE",
-        "func": "handleHelpPage"
+        "func": "handleHelpPage",
+        "assets": PAGE_ASSETS
     },
     "data/atticfan.js": {
         "dest": "atticfan_js.h",
@@ -51,13 +57,14 @@ UI_FILES_TO_MANAGE = {
     "data/indoor_sensors_dashboard.html": {
         "dest": "indoor_sensors_dashboard.h",
         "var": "INDOOR_DASHBOARD_PAGE",
-        "func": "handleIndoorDashboardPage"
+        "func": "handleIndoorDashboardPage",
+        "assets": PAGE_ASSETS
     }
 }
 POLL_INTERVAL_S = 1.0  # How often to check for file changes in watch mode.
 # ---------------------
 
-def run_embed_script(input_path: Path, output_path: Path, var_name: str, func_name: str):
+def run_embed_script(input_path: Path, output_path: Path, var_name: str, func_name: str, assets=()):
     """Calls the embed_html.py script for a single file pair."""
     embed_script_path = Path(__file__).parent / "embed_html.py"
     if not embed_script_path.exists():
@@ -66,7 +73,9 @@ def run_embed_script(input_path: Path, output_path: Path, var_name: str, func_na
 
     print(f"Regenerating {output_path.name} from {input_path.name}...")
     cmd = [sys.executable, str(embed_script_path), str(input_path), str(output_path),
-           "--var-name", var_name, "--func-name", func_name]
+           "--var-name", var_name, "--func-name", func_name, "--gzip"]
+    for asset in assets:
+        cmd += ["--version-asset", asset]
     
     res = subprocess.run(cmd, capture_output=True, text=True, check=False)
     
@@ -91,11 +100,11 @@ def update_all_files():
         dest_path = Path(config["dest"])
         var_name = config["var"]
         func_name = config["func"]
-        # Regenerate if destination doesn't exist, or if source HTML or the embed script is newer.
+        assets = config.get("assets", [])
+        # Regenerate if destination doesn't exist, or if the source, an asset it references or the embed script is newer.
         if not dest_path.exists() or \
-           src_path.stat().st_mtime > dest_path.stat().st_mtime or \
-           embed_script_path.stat().st_mtime > dest_path.stat().st_mtime:
-            if run_embed_script(src_path, dest_path, var_name, func_name):
+           any(Path(p).stat().st_mtime > dest_path.stat().st_mtime for p in [src_path, embed_script_path, *assets]):
+            if run_embed_script(src_path, dest_path, var_name, func_name, assets):
                 files_updated += 1
         else:
             print(f"{dest_path.name} is already up-to-date.")
@@ -168,8 +177,13 @@ def watch_all_files():
                 config = UI_FILES_TO_MANAGE[str(src_path)]
                 if src_path.exists() and (mtime := src_path.stat().st_mtime) != last_mtime:
                     dest_path = Path(config["dest"])
-                    if run_embed_script(src_path, dest_path, config["var"], config["func"]):
+                    if run_embed_script(src_path, dest_path, config["var"], config["func"], config.get("assets", [])):
                         last_mtimes[src_path] = mtime
+                    # Pages embed the hashes of their assets
+                    for page, page_config in UI_FILES_TO_MANAGE.items():
+                        if str(src_path) in page_config.get("assets", []):
+                            run_embed_script(Path(page), Path(page_config["dest"]), page_config["var"], page_config["func"],
+                                             page_config["assets"])
     except KeyboardInterrupt:
         print("\nWatcher stopped.")
 
@@ -195,19 +195,19 @@ void publishState() {
     char payloadBuffer[64];
 
     // Attic Temp
-    doc["value"] = readAtticTemp();
+    doc["value"] = sensorSnapshot.atticTemp;
     serializeJson(doc, payloadBuffer);
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/sensor/attic_temp/state", baseTopic);
     mqttClient.publish(topicBuffer, payloadBuffer, true);
 
     // Attic Humidity
-    doc["value"] = readAtticHumidity();
+    doc["value"] = sensorSnapshot.atticHumidity;
     serializeJson(doc, payloadBuffer);
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/sensor/attic_humidity/state", baseTopic);
     mqttClient.publish(topicBuffer, payloadBuffer, true);
 
     // Outdoor Temp
-    doc["value"] = readOutdoorTemp();
+    doc["value"] = sensorSnapshot.outdoorTemp;
     serializeJson(doc, payloadBuffer);
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/sensor/outdoor_temp/state", baseTopic);
     mqttClient.publish(topicBuffer, payloadBuffer, true);
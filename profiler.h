@@ -0,0 +1,129 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * @brief Per-stage latency profiler for loop().
+ *
+ * Each stage of loop() is timed with the CPU cycle counter and recorded in a
+ * fixed log2 histogram (bucket i holds durations in [2^i, 2^(i+1)) microseconds),
+ * so memory use is constant no matter how long the device runs. Percentiles are
+ * estimated from the buckets and reported as the bucket's upper bound.
+ *
+ * Usage: take one cycle count at the start, then mark where each stage begins
+ * and chain profileMark() after it:
+ *   uint32_t t = ESP.getCycleCount();
+ *   profileEnter(STAGE_HTTP);
+ *   serviceHttp(server);
+ *   t = profileMark(STAGE_HTTP, t);
+ */
+
+enum LoopStage : uint8_t {
+  STAGE_HTTP,       // serviceHttp(), first call
+  STAGE_MDNS,       // MDNS.update() / announce(), first call
+  STAGE_NTP,        // One-time NTP sync check
+  STAGE_OTA,        // ArduinoOTA.handle()
+  STAGE_WIFI,       // handleWiFiConnection()
+  STAGE_MQTT,       // handleMqtt()
+  STAGE_WEATHER,    // updateWeatherData()
+  STAGE_TIMER,      // handleManualTimer()
+  STAGE_LED,        // updateStatusLED()
+  STAGE_RESTART,    // handleDailyRestart()
+  STAGE_INDOOR,     // cleanupExpiredSensors()
+  STAGE_PROBES,     // serviceSensors() background conversions
+  STAGE_SENSORS,    // Sensor reads and fan logic
+  STAGE_HISTORY,    // appendHistoryLog(), serviceHistoryRollups() after boot
+  STAGE_DIAGNOSTICS, // serviceDiagnostics() batched log writes
+  STAGE_EVENTS,     // serviceEvents() state deltas to /events subscribers
+  STAGE_RESPONSES,  // serviceBackgroundResponses() download bodies
+  STAGE_DNS,        // dnsServer.processNextRequest() in AP mode
+  STAGE_MDNS_LATE,  // MDNS.update(), second call
+  STAGE_HTTP_LATE,  // serviceHttp(), second call
+  STAGE_LOOP,       // Whole loop() iteration; entered when loop() returns
+  STAGE_COUNT
+};
+
+#define PROFILER_BUCKETS 22 // Last bucket collects everything from ~2.1 s up
+
+struct StageProfile {
+  uint32_t count;
+  uint32_t minUs;
+  uint32_t maxUs;
+  uint64_t totalUs;
+  uint32_t buckets[PROFILER_BUCKETS];
+};
+
+StageProfile stageProfiles[STAGE_COUNT];
+
+inline const char* stageName(uint8_t stage) {
+  static const char* const names[STAGE_COUNT] = {
+    "http", "mdns", "ntp", "ota", "wifi", "mqtt", "weather", "timer",
+    "led", "restart", "indoor", "probes", "sensors", "history", "diagnostics", "events", "responses", "dns", "mdns_late", "http_late", "loop"
+  };
+  return stage < STAGE_COUNT ? names[stage] : "unknown";
+}
+
+// Called with each stage as it is entered; breadcrumbs.h uses it to record the loop position.
+void (*profileStageHook)(LoopStage stage) = nullptr;
+
+/**
+ * @brief Clears all stage statistics.
+ */
+inline void resetProfiler() {
+  memset(stageProfiles, 0, sizeof(stageProfiles));
+}
+
+/**
+ * @brief Records one duration for a stage.
+ * @param stage The stage being measured.
+ * @param us Duration in microseconds.
+ */
+inline void profileRecord(LoopStage stage, uint32_t us) {
+  StageProfile& p = stageProfiles[stage];
+  if (p.count == 0) p.minUs = UINT32_MAX; // Zero-initialised at boot
+  if (p.count < UINT32_MAX) p.count++;
+  p.totalUs += us;
+  if (us < p.minUs) p.minUs = us;
+  if (us > p.maxUs) p.maxUs = us;
+  uint8_t bucket = 0;
+  while (bucket < PROFILER_BUCKETS - 1 && (us >> (bucket + 1)) != 0) bucket++;
+  p.buckets[bucket]++;
+}
+
+/**
+ * @brief Records the time since startCycles against a stage and returns the current cycle count.
+ * @note The cycle counter wraps every ~53 s at 80 MHz, which bounds the longest measurable stall.
+ */
+inline uint32_t profileMark(LoopStage stage, uint32_t startCycles) {
+  uint32_t now = ESP.getCycleCount();
+  profileRecord(stage, (now - startCycles) / ESP.getCpuFreqMHz());
+  return now;
+}
+
+/**
+ * @brief Marks the start of a stage. Several stages only run now and then, so
+ * where loop() currently is can only be known from where a stage begins.
+ */
+inline void profileEnter(LoopStage stage) {
+  if (profileStageHook) profileStageHook(stage);
+}
+
+/**
+ * @brief Estimates a percentile for a stage from its histogram.
+ * @param p The stage statistics.
+ * @param percentile Percentile in the range 0-100.
+ * @return Upper bound in microseconds of the bucket holding the percentile, capped at the observed max.
+ */
+inline uint32_t profilePercentile(const StageProfile& p, uint8_t percentile) {
+  if (p.count == 0) return 0;
+  uint64_t target = ((uint64_t)p.count * percentile + 99) / 100;
+  if (target == 0) target = 1;
+  uint64_t seen = 0;
+  for (uint8_t i = 0; i < PROFILER_BUCKETS; i++) {
+    seen += p.buckets[i];
+    if (seen >= target) {
+      uint32_t upper = (i == PROFILER_BUCKETS - 1) ? p.maxUs : ((2UL << i) - 1);
+      return upper < p.maxUs ? upper : p.maxUs;
+    }
+  }
+  return p.maxUs;
+}
@@ -4,8 +4,8 @@
 #include "hardware.h"           // GPIO and flags
 #include "config.h"             // To access the runtime config
 #include "diagnostics.h"
+#include "types.h"
 #include <Wire.h>                // I2C for SHT21
-#include "DFRobot_SHT20.h"      // SHT21 sensor
 #include <OneWire.h>            // DS18B20
 #include <DallasTemperature.h>  // DS18B20
 
@@ -13,15 +13,16 @@ extern float simulatedAtticTemp;
 extern float simulatedOutdoorTemp;
 extern float simulatedAtticHumidity;
 
-// Helper for jump check and logging
-inline float validateSensorJump(const char* label, float newValue, float lastGood, float maxDelta) {
+// Helper for jump check and logging; repeats are deduplicated and rate-limited per event
+inline float validateSensorJump(DiagnosticsEventId event, const char* label, float newValue, float lastGood, float maxDelta) {
   if (fabs(newValue - lastGood) > maxDelta) {
     char buf[80];
     snprintf(buf, sizeof(buf), "[WARN] %s jump: %.1f -> %.1f", label, lastGood, newValue);
-    #if DEBUG_SERIAL
-    logSerial("%s", buf);
-    #endif
-    logDiagnostics(buf);
+    if (logDiagnosticsEvent(event, buf)) {
+      #if DEBUG_SERIAL
+      logSerial("%s", buf);
+      #endif
+    }
     return lastGood;
   }
   return newValue;
@@ -37,26 +38,96 @@ static float lastGoodAtticTempF = MOCK_ATTIC_TEMP;
 static float lastGoodAtticHumidity = 50.0;
 static float lastGoodOutdoorTempF = MOCK_OUTDOOR_TEMP;
 
+// === Sensor Snapshot ===
+// Readings are sampled once per SENSOR_UPDATE_INTERVAL_MS by loop(); everything
+// else reads this copy instead of starting its own bus transaction.
+SensorSnapshot sensorSnapshot = { MOCK_ATTIC_TEMP, 50.0, MOCK_OUTDOOR_TEMP, 0, 0 };
+
 // === DS18B20 Setup ===
 #if HAS_DS18B20
 OneWire oneWire(DS18B20_PIN);
 DallasTemperature ds18b20(&oneWire);
+
+// Outdoor probe conversion state. Conversions run in the background and
+// serviceOutdoorProbe() collects the result, so loop() never waits on the probe.
+enum OutdoorProbeState : uint8_t { PROBE_IDLE, PROBE_CONVERTING };
+
+struct OutdoorProbe {
+  OutdoorProbeState state = PROBE_IDLE;
+  bool requested = false;           // A new reading is wanted
+  unsigned long startedAt = 0;      // millis() when the conversion was started
+  unsigned long conversionMs = 750; // Datasheet conversion time for DS18B20_RESOLUTION
+};
+OutdoorProbe outdoorProbe;
 #endif
 
 // === SHT21 Setup ===
 #if HAS_SHT21
-DFRobot_SHT20 sht21(&Wire, SHT21_I2C_ADDR);
+// SHT21 commands and datasheet maximum measurement times at the default 14-bit T / 12-bit RH
+#define SHT21_TRIGGER_TEMP_NOHOLD     0xF3
+#define SHT21_TRIGGER_HUMIDITY_NOHOLD 0xF5
+#define SHT21_SOFT_RESET              0xFE
+#define SHT21_TEMP_MEASURE_MS         85
+#define SHT21_HUMIDITY_MEASURE_MS     29
+
+// Attic sensor measurement state. Measurements use no-hold-master mode: the
+// sensor NACKs reads until the result is ready, so the bus is free meanwhile.
+// Temperature and humidity are taken back to back in one cycle.
+enum AtticProbeState : uint8_t { SHT21_IDLE, SHT21_MEASURING_TEMP, SHT21_MEASURING_HUMIDITY };
+
+struct AtticProbe {
+  AtticProbeState state = SHT21_IDLE;
+  bool requested = false;      // A new reading is wanted
+  unsigned long startedAt = 0; // millis() when the current measurement was triggered
+  uint16_t rawTemp = 0;        // Temperature result held until humidity completes
+};
+AtticProbe atticProbe;
+
+/**
+ * @brief Sends a one-byte command to the SHT21.
+ * @return true if the sensor acknowledged.
+ */
+inline bool sht21Command(uint8_t command) {
+  Wire.beginTransmission(SHT21_I2C_ADDR);
+  Wire.write(command);
+  return Wire.endTransmission() == 0;
+}
+
+/**
+ * @brief Fetches a finished measurement and checks its CRC.
+ * @param raw Receives the 16-bit result with the status bits cleared.
+ * @return false if the sensor is still measuring (NACK) or the CRC failed.
+ */
+inline bool sht21Fetch(uint16_t& raw) {
+  if (Wire.requestFrom(SHT21_I2C_ADDR, 3) != 3) return false;
+  uint8_t data[3];
+  for (uint8_t i = 0; i < 3; i++) data[i] = Wire.read();
+  uint8_t crc = 0; // CRC-8, polynomial x^8 + x^5 + x^4 + 1
+  for (uint8_t i = 0; i < 2; i++) {
+    crc ^= data[i];
+    for (uint8_t bit = 0; bit < 8; bit++) crc = (crc & 0x80) ? (crc << 1) ^ 0x31 : (crc << 1);
+  }
+  if (crc != data[2]) return false;
+  raw = ((uint16_t)data[0] << 8 | data[1]) & 0xFFFC;
+  return true;
+}
 #endif
 
 // === Sensor Initialization ===
 inline void initSensors() {
 #if HAS_SHT21
   Wire.begin(SHT21_SDA_PIN, SHT21_SCL_PIN);
-  sht21.initSHT20();
+  sht21Command(SHT21_SOFT_RESET);
+  delay(15);                   // Soft reset completes within 15 ms
+  atticProbe.requested = true; // Have a first reading ready for the first sample
 #endif
 
 #if HAS_DS18B20
   ds18b20.begin();
+  ds18b20.setResolution(DS18B20_RESOLUTION);
+  ds18b20.setWaitForConversion(false); // requestTemperatures() returns immediately
+  outdoorProbe.conversionMs = ds18b20.millisToWaitForConversion(DS18B20_RESOLUTION);
+  outdoorProbe.requested = true;       // Have a first reading ready for the first sample
 #endif
 
   if (HAS_SHT21 || HAS_DS18B20) {
@@ -70,63 +141,179 @@ inline void initSensors() {
   }
 }
 
-// === Attic Temperature (SHT21 or fallback) ===
-inline float readAtticTemp() {
-  if (config.testModeEnabled) { // Checks the runtime flag
-    return simulatedAtticTemp;
-  }
+/**
+ * @brief Advances the SHT21 measurement cycle. Call on every loop() iteration.
+ * Each call does at most one short I2C transaction; both values are validated
+ * and published into sensorSnapshot together once humidity completes.
+ */
+inline void serviceAtticProbe() {
 #if HAS_SHT21
-  float tempC = sht21.readTemperature();
-  float tempF = tempC * 1.8 + 32.0;
-  // A valid reading should be within a plausible range and not NaN.
-  if (!isnan(tempF) && tempF > -50 && tempF < 200) {
-    // Guardband: skip if jump is too large
-  lastGoodAtticTempF = validateSensorJump("Attic temp", tempF, lastGoodAtticTempF, ATTIC_TEMP_DELTA_MAX);
-  } else {
-    // Reading is invalid (NaN or out of range), likely a sensor error. Do nothing and use last known good value.
-    logDiagnostics("[ERROR] Invalid attic temperature reading (NaN or out of range)");
+  unsigned long elapsed = millis() - atticProbe.startedAt;
+  switch (atticProbe.state) {
+    case SHT21_IDLE:
+      if (atticProbe.requested) {
+        atticProbe.requested = false;
+        if (sht21Command(SHT21_TRIGGER_TEMP_NOHOLD)) {
+          atticProbe.startedAt = millis();
+          atticProbe.state = SHT21_MEASURING_TEMP;
+        } else {
+          logDiagnosticsEvent(DIAG_EVENT_ATTIC_BUS_ERROR, "[ERROR] Attic sensor bus error (SHT21 did not acknowledge the measurement command)");
+        }
+      }
+      break;
+
+    case SHT21_MEASURING_TEMP:
+      if (elapsed < SHT21_TEMP_MEASURE_MS) break;
+      if (sht21Fetch(atticProbe.rawTemp) && sht21Command(SHT21_TRIGGER_HUMIDITY_NOHOLD)) {
+        atticProbe.startedAt = millis();
+        atticProbe.state = SHT21_MEASURING_HUMIDITY;
+      } else if (elapsed >= 2 * SHT21_TEMP_MEASURE_MS) {
+        atticProbe.state = SHT21_IDLE;
+        logDiagnosticsEvent(DIAG_EVENT_ATTIC_BUS_ERROR, "[ERROR] Attic sensor bus error (SHT21 temperature timed out or failed its CRC)");
+      }
+      break;
+
+    case SHT21_MEASURING_HUMIDITY: {
+      if (elapsed < SHT21_HUMIDITY_MEASURE_MS) break;
+      uint16_t rawHumidity;
+      if (!sht21Fetch(rawHumidity)) {
+        if (elapsed >= 2 * SHT21_HUMIDITY_MEASURE_MS) {
+          atticProbe.state = SHT21_IDLE;
+          logDiagnosticsEvent(DIAG_EVENT_ATTIC_BUS_ERROR, "[ERROR] Attic sensor bus error (SHT21 humidity timed out or failed its CRC)");
+        }
+        break;
+      }
+      atticProbe.state = SHT21_IDLE;
+      if (config.testModeEnabled) break; // Simulated values own the snapshot in test mode
+
+      float tempF = (-46.85f + 175.72f * atticProbe.rawTemp / 65536.0f) * 1.8f + 32.0f;
+      // A valid reading should be within a plausible range.
+      if (tempF > -50 && tempF < 200) {
+        // Guardband: skip if jump is too large
+        lastGoodAtticTempF = validateSensorJump(DIAG_EVENT_ATTIC_TEMP_JUMP, "Attic temp", tempF, lastGoodAtticTempF, ATTIC_TEMP_DELTA_MAX);
+        sensorSnapshot.atticAcquiredAt = millis();
+      } else {
+        logDiagnosticsEvent(DIAG_EVENT_ATTIC_TEMP_INVALID, "[ERROR] Invalid attic temperature reading (NaN or out of range)");
+      }
+      float humidity = -6.0f + 125.0f * rawHumidity / 65536.0f;
+      // A valid reading should be within the 0-100% range.
+      if (humidity >= 0 && humidity <= 100) {
+        lastGoodAtticHumidity = validateSensorJump(DIAG_EVENT_ATTIC_HUMIDITY_JUMP, "Attic humidity", humidity, lastGoodAtticHumidity, ATTIC_HUMIDITY_DELTA_MAX);
+      } else {
+        logDiagnosticsEvent(DIAG_EVENT_ATTIC_HUMIDITY_INVALID, "[ERROR] Invalid attic humidity reading (NaN or out of range)");
+      }
+      sensorSnapshot.atticTemp = lastGoodAtticTempF;
+      sensorSnapshot.atticHumidity = lastGoodAtticHumidity;
+      break;
+    }
   }
-  return lastGoodAtticTempF;
-#else
-  return lastGoodAtticTempF;
 #endif
 }
 
-// === Attic Humidity (SHT21 or fallback) ===
-inline float readAtticHumidity() {
-  if (config.testModeEnabled) {
-    return simulatedAtticHumidity; // In test mode, use the simulated value.
-  }
-#if HAS_SHT21
-  float humidity = sht21.readHumidity();
-  // A valid reading should be within the 0-100% range and not NaN.
-  if (!isnan(humidity) && humidity >= 0 && humidity <= 100) {
-  lastGoodAtticHumidity = validateSensorJump("Attic humidity", humidity, lastGoodAtticHumidity, ATTIC_HUMIDITY_DELTA_MAX);
-  } else {
-    // Reading is invalid (NaN or out of range), likely a sensor error. Do nothing and use last known good value.
-    logDiagnostics("[ERROR] Invalid attic humidity reading (NaN or out of range)");
+#if HAS_DS18B20
+/**
+ * @brief Reads the probe's scratchpad and returns the temperature in Fahrenheit.
+ * Uses Skip ROM (the probe is the only device on the bus) so the read takes a few
+ * milliseconds, instead of addressing the probe by ROM code via getTempFByIndex().
+ * @return The temperature, or DEVICE_DISCONNECTED_F if the probe did not answer, the CRC
+ * failed or the scratchpad read back as all zeros.
+ */
+inline float readOutdoorProbeScratchpad() {
+  uint8_t scratch[9];
+  if (!oneWire.reset()) return DEVICE_DISCONNECTED_F;
+  oneWire.skip();
+  oneWire.write(0xBE); // READ SCRATCHPAD
+  oneWire.read_bytes(scratch, sizeof(scratch));
+  if (OneWire::crc8(scratch, 8) != scratch[8]) return DEVICE_DISCONNECTED_F; // Also catches an all-0xFF bus
+  // All zeros passes the CRC (CRC8 of zeros is 0) but is never a real scratchpad: byte 5 reads 0xFF
+  uint8_t any = 0;
+  for (uint8_t i = 0; i < sizeof(scratch); i++) any |= scratch[i];
+  if (any == 0) return DEVICE_DISCONNECTED_F;
+  int16_t raw = (int16_t)((scratch[1] << 8) | scratch[0]);
+  raw &= ~((1 << (12 - DS18B20_RESOLUTION)) - 1); // Undefined low bits below the configured resolution
+  return (raw / 16.0f) * 1.8f + 32.0f;
+}
+#endif
+
+/**
+ * @brief Advances the outdoor probe state machine. Call on every loop() iteration.
+ * Each call does at most one short bus transaction: start a conversion, poll for
+ * completion once the datasheet time has passed, or read the result.
+ */
+inline void serviceOutdoorProbe() {
+#if HAS_DS18B20
+  switch (outdoorProbe.state) {
+    case PROBE_IDLE:
+      if (outdoorProbe.requested) {
+        ds18b20.requestTemperatures();
+        outdoorProbe.startedAt = millis();
+        outdoorProbe.requested = false;
+        outdoorProbe.state = PROBE_CONVERTING;
+      }
+      break;
+
+    case PROBE_CONVERTING: {
+      unsigned long elapsed = millis() - outdoorProbe.startedAt;
+      if (elapsed < outdoorProbe.conversionMs) break;
+      // Poll the probe after the nominal time; give up waiting at twice that and read anyway.
+      if (elapsed < 2 * outdoorProbe.conversionMs && !ds18b20.isConversionComplete()) break;
+      outdoorProbe.state = PROBE_IDLE;
+      if (config.testModeEnabled) break; // Simulated values own the snapshot in test mode
+
+      float tempF = readOutdoorProbeScratchpad();
+      // Check for valid reading (not the error code) and that it's within a reasonable range.
+      // On an invalid reading, do nothing and keep the last known good value.
+      if (tempF == DEVICE_DISCONNECTED_F) {
+        logDiagnosticsEvent(DIAG_EVENT_OUTDOOR_BUS_ERROR, "[ERROR] Outdoor sensor bus error (DS18B20 not present, CRC failed or disconnected)");
+      } else if (tempF > -50 && tempF < 150) {
+        lastGoodOutdoorTempF = validateSensorJump(DIAG_EVENT_OUTDOOR_TEMP_JUMP, "Outdoor temp", tempF, lastGoodOutdoorTempF, OUTDOOR_TEMP_DELTA_MAX);
+        sensorSnapshot.outdoorAcquiredAt = millis();
+      } else {
+        logDiagnosticsEvent(DIAG_EVENT_OUTDOOR_TEMP_INVALID, "[ERROR] Invalid outdoor temperature reading (NaN or out of range)");
+      }
+      sensorSnapshot.outdoorTemp = lastGoodOutdoorTempF;
+      break;
+    }
   }
 #endif
-  return lastGoodAtticHumidity;
 }
 
-// === Outdoor Temperature (DS18B20 or fallback) ===
-inline float readOutdoorTemp() {
+/**
+ * @brief Starts a new reading of every local sensor. With an SHT21 or DS18B20
+ * the value arrives later: serviceAtticProbe() and serviceOutdoorProbe() publish
+ * it into sensorSnapshot and stamp it when the conversion completes. Test mode
+ * and absent sensors have nothing to wait for, so their values are published here.
+ * @return The snapshot, holding the most recent completed readings.
+ */
+inline const SensorSnapshot& sampleSensors() {
+  unsigned long now = millis();
   if (config.testModeEnabled) {
-    return simulatedOutdoorTemp;
+    sensorSnapshot.atticTemp = simulatedAtticTemp;
+    sensorSnapshot.atticHumidity = simulatedAtticHumidity;
+    sensorSnapshot.outdoorTemp = simulatedOutdoorTemp;
+    sensorSnapshot.atticAcquiredAt = sensorSnapshot.outdoorAcquiredAt = now;
+    return sensorSnapshot;
   }
+#if HAS_SHT21
+  atticProbe.requested = true;
+#else
+  sensorSnapshot.atticTemp = lastGoodAtticTempF;
+  sensorSnapshot.atticHumidity = lastGoodAtticHumidity;
+  sensorSnapshot.atticAcquiredAt = now;
+#endif
 #if HAS_DS18B20
-  ds18b20.requestTemperatures();
-  float tempF = ds18b20.getTempFByIndex(0);
-  // Check for valid reading (not the error code) and that it's within a reasonable range.
-  if (tempF != DEVICE_DISCONNECTED_F && tempF > -50 && tempF < 150) {
-  lastGoodOutdoorTempF = validateSensorJump("Outdoor temp", tempF, lastGoodOutdoorTempF, OUTDOOR_TEMP_DELTA_MAX);
-  } else {
-    // Reading is invalid, likely a sensor error. Do nothing and use last known good value.
-    logDiagnostics("[ERROR] Invalid outdoor temperature reading (NaN, out of range, or disconnected)");
-  }
-  return lastGoodOutdoorTempF;
+  outdoorProbe.requested = true;
 #else
-  return lastGoodOutdoorTempF; // Always return the static value if sensor not present
+  sensorSnapshot.outdoorTemp = lastGoodOutdoorTempF; // The static fallback value
+  sensorSnapshot.outdoorAcquiredAt = now;
 #endif
+  return sensorSnapshot;
+}
+
+/**
+ * @brief Services the background sensor state machines. Call on every loop() iteration.
+ */
+inline void serviceSensors() {
+  serviceAtticProbe();
+  serviceOutdoorProbe();
 }
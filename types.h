@@ -23,6 +23,17 @@ struct ManualTimerState {
   PostTimerAction postAction = REVERT_TO_AUTO;
 };
 
+// One sampled set of local sensor readings, shared by the fan logic, LED, web UI and MQTT.
+struct SensorSnapshot {
+  float atticTemp;          // Attic temperature in Fahrenheit
+  float atticHumidity;      // Attic relative humidity percentage
+  float outdoorTemp;        // Outdoor temperature in Fahrenheit
+  // millis() when each bus last delivered a valid reading (0 = none yet); the two
+  // probes finish their conversions independently of each other
+  unsigned long atticAcquiredAt;
+  unsigned long outdoorAcquiredAt;
+};
+
 // Indoor sensor data structure
 struct IndoorSensorData {
   String sensorId;        // Unique identifier for the sensor
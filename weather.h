@@ -6,6 +6,7 @@
 #include <ArduinoJson.h>
 #include "hardware.h"
 #include "secrets.h"
+#include "json_writer.h"
 
 // Structure to hold current weather conditions
 struct CurrentWeather {
@@ -231,38 +232,56 @@ inline void updateWeatherData() {
   http.end();
 }
 
-inline void handleWeather(ESP8266WebServer &server) {
-  StaticJsonDocument<1024> doc; // Increased size for new data
-  doc["currentTemp"] = serialized(String(currentWeather.temperature, 1));
-  doc["currentHumidity"] = currentWeather.humidity;
-  doc["currentIcon"] = weatherCodeToEmoji(currentWeather.weatherCode);
+/**
+ * @brief Writes the /weather fields into the current JSON object.
+ */
+inline void writeWeatherJson(JsonStreamWriter &json) {
+  json.addFixed("currentTemp", currentWeather.temperature, 1);
+  json.addInt("currentHumidity", currentWeather.humidity);
+  json.addString("currentIcon", weatherCodeToEmoji(currentWeather.weatherCode));
   
   // Add sunrise and sunset from today's forecast (first entry)
   if (strlen(forecast[0].sunrise) > 0 && strlen(forecast[0].sunset) > 0) {
-    doc["sunrise"] = forecast[0].sunrise;
-    doc["sunset"] = forecast[0].sunset;
+    json.addString("sunrise", forecast[0].sunrise);
+    json.addString("sunset", forecast[0].sunset);
   }
   
-  // Add hourly forecast in Open-Meteo format
-  JsonObject hourlyObj = doc.createNestedObject("hourly");
-  JsonArray timeArr = hourlyObj.createNestedArray("time");
-  JsonArray tempArr = hourlyObj.createNestedArray("temperature_2m");
-  JsonArray codeArr = hourlyObj.createNestedArray("weathercode");
+  // Add hourly forecast in Open-Meteo format; entries without a time are skipped
+  json.beginObject("hourly");
+  json.beginArray("time");
   for (int i = 0; i < 5; i++) {
-    if (strlen(hourlyForecast[i].timeString) > 0) {
-      timeArr.add(hourlyForecast[i].timeString);
-      tempArr.add(hourlyForecast[i].temperature);
-      codeArr.add(hourlyForecast[i].weatherCode);
-    }
+    if (strlen(hourlyForecast[i].timeString) > 0) json.addString(nullptr, hourlyForecast[i].timeString);
+  }
+  json.endArray();
+  json.beginArray("temperature_2m");
+  for (int i = 0; i < 5; i++) {
+    if (strlen(hourlyForecast[i].timeString) > 0) json.addFloat(nullptr, hourlyForecast[i].temperature);
   }
+  json.endArray();
+  json.beginArray("weathercode");
+  for (int i = 0; i < 5; i++) {
+    if (strlen(hourlyForecast[i].timeString) > 0) json.addInt(nullptr, hourlyForecast[i].weatherCode);
+  }
+  json.endArray();
+  json.endObject();
   
-  JsonArray forecastData = doc.createNestedArray("forecast");
+  json.beginArray("forecast");
   for (int i = 0; i < 3; i++) {
-    JsonObject day = forecastData.createNestedObject();
-    day["icon"] = weatherCodeToEmoji(forecast[i].weatherCode);
-    day["max"] = serialized(String(forecast[i].tempMax, 0));
-    day["min"] = serialized(String(forecast[i].tempMin, 0));
-    day["dayOfWeek"] = forecast[i].dayOfWeek;
+    json.beginObject();
+    json.addString("icon", weatherCodeToEmoji(forecast[i].weatherCode));
+    json.addFixed("max", forecast[i].tempMax, 0);
+    json.addFixed("min", forecast[i].tempMin, 0);
+    json.addInt("dayOfWeek", forecast[i].dayOfWeek);
+    json.endObject();
   }
-  server.send(200, "application/json", doc.as<String>());
+  json.endArray();
+}
+
+inline void handleWeather(ESP8266WebServer &server) {
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  writeWeatherJson(json);
+  json.endObject();
+  json.end();
 }
\ No newline at end of file
@@ -19,6 +19,13 @@
 #include "weather.h"
 #include "types.h"
 #include "indoor_sensors.h"
+#include "diagnostics.h"
+#include "profiler.h"
+#include "events.h"
+#include "json_writer.h"
+#include "http_server.h"
+#include "background_response.h"
+#include "ingest_limits.h"
 
 extern void logDiagnostics(const char* msg);
 extern ESP8266WebServer server;
@@ -26,12 +33,9 @@ extern ESP8266WebServer server;
 // To access the global timer state from the main .ino file
 extern ManualTimerState manualTimer;
 
-// Path for the diagnostics log file, consistent with documentation
-#define DIAGNOSTICS_LOG_PATH "/diagnostics.log"
-
 // Forward declarations
 inline void handleSystemInfo(ESP8266WebServer &server) {
-  StaticJsonDocument<512> doc;
+  StaticJsonDocument<768> doc;
   doc["board"] = "ESP8266";
   doc["firmware"] = FIRMWARE_VERSION;
   FSInfo fsinfo;
@@ -47,29 +51,252 @@ inline void handleSystemInfo(ESP8266WebServer &server) {
   doc["memory_free"] = ESP.getFreeHeap();
   doc["uptime_ms"] = millis();
   doc["ip"] = WiFi.localIP().toString();
+  doc["event_subscribers"] = eventSubscriberCount();
+  doc["events_sent"] = eventsSent;
+  doc["events_missed"] = eventsMissed;
+  doc["http_requests"] = httpRequests;
+  doc["http_reused_requests"] = httpReusedRequests;
+  doc["downloads_active"] = backgroundResponseCount();
+  doc["downloads_completed"] = backgroundResponsesCompleted;
+  doc["downloads_aborted"] = backgroundResponsesAborted;
+  doc["indoor_posts_admitted"] = ingestAdmitted;
+  doc["indoor_posts_limited_ip"] = ingestLimitedIp;
+  doc["indoor_posts_limited_global"] = ingestLimitedGlobal;
+  doc["indoor_posts_limited_sensor"] = ingestLimitedSensor;
   String response;
   serializeJson(doc, response);
   server.send(200, "application/json", response);
 }
+
+/**
+ * @brief Serves the per-stage loop latency histograms as JSON.
+ * Pass ?reset=1 to clear the statistics after reading them.
+ */
+inline void handleMetrics(ESP8266WebServer &server) {
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  json.addUInt("uptime_ms", millis());
+  json.addUInt("cpu_mhz", ESP.getCpuFreqMHz());
+  json.beginArray("stages");
+  for (uint8_t i = 0; i < STAGE_COUNT; i++) {
+    const StageProfile& p = stageProfiles[i];
+    json.beginObject();
+    json.addString("name", stageName(i));
+    json.addUInt("count", p.count);
+    json.addUInt("min_us", p.count ? p.minUs : 0);
+    json.addUInt("p50_us", profilePercentile(p, 50));
+    json.addUInt("p99_us", profilePercentile(p, 99));
+    json.addUInt("max_us", p.maxUs);
+    json.addUInt("total_ms", (uint32_t)(p.totalUs / 1000));
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
+  json.end();
+  if (server.arg("reset") == "1") {
+    resetProfiler();
+  }
+}
+
 void reinitMqtt();
 
-// Endpoint to download the CSV history log
+/**
+ * @brief Sets the ETag header and answers 304 if the client's copy matches it.
+ * @return true if the 304 was sent and the handler is done.
+ */
+inline bool sendHistoryETag(ESP8266WebServer &server, const String& etag) {
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Cache-Control", "no-cache"); // Always revalidate
+  if (server.header("If-None-Match") != etag) return false;
+  server.send(304, "text/csv", "");
+  return true;
+}
+
+/**
+ * @brief Produces /history.csv from the binary ring: the header line, then one line per record.
+ */
+struct HistoryCsvSource : ResponseSource {
+  HistoryCursor cursor;
+  bool headerSent = false;
+
+  HistoryCsvSource() { cursor.begin(); }
+  ~HistoryCsvSource() { cursor.end(); }
+
+  size_t read(char* buf, size_t size) override {
+    size_t len = 0;
+    if (!headerSent) {
+      len = snprintf(buf, size, "%s", HISTORY_CSV_HEADER);
+      headerSent = true;
+    }
+    HistoryRecord record;
+    while (len + 64 <= size && cursor.next(record)) { // Room for one more line
+      len += formatHistoryCsvLine(record, buf + len, size - len);
+    }
+    return len;
+  }
+
+  // Skips the header and whole segments.
+  size_t skip(size_t offset) override {
+    size_t skipped = strlen(HISTORY_CSV_HEADER);
+    if (offset < skipped) return 0;
+    headerSent = true;
+    uint32_t seq = historyOldestSeq();
+    for (; !historyRingIsEmpty() && seq <= historyStore.headSeq; seq++) {
+      uint32_t bytes = historySegmentCsvBytes[seq % HISTORY_SEGMENTS];
+      if (skipped + bytes > offset) break;
+      skipped += bytes;
+    }
+    cursor.skipToSegment(seq);
+    return skipped;
+  }
+};
+
+// Endpoint to download the history log, rendered as CSV from the binary ring.
+// The body is written from loop() (see background_response.h); Range requests
+// are served from the per-segment CSV sizes.
 inline void handleHistoryDownload(ESP8266WebServer &server) {
-  if (LittleFS.exists(HISTORY_LOG_PATH)) {
-    File f = LittleFS.open(HISTORY_LOG_PATH, "r");
-    server.streamFile(f, "text/csv");
-    f.close();
-  } else {
+  if (historyIsEmpty()) {
     server.send(404, "text/plain", "No history log found.");
+    return;
+  }
+  // Every append takes a new record number, including samples without a synced clock
+  char etag[64];
+  snprintf(etag, sizeof(etag), "\"h%lu-%lu.%u\"", (unsigned long)historyNextRecord(),
+           (unsigned long)historyStore.headSeq, (unsigned)historyStore.headBytes);
+  if (server.header("If-None-Match") == etag) {
+    sendHistoryETag(server, etag); // 304
+    return;
   }
+  startRangedBackgroundResponse(server, "text/csv", new HistoryCsvSource(), historyCsvBytes(), etag,
+                                "ETag: " + String(etag) + "\r\nCache-Control: no-cache\r\n");
+}
+
+/**
+ * @brief Produces a /history query: the header line, then the records HistoryQuery keeps.
+ * Each read() decodes at most HISTORY_QUERY_STEP_RECORDS records, so a wide
+ * bucket spans several reads that produce nothing.
+ */
+struct HistoryQuerySource : ResponseSource {
+  HistoryQuery query;
+  bool headerSent = false;
+
+  HistoryQuerySource(uint32_t from, uint32_t to, uint16_t maxPoints) { query.begin(from, to, maxPoints); }
+  HistoryQuerySource(uint32_t since, uint16_t maxPoints) { query.beginSince(since, maxPoints); }
+  ~HistoryQuerySource() { query.end(); }
+
+  size_t read(char* buf, size_t size) override {
+    size_t len = 0;
+    if (!headerSent) {
+      len = snprintf(buf, size, "%s", HISTORY_CSV_HEADER);
+      headerSent = true;
+    }
+    uint16_t steps = HISTORY_QUERY_STEP_RECORDS;
+    HistoryRecord record;
+    while (len + 64 <= size && query.next(record, steps)) { // Room for one more line
+      len += formatHistoryCsvLine(record, buf + len, size - len);
+    }
+    return len;
+  }
+
+  bool finished() override { return query.done(); }
+};
+
+/**
+ * @brief Serves a time range of history as CSV, decimated on the device.
+ * Query: from and to (Unix seconds, default: oldest record / now) and maxPoints
+ * (default HISTORY_QUERY_DEFAULT_POINTS). Same columns as /history.csv.
+ * Every response carries X-History-Cursor, the number the next record will get
+ * (see historyNextRecord()). since=<cursor> returns the records appended since,
+ * whatever their timestamps (from and to are ignored), with an ETag that only
+ * changes when a record is appended, so an up-to-date client gets a 304. A
+ * cursor ahead of the history (it was cleared, or the device restarted with
+ * an empty ring) gets a 409.
+ * The body is written from loop() (see background_response.h).
+ */
+inline void handleHistoryQuery(ESP8266WebServer &server) {
+  uint32_t from = server.hasArg("from") ? strtoul(server.arg("from").c_str(), nullptr, 10) : 0;
+  uint32_t to = server.hasArg("to") ? strtoul(server.arg("to").c_str(), nullptr, 10) : (uint32_t)time(nullptr);
+  long maxPoints = server.hasArg("maxPoints") ? server.arg("maxPoints").toInt() : HISTORY_QUERY_DEFAULT_POINTS;
+  if (maxPoints < 2 || maxPoints > HISTORY_QUERY_MAX_POINTS || to < from) {
+    server.send(400, "text/plain", "Invalid range or maxPoints (2-" + String(HISTORY_QUERY_MAX_POINTS) + ").");
+    return;
+  }
+  uint32_t cursor = historyNextRecord();
+  bool hasSince = server.hasArg("since");
+  uint32_t since = hasSince ? strtoul(server.arg("since").c_str(), nullptr, 10) : 0;
+  String etag;
+  if (hasSince) {
+    if (since > cursor) {
+      server.sendHeader("X-History-Cursor", String(cursor));
+      server.send(409, "text/plain", "Cursor is ahead of the history; reload it.");
+      return;
+    }
+    etag = "\"h" + String(cursor) + "\"";
+  } else {
+    etag = "\"h" + String(cursor) + "-" + String(from) + "-" + String(server.hasArg("to") ? to : 0) + "-" + String(maxPoints) + "\"";
+  }
+  if (server.header("If-None-Match") == etag) {
+    server.sendHeader("X-History-Cursor", String(cursor));
+    sendHistoryETag(server, etag); // 304
+    return;
+  }
+  HistoryQuerySource* source;
+  if (hasSince) {
+    source = new HistoryQuerySource(since, (uint16_t)maxPoints);
+  } else {
+    uint32_t oldest = historyOldestTimestamp();
+    if (from < oldest) from = oldest; // Spread the buckets over data that exists
+    if (to < from) to = from;
+    source = new HistoryQuerySource(from, to, (uint16_t)maxPoints);
+  }
+  startBackgroundResponse(server, 200, "text/csv", source,
+                          "X-History-Cursor: " + String(cursor) + "\r\nETag: " + etag + "\r\nCache-Control: no-cache\r\n");
+}
+
+/**
+ * @brief Produces a rollup tier as CSV: the header line, then one line per row.
+ */
+struct RollupCsvSource : ResponseSource {
+  HistoryRollupReader reader;
+  bool headerSent = false;
+
+  RollupCsvSource(uint8_t tier) { reader.open(tier); }
+  ~RollupCsvSource() { reader.close(); }
+
+  size_t read(char* buf, size_t size) override {
+    size_t len = 0;
+    if (!headerSent) {
+      len = snprintf(buf, size, "%s", ROLLUP_CSV_HEADER);
+      headerSent = true;
+    }
+    HistoryRollup row;
+    while (len + 128 <= size && reader.next(row)) { // Room for one more line
+      len += formatRollupCsvLine(row, buf + len, size - len);
+    }
+    return len;
+  }
+};
+
+/**
+ * @brief Serves hourly or daily history summaries as CSV.
+ * Query: tier=hourly (default) or tier=daily. The last row is the period still in progress.
+ * The body is written from loop() (see background_response.h).
+ */
+inline void handleHistoryRollup(ESP8266WebServer &server) {
+  uint8_t tier = server.arg("tier") == "daily" ? ROLLUP_DAILY : ROLLUP_HOURLY;
+  startBackgroundResponse(server, 200, "text/csv", new RollupCsvSource(tier));
 }
 
 /**
  * @brief Handles requests to clear the diagnostics log file.
  */
 inline void handleClearDiagnostics(ESP8266WebServer &server) {
-  if (LittleFS.exists(DIAGNOSTICS_LOG_PATH)) {
-    if (LittleFS.remove(DIAGNOSTICS_LOG_PATH)) {
+  diagnosticsBuffer.count = 0; // Drop unwritten lines along with the file
+  diagnosticsBuffer.dropped = 0;
+  if (diagnosticsLogBytes() > 0) {
+    clearDiagnosticsLog();
+    if (diagnosticsLogBytes() == 0) {
       logDiagnostics("[INFO] Diagnostics log cleared by user.");
       server.send(200, "text/plain", "Diagnostics log cleared successfully.");
     } else {
@@ -84,18 +311,13 @@ inline void handleClearDiagnostics(ESP8266WebServer &server) {
  * @brief Handles requests to clear the history log file.
  */
 inline void handleClearHistory(ESP8266WebServer &server) {
-  if (LittleFS.exists(HISTORY_LOG_PATH)) {
-    if (LittleFS.remove(HISTORY_LOG_PATH)) {
-      logDiagnostics("[INFO] History log cleared by user.");
-      server.send(200, "text/plain", "History log cleared successfully.");
-    } else {
-      server.send(500, "text/plain", "Failed to clear history log.");
-    }
+  if (!historyIsEmpty()) {
+    clearHistoryStore();
+    logDiagnostics("[INFO] History log cleared by user.");
+    server.send(200, "text/plain", "History log cleared successfully.");
   } else {
     server.send(200, "text/plain", "History log was already empty.");
   }
-  // After clearing, we should re-create the header on the next log to avoid issues.
-  // The appendHistoryLog function already handles this if the file is size 0.
 }
 
 inline void handleHelp(ESP8266WebServer &server) {
@@ -108,7 +330,7 @@ inline void handleHelp(ESP8266WebServer &server) {
     server.send(404, "text/plain", "help.html not found on filesystem.");
   }
 #else
-  server.send_P(200, "text/html", HELP_PAGE, sizeof(HELP_PAGE) - 1);
+  handleHelpPage();
 #endif
 }
 
@@ -183,81 +405,92 @@ inline void handleFan(ESP8266WebServer &server, FanMode &fanMode) {
   }
 }
 
-inline void handleStatus(ESP8266WebServer &server, FanMode fanMode) {
-  float atticTemp = readAtticTemp();
-  float atticHumidity = readAtticHumidity();
-  float outdoorTemp = readOutdoorTemp();
+/**
+ * @brief Writes the /status fields into the current JSON object.
+ */
+inline void writeStatusJson(JsonStreamWriter &json, FanMode fanMode) {
+  const SensorSnapshot& sensors = sensorSnapshot;
   bool fanOn = digitalRead(FAN_RELAY_PIN) == HIGH;
 
-  StaticJsonDocument<512> doc;
-  doc["firmwareVersion"] = FIRMWARE_VERSION;
-  doc["atticTemp"] = serialized(String(atticTemp, 1));
-  doc["atticHumidity"] = serialized(String(atticHumidity, 1));
-  doc["outdoorTemp"] = serialized(String(outdoorTemp, 1));
-  doc["fanOn"] = fanOn;
+  json.addString("firmwareVersion", FIRMWARE_VERSION);
+  json.addFixed("atticTemp", sensors.atticTemp, 1);
+  json.addFixed("atticHumidity", sensors.atticHumidity, 1);
+  json.addFixed("outdoorTemp", sensors.outdoorTemp, 1);
+  // The older of the two readings; the attic and outdoor buses complete independently
+  unsigned long atticAge = millis() - sensors.atticAcquiredAt;
+  unsigned long outdoorAge = millis() - sensors.outdoorAcquiredAt;
+  json.addUInt("sensorAgeMs", atticAge > outdoorAge ? atticAge : outdoorAge);
+  json.addBool("fanOn", fanOn);
 
   // Convert FanMode enum to strings for JSON
   switch (fanMode) {
     case MANUAL_ON:
-      doc["fanMode"] = "MANUAL";
-      doc["fanSubMode"] = "ON"; // e.g. Manually turned on
+      json.addString("fanMode", "MANUAL");
+      json.addString("fanSubMode", "ON"); // e.g. Manually turned on
       break;
     case MANUAL_OFF:
-      doc["fanMode"] = "MANUAL";
-      doc["fanSubMode"] = "OFF"; // e.g. Manually turned off
+      json.addString("fanMode", "MANUAL");
+      json.addString("fanSubMode", "OFF"); // e.g. Manually turned off
       break;
     case MANUAL_TIMED:
-      doc["fanMode"] = "MANUAL";
-      doc["fanSubMode"] = "TIMED"; // Timer is active
+      json.addString("fanMode", "MANUAL");
+      json.addString("fanSubMode", "TIMED"); // Timer is active
       break;
     default: // AUTO
-      doc["fanMode"] = "AUTO";
+      json.addString("fanMode", "AUTO");
   }
 
   // Add timer status
   if (manualTimer.isActive) {
-    doc["timerActive"] = true;
+    json.addBool("timerActive", true);
     unsigned long now = millis();
     if (now < manualTimer.delayEndTime) {
-      doc["timerMode"] = "delay";
-      doc["timerRemainingSec"] = (manualTimer.delayEndTime - now) / 1000;
+      json.addString("timerMode", "delay");
+      json.addUInt("timerRemainingSec", (manualTimer.delayEndTime - now) / 1000);
     } else {
-      doc["timerMode"] = "run";
-      doc["timerRemainingSec"] = (manualTimer.timerEndTime - now) / 1000;
+      json.addString("timerMode", "run");
+      json.addUInt("timerRemainingSec", (manualTimer.timerEndTime - now) / 1000);
     }
   } else {
-    doc["timerActive"] = false;
+    json.addBool("timerActive", false);
   }
 
-  doc["testModeEnabled"] = config.testModeEnabled;
+  json.addBool("testModeEnabled", config.testModeEnabled);
   if (config.testModeEnabled) {
     extern float simulatedAtticTemp;
     extern float simulatedOutdoorTemp;
     extern float simulatedAtticHumidity;
-    doc["simulatedAtticTemp"] = simulatedAtticTemp;
-    doc["simulatedOutdoorTemp"] = simulatedOutdoorTemp;
-    doc["simulatedAtticHumidity"] = simulatedAtticHumidity;
+    json.addFloat("simulatedAtticTemp", simulatedAtticTemp);
+    json.addFloat("simulatedOutdoorTemp", simulatedOutdoorTemp);
+    json.addFloat("simulatedAtticHumidity", simulatedAtticHumidity);
   }
-  
+
   // Add indoor sensor data if enabled
   if (config.indoorSensorsEnabled) {
-    doc["indoorSensorsEnabled"] = true;
-    doc["indoorSensorCount"] = getActiveSensorCount();
-    
+    json.addBool("indoorSensorsEnabled", true);
+    json.addInt("indoorSensorCount", getActiveSensorCount());
+
     float avgIndoorTemp = getAverageIndoorTemperature();
     float avgIndoorHumidity = getAverageIndoorHumidity();
-    
+
     if (!isnan(avgIndoorTemp)) {
-      doc["avgIndoorTemp"] = serialized(String(avgIndoorTemp, 1));
+      json.addFixed("avgIndoorTemp", avgIndoorTemp, 1);
     }
     if (!isnan(avgIndoorHumidity)) {
-      doc["avgIndoorHumidity"] = serialized(String(avgIndoorHumidity, 1));
+      json.addFixed("avgIndoorHumidity", avgIndoorHumidity, 1);
     }
   } else {
-    doc["indoorSensorsEnabled"] = false;
+    json.addBool("indoorSensorsEnabled", false);
   }
-  
-  server.send(200, "application/json", doc.as<String>());
+}
+
+inline void handleStatus(ESP8266WebServer &server, FanMode fanMode) {
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  writeStatusJson(json, fanMode);
+  json.endObject();
+  json.end();
 }
 
 /**
@@ -265,7 +498,9 @@ inline void handleStatus(ESP8266WebServer &server, FanMode fanMode) {
  * @param reason The reason for the restart, to be logged.
  */
 inline void logAndRestart(const char* reason) {
+  flushHistoryBuffer(); // Staged history samples would otherwise only survive in RTC memory
   logDiagnostics(reason);
+  flushDiagnostics();
   delay(100); // Short delay to allow log to write
   ESP.restart();
 }
@@ -281,23 +516,33 @@ inline void handleResetConfig(ESP8266WebServer &server) {
   logAndRestart("[RESTART] Configuration reset from web UI.");
 }
 
-inline void handleGetConfig(ESP8266WebServer &server) {
-  StaticJsonDocument<512> doc;
+/**
+ * @brief Writes the /config fields into the current JSON object.
+ */
+inline void writeConfigJson(JsonStreamWriter &json) {
   // Values are now sanitized at boot in loadConfig(), so we can just send them.
-  doc["fanOnTemp"] = config.fanOnTemp;
-  doc["fanDeltaTemp"] = config.fanDeltaTemp;
-  doc["fanHysteresis"] = config.fanHysteresis;
-  doc["preCoolTriggerTemp"] = config.preCoolTriggerTemp;
-  doc["preCoolTempOffset"] = config.preCoolTempOffset;
-  doc["preCoolingEnabled"] = config.preCoolingEnabled;
-  doc["onboardLedEnabled"] = config.onboardLedEnabled;
-  doc["testModeEnabled"] = config.testModeEnabled;
-  doc["dailyRestartEnabled"] = config.dailyRestartEnabled;
-  doc["mqttEnabled"] = config.mqttEnabled;
-  doc["mqttDiscoveryEnabled"] = config.mqttDiscoveryEnabled;
-  doc["indoorSensorsEnabled"] = config.indoorSensorsEnabled;
-  doc["historyLogIntervalMs"] = config.historyLogIntervalMs;
-  server.send(200, "application/json", doc.as<String>());
+  json.addFloat("fanOnTemp", config.fanOnTemp);
+  json.addFloat("fanDeltaTemp", config.fanDeltaTemp);
+  json.addFloat("fanHysteresis", config.fanHysteresis);
+  json.addFloat("preCoolTriggerTemp", config.preCoolTriggerTemp);
+  json.addFloat("preCoolTempOffset", config.preCoolTempOffset);
+  json.addBool("preCoolingEnabled", config.preCoolingEnabled);
+  json.addBool("onboardLedEnabled", config.onboardLedEnabled);
+  json.addBool("testModeEnabled", config.testModeEnabled);
+  json.addBool("dailyRestartEnabled", config.dailyRestartEnabled);
+  json.addBool("mqttEnabled", config.mqttEnabled);
+  json.addBool("mqttDiscoveryEnabled", config.mqttDiscoveryEnabled);
+  json.addBool("indoorSensorsEnabled", config.indoorSensorsEnabled);
+  json.addUInt("historyLogIntervalMs", config.historyLogIntervalMs);
+}
+
+inline void handleGetConfig(ESP8266WebServer &server) {
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  writeConfigJson(json);
+  json.endObject();
+  json.end();
 }
 
 inline void handleSetConfig(ESP8266WebServer &server) {
@@ -403,6 +648,7 @@ inline void handleSetTestTemps(ESP8266WebServer &server) {
     if (server.hasArg("outdoor")) {
         simulatedOutdoorTemp = server.arg("outdoor").toFloat();
     }
+    sampleSensors(); // Test mode reads no hardware, so refresh the snapshot right away
     server.send(200, "text/plain", "Test temperatures updated.");
 }
 
@@ -462,6 +708,13 @@ inline void handleIndoorSensorData(ESP8266WebServer &server) {
     server.send(400, "text/plain", "Missing required fields: sensorId, name, temperature, humidity");
     return;
   }
+
+  uint32_t retryAfter = 0;
+  if (!admitIndoorSensorUpdate(doc["sensorId"].as<const char*>(), retryAfter)) {
+    server.sendHeader("Retry-After", String(retryAfter));
+    server.send(429, "text/plain", "Too many updates for this sensor");
+    return;
+  }
   
   String sensorId = doc["sensorId"].as<String>();
   String name = doc["name"].as<String>();
@@ -485,53 +738,50 @@ inline void handleIndoorSensorData(ESP8266WebServer &server) {
 }
 
 /**
- * @brief Get list of all indoor sensors
- * GET /indoor_sensors
+ * @brief Writes the /indoor_sensors fields into the current JSON object.
  */
-inline void handleGetIndoorSensors(ESP8266WebServer &server) {
-  cleanupExpiredSensors(); // Clean up before responding
-  
-  StaticJsonDocument<2048> doc;
-  JsonArray sensors = doc.createNestedArray("sensors");
-  
+inline void writeIndoorSensorsJson(JsonStreamWriter &json) {
+  json.beginArray("sensors");
   for (int i = 0; i < MAX_INDOOR_SENSORS; i++) {
-    if (indoorSensors[i].isActive) {
-      JsonObject sensor = sensors.createNestedObject();
-      sensor["sensorId"] = indoorSensors[i].sensorId;
-      sensor["name"] = indoorSensors[i].name;
-      sensor["temperature"] = serialized(String(indoorSensors[i].temperature, 1));
-      sensor["humidity"] = serialized(String(indoorSensors[i].humidity, 1));
-      sensor["lastUpdate"] = indoorSensors[i].lastUpdate;
-      sensor["ipAddress"] = indoorSensors[i].ipAddress;
-      
+    const IndoorSensorData& sensor = indoorSensors[i];
+    if (sensor.isActive) {
+      json.beginObject();
+      json.addString("sensorId", sensor.sensorId.c_str());
+      json.addString("name", sensor.name.c_str());
+      json.addFixed("temperature", sensor.temperature, 1);
+      json.addFixed("humidity", sensor.humidity, 1);
+      json.addUInt("lastUpdate", sensor.lastUpdate);
+      json.addString("ipAddress", sensor.ipAddress.c_str());
+
       // Calculate time since last update
-      unsigned long timeSinceUpdate = millis() - indoorSensors[i].lastUpdate;
-      sensor["secondsSinceUpdate"] = timeSinceUpdate / 1000;
+      unsigned long timeSinceUpdate = millis() - sensor.lastUpdate;
+      json.addUInt("secondsSinceUpdate", timeSinceUpdate / 1000);
+      json.endObject();
     }
   }
-  
-  doc["count"] = getActiveSensorCount();
-  doc["maxSensors"] = MAX_INDOOR_SENSORS;
-  
-  // Add average values
-  float avgTemp = getAverageIndoorTemperature();
-  float avgHumidity = getAverageIndoorHumidity();
-  
-  if (!isnan(avgTemp)) {
-    doc["averageTemperature"] = serialized(String(avgTemp, 1));
-  } else {
-    doc["averageTemperature"] = nullptr;
-  }
-  
-  if (!isnan(avgHumidity)) {
-    doc["averageHumidity"] = serialized(String(avgHumidity, 1));
-  } else {
-    doc["averageHumidity"] = nullptr;
-  }
-  
-  String response;
-  serializeJson(doc, response);
-  server.send(200, "application/json", response);
+  json.endArray();
+
+  json.addInt("count", getActiveSensorCount());
+  json.addInt("maxSensors", MAX_INDOOR_SENSORS);
+
+  // Add average values (NaN is written as null)
+  json.addFixed("averageTemperature", getAverageIndoorTemperature(), 1);
+  json.addFixed("averageHumidity", getAverageIndoorHumidity(), 1);
+}
+
+/**
+ * @brief Get list of all indoor sensors
+ * GET /indoor_sensors
+ */
+inline void handleGetIndoorSensors(ESP8266WebServer &server) {
+  cleanupExpiredSensors(); // Clean up before responding
+
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  writeIndoorSensorsJson(json);
+  json.endObject();
+  json.end();
 }
 
 /**
@@ -557,4 +807,37 @@ inline void handleRemoveIndoorSensor(ESP8266WebServer &server) {
   } else {
     server.send(404, "application/json", "{\"status\":\"error\",\"message\":\"Sensor not found\"}");
   }
+}
+
+/**
+ * @brief Everything the dashboard needs on first paint, in one response.
+ * GET /api/bootstrap
+ * Streams {"status":{...},"config":{...},"weather":{...},"indoorSensors":{...}}, each
+ * member identical to the body of its own endpoint. indoorSensors is null when the
+ * feature is disabled.
+ */
+inline void handleBootstrap(ESP8266WebServer &server, FanMode fanMode) {
+  if (config.indoorSensorsEnabled) cleanupExpiredSensors();
+
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  json.beginObject("status");
+  writeStatusJson(json, fanMode);
+  json.endObject();
+  json.beginObject("config");
+  writeConfigJson(json);
+  json.endObject();
+  json.beginObject("weather");
+  writeWeatherJson(json);
+  json.endObject();
+  if (config.indoorSensorsEnabled) {
+    json.beginObject("indoorSensors");
+    writeIndoorSensorsJson(json);
+    json.endObject();
+  } else {
+    json.addNull("indoorSensors");
+  }
+  json.endObject();
+  json.end();
 }
\ No newline at end of file
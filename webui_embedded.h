@@ -7,247 +7,241 @@
 #define WEBUI_EMIT_STREAM_HELPER 1
 #endif
 
-#undef F
-const char EMBEDDED_WEBUI[] PROGMEM = R"EMB1(
-<!DOCTYPE html>
-<html>
-<head>
-  <meta charset="utf-8">
-  <meta name="viewport" content="width=device-width, initial-scale=1">
-  <title>Attic Fan Control</title>
-  <link rel="stylesheet" href="atticfan.css">
-  <link rel="icon" type="image/png" href="favicon.png">
-  <link rel="icon" href="favicon.ico">
-</head>
-<body>
-<div class="page-container">
-  <h1>🏠 Attic Fan Control</h1>
-  <div class="top-layout-grid">
-    <div class="sensor-column">
-      <div class="sensor-item">
-        <strong>🌤️ Outdoor</strong>
-        <div class="sensor-value"><span id="outdoorTemp">--</span>°F</div>
-      </div>
-      <div class="sensor-item">
-        <strong>🌡️ Attic</strong>
-        <div class="sensor-value"><span id="atticTemp">--</span>°F / <span id="atticHumidity">--</span>%</div>
-      </div>
-      <div class="sensor-item" id="indoorSensorDisplay" style="display: none;">
-        <strong>🏠 Indoor (Avg) <a href="#" onclick="openIndoorSensorsModal(event)" class="help-link" title="Click to see all indoor sensors" aria-label="Help on indoor sensors">(+)</a></strong>
-        <div class="sensor-value"><span id="avgIndoorTemp">--</span>°F / <span id="avgIndoorHumidity">--</span>%</div>
-      </div>
-      <div class="sensor-item" id="indoorSensor1" style="display: none;">
-        <strong id="indoorSensor1Name">--</strong>
-        <div class="sensor-value"><span id="indoorSensor1Temp">--</span>°F / <span id="indoorSensor1Humidity">--</span>%</div>
-      </div>
-      <div class="sensor-item" id="indoorSensor2" style="display: none;">
-        <strong id="indoorSensor2Name">--</strong>
-        <div class="sensor-value"><span id="indoorSensor2Temp">--</span>°F / <span id="indoorSensor2Humidity">--</span>%</div>
-      </div>
-    </div>
-    <div class="control-column">
-      <div class="control-group" id="mode-control-box">
-  <h3>⚙️ Mode Control <a href="help.html#mode-control" class="help-link" title="Click for detailed help on modes" aria-label="Help on mode control">(?)</a></h3>
-        <div class="mode-buttons-container">
-          <button id="autoModeBtn" class="section-save-btn" onclick="setMode('AUTO')">AUTO</button>
-          <button id="manualModeBtn" class="section-save-btn" onclick="setMode('MANUAL')">MANUAL</button>
-        </div>
-        <div class="fan-status-container">
-          <div id="fan-icon-container">
-            <svg id="fan-icon" class="fan-icon" viewBox="0 0 100 100" xmlns="http://www.w3.org/2000/svg">
-              <path d="M50,15 A35,35 0 0,1 85,50 L50,50 Z" fill="white" />
-              <path d="M50,15 A35,35 0 0,0 15,50 L50,50 Z" transform="rotate(120 50 50)" fill="white" />
-              <path d="M50,15 A35,35 0 0,0 15,50 L50,50 Z" transform="rotate(240 50 50)" fill="white" />
-              <circle cx="50" cy="50" r="8" fill="rgba(255,255,255,0.8)"/>
-            </svg>
-          </div>
-          <div class="fan-text-container">
-            <p><span class="status-indicator" id="statusIndicator"></span>Mode: <span id="currentMode">--</span></p>
-            <p>Fan is <span id="fanState">OFF</span></p>
-          </div>
-        </div>
-        <div>
-          <p id="timerStatus"></p>
-          <button id="manualOnBtn" class="section-save-btn" onclick="setFan('on')" disabled>Turn ON</button>
-          <button id="manualOffBtn" class="section-save-btn" onclick="setFan('off')" disabled>Turn OFF</button>
-          <button id="setTimerBtn" class="section-save-btn" onclick="openTimerModal()" disabled>Set Timer</button>
-        </div>
-      </div>
-    </div>
-  </div>
-  <section class="content-section">
-  <h2>📊 Weather Forecast <a href="help.html#pre-cooling" class="help-link" title="Click for help on weather and pre-cooling" aria-label="Help on weather and pre-cooling">(?)</a></h2>
-    <p>Current: <span id="currentWeatherIcon"></span> <span id="currentWeatherTemp">--</span>°F / <span id="currentWeatherHumidity">--</span>%</p>
-    <div class="weather-forecast" id="forecastContainer"></div>
-  </section>
-  <section class="content-section">
-  <h2>📈 History <a href="help.html#history" class="help-link" title="Click for help on history chart and CSV log" aria-label="Help on history chart and CSV log">(?)</a></h2>
-    <div class="chart-container">
-      <canvas id="historyChart"></canvas>
-      <div id="historyChartMsg"></div>
-    </div>
-  </section>
-  <section id="configForm" class="content-section">
-  <h2>🎛️ Fan Temperature Control Settings <a href="help.html#temp-settings" class="help-link" title="Click for detailed help on temperature settings" aria-label="Help on temperature settings">(?)</a></h2>
-    <p class="unit-note">(All temperatures in Fahrenheit °F)</p>
-    <div class="settings-container">
-      <div class="settings-group">
-        <h4 class="config-subheading">Core Automation</h4>
-        <div class="config-grid">
-          <div class="config-item">
-            <label for="fanOnTemp" title="The attic temperature at which the fan will consider turning on.">On Temp</label>
-            <div class="number-input-wrapper"><input type="number" id="fanOnTemp" step="0.5" value="90.0"></div>
-          </div>
-          <div class="config-item">
-            <label for="fanDeltaTemp" title="Fan only runs if attic is this much hotter than outside. Prevents pulling in hot air.">Delta Temp</label>
-            <div class="number-input-wrapper"><input type="number" id="fanDeltaTemp" step="0.5" value="5.0"></div>
-          </div>
-          <div class="config-item">
-            <label for="fanHysteresis" title="Prevents rapid on/off cycling. Fan turns off at (On Temp - Hysteresis).">Hysteresis</label>
-            <div class="number-input-wrapper"><input type="number" id="fanHysteresis" step="0.5" value="2.0"></div>
-          </div>
-          <div class="save-cell">
-            <button class="section-save-btn" onclick="saveCoreAutomation()">💾 Save Core Automation</button>
-          </div>
-        </div>
-      </div>
-      <div class="settings-group">
-        <h4 class="config-subheading">Smart Pre-Cooling</h4>
-        <div class="config-grid">
-          <div class="config-item">
-            <label for="preCoolTriggerTemp" title="If forecast high is at or above this, pre-cooling activates.">Pre-Cool Trigger</label>
-            <div class="number-input-wrapper"><input type="number" id="preCoolTriggerTemp" step="0.5" value="90.0"></div>
-          </div>
-          <div class="config-item">
-            <label for="preCoolTempOffset" title="Lowers the 'On Temp' by this amount when pre-cooling is active.">Pre-Cool Offset</label>
-            <div class="number-input-wrapper"><input type="number" id="preCoolTempOffset" step="0.5" value="5.0"></div>
-          </div>
-          <div class="config-item">
-            <label for="historyLogInterval" title="How often to log sensor history (in minutes).">History Log Interval</label>
-            <div class="number-input-wrapper"><input type="number" id="historyLogInterval" min="1" max="1440" step="1" required value="5"></div>
-          </div>
-          <div class="save-cell">
-            <button class="section-save-btn" onclick="saveSmartPreCooling()">💾 Save Smart Pre-Cooling</button>
-          </div>
-        </div>
-      </div>
-    </div>
-  </section>
-  <section class="content-section" id="feature-toggles">
-  <h2>Feature Toggles <a class="help-link" href="help.html#feature-toggles" target="_blank" rel="noopener">(?)</a></h2>
-    <div class="config-grid">
-      <div class="config-item"><label for="preCoolingEnabled">Enable Pre-Cooling</label><label class="switch"><input type="checkbox" id="preCoolingEnabled"><span class="slider"></span></label></div>
-      <div class="config-item"><label for="onboardLedEnabled">Enable Status LED</label><label class="switch"><input type="checkbox" id="onboardLedEnabled"><span class="slider"></span></label></div>
-      <div class="config-item"><label for="dailyRestartEnabled">Enable Daily Restart</label><label class="switch"><input type="checkbox" id="dailyRestartEnabled"><span class="slider"></span></label></div>
-      <div class="config-item"><label for="mqttEnabled">Enable MQTT Broker</label><label class="switch"><input type="checkbox" id="mqttEnabled"><span class="slider"></span></label></div>
-      <div class="config-item"><label for="mqttDiscoveryEnabled">Publish HA Discovery</label><label class="switch"><input type="checkbox" id="mqttDiscoveryEnabled"><span class="slider"></span></label></div>
-      <div class="config-item"><label for="testModeEnabled">Enable Test Mode</label><label class="switch"><input type="checkbox" id="testModeEnabled"><span class="slider"></span></label></div>
-    </div>
-  </section>
-  <section id="test-panel" class="content-section">
-  <h2>🧪 Test Panel <a href="help.html#feature-toggles" class="help-link" title="Click for help on test mode" aria-label="Help on test mode">(?)</a></h2>
-      <h4 class="config-subheading">Simulated Temps</h4>
-      <div class="config-grid">
-        <div class="config-item">
-          <label for="simulatedAtticTemp">Attic: <span id="attic-temp-val">--</span>°F</label>
-          <input type="range" id="simulatedAtticTemp" min="50" max="150" step="1" oninput="updateTempDisplay('attic-temp-val', this.value); setSliderInteraction(true)">
-        </div>
-        <div class="config-item">
-          <label for="simulatedOutdoorTemp">Outdoor: <span id="outdoor-temp-val">--</span>°F</label>
-          <input type="range" id="simulatedOutdoorTemp" min="30" max="120" step="1" oninput="updateTempDisplay('outdoor-temp-val', this.value); setSliderInteraction(true)">
-        </div>
-      </div>
-      <div class="test-panel-actions">
-        <button onclick="updateTestTemps()" class="section-save-btn">Update Temps</button>
-      </div>
-      </section>
-  <section class="content-section" id="ap-mode">
-  <h2>Access Point (AP) Mode <a href="help.html#troubleshooting" class="help-link" title="Click for help on AP mode and WiFi recovery" aria-label="Help on AP mode and WiFi recovery">(?)</a></h2>
-    <p>Put device into AP Mode to change WiFi credentials:</p>
-    <button onclick="forceAPMode()" class="section-save-btn btn-danger">Force AP Mode</button>
-  </section>
-<section class="content-section">
-  <h2>System & Maintenance <a href="help.html#api-reference" class="help-link" title="Click for help on system and API" aria-label="Help on system and API">(?)</a></h2>
-    <div class="system-controls-columns">
-      <div class="system-col">
-        <button onclick="window.location.href='/update_wrapper'" class="section-save-btn">Firmware Update</button>
-        <a href="/diagnostics" class="section-save-btn" download>Download Diagnostics</a>
-        <a href="/history.csv" class="section-save-btn" download>Download History</a>
-        <button onclick="restartDevice()" class="section-save-btn btn-danger">Restart Device</button>
-      </div>
-      <div class="system-col">
-        <button onclick="openSystemInfoModal()" class="section-save-btn">System Info</button>
-        <button onclick="clearDiagnostics()" class="section-save-btn">Clear Diagnostics</button>
-        <button onclick="clearHistory()" class="section-save-btn">Clear History</button>
-        <button onclick="resetConfig()" class="section-save-btn btn-danger">Reset to Defaults</button>
-      </div>
-    </div>
-    </section>
-
-<footer class="app-footer">Firmware: <span id="firmwareVersion">--</span></footer>
-</div>
-
-<!-- Non-visual elements -->
-<div id="saveToast" class="toast"></div>
-<div id="timerModal" class="modal">
-  <div class="modal-content">
-    <span class="close-btn" onclick="closeTimerModal()">&times;</span>
-    <h3>Set Manual Timer</h3>
-    <div class="config-grid">
-      <div class="config-item"><label for="timerDelay">Delay Start (mins)</label><div class="number-input-wrapper"><input type="number" id="timerDelay" min="0" step="1" value="0"></div></div>
-      <div class="config-item"><label for="timerDuration">Run Duration (mins)</label><div class="number-input-wrapper"><input type="number" id="timerDuration" min="1" step="1" value="30"></div></div>
-    </div>
-    <div class="timer-options"><label for="postTimerAction">After timer ends:</label>
-      <select id="postTimerAction">
-        <option value="go_auto">Switch to AUTO</option>
-        <option value="stay_manual">Stay MANUAL (Fan Off)</option>
-      </select>
-    </div>
-    <div class="timer-actions" style="text-align: center;"><button class="section-save-btn" onclick="startTimedRun()">Start Timed Run</button></div>
-  </div>
-</div>
-
-<!-- Indoor Sensors Modal -->
-<div id="indoorSensorsModal" class="modal">
-  <div class="modal-content">
-    <span class="close-btn" onclick="closeIndoorSensorsModal()">&times;</span>
-    <h3>All Indoor Sensors</h3>
-    <div class="modal-link-container">
-          <a href="/indoor_sensors_dashboard.html">Go to Indoor Sensors Dashboard &rarr;</a>
-        </div>
-    <div id="indoorSensorsList"></div>
-  </div>
-</div>
-
-<!-- System Info Modal -->
-<div id="systemInfoModal" class="modal">
-  <div class="modal-content">
-    <span class="close-btn" onclick="closeSystemInfoModal()">&times;</span>
-    <h3>System Information</h3>
-    <div id="systemInfoContent">
-      <!-- System info will be loaded here -->
-    </div>
-  </div>
-</div>
-
-<!-- Scripts -->
-<script src="https://cdn.jsdelivr.net/npm/chart.js"></script>
-<script src="atticfan.js" defer></script>
-</body>
-</html>)EMB1";
-const size_t EMBEDDED_WEBUI_LEN = sizeof(EMBEDDED_WEBUI) - 1;
+// 13593 bytes, gzipped to 3397
+const unsigned char EMBEDDED_WEBUI[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x5b, 0x4f, 0x6f, 0x23, 0xb7,
+  0x15, 0xbf, 0xef, 0xa7, 0x60, 0x26, 0x68, 0x2c, 0xa3, 0x1e, 0x49, 0xb6, 0xac, 0xcd, 0xc6, 0x2b,
+  0x29, 0x50, 0xec, 0xb8, 0x6b, 0xc0, 0x5e, 0xbb, 0xb1, 0x93, 0xa0, 0xbd, 0x2c, 0xa8, 0x19, 0x4a,
+  0x62, 0x76, 0x34, 0x9c, 0x90, 0x1c, 0x69, 0xf5, 0x0d, 0x8a, 0xa2, 0x68, 0x80, 0xf6, 0xd4, 0xf6,
+  0xd0, 0x16, 0x28, 0x50, 0xa0, 0xa7, 0x1e, 0x7b, 0xea, 0xa1, 0x1f, 0xa5, 0x5f, 0xa0, 0xfd, 0x08,
+  0x7d, 0x8f, 0xe4, 0x8c, 0x66, 0x46, 0x23, 0x5b, 0x72, 0xd6, 0x29, 0xb0, 0x5e, 0x69, 0x38, 0x8f,
+  0xef, 0x91, 0xef, 0x1f, 0x7f, 0x24, 0x9f, 0x7a, 0x1f, 0x9c, 0x5d, 0x9f, 0xde, 0xfd, 0xec, 0xe6,
+  0x73, 0x32, 0xd5, 0xb3, 0x68, 0xf0, 0xac, 0x97, 0x7d, 0x30, 0x1a, 0x0e, 0x9e, 0x11, 0xd2, 0x9b,
+  0x31, 0x4d, 0x49, 0x30, 0xa5, 0x52, 0x31, 0xdd, 0xf7, 0x52, 0x3d, 0xf6, 0x5f, 0x78, 0xab, 0x17,
+  0x31, 0x9d, 0xb1, 0xbe, 0x37, 0xe7, 0x6c, 0x91, 0x08, 0xa9, 0x3d, 0x12, 0x88, 0x58, 0xb3, 0x18,
+  0x08, 0x17, 0x3c, 0xd4, 0xd3, 0x7e, 0xc8, 0xe6, 0x3c, 0x60, 0xbe, 0x79, 0x38, 0x20, 0x3c, 0xe6,
+  0x9a, 0xd3, 0xc8, 0x57, 0x01, 0x8d, 0x58, 0xff, 0xd0, 0xb2, 0xd1, 0x5c, 0x47, 0x6c, 0x30, 0xd4,
+  0x9a, 0x07, 0xe4, 0x9c, 0xc6, 0xe4, 0x14, 0x38, 0x48, 0x11, 0xf5, 0x5a, 0xf6, 0x05, 0x92, 0x44,
+  0x3c, 0x7e, 0x4b, 0x24, 0x8b, 0xfa, 0x9e, 0xd2, 0xcb, 0x88, 0xa9, 0x29, 0x63, 0x20, 0x6a, 0x2a,
+  0xd9, 0xb8, 0xef, 0x51, 0xec, 0x38, 0xa6, 0x71, 0x33, 0x50, 0xea, 0xd3, 0x79, 0x9f, 0x3d, 0xff,
+  0x38, 0x64, 0xcf, 0xdb, 0xcf, 0x47, 0x1f, 0xb3, 0x6e, 0xf7, 0xb0, 0xd3, 0xf6, 0x2a, 0x0c, 0x38,
+  0x0c, 0xd0, 0x23, 0x7a, 0x99, 0xc0, 0xa8, 0xf9, 0x8c, 0x4e, 0x58, 0x2b, 0x89, 0x27, 0x19, 0xaf,
+  0x31, 0x9d, 0xe3, 0xfb, 0x26, 0x34, 0x01, 0xab, 0xe7, 0x87, 0xa3, 0xf6, 0xb8, 0x43, 0x8f, 0x3b,
+  0x87, 0xa3, 0xce, 0xf8, 0xa8, 0xd3, 0xa9, 0x67, 0x55, 0xee, 0x09, 0xff, 0xd5, 0xf7, 0xec, 0xb5,
+  0xac, 0x42, 0x7b, 0x23, 0x11, 0x2e, 0xe1, 0x23, 0xe4, 0x73, 0x12, 0x44, 0x54, 0xa9, 0xbe, 0x97,
+  0xc0, 0x28, 0x7c, 0xd4, 0x1b, 0xe5, 0x31, 0x93, 0x56, 0xca, 0xf4, 0x70, 0xf0, 0xdf, 0x3f, 0x7e,
+  0xf7, 0x27, 0x52, 0xa3, 0x16, 0x78, 0x85, 0x14, 0x05, 0x06, 0x5a, 0x24, 0x7e, 0x44, 0x97, 0x22,
+  0xd5, 0xfe, 0x44, 0xf2, 0xd0, 0x70, 0x28, 0x53, 0x28, 0x16, 0x2b, 0x21, 0x41, 0x48, 0x94, 0xce,
+  0x62, 0xf7, 0xbe, 0x96, 0x82, 0x6b, 0x36, 0xcb, 0xdf, 0x03, 0x85, 0x02, 0x99, 0xf1, 0x04, 0xc6,
+  0xf2, 0xab, 0xbf, 0xfc, 0xe7, 0x1f, 0xdf, 0x91, 0xeb, 0x54, 0x87, 0x42, 0xc8, 0x5e, 0xcb, 0xb5,
+  0xaf, 0x08, 0xd7, 0x59, 0xcd, 0x69, 0x94, 0x32, 0x6f, 0xd0, 0x53, 0x09, 0x8c, 0x9e, 0x87, 0x7d,
+  0x4f, 0xd8, 0xce, 0x77, 0x6c, 0x96, 0x78, 0x03, 0xdf, 0x07, 0x26, 0xf0, 0x66, 0xf0, 0xaf, 0xbf,
+  0x9f, 0xf7, 0x5a, 0xd0, 0x3b, 0x1f, 0x54, 0xe9, 0x61, 0x97, 0x11, 0xfe, 0x19, 0x47, 0x68, 0x14,
+  0xf6, 0xb8, 0xf1, 0x19, 0x4f, 0x5a, 0x1f, 0x1d, 0x69, 0x91, 0x0a, 0xcd, 0xab, 0x74, 0xc6, 0x43,
+  0xae, 0x97, 0x05, 0xba, 0x1f, 0xed, 0x3e, 0x07, 0xc3, 0x8f, 0xc7, 0xa8, 0x92, 0x5b, 0xd3, 0x7c,
+  0xc6, 0x55, 0x02, 0x66, 0xf4, 0x88, 0x71, 0xf2, 0xbe, 0x17, 0xda, 0xe7, 0x13, 0x12, 0x8b, 0x98,
+  0xbd, 0xac, 0x9d, 0x33, 0x78, 0xc8, 0x85, 0xe1, 0x40, 0x1a, 0xc3, 0xf9, 0x64, 0x9f, 0xf4, 0xa8,
+  0xf3, 0xc7, 0x0f, 0x3d, 0x22, 0xe2, 0x20, 0xe2, 0xc1, 0x5b, 0xd0, 0x7b, 0xc2, 0xe2, 0x8b, 0x82,
+  0x1c, 0x75, 0x25, 0x42, 0x1a, 0x35, 0xd8, 0x1c, 0xe2, 0x74, 0xdf, 0xcb, 0x86, 0x36, 0x65, 0x11,
+  0x78, 0x11, 0x38, 0x37, 0x44, 0x07, 0x06, 0x5e, 0xdf, 0x3b, 0xc5, 0xee, 0x44, 0x0b, 0xa2, 0x18,
+  0x23, 0x34, 0x8a, 0x88, 0x1d, 0x2c, 0xb1, 0x93, 0x50, 0x1e, 0xa1, 0x92, 0x53, 0x70, 0xbc, 0x11,
+  0x06, 0xc3, 0x2b, 0xe8, 0x0e, 0x22, 0xab, 0x34, 0x83, 0xc6, 0x8f, 0xf7, 0x7b, 0x2d, 0x3a, 0x78,
+  0xa4, 0x45, 0xe6, 0x13, 0x3b, 0xf0, 0x87, 0xac, 0x92, 0xd1, 0x3d, 0x91, 0x65, 0x0e, 0xb7, 0xb6,
+  0xc9, 0x7a, 0xd7, 0xd7, 0x90, 0x20, 0xdd, 0x70, 0x1e, 0xa1, 0x81, 0x12, 0xab, 0x07, 0xb4, 0x50,
+  0xa2, 0x7d, 0x22, 0x4d, 0x1c, 0x3d, 0x5e, 0x13, 0x47, 0xef, 0x4f, 0x13, 0x47, 0x3b, 0x68, 0xe2,
+  0x68, 0x17, 0x4d, 0x14, 0xbf, 0x16, 0xc6, 0x14, 0xd8, 0xdc, 0x7b, 0x5f, 0xfe, 0xcc, 0x48, 0x26,
+  0x52, 0xa4, 0x89, 0xd5, 0xdb, 0x4c, 0x84, 0x36, 0xaf, 0x63, 0xfb, 0x48, 0xbc, 0x73, 0x99, 0xbd,
+  0x33, 0xf8, 0xf7, 0xef, 0x7f, 0x87, 0xa9, 0x0a, 0xc2, 0x90, 0x65, 0x69, 0x7d, 0x15, 0xb9, 0x18,
+  0x87, 0x4d, 0x5c, 0x83, 0x3f, 0x2c, 0xf6, 0x7f, 0x30, 0x4c, 0xc7, 0x10, 0x74, 0x21, 0x2c, 0xc8,
+  0x3c, 0x62, 0x21, 0x99, 0xba, 0x60, 0x44, 0x0e, 0x1b, 0xe2, 0x14, 0x5f, 0x91, 0x8c, 0xf9, 0xa0,
+  0xf1, 0xa9, 0x8b, 0x52, 0x18, 0x5d, 0xad, 0x55, 0xcc, 0x58, 0x46, 0xa9, 0xd6, 0x22, 0x56, 0x95,
+  0xb5, 0x2a, 0x27, 0xb7, 0xaf, 0x6d, 0x40, 0xa6, 0x5a, 0xe0, 0xf4, 0x3e, 0xd3, 0xb1, 0xb7, 0x32,
+  0x6c, 0xa0, 0xb9, 0x88, 0x7d, 0x45, 0xe7, 0xc0, 0x0a, 0x5f, 0xe4, 0x19, 0x0a, 0x90, 0x05, 0x52,
+  0x37, 0xf6, 0x86, 0x5f, 0xde, 0x5d, 0xef, 0xed, 0x7b, 0x03, 0xfc, 0xec, 0xb5, 0x2c, 0xc3, 0x4d,
+  0x32, 0x66, 0x34, 0x4e, 0x69, 0xf4, 0x18, 0x29, 0x57, 0xc3, 0xd7, 0x5f, 0x0e, 0x2f, 0x51, 0x8e,
+  0xfd, 0xb6, 0x2e, 0xa9, 0xe4, 0x1f, 0x65, 0x4d, 0x00, 0xd4, 0xf0, 0x95, 0xa6, 0x3a, 0xdd, 0xa8,
+  0x07, 0x24, 0xc6, 0x01, 0x22, 0x25, 0x82, 0x82, 0x0d, 0x74, 0x18, 0x29, 0xf3, 0x49, 0x89, 0xd2,
+  0x2b, 0x0a, 0xb1, 0x0d, 0x88, 0xac, 0x3e, 0x13, 0xef, 0xfa, 0x5e, 0x9b, 0xb4, 0xc9, 0x61, 0xdb,
+  0xfc, 0x79, 0xe4, 0xdd, 0x2c, 0x8a, 0xd1, 0x19, 0xb4, 0x4e, 0x4e, 0x5a, 0xad, 0xc5, 0x62, 0xd1,
+  0x5c, 0x74, 0x9a, 0x42, 0x4e, 0x5a, 0x47, 0xed, 0x76, 0xbb, 0x05, 0x6c, 0x2b, 0x92, 0x40, 0x56,
+  0x42, 0xf5, 0x94, 0x80, 0xac, 0xab, 0x6e, 0xfb, 0xe0, 0xb0, 0x4b, 0x86, 0x9d, 0xee, 0x41, 0xa7,
+  0x0b, 0x3c, 0xe1, 0x89, 0xbc, 0xe8, 0x1e, 0x74, 0xdb, 0xe4, 0x12, 0xde, 0xc0, 0xc7, 0xcf, 0x3d,
+  0x32, 0xe6, 0x11, 0xb8, 0xca, 0x62, 0x0a, 0x39, 0xc0, 0x23, 0xad, 0x1d, 0x58, 0xc1, 0xf0, 0x2a,
+  0xac, 0xb4, 0xa4, 0xb1, 0x02, 0xe7, 0x9c, 0xf5, 0x3d, 0x29, 0x40, 0x6d, 0xac, 0x71, 0x78, 0xd4,
+  0x26, 0x5d, 0xfc, 0xb7, 0xff, 0xc4, 0x82, 0x8e, 0x8e, 0xb7, 0x16, 0x14, 0x70, 0x19, 0x44, 0x10,
+  0x0f, 0xa0, 0xe7, 0x2e, 0xa8, 0x37, 0x58, 0xda, 0x4f, 0xd9, 0xf7, 0x5e, 0x64, 0x7d, 0xe5, 0x64,
+  0x44, 0x1b, 0x47, 0xdd, 0xee, 0x41, 0xf6, 0xd7, 0x6e, 0xbe, 0xd8, 0xf7, 0x2a, 0xac, 0x7a, 0xa8,
+  0xfb, 0x92, 0x33, 0x94, 0x1d, 0x69, 0xdd, 0x95, 0x34, 0x7b, 0xa7, 0x37, 0x3b, 0x48, 0xe2, 0x12,
+  0x60, 0xe6, 0xdc, 0xd6, 0xef, 0x20, 0xbd, 0xf1, 0x80, 0x6a, 0x21, 0x6d, 0x9e, 0xb1, 0xad, 0x17,
+  0x79, 0xe3, 0xc0, 0x65, 0x39, 0x74, 0xf6, 0x93, 0x42, 0x56, 0x0c, 0x52, 0x29, 0x61, 0xc9, 0xc7,
+  0xe6, 0x42, 0x2e, 0xec, 0xb5, 0x92, 0x35, 0xa1, 0x88, 0x37, 0xb9, 0x2a, 0x74, 0x85, 0x91, 0xde,
+  0xa2, 0x4e, 0xbd, 0xc1, 0xf5, 0xf9, 0x79, 0x7d, 0xc7, 0x6a, 0xc8, 0xac, 0x47, 0x50, 0x89, 0x3a,
+  0x31, 0x7c, 0x35, 0x9f, 0x31, 0x79, 0x6b, 0xc6, 0xef, 0xad, 0x31, 0x5c, 0x8b, 0xf5, 0xeb, 0x78,
+  0xfb, 0x48, 0x87, 0x29, 0x34, 0xf6, 0x44, 0x0c, 0x41, 0x4e, 0x60, 0xa5, 0xa2, 0x23, 0x48, 0x8b,
+  0x83, 0xbb, 0x54, 0xc6, 0xe4, 0xfa, 0xf5, 0x76, 0x89, 0xe5, 0x7a, 0x3c, 0xde, 0x55, 0xda, 0x78,
+  0x5c, 0x23, 0x0e, 0xf5, 0x75, 0xbf, 0x3c, 0xe8, 0x7f, 0x87, 0x7a, 0xd8, 0x52, 0x1c, 0xc2, 0x39,
+  0x43, 0x6f, 0x61, 0x5c, 0x51, 0xe2, 0x2d, 0xd3, 0xc4, 0xbc, 0x7a, 0x20, 0xa3, 0xd5, 0xad, 0x78,
+  0xab, 0x2f, 0x4e, 0x76, 0x71, 0x65, 0x03, 0xb7, 0xf1, 0x5d, 0xb3, 0x5b, 0xc5, 0x8e, 0x00, 0x7d,
+  0xfe, 0xf6, 0x97, 0xe4, 0x6b, 0x06, 0x21, 0xca, 0x24, 0x39, 0x17, 0x92, 0x05, 0x54, 0xe9, 0xba,
+  0x75, 0x2c, 0x91, 0xb8, 0x8c, 0x09, 0x58, 0xb4, 0x26, 0x5b, 0x2d, 0x63, 0xd9, 0xea, 0xb5, 0x70,
+  0xbc, 0x69, 0x1c, 0x92, 0x12, 0x8f, 0xba, 0xf5, 0x6c, 0x13, 0x71, 0x61, 0x69, 0x3b, 0x72, 0x33,
+  0x4e, 0x06, 0xa7, 0x36, 0x12, 0x6a, 0x82, 0xc3, 0xcd, 0xe7, 0x02, 0x73, 0x6f, 0x16, 0x47, 0x1b,
+  0xa9, 0x1e, 0x40, 0x21, 0x65, 0xe2, 0x7a, 0x18, 0x92, 0xac, 0x83, 0x0d, 0x37, 0x13, 0x7f, 0xec,
+  0x54, 0x6a, 0x83, 0x3c, 0x7b, 0x3a, 0x5d, 0xa5, 0x8a, 0x82, 0xe9, 0x9c, 0x6d, 0x76, 0x34, 0xdf,
+  0x2f, 0xc8, 0x2b, 0xae, 0x20, 0x63, 0x2c, 0xeb, 0xac, 0x36, 0xb5, 0xaf, 0x76, 0xb2, 0x98, 0xeb,
+  0x63, 0x4e, 0x0b, 0xb4, 0x31, 0xc5, 0xe9, 0xed, 0x57, 0x24, 0x12, 0x1b, 0x6c, 0xb6, 0x99, 0xbc,
+  0xc6, 0x6a, 0x45, 0xac, 0x85, 0xf4, 0x35, 0x49, 0xb3, 0x17, 0xd0, 0x78, 0x4e, 0x95, 0xd1, 0x97,
+  0xe3, 0x7d, 0x8a, 0xa4, 0xa8, 0x2a, 0xfb, 0xaa, 0x84, 0xdc, 0xaa, 0x64, 0x57, 0x6a, 0x52, 0x50,
+  0x6a, 0x29, 0x34, 0xea, 0xf4, 0x6b, 0x4c, 0x2c, 0xe2, 0x31, 0x9f, 0x80, 0xf3, 0xcf, 0xbc, 0x87,
+  0xf5, 0xfd, 0xeb, 0x3f, 0x20, 0xea, 0xc3, 0xdc, 0x8a, 0x8e, 0xc3, 0x24, 0x64, 0x3d, 0xb9, 0x02,
+  0x80, 0x10, 0xbb, 0x1a, 0x1c, 0x56, 0xd5, 0xd9, 0x02, 0xa0, 0x78, 0x02, 0x0c, 0x2d, 0xc1, 0xe3,
+  0xa0, 0xa0, 0x2e, 0x88, 0x5c, 0x71, 0xaa, 0xb3, 0x4a, 0x2d, 0x65, 0x5d, 0x18, 0x65, 0xe3, 0x48,
+  0x63, 0xae, 0xfd, 0x58, 0xe0, 0xea, 0xd0, 0x18, 0xc2, 0x36, 0xb1, 0xc0, 0x00, 0x6c, 0x11, 0xc3,
+  0x8c, 0x61, 0x3e, 0xf1, 0x94, 0x71, 0x4d, 0x20, 0x44, 0xf6, 0x6b, 0x9d, 0x3e, 0x13, 0x54, 0x67,
+  0xd5, 0x3a, 0x32, 0x0b, 0xb3, 0x0b, 0xe9, 0x6d, 0x7a, 0x5c, 0x30, 0x00, 0xd8, 0xc4, 0x57, 0xe9,
+  0x08, 0x4f, 0x5c, 0x4c, 0x0e, 0x38, 0x85, 0xe0, 0x21, 0x43, 0xc0, 0xa4, 0x33, 0x8a, 0x36, 0x81,
+  0x49, 0x1c, 0xd7, 0x83, 0x3b, 0xd7, 0xb7, 0x70, 0x8a, 0xb2, 0x91, 0xa6, 0x72, 0x0e, 0x61, 0xa8,
+  0x8c, 0x26, 0x51, 0xff, 0x66, 0xc5, 0xbc, 0x8e, 0x4d, 0x82, 0xc8, 0x8c, 0x73, 0x37, 0x85, 0x5d,
+  0xb4, 0x39, 0xce, 0x29, 0x6a, 0x98, 0x6a, 0x02, 0xa8, 0x24, 0x98, 0x12, 0x88, 0x79, 0x02, 0x9d,
+  0xc8, 0x02, 0xd0, 0x06, 0x02, 0x73, 0xc5, 0x43, 0x48, 0x67, 0x40, 0x13, 0xc3, 0x14, 0xc0, 0x2e,
+  0x4d, 0x58, 0x7b, 0xad, 0xe7, 0xf4, 0x5a, 0x46, 0x4e, 0x45, 0x76, 0x61, 0x84, 0x71, 0x3a, 0x1b,
+  0x41, 0x02, 0xe1, 0x71, 0x92, 0x6a, 0x7f, 0x21, 0x69, 0x92, 0x98, 0x74, 0x61, 0x9e, 0xdd, 0xd1,
+  0x97, 0x25, 0xf1, 0xb2, 0xc5, 0x3d, 0x1b, 0xaa, 0xd2, 0x2c, 0x01, 0xa8, 0xd9, 0xec, 0x02, 0xf0,
+  0xc4, 0x0d, 0x58, 0xdf, 0xfb, 0xa4, 0xdd, 0x6c, 0x97, 0xa2, 0x62, 0x0b, 0x5c, 0xb3, 0xb5, 0x86,
+  0xce, 0x58, 0xa4, 0x69, 0x49, 0x49, 0x18, 0x1d, 0x22, 0x8e, 0x96, 0x44, 0xa6, 0x31, 0x38, 0xcf,
+  0xd8, 0x69, 0x0c, 0xc0, 0x88, 0x86, 0x50, 0x25, 0xb3, 0x14, 0x34, 0x35, 0x15, 0x5a, 0xa3, 0x6a,
+  0xa6, 0x48, 0x9b, 0x6a, 0x54, 0x54, 0x93, 0xdc, 0x48, 0x73, 0x9e, 0xa1, 0x48, 0x92, 0x46, 0x98,
+  0xf8, 0xd1, 0xf1, 0x80, 0x90, 0x50, 0x2e, 0x41, 0x73, 0x46, 0xd0, 0x53, 0x29, 0xaf, 0x30, 0x8b,
+  0x75, 0xfd, 0x75, 0x9f, 0x50, 0x7d, 0xaf, 0x96, 0x20, 0x0f, 0x82, 0x8c, 0xab, 0x5c, 0x7f, 0xb9,
+  0x1a, 0x60, 0xe0, 0x3c, 0x04, 0x55, 0xb6, 0x00, 0x95, 0x00, 0x9e, 0x0d, 0x50, 0x27, 0x4d, 0x93,
+  0x7c, 0xd0, 0xa5, 0x14, 0xc1, 0x66, 0xf0, 0xbd, 0x86, 0xf3, 0x29, 0xe2, 0x93, 0x15, 0xb7, 0x7d,
+  0xd0, 0xd8, 0xea, 0xe9, 0x09, 0x34, 0x56, 0x1c, 0xf8, 0xba, 0xca, 0x8e, 0x76, 0x57, 0x99, 0x81,
+  0x49, 0x01, 0x8b, 0xa2, 0xaa, 0xc2, 0x1c, 0xcc, 0xda, 0x02, 0xc4, 0x41, 0x13, 0xa6, 0x89, 0x55,
+  0x96, 0x00, 0x64, 0x05, 0x49, 0xfb, 0x37, 0xff, 0x24, 0xb7, 0xf0, 0x8a, 0xac, 0xa5, 0x90, 0x1a,
+  0x4c, 0x77, 0x0f, 0x02, 0xbe, 0xe7, 0xb4, 0xe5, 0x51, 0x19, 0xed, 0x76, 0x86, 0x4b, 0x26, 0x58,
+  0xdb, 0x3f, 0xb5, 0x40, 0xe7, 0x87, 0xc8, 0x69, 0x80, 0xab, 0x50, 0xda, 0x9d, 0xe4, 0x93, 0x89,
+  0x43, 0x3f, 0x99, 0xdf, 0x5d, 0x8c, 0x49, 0x86, 0x50, 0x60, 0x59, 0x9f, 0x4c, 0x31, 0x62, 0xc1,
+  0xbd, 0x60, 0x25, 0xa2, 0x23, 0x01, 0xea, 0xc3, 0xe8, 0x3d, 0x28, 0x02, 0x33, 0x42, 0xc1, 0x14,
+  0x73, 0xd8, 0x52, 0x28, 0x70, 0xb6, 0x6c, 0x1e, 0xc4, 0xb1, 0x7e, 0xdf, 0x2e, 0x57, 0x37, 0xf0,
+  0x1f, 0x32, 0xd5, 0x65, 0xf2, 0x41, 0x30, 0x6c, 0x2b, 0x14, 0x5e, 0x5e, 0x38, 0xbd, 0x5d, 0x8a,
+  0x05, 0x93, 0xca, 0x24, 0xff, 0x3d, 0x17, 0x8a, 0x7b, 0x64, 0xb4, 0xb4, 0xd9, 0x8e, 0xce, 0x44,
+  0x1a, 0xe3, 0xfa, 0xc0, 0xe2, 0x92, 0xea, 0xf0, 0x15, 0x6a, 0x8f, 0x15, 0x55, 0x67, 0x19, 0x3f,
+  0x95, 0xe6, 0x0a, 0x23, 0xff, 0x01, 0x73, 0x9c, 0x43, 0x67, 0x97, 0x62, 0x72, 0x01, 0xa0, 0x4a,
+  0x82, 0xb8, 0x5c, 0x71, 0xaf, 0xc4, 0x02, 0x72, 0x18, 0x20, 0x2d, 0x3c, 0xa0, 0x06, 0xc8, 0xe8,
+  0x4e, 0x9c, 0x73, 0x4c, 0xd9, 0x80, 0xfc, 0x3f, 0xe3, 0x71, 0x0a, 0x0e, 0x66, 0xd2, 0x99, 0x6b,
+  0x06, 0x56, 0x24, 0xe3, 0xf5, 0xbe, 0x75, 0x55, 0x37, 0x5a, 0x18, 0x42, 0xdf, 0x3b, 0x84, 0x4f,
+  0xfa, 0x0e, 0x3e, 0x8f, 0x8f, 0xdb, 0x99, 0xfe, 0xa0, 0x4d, 0xb2, 0x6f, 0x53, 0x2e, 0x01, 0xa3,
+  0x65, 0x6a, 0xfc, 0xff, 0x64, 0x3d, 0x93, 0x4a, 0x6e, 0xac, 0x9d, 0xc1, 0xbb, 0xca, 0x69, 0xaf,
+  0x26, 0xcf, 0x3c, 0x3a, 0xf1, 0x3d, 0x6e, 0xbf, 0x62, 0xd7, 0x0c, 0x66, 0xd0, 0x92, 0xaf, 0xc5,
+  0x64, 0x12, 0x31, 0x95, 0x83, 0xea, 0x73, 0xdb, 0x4e, 0xee, 0x6c, 0x3b, 0x62, 0xe7, 0x75, 0x70,
+  0x5c, 0x45, 0xd3, 0x55, 0x66, 0x44, 0x53, 0x39, 0xc1, 0xbb, 0xcd, 0x37, 0xa3, 0x88, 0x62, 0x07,
+  0x73, 0xbb, 0x17, 0x0b, 0xdc, 0x68, 0xa3, 0xc1, 0xef, 0xdf, 0x8b, 0xd4, 0x64, 0xd7, 0x8d, 0x8e,
+  0x5e, 0x93, 0x13, 0x40, 0xa5, 0x9f, 0xc7, 0x66, 0xf7, 0xee, 0x0d, 0xec, 0x97, 0xb2, 0xb6, 0xad,
+  0x8b, 0xba, 0x8e, 0x99, 0x41, 0x17, 0x5c, 0x07, 0xd3, 0x8a, 0x27, 0x06, 0x53, 0x16, 0xbc, 0xc5,
+  0x53, 0xe6, 0x62, 0xdc, 0x16, 0xb9, 0x97, 0x4f, 0x92, 0x22, 0x84, 0x97, 0xf9, 0x16, 0x37, 0x97,
+  0xb3, 0x69, 0x99, 0xda, 0x38, 0x0d, 0x11, 0x8f, 0x04, 0x95, 0xe1, 0x25, 0x0b, 0xab, 0xd3, 0xb0,
+  0xc7, 0x3a, 0xe4, 0xf2, 0xf3, 0xb3, 0x47, 0xcf, 0xa2, 0x86, 0xf9, 0xd3, 0xcc, 0x22, 0x84, 0xcd,
+  0xd2, 0xf2, 0x0b, 0xa6, 0xc0, 0x13, 0x74, 0x75, 0x1e, 0x67, 0xf8, 0x8e, 0xb8, 0x97, 0x8f, 0x9e,
+  0x4a, 0xad, 0x84, 0xa7, 0x99, 0xcc, 0xec, 0x5b, 0xbd, 0x36, 0x89, 0xab, 0x9f, 0xde, 0xdd, 0x91,
+  0xcf, 0xa4, 0x78, 0xbb, 0x5a, 0x5c, 0x77, 0x9e, 0x42, 0x89, 0xef, 0xd3, 0x0d, 0xfd, 0x8c, 0xab,
+  0x00, 0x20, 0x83, 0x5c, 0xe6, 0xb2, 0x6e, 0xd2, 0x51, 0xc4, 0xd5, 0x94, 0xbc, 0x1a, 0x92, 0xfc,
+  0xe5, 0xf7, 0x9a, 0xc5, 0xba, 0x88, 0xa7, 0x99, 0x0e, 0x2c, 0x3e, 0xe6, 0xb8, 0xb5, 0x6a, 0x8d,
+  0x3b, 0x68, 0x37, 0xd7, 0x3f, 0x8f, 0x9e, 0xc5, 0x1a, 0xe7, 0x1d, 0x27, 0xb0, 0xc5, 0xd9, 0x06,
+  0x8a, 0xf0, 0xa1, 0x3b, 0x8b, 0xb6, 0x38, 0xdb, 0xf8, 0xeb, 0xdf, 0xec, 0xa4, 0x6e, 0x90, 0xbe,
+  0xee, 0x08, 0x63, 0x2d, 0xe9, 0xee, 0x70, 0xac, 0x84, 0x23, 0x31, 0x17, 0x56, 0x9b, 0x0e, 0x2c,
+  0xb2, 0xd7, 0xeb, 0xa9, 0xfa, 0x41, 0x1c, 0xcd, 0x67, 0x69, 0x04, 0x28, 0x34, 0x34, 0xd0, 0x4b,
+  0x15, 0x51, 0xf4, 0xc3, 0x18, 0x7a, 0x1b, 0x40, 0x53, 0x74, 0x07, 0x95, 0x09, 0x1b, 0xae, 0x2a,
+  0x0d, 0xcc, 0xd7, 0x93, 0x6a, 0x85, 0x81, 0x6f, 0x4e, 0x7c, 0x10, 0x41, 0x54, 0x0a, 0x25, 0xd6,
+  0x10, 0x4b, 0xc9, 0x47, 0x24, 0x8d, 0x27, 0xcc, 0x5d, 0x0a, 0xac, 0xcb, 0xb2, 0x60, 0x04, 0xef,
+  0x35, 0x2c, 0x1a, 0xe9, 0x16, 0xc1, 0x88, 0x88, 0x0d, 0xa3, 0xbe, 0x97, 0x26, 0x21, 0x74, 0xc3,
+  0x0e, 0xae, 0x1e, 0xa1, 0xb1, 0x57, 0x1e, 0xd2, 0xde, 0x81, 0x41, 0xa7, 0x4d, 0x83, 0x5a, 0xf6,
+  0x5f, 0xe2, 0x19, 0xd1, 0xad, 0xf1, 0x37, 0x83, 0x7a, 0xa8, 0xf1, 0x8c, 0x86, 0x96, 0xf0, 0xce,
+  0xdb, 0xea, 0x42, 0x6d, 0x27, 0xcd, 0x5d, 0x17, 0x6b, 0x48, 0xdc, 0x43, 0x51, 0x7b, 0xae, 0xc6,
+  0xe4, 0x3d, 0xea, 0xaf, 0x28, 0xd1, 0x6a, 0xb0, 0x93, 0x6b, 0xf0, 0x68, 0x5b, 0x0d, 0x56, 0x87,
+  0xf5, 0xfd, 0x75, 0xb8, 0x31, 0x19, 0xad, 0xc2, 0xd6, 0xb7, 0x7c, 0x54, 0x91, 0x85, 0x43, 0x86,
+  0x39, 0x00, 0xcc, 0xc6, 0xaa, 0xb4, 0xf1, 0xff, 0xc6, 0xfe, 0xe6, 0x1b, 0x88, 0xc1, 0x97, 0x86,
+  0x36, 0x0b, 0x94, 0x32, 0x0c, 0xac, 0x8c, 0x6d, 0x57, 0x7c, 0x47, 0x13, 0xdf, 0x06, 0xb0, 0x4b,
+  0x28, 0xc3, 0x20, 0x60, 0x4a, 0x91, 0x1b, 0xc1, 0x61, 0xff, 0xd3, 0x18, 0xde, 0xec, 0xdb, 0xcb,
+  0xf2, 0xba, 0xa3, 0x51, 0xd8, 0x36, 0x8f, 0xb0, 0x24, 0x4c, 0x08, 0xbd, 0xeb, 0x05, 0xc3, 0xf0,
+  0xc6, 0x5e, 0x83, 0xe3, 0xc9, 0xf3, 0xd7, 0xfc, 0x9c, 0x03, 0xf0, 0xb3, 0xcb, 0x42, 0x7d, 0x9e,
+  0xd9, 0x4c, 0x5e, 0x7b, 0xc9, 0x70, 0x03, 0x6e, 0x65, 0xcb, 0xdf, 0x08, 0xcc, 0x42, 0x60, 0x77,
+  0x33, 0x09, 0xf8, 0x1a, 0x4c, 0xd1, 0xd1, 0x2c, 0x93, 0x00, 0x76, 0x00, 0xa0, 0x0f, 0x4e, 0x23,
+  0x75, 0xb2, 0x3a, 0x1a, 0xad, 0xda, 0x09, 0x86, 0x1d, 0xb0, 0xe1, 0x8d, 0xb9, 0xbf, 0xde, 0x6c,
+  0x23, 0x02, 0x7f, 0x7e, 0x88, 0xbc, 0x21, 0xf9, 0x9f, 0x63, 0x97, 0x4c, 0x6a, 0xd1, 0x5e, 0x05,
+  0xf3, 0x6c, 0x7b, 0x59, 0x70, 0x8b, 0x07, 0x36, 0x33, 0xf2, 0x11, 0xb9, 0xa2, 0x1c, 0x29, 0x68,
+  0x1c, 0xd4, 0x5a, 0x83, 0x26, 0xdc, 0x87, 0x26, 0x26, 0x19, 0x10, 0xec, 0x64, 0x0b, 0x65, 0x25,
+  0xa0, 0x6e, 0x87, 0x37, 0x17, 0xf5, 0x06, 0xa8, 0xd0, 0xdc, 0x0f, 0xcc, 0x2d, 0x71, 0x56, 0x3f,
+  0xa1, 0x5c, 0xed, 0x86, 0xaa, 0x3f, 0x56, 0xce, 0x68, 0xa3, 0xfb, 0x62, 0x65, 0x81, 0x65, 0x25,
+  0x8b, 0x66, 0x24, 0x02, 0x73, 0x04, 0xd4, 0x34, 0x93, 0xdf, 0x6b, 0xd9, 0x10, 0x7a, 0xe3, 0xf6,
+  0x87, 0x7b, 0xf7, 0x04, 0xd0, 0x39, 0x97, 0xb3, 0x05, 0x85, 0xed, 0x8a, 0x8d, 0xa4, 0x9a, 0x4b,
+  0xba, 0x4c, 0xa3, 0x10, 0x4d, 0x74, 0x12, 0x0b, 0x05, 0x79, 0x57, 0xdd, 0x73, 0x27, 0x08, 0xc3,
+  0x89, 0x23, 0x41, 0xc3, 0xc1, 0x99, 0xfb, 0x02, 0xf8, 0x28, 0xef, 0x87, 0xaa, 0xa9, 0xe1, 0xec,
+  0x76, 0xa9, 0xcd, 0x40, 0xcd, 0x77, 0xe2, 0xec, 0x76, 0xd0, 0x65, 0xae, 0x55, 0x15, 0x49, 0x0b,
+  0x70, 0xcf, 0x8c, 0xdb, 0x6f, 0xeb, 0xa8, 0x0e, 0x15, 0x13, 0xdb, 0xeb, 0xfe, 0xcc, 0xb2, 0xb3,
+  0xd1, 0x70, 0x13, 0x67, 0xbd, 0xf7, 0x22, 0x1e, 0x8b, 0xfc, 0xca, 0x74, 0xa3, 0x8d, 0x9c, 0xa7,
+  0x23, 0x71, 0x8d, 0x7d, 0xaa, 0xdc, 0x83, 0x88, 0x51, 0x59, 0xd0, 0xf9, 0xbd, 0xac, 0x4f, 0x91,
+  0xb8, 0x6c, 0xa1, 0xed, 0x04, 0x38, 0xd5, 0x6f, 0xc1, 0x3c, 0x37, 0xd2, 0x83, 0x8c, 0xc1, 0x52,
+  0x0c, 0x2f, 0x13, 0x61, 0xe9, 0xdd, 0xc1, 0x4e, 0x4c, 0x63, 0xfa, 0x3a, 0x63, 0x63, 0x9a, 0x46,
+  0xfa, 0xbe, 0x45, 0xa0, 0x54, 0x48, 0x65, 0xee, 0xa2, 0x54, 0x26, 0x23, 0xe2, 0xc0, 0x3b, 0x12,
+  0x13, 0x87, 0x2d, 0xf3, 0xce, 0x2a, 0x9d, 0xcd, 0xa8, 0x5c, 0x0e, 0x2e, 0xe1, 0x3d, 0x9e, 0xd3,
+  0x40, 0x9a, 0x72, 0x2d, 0x19, 0x05, 0x6c, 0x6a, 0xcd, 0x6a, 0x81, 0x1c, 0x2e, 0xc5, 0x2a, 0xd7,
+  0x67, 0x1c, 0x4d, 0x09, 0x81, 0x64, 0xf9, 0x08, 0xac, 0xdc, 0xec, 0x31, 0x4f, 0x7a, 0xcf, 0x7a,
+  0x63, 0x58, 0x2c, 0x98, 0xcc, 0xba, 0x43, 0xdc, 0xfa, 0xb6, 0x65, 0x15, 0xa2, 0x45, 0x4c, 0x31,
+  0x76, 0x6d, 0x5f, 0x31, 0xa9, 0x4c, 0x52, 0x2c, 0xd4, 0x4e, 0xd8, 0x7e, 0x58, 0xde, 0x6b, 0xe6,
+  0xfb, 0xac, 0xf7, 0x81, 0xef, 0x93, 0xd7, 0xa0, 0xc1, 0x39, 0x57, 0x29, 0x8d, 0x08, 0x8b, 0xd8,
+  0xcc, 0x9c, 0xc7, 0xfb, 0xbe, 0x2b, 0xfa, 0x35, 0xe0, 0x02, 0xd4, 0x7b, 0x27, 0xcc, 0xdd, 0x6e,
+  0x5e, 0xc2, 0x8b, 0x4f, 0x19, 0x42, 0xcf, 0x09, 0x75, 0x7e, 0xcf, 0xef, 0x15, 0x2a, 0xb1, 0xa8,
+  0xd5, 0x5a, 0xa5, 0x3e, 0x8b, 0x46, 0xbe, 0x4b, 0xdf, 0x59, 0x01, 0x70, 0x71, 0x4b, 0x10, 0x44,
+  0x42, 0x55, 0x4f, 0x7f, 0x4c, 0x5b, 0xa9, 0x94, 0x60, 0xf0, 0x11, 0x4a, 0x54, 0x2f, 0xdd, 0xfc,
+  0x2c, 0x9b, 0x69, 0xc7, 0x14, 0x16, 0x5c, 0x99, 0xb2, 0x88, 0xac, 0xbe, 0x20, 0x2b, 0x14, 0x7b,
+  0x2f, 0x67, 0x21, 0x66, 0x9a, 0x67, 0x0c, 0x8b, 0x5f, 0x07, 0xe6, 0x03, 0x0f, 0x0f, 0x20, 0x23,
+  0x34, 0x00, 0x6f, 0xa9, 0xfd, 0x7c, 0xfb, 0xf2, 0xf8, 0xa3, 0xb9, 0x82, 0x00, 0x8b, 0xe1, 0x8a,
+  0xc0, 0xcd, 0x1d, 0xbf, 0xe5, 0x67, 0x98, 0x8f, 0xd8, 0xe7, 0x19, 0xf6, 0xa9, 0xa4, 0x76, 0xd1,
+  0xfc, 0x22, 0x8d, 0x49, 0xf6, 0xf4, 0xbe, 0xe7, 0x90, 0x09, 0xc9, 0x4f, 0x16, 0xab, 0xd3, 0xe8,
+  0xd4, 0xcd, 0x63, 0x43, 0x5d, 0xa3, 0x61, 0xe9, 0x8b, 0xc4, 0xc1, 0xc4, 0xd2, 0xf1, 0x14, 0xa4,
+  0x28, 0x63, 0xea, 0xa1, 0x43, 0x02, 0xc3, 0xb1, 0xb9, 0x74, 0xc3, 0x26, 0xc2, 0xe2, 0x10, 0xc1,
+  0x4a, 0x09, 0x4c, 0x03, 0x94, 0x88, 0x20, 0xc2, 0xec, 0xe9, 0x53, 0xb5, 0xf3, 0x2a, 0x0f, 0x59,
+  0x61, 0xd9, 0x60, 0x27, 0xe2, 0x0d, 0x96, 0x0a, 0x42, 0xda, 0x35, 0x5b, 0x5e, 0x4c, 0x2e, 0xb6,
+  0xf4, 0xcf, 0x92, 0x6d, 0xec, 0x07, 0x0b, 0xc6, 0xf2, 0x8d, 0xad, 0xd3, 0x81, 0xbe, 0xf0, 0x40,
+  0x6c, 0x25, 0x1f, 0x69, 0xe0, 0x0d, 0xd7, 0xf5, 0x78, 0xbc, 0x5f, 0x65, 0x81, 0xf1, 0x8f, 0xe3,
+  0xdb, 0x42, 0x1f, 0x19, 0x6c, 0xce, 0x2a, 0x5d, 0x4d, 0x89, 0x16, 0x8d, 0xf8, 0x24, 0x3e, 0x21,
+  0x01, 0x43, 0x80, 0xfe, 0x12, 0x74, 0xb5, 0xfd, 0x19, 0x2b, 0xba, 0x32, 0x6a, 0x23, 0x04, 0xbf,
+  0xc0, 0x18, 0xb3, 0xbe, 0x6d, 0x5a, 0x08, 0x34, 0xe5, 0x59, 0xb4, 0x5a, 0x8a, 0x53, 0xca, 0x29,
+  0xae, 0xcc, 0xdb, 0x55, 0x70, 0x13, 0x13, 0xb0, 0xe5, 0xa4, 0xc2, 0xd7, 0x4a, 0xbc, 0x9f, 0x2c,
+  0x67, 0xd4, 0x54, 0x93, 0x6f, 0xce, 0x1d, 0x58, 0x12, 0x50, 0x1e, 0x7d, 0x7d, 0xf6, 0xb0, 0xc3,
+  0x41, 0x98, 0xb8, 0xa9, 0xb0, 0x32, 0xc7, 0x30, 0x76, 0xaa, 0x6f, 0x5c, 0x91, 0xf9, 0x9b, 0x90,
+  0xaa, 0xa9, 0x39, 0x28, 0x34, 0x20, 0xd4, 0x1b, 0xfc, 0x44, 0xa0, 0x23, 0x55, 0x34, 0x76, 0x96,
+  0x11, 0x91, 0x8f, 0x24, 0x95, 0xf2, 0x65, 0x19, 0xc8, 0x54, 0xfc, 0x61, 0x4d, 0x9f, 0x97, 0xbc,
+  0x90, 0x9e, 0xeb, 0x2d, 0x54, 0x40, 0x0e, 0x75, 0xe6, 0x51, 0x65, 0x10, 0xf2, 0x64, 0xb6, 0x59,
+  0x07, 0x3b, 0x1b, 0x93, 0xfa, 0x6a, 0xc0, 0x32, 0x2f, 0x8c, 0xe8, 0x54, 0xb4, 0xb0, 0x1a, 0xf6,
+  0x69, 0x69, 0x30, 0x40, 0x52, 0x98, 0x34, 0xc7, 0x49, 0x9b, 0xca, 0x85, 0x11, 0x23, 0x08, 0x17,
+  0x4d, 0xe5, 0x09, 0x2c, 0xd7, 0xa8, 0x82, 0xba, 0x32, 0xb3, 0xb2, 0xe6, 0x02, 0xc9, 0x93, 0x6c,
+  0x8d, 0x54, 0xe6, 0x81, 0x28, 0x19, 0xd8, 0xfa, 0x56, 0x75, 0xd2, 0x6a, 0x05, 0x61, 0xdc, 0xfc,
+  0x46, 0x85, 0x0c, 0x16, 0x7a, 0xd9, 0x8c, 0x99, 0x6e, 0xc5, 0xc9, 0xac, 0x65, 0xaa, 0x80, 0xa0,
+  0xd9, 0x1c, 0x73, 0x99, 0x4e, 0x95, 0xde, 0xf9, 0x2f, 0x83, 0xbe, 0xc1, 0x1f, 0x06, 0x7d, 0xf2,
+  0xbc, 0x13, 0xb4, 0xc7, 0xed, 0x51, 0xb7, 0xfd, 0x71, 0x40, 0x9f, 0x1f, 0x43, 0xc2, 0x0c, 0x71,
+  0xa3, 0x52, 0xec, 0xdc, 0x72, 0xbf, 0xcd, 0x69, 0x99, 0x9f, 0x40, 0xfd, 0x0f, 0xa7, 0xa7, 0xd7,
+  0x8a, 0x19, 0x35, 0x00, 0x00
+};
+const size_t EMBEDDED_WEBUI_LEN = sizeof(EMBEDDED_WEBUI);
+#define EMBEDDED_WEBUI_ETAG "\"d720f7e164ebd9d7\""
 
 #if WEBUI_EMIT_STREAM_HELPER
-// NOTE: Assumes you have a global 'ESP8266WebServer server(80);'
-// If your instance is named differently, set WEBUI_EMIT_STREAM_HELPER=0
-// and paste a custom handler in your route file. 
-#include <ESP8266WebServer.h>                                                   
+#include <ESP8266WebServer.h>
 static void handleEmbeddedWebUI() {
-  extern ESP8266WebServer server;                                              
-  server.sendHeader("Connection", "close");                                   
-  server.send_P(200, "text/html",                                               
-                EMBEDDED_WEBUI, EMBEDDED_WEBUI_LEN);
+  extern ESP8266WebServer server;
+  server.sendHeader("Vary", "Accept-Encoding");
+  if (server.header("Accept-Encoding").indexOf("gzip") < 0) {
+    server.send(406, "text/plain", "Only available gzip-compressed; send Accept-Encoding: gzip.");
+    return;
+  }
+  server.sendHeader("ETag", EMBEDDED_WEBUI_ETAG);
+  server.sendHeader("Cache-Control", server.hasArg("v") ? "public, max-age=31536000, immutable" : "no-cache");
+  if (server.header("If-None-Match") == EMBEDDED_WEBUI_ETAG) {
+    server.send(304);
+    return;
+  }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, "text/html", reinterpret_cast<const char*>(EMBEDDED_WEBUI), EMBEDDED_WEBUI_LEN);
 }
 #endif
-
-#define F(string_literal) (FPSTR(PSTR(string_literal)))